@@ -57,6 +57,7 @@ LinearSolver::LinearSolver() :
         M_displayer            ( new Displayer() ),
         M_maxItersForReuse     ( 0 ),
         M_reusePreconditioner  ( false ),
+        M_recomputePreconditionerValues( false ),
         M_quitOnFailure        ( false ),
         M_silent               ( false ),
         M_lossOfPrecision      ( SolverOperator_Type::undefined ),
@@ -79,6 +80,7 @@ LinearSolver::LinearSolver( const boost::shared_ptr<Epetra_Comm> commPtr ) :
         M_displayer            ( new Displayer( commPtr ) ),
         M_maxItersForReuse     ( 0 ),
         M_reusePreconditioner  ( false ),
+        M_recomputePreconditionerValues( false ),
         M_quitOnFailure        ( false ),
         M_silent               ( false ),
         M_lossOfPrecision      ( SolverOperator_Type::undefined ),
@@ -150,6 +152,8 @@ LinearSolver::solve( vectorPtr_Type solutionPtr )
         M_displayer->leaderPrint( "SLV-  Iterative solver failed, numiter = " , numIters, "\n" );
         M_displayer->leaderPrint( "SLV-  retrying:\n" );
 
+        // The preconditioner is built from scratch
+        resetPreconditioner();
         buildPreconditioner();
 
         // Solving again, but only once (retry = false)
@@ -265,15 +269,20 @@ LinearSolver::buildPreconditioner()
         {
             chrono.start();
             if( !M_silent ) M_displayer->leaderPrint( "SLV-  Computing the preconditioner...\n" );
-            if ( M_baseMatrixForPreconditioner.get() == 0 )
+            matrixPtr_Type& matrix( M_baseMatrixForPreconditioner.get() == 0 ? M_matrix : M_baseMatrixForPreconditioner );
+            if( !M_silent && M_baseMatrixForPreconditioner.get() == 0 )
+                M_displayer->leaderPrint( "SLV-  Build the preconditioner using the problem matrix\n" );
+            else if( !M_silent )
+                M_displayer->leaderPrint( "SLV-  Build the preconditioner using the base matrix provided\n" );
+
+            if ( M_recomputePreconditionerValues && M_preconditioner->preconditionerCreated() )
             {
-                if( !M_silent ) M_displayer->leaderPrint( "SLV-  Build the preconditioner using the problem matrix\n" );
-                M_preconditioner->buildPreconditioner( M_matrix );
+                if( !M_silent ) M_displayer->leaderPrint( "SLV-  Recomputing only the values of the preconditioner\n" );
+                M_preconditioner->recomputePreconditioner( matrix );
             }
             else
             {
-                if( !M_silent ) M_displayer->leaderPrint( "SLV-  Build the preconditioner using the base matrix provided\n" );
-                M_preconditioner->buildPreconditioner( M_baseMatrixForPreconditioner );
+                M_preconditioner->buildPreconditioner( matrix );
             }
             condest = M_preconditioner->condest();
             chrono.stop();
@@ -389,6 +398,7 @@ LinearSolver::setParameters( const Teuchos::ParameterList& list )
     }
 
     M_reusePreconditioner  = M_parameterList.get( "Reuse Preconditioner"     , false );
+    M_recomputePreconditionerValues = M_parameterList.get( "Recompute Preconditioner Values", false );
     Int maxIter            = M_parameterList.get( "Maximum Iterations"       , 200 );
     M_maxItersForReuse     = M_parameterList.get( "Max Iterations For Reuse" , static_cast<Int> ( maxIter*8./10. ) );
     M_quitOnFailure        = M_parameterList.get( "Quit On Failure"          , false );
@@ -407,6 +417,12 @@ LinearSolver::setReusePreconditioner( const bool reusePreconditioner )
     M_reusePreconditioner = reusePreconditioner;
 }
 
+void
+LinearSolver::setRecomputePreconditionerValues( const bool recomputePreconditionerValues )
+{
+    M_recomputePreconditionerValues = recomputePreconditionerValues;
+}
+
 void
 LinearSolver::setQuitOnFailure( const bool enable )
 {
@@ -486,6 +502,12 @@ LinearSolver::reusePreconditioner() const
     return M_reusePreconditioner;
 }
 
+bool
+LinearSolver::recomputePreconditionerValues() const
+{
+    return M_recomputePreconditionerValues;
+}
+
 bool
 LinearSolver::quitOnFailure() const
 {
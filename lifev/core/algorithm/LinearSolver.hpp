@@ -269,6 +269,15 @@ public:
      */
     void setReusePreconditioner( const bool reusePreconditioner );
 
+    //! Specify if the preconditioner should be recomputed keeping the setup that depends only on the matrix pattern
+    /*!
+      When the preconditioner is not reused, it is recomputed with Preconditioner::recomputePreconditioner
+      instead of being built from scratch. It is still built from scratch after a reset, i.e. when
+      the number of iterations exceeds the threshold for the reuse or when the solver fails.
+      @param recomputePreconditionerValues If set to true, recompute only the values of the preconditioner
+     */
+    void setRecomputePreconditionerValues( const bool recomputePreconditionerValues );
+
     //! Specify if the application should stop when problems occur in the iterations
     /*!
       @param enable If set to true, application will stop if problems occur
@@ -316,6 +325,9 @@ public:
     //! Returns if the preconditioner can be reused
     bool reusePreconditioner() const;
 
+    //! Returns if only the values of the preconditioner are recomputed
+    bool recomputePreconditionerValues() const;
+
     //! Returns if the application should stop if a problem occurs
     bool quitOnFailure() const;
 
@@ -360,6 +372,7 @@ private:
     // LifeV features
     Int                          M_maxItersForReuse;
     bool                         M_reusePreconditioner;
+    bool                         M_recomputePreconditionerValues;
     bool                         M_quitOnFailure;
     bool                         M_silent;
 
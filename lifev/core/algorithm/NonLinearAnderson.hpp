@@ -0,0 +1,443 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+ *  @file
+ *  @brief File containing the interface quasi-Newton (IQN-ILS / Anderson) acceleration
+ *
+ *  @date 19-10-2026
+ *
+ *  @see J. Degroote, K.-J. Bathe and J. Vierendeels, Performance of a new partitioned procedure
+ *       versus a monolithic procedure in fluid-structure interaction, Comput. Struct. 87 (2009).
+ *  @see R. Haelterman, A. Bogaers, K. Scheufele, B. Uekermann and M. Mehl, Improving the performance
+ *       of the partitioned QN-ILS procedure for fluid-structure interaction problems: filtering,
+ *       Comput. Struct. 171 (2016).
+ */
+
+#ifndef NonLinearAnderson_H
+#define NonLinearAnderson_H
+
+#include <deque>
+#include <vector>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/util/LifeDebug.hpp>
+
+namespace LifeV
+{
+
+//! NonLinearAnderson - LifeV class for the interface quasi-Newton (IQN-ILS) acceleration
+/*
+ *  Multi-secant acceleration of a fixed point iteration x = G(x), written in terms of the
+ *  residual f(x) = x - G(x) (same convention used by NonLinearAitken).
+ *
+ *  The class stores the differences between successive iterates \f$\Delta X\f$ and residuals
+ *  \f$\Delta F\f$ and computes the step
+ *
+ *  \f[ \delta x = \beta f_k - ( \Delta X + \beta \Delta F ) \gamma, \qquad
+ *      \gamma = \arg\min \| \Delta F \gamma - f_k \| \f]
+ *
+ *  which is the Anderson mixing with mixing parameter \f$\beta\f$. When the residual is given as
+ *  \f$f = G(x) - x\f$, \f$\beta = 1\f$ (default) gives the IQN-ILS method of Degroote et al.,
+ *  i.e. \f$ x_{k+1} = G(x_k) - \Delta G \gamma \f$; with the opposite sign convention
+ *  \f$f = x - G(x)\f$ use \f$\beta = -1\f$.
+ *
+ *  When no differences are available (first iteration, without reuse of the previous time steps)
+ *  the step is the relaxed fixed point \f$\omega_0 f_k\f$, where the initial relaxation
+ *  \f$\omega_0\f$ is set independently of \f$\beta\f$ (see setDefaultOmega()).
+ *
+ *  The least squares problem is solved with an economical (thin) QR factorization of \f$\Delta F\f$
+ *  which is updated, not recomputed: adding a column costs one modified Gram-Schmidt sweep against
+ *  the current basis, while dropping the oldest column is done with Givens rotations on the small
+ *  triangular factor, applied to the basis vectors without any global communication.
+ *  Columns which are (almost) linearly dependent on the previous ones are filtered out.
+ *
+ *  The differences of the last \f$q\f$ time steps can be kept (IQN-ILS(q), "reuse"); call restart()
+ *  at the beginning of each time step.
+ */
+template< typename VectorType >
+class NonLinearAnderson
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef VectorType                            vector_Type;
+    typedef boost::shared_ptr< vector_Type >      vectorPtr_Type;
+
+    //@}
+
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    explicit NonLinearAnderson();
+
+    //! Destructor
+    virtual ~NonLinearAnderson() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Start a new time step
+    /*!
+     * The differences collected in the time steps older than the reuse window are removed.
+     */
+    void restart();
+
+    //! Remove all the stored differences
+    void reset();
+
+    //! Compute the quasi-Newton step
+    /*!
+     * @param solution - vector of unknown
+     * @param residual - vector of residuals
+     * @return the increment to be added to the solution
+     */
+    vector_Type computeDeltaLambda( const vector_Type& solution,
+                                    const vector_Type& residual );
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the relaxation used when no differences are available
+    /*!
+     * @param defaultOmega relaxation parameter of the first (history-free) step
+     */
+    void setDefaultOmega( const Real& defaultOmega ) { M_defaultOmega = defaultOmega; }
+
+    //! Set the mixing parameter used when differences are available
+    /*!
+     * @param mixingParameter mixing parameter \beta (1 for IQN-ILS with f = G(x) - x)
+     */
+    void setMixingParameter( const Real& mixingParameter ) { M_mixingParameter = mixingParameter; }
+
+    //! Set the maximum number of columns kept in the least squares problem
+    /*!
+     * @param maxColumns maximum number of columns
+     */
+    void setMaxColumns( const UInt& maxColumns ) { M_maxColumns = maxColumns; }
+
+    //! Set the number of previous time steps whose differences are reused
+    /*!
+     * @param reuseTimeSteps 0: IQN-ILS; q > 0: IQN-ILS(q)
+     */
+    void setReuseTimeSteps( const UInt& reuseTimeSteps ) { M_reuseTimeSteps = reuseTimeSteps; }
+
+    //! Set the filter tolerance
+    /*!
+     * A new column is discarded if the norm of its component orthogonal to the
+     * current basis is smaller than filterTolerance times its norm.
+     *
+     * @param filterTolerance filter tolerance
+     */
+    void setFilterTolerance( const Real& filterTolerance ) { M_filterTolerance = filterTolerance; }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Get the default relaxation parameter
+    /*!
+     * @return default relaxation parameter
+     */
+    const Real& defaultOmega() const { return M_defaultOmega; }
+
+    //! Get the mixing parameter
+    /*!
+     * @return mixing parameter
+     */
+    const Real& mixingParameter() const { return M_mixingParameter; }
+
+    //! Get the number of columns currently used
+    /*!
+     * @return number of columns
+     */
+    UInt columns() const { return static_cast<UInt> ( M_Q.size() ); }
+
+    //@}
+
+private:
+
+    //! @name Private unimplemented Methods
+    //@{
+
+    NonLinearAnderson( const NonLinearAnderson& anderson );
+
+    NonLinearAnderson& operator=( const NonLinearAnderson& anderson );
+
+    //@}
+
+
+    //! @name Private Methods
+    //@{
+
+    //! Add a column to \Delta X, \Delta F and update the QR factorization
+    void addColumn( const vector_Type& deltaX, const vector_Type& deltaF );
+
+    //! Remove the oldest column and update the QR factorization
+    void removeOldestColumn();
+
+    //@}
+
+    // last iterate and residual
+    vectorPtr_Type                   M_oldSolution;
+    vectorPtr_Type                   M_oldResidual;
+
+    // \Delta X, \Delta F and the time step they belong to (oldest first)
+    std::deque< vectorPtr_Type >     M_deltaX;
+    std::deque< vectorPtr_Type >     M_deltaF;
+    std::deque< UInt >               M_timeStep;
+
+    // thin QR factorization of \Delta F
+    std::deque< vectorPtr_Type >     M_Q;
+    std::vector< std::vector<Real> > M_R;
+
+    Real                             M_defaultOmega;
+    Real                             M_mixingParameter;
+    UInt                             M_maxColumns;
+    UInt                             M_reuseTimeSteps;
+    Real                             M_filterTolerance;
+
+    UInt                             M_currentTimeStep;
+};
+
+
+
+// ===================================================
+// Constructors
+// ===================================================
+template < class VectorType >
+NonLinearAnderson< VectorType >::NonLinearAnderson() :
+        M_oldSolution     ( ),
+        M_oldResidual     ( ),
+        M_deltaX          ( ),
+        M_deltaF          ( ),
+        M_timeStep        ( ),
+        M_Q               ( ),
+        M_R               ( ),
+        M_defaultOmega    ( 0.1 ),
+        M_mixingParameter ( 1. ),
+        M_maxColumns      ( 20 ),
+        M_reuseTimeSteps  ( 0 ),
+        M_filterTolerance ( 1.e-8 ),
+        M_currentTimeStep ( 0 )
+{
+}
+
+// ===================================================
+// Methods
+// ===================================================
+template < class VectorType >
+void
+NonLinearAnderson< VectorType >::restart()
+{
+    M_oldSolution.reset();
+    M_oldResidual.reset();
+
+    ++M_currentTimeStep;
+
+    while ( !M_timeStep.empty() && M_timeStep.front() + M_reuseTimeSteps < M_currentTimeStep )
+        removeOldestColumn();
+}
+
+template < class VectorType >
+void
+NonLinearAnderson< VectorType >::reset()
+{
+    M_oldSolution.reset();
+    M_oldResidual.reset();
+
+    M_deltaX.clear();
+    M_deltaF.clear();
+    M_timeStep.clear();
+    M_Q.clear();
+    M_R.clear();
+}
+
+template < class VectorType >
+typename NonLinearAnderson< VectorType >::vector_Type
+NonLinearAnderson< VectorType >::computeDeltaLambda( const vector_Type& solution,
+                                                     const vector_Type& residual )
+{
+    if ( M_oldSolution.get() )
+    {
+        addColumn( solution - *M_oldSolution, residual - *M_oldResidual );
+
+        *M_oldSolution = solution;
+        *M_oldResidual = residual;
+    }
+    else
+    {
+        M_oldSolution.reset( new vector_Type( solution ) );
+        M_oldResidual.reset( new vector_Type( residual ) );
+    }
+
+    vector_Type step( residual );
+
+    const UInt m( columns() );
+    if ( m == 0 )
+    {
+#ifdef HAVE_LIFEV_DEBUG
+        debugStream(7020) << "NonLinearAnderson: omega = " << M_defaultOmega << "\n";
+#endif
+        step *= M_defaultOmega;
+        return step;
+    }
+
+    step *= M_mixingParameter;
+
+    // gamma = R^{-1} Q^T residual
+    std::vector<Real> gamma( m );
+    for ( UInt i(0); i < m; ++i )
+        gamma[i] = M_Q[i]->dot( residual );
+
+    for ( Int i( m - 1 ); i >= 0; --i )
+    {
+        for ( UInt j( i + 1 ); j < m; ++j )
+            gamma[i] -= M_R[i][j] * gamma[j];
+        gamma[i] /= M_R[i][i];
+    }
+
+    // step = beta * f - ( \Delta X + beta \Delta F ) gamma
+    for ( UInt j(0); j < m; ++j )
+    {
+        step -= gamma[j] * *M_deltaX[j];
+        step -= ( M_mixingParameter * gamma[j] ) * *M_deltaF[j];
+    }
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream(7020) << "NonLinearAnderson: columns = " << m << "\n";
+#endif
+
+    return step;
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+template < class VectorType >
+void
+NonLinearAnderson< VectorType >::addColumn( const vector_Type& deltaX, const vector_Type& deltaF )
+{
+    if ( M_maxColumns == 0 )
+        return;
+
+    // Modified Gram-Schmidt against the current basis
+    vectorPtr_Type q( new vector_Type( deltaF ) );
+    const Real norm( deltaF.norm2() );
+    const UInt m( columns() );
+
+    std::vector<Real> r( m + 1, 0. );
+    for ( UInt i(0); i < m; ++i )
+    {
+        r[i] = M_Q[i]->dot( *q );
+        *q -= r[i] * *M_Q[i];
+    }
+    r[m] = q->norm2();
+
+    // Filtering: discard columns (almost) linearly dependent on the previous ones
+    if ( r[m] <= M_filterTolerance * norm )
+    {
+#ifdef HAVE_LIFEV_DEBUG
+        debugStream(7020) << "NonLinearAnderson: column filtered out\n";
+#endif
+        return;
+    }
+
+    *q /= r[m];
+
+    M_deltaX.push_back( vectorPtr_Type( new vector_Type( deltaX ) ) );
+    M_deltaF.push_back( vectorPtr_Type( new vector_Type( deltaF ) ) );
+    M_timeStep.push_back( M_currentTimeStep );
+    M_Q.push_back( q );
+
+    for ( UInt i(0); i < m; ++i )
+        M_R[i].push_back( r[i] );
+    M_R.push_back( std::vector<Real>( m + 1, 0. ) );
+    M_R[m][m] = r[m];
+
+    if ( columns() > M_maxColumns )
+        removeOldestColumn();
+}
+
+template < class VectorType >
+void
+NonLinearAnderson< VectorType >::removeOldestColumn()
+{
+    const UInt m( columns() );
+
+    M_deltaX.pop_front();
+    M_deltaF.pop_front();
+    M_timeStep.pop_front();
+
+    // Removing the first column of R leaves an upper Hessenberg matrix,
+    // which is brought back to triangular form by Givens rotations.
+    for ( UInt i(0); i < m; ++i )
+        M_R[i].erase( M_R[i].begin() );
+
+    for ( UInt i(0); i + 1 < m; ++i )
+    {
+        const Real a( M_R[i][i] );
+        const Real b( M_R[i+1][i] );
+        const Real rho( std::sqrt( a * a + b * b ) );
+        const Real c( a / rho );
+        const Real s( b / rho );
+
+        for ( UInt j(i); j + 1 < m; ++j )
+        {
+            const Real upper( M_R[i][j] );
+            const Real lower( M_R[i+1][j] );
+            M_R[i][j]   =  c * upper + s * lower;
+            M_R[i+1][j] = -s * upper + c * lower;
+        }
+
+        // Q <- Q G^T: local operation, no communication needed
+        vector_Type qi( *M_Q[i] );
+        *M_Q[i]   *= c;
+        *M_Q[i]   += s * *M_Q[i+1];
+        *M_Q[i+1] *= c;
+        *M_Q[i+1] -= s * qi;
+    }
+
+    M_R.pop_back();
+    M_Q.pop_back();
+}
+
+} // end namespace LifeV
+
+#endif // NonLinearAnderson_H
@@ -0,0 +1,240 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+ *  @file
+ *  @brief File containing the policy for the reuse of the Jacobian in the Newton iterations
+ *
+ *  @date 19-10-2012
+ */
+
+#ifndef NonLinearJacobianLagging_H
+#define NonLinearJacobianLagging_H
+
+#include <ostream>
+
+#include <lifev/core/LifeV.hpp>
+
+namespace LifeV
+{
+
+//! NonLinearJacobianLagging - Policy for the reuse of the Jacobian in the Newton iterations (modified Newton)
+/*
+ *  The class decides, before each linear solve of NonLinearRichardson, whether the Jacobian
+ *  (and its preconditioner) has to be evaluated again or if the one of a previous iteration can be kept.
+ *  A new Jacobian is required when:
+ *  <ul>
+ *  <li> no Jacobian is available (first iteration, or first iteration of a new time step
+ *       if the Jacobian is not reused across the time steps); </li>
+ *  <li> the Jacobian has already been used for maxAge linear solves; </li>
+ *  <li> the contraction of the residual in the last iteration, \f$ \|r_k\| / \|r_{k-1}\| \f$,
+ *       is larger than maxContraction (the convergence stalls). </li>
+ *  </ul>
+ *  With maxAge = 1 (default) a new Jacobian is evaluated at each iteration (Newton method).
+ *
+ *  The number of evaluated and reused Jacobians is recorded for the report of the solver;
+ *  NonLinearRichardson resets it at the beginning of each non-linear solve.
+ */
+class NonLinearJacobianLagging
+{
+
+public:
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+     * @param maxAge maximum number of linear solves with the same Jacobian
+     * @param maxContraction maximum contraction of the residual for keeping the Jacobian
+     * @param reuseTimeSteps keep the Jacobian from a time step to the next one
+     */
+    explicit NonLinearJacobianLagging( const UInt& maxAge = 1,
+                                       const Real& maxContraction = 0.5,
+                                       const bool& reuseTimeSteps = false );
+
+    //! Destructor
+    virtual ~NonLinearJacobianLagging() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Start a new non-linear solve (e.g. a new time step)
+    void restart();
+
+    //! Force the evaluation of the Jacobian at the next iteration
+    void invalidate() { M_isValid = false; }
+
+    //! Decide if the Jacobian has to be evaluated
+    /*!
+     * @param contraction contraction of the residual in the last iteration (zero if not available)
+     * @return true if a new Jacobian has to be evaluated, false if the last one is kept
+     */
+    bool updateJacobian( const Real& contraction );
+
+    //! Reset the counters of the evaluated and reused Jacobians
+    void resetCounters();
+
+    //! Display the counters
+    /*!
+     * @param output specify the output stream
+     */
+    void showMe( std::ostream& output = std::cout ) const;
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the maximum number of linear solves with the same Jacobian
+    /*!
+     * @param maxAge maximum age of the Jacobian (1: Newton method)
+     */
+    void setMaxAge( const UInt& maxAge ) { M_maxAge = maxAge; }
+
+    //! Set the maximum contraction of the residual for keeping the Jacobian
+    /*!
+     * @param maxContraction maximum value of \f$ \|r_k\| / \|r_{k-1}\| \f$
+     */
+    void setMaxContraction( const Real& maxContraction ) { M_maxContraction = maxContraction; }
+
+    //! Keep the Jacobian from a time step to the next one
+    /*!
+     * @param reuseTimeSteps true if the Jacobian is kept across the time steps
+     */
+    void setReuseTimeSteps( const bool& reuseTimeSteps ) { M_reuseTimeSteps = reuseTimeSteps; }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Get the maximum number of linear solves with the same Jacobian
+    /*!
+     * @return maximum age of the Jacobian
+     */
+    const UInt& maxAge() const { return M_maxAge; }
+
+    //! Check if the policy can reuse a Jacobian
+    /*!
+     * @return false if a new Jacobian is evaluated at each iteration
+     */
+    bool isActive() const { return M_maxAge > 1; }
+
+    //! Get the number of evaluated Jacobians
+    /*!
+     * @return number of evaluated Jacobians
+     */
+    const UInt& evaluations() const { return M_evaluations; }
+
+    //! Get the number of reused Jacobians (saved evaluations)
+    /*!
+     * @return number of reused Jacobians
+     */
+    const UInt& reuses() const { return M_reuses; }
+
+    //@}
+
+private:
+
+    UInt M_maxAge;
+    Real M_maxContraction;
+    bool M_reuseTimeSteps;
+
+    // state of the current Jacobian
+    bool M_isValid;
+    UInt M_age;
+
+    // counters
+    UInt M_evaluations;
+    UInt M_reuses;
+};
+
+// ===================================================
+// Constructors
+// ===================================================
+inline
+NonLinearJacobianLagging::NonLinearJacobianLagging( const UInt& maxAge,
+                                                    const Real& maxContraction,
+                                                    const bool& reuseTimeSteps ) :
+    M_maxAge         ( maxAge ),
+    M_maxContraction ( maxContraction ),
+    M_reuseTimeSteps ( reuseTimeSteps ),
+    M_isValid        ( false ),
+    M_age            ( 0 ),
+    M_evaluations    ( 0 ),
+    M_reuses         ( 0 )
+{
+}
+
+// ===================================================
+// Methods
+// ===================================================
+inline void
+NonLinearJacobianLagging::restart()
+{
+    if ( !M_reuseTimeSteps )
+        M_isValid = false;
+}
+
+inline bool
+NonLinearJacobianLagging::updateJacobian( const Real& contraction )
+{
+    if ( !M_isValid || M_age >= M_maxAge || contraction > M_maxContraction )
+    {
+        M_isValid = true;
+        M_age = 1;
+        ++M_evaluations;
+        return true;
+    }
+
+    ++M_age;
+    ++M_reuses;
+    return false;
+}
+
+inline void
+NonLinearJacobianLagging::resetCounters()
+{
+    M_evaluations = 0;
+    M_reuses = 0;
+}
+
+inline void
+NonLinearJacobianLagging::showMe( std::ostream& output ) const
+{
+    output << "Jacobian evaluations             = " << M_evaluations << std::endl;
+    output << "Jacobian reuses                  = " << M_reuses << std::endl;
+}
+
+} // end namespace LifeV
+
+#endif // NonLinearJacobianLagging_H
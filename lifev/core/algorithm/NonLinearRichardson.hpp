@@ -49,6 +49,7 @@
 
 #include <algorithm> // for min and max
 #include <lifev/core/algorithm/NonLinearLineSearch.hpp>
+#include <lifev/core/algorithm/NonLinearJacobianLagging.hpp>
 #include <lifev/core/array/VectorEpetra.hpp>
 
 namespace LifeV
@@ -76,6 +77,16 @@ namespace LifeV
        if omega is negative, then its absolute value is
        taken as constant relaxation parameter
 
+       @param jacobianLagging :  policy for the reuse of the Jacobian (modified Newton), optional.
+       Before each call to solveJac the functional is told, through
+       setReuseJacobian, if it can keep the Jacobian and the preconditioner
+       of the previous iteration. If a line search fails with a reused
+       Jacobian, the solution of the previous iteration is restored, its
+       residual is evaluated again (so that the functional is linearized
+       around it) and the iteration is done again with a new Jacobian;
+       the failed iteration does not count in maxit. The counters of the
+       evaluated and reused Jacobians are reset at each call.
+
     */
 
 template < class Fct >
@@ -88,7 +99,8 @@ Int NonLinearRichardson( VectorEpetra& sol,
                       Int         NonLinearLineSearch,
                       std::ofstream& out_res,
                       const Real& time,
-                      UInt iter = UInt(0) )
+                      UInt iter = UInt(0),
+                      NonLinearJacobianLagging* jacobianLagging = 0 )
 {
     /*
         */
@@ -114,6 +126,7 @@ Int NonLinearRichardson( VectorEpetra& sol,
 
     VectorEpetra residual ( sol.map() );
     VectorEpetra step     ( sol.map() );
+    VectorEpetra solOld   ( sol.map() ); // solution before a line search with a reused Jacobian
 
     step *= 0.;
 
@@ -145,6 +158,15 @@ Int NonLinearRichardson( VectorEpetra& sol,
 
     Real solNormInf(sol.normInf());
     Real stepNormInf;
+
+    Real contraction(0.);
+    bool reuseJacobian(false);
+    if ( jacobianLagging )
+    {
+        jacobianLagging->restart();
+        jacobianLagging->resetCounters();
+    }
+
     if (verbose)
     {
         out_res << std::scientific;
@@ -173,10 +195,17 @@ Int NonLinearRichardson( VectorEpetra& sol,
 
         iter++;
 
+        const Real normResOlder( normResOld );
         ratio      = normRes/normResOld;
         normResOld = normRes;
         normRes    = residual.normInf();
 
+        if ( jacobianLagging )
+        {
+            reuseJacobian = !jacobianLagging->updateJacobian( contraction );
+            functional.setReuseJacobian( reuseJacobian );
+        }
+
         residual *= -1;
         functional.solveJac(step, residual, linearRelTol); // J*step = -R
 
@@ -190,6 +219,9 @@ Int NonLinearRichardson( VectorEpetra& sol,
         }
         linres = linearRelTol;
 
+        if ( reuseJacobian )
+            solOld = sol;
+
         lambda = 1.;
         slope  = normRes * normRes * ( linres * linres - 1 );
 
@@ -213,11 +245,32 @@ Int NonLinearRichardson( VectorEpetra& sol,
         }
 
         if (status == EXIT_FAILURE)
-            return status;
+        {
+            if ( !reuseJacobian )
+                return status;
+
+            // The step computed with an old Jacobian is not good enough: restore the solution
+            // and try the same iteration again with a new Jacobian
+            if (verbose)
+            {
+                std::cout << "    Newton: line search failed with a reused Jacobian, evaluating it again" << std::endl;
+                out_res << "   line search failed with a reused Jacobian" << std::endl;
+            }
+            jacobianLagging->invalidate();
+
+            iter--;
+            sol = solOld;
+            functional.evalResidual( residual, sol, iter );
+            normRes     = residual.normInf();
+            normResOld  = normResOlder;
+            contraction = 0.;
+            continue;
+        }
 
 
 
         normRes = residual.normInf();
+        contraction = normRes / normResOld;
 
         if (verbose)
             out_res << std::setw(15) << normRes << std::endl;
@@ -255,6 +308,9 @@ Int NonLinearRichardson( VectorEpetra& sol,
         std::cout << ">>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>" << std::endl;
         std::cout << "      Non-Linear Richardson: convergence =     " << normRes << std::endl
                   << "                             iterations  =     " << iter << std::endl;
+        if ( jacobianLagging )
+            std::cout << "                             Jacobians   =     " << jacobianLagging->evaluations()
+                      << " evaluated, " << jacobianLagging->reuses() << " reused" << std::endl;
         std::cout << "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<" << std::endl;
         std::cout << std::endl;
         //std::cout << "------------------------------------------------------------------" << std::endl;
@@ -117,6 +117,11 @@ Preconditioner::setSolver( SolverAztecOO& /*solver*/ )
     //assert( false );
 }
 
+void
+Preconditioner::setNullSpace( const boost::shared_ptr<std::vector<Real> >& /*nullSpace*/, const UInt& /*numVectors*/ )
+{
+}
+
 // ===================================================
 // Get Methods
 // ===================================================
@@ -131,6 +131,14 @@ public:
      */
     virtual Int buildPreconditioner( operator_type& matrix ) = 0;
 
+    //! Recompute the preconditioner for a matrix with the same pattern as the one used to build it
+    /*!
+      The preconditioners that can keep a part of their setup when only the values of the
+      matrix change override this method. By default the preconditioner is built again.
+      @param matrix Matrix upon which recompute the preconditioner
+     */
+    virtual Int recomputePreconditioner( operator_type& matrix ) { return buildPreconditioner( matrix ); }
+
     //! Reset the preconditioner
     virtual void resetPreconditioner() = 0;
 
@@ -201,6 +209,14 @@ public:
      */
     virtual void setSolver( SolverAztecOO& /*solver*/ );
 
+    //! Set the near null space of the operator
+    /*!
+      Note: only used by the multilevel preconditioners, the others ignore it
+      @param nullSpace the vectors of the null space, one after the other (see FESpace::rigidBodyModes)
+      @param numVectors the number of vectors
+     */
+    virtual void setNullSpace( const boost::shared_ptr<std::vector<Real> >& /*nullSpace*/, const UInt& /*numVectors*/ );
+
     //@}
 
 
@@ -157,6 +157,16 @@ PreconditionerComposed::replace(operatorPtr_Type& oper,
     return EXIT_SUCCESS;
 }
 
+void
+PreconditionerComposed::setNullSpace( const UInt& index,
+                                      const boost::shared_ptr<std::vector<Real> >& nullSpace,
+                                      const UInt& numVectors )
+{
+    ASSERT(index < M_prec->Operator().size(), "PreconditionerComposed::setNullSpace: index too large");
+
+    M_prec->OperatorView()[index]->setNullSpace( nullSpace, numVectors );
+}
+
 void
 PreconditionerComposed::resetPreconditioner()
 {
@@ -137,6 +137,11 @@ public:
     //! resets the pointer to the preconditioner M_prec
     void                   resetPreconditioner();
 
+    //! Sets the near null space of the operator of a factor (see Preconditioner::setNullSpace)
+    void                   setNullSpace( const UInt& index,
+                                         const boost::shared_ptr<std::vector<Real> >& nullSpace,
+                                         const UInt& numVectors );
+
     //! returns the operator vectir
     const std::vector<operatorPtr_Type>& operVector() const {return M_operVector;}
     //@}
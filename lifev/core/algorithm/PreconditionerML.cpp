@@ -51,7 +51,10 @@ PreconditionerML::PreconditionerML( boost::shared_ptr<Epetra_Comm> comm ):
         M_operator(),
         M_preconditioner(),
         M_analyze(false),
-        M_visualizationDataAvailable(false)
+        M_visualizationDataAvailable(false),
+        M_nullSpace(),
+        M_nullSpaceDimension(0),
+        M_hierarchyReused(false)
 {
 
 }
@@ -73,15 +76,39 @@ PreconditionerML::buildPreconditioner( operator_type& matrix )
     //the Trilinos::MultiLevelPreconditioner unsafely access to the area of memory co-owned by M_operator.
     //to avoid the risk of dandling pointers always deallocate M_preconditioner first and then M_operator
     M_preconditioner.reset();
-    M_operator = matrix;
+    M_hierarchyReused = false;
+
+    // To recompute the values, the preconditioner must own the matrix it refers to
+    if ( this->parametersList().get( "reuse: enable", false ) )
+        M_operator.reset( new operator_raw_type( *matrix ) );
+    else
+        M_operator = matrix;
 
     M_precType = M_list.get( "prec type", "undefined??" );
     M_precType += "_ML";
 
+    // Near null space given by the problem (e.g. rigid body modes), only if requested:
+    // the list given to ML is a copy, so that the request holds for the next matrices
+    list_Type list( this->parametersList() );
+    if ( list.isParameter( "null space: type" ) && list.get<std::string>( "null space: type" ) == "pre-computed" )
+    {
+        if ( M_nullSpace && M_nullSpace->size() == M_nullSpaceDimension * M_operator->matrixPtr()->NumMyRows() )
+        {
+            list.set( "null space: dimension", static_cast<Int>( M_nullSpaceDimension ) );
+            list.set( "null space: vectors", &( *M_nullSpace )[0] );
+            list.set( "null space: add default vectors", false );
+        }
+        else
+        {
+            // No null space for this matrix: back to the ML default
+            list.set( "null space: type", "default vectors" );
+        }
+    }
+
     // <one-level-postsmoothing> / <two-level-additive>
     // <two-level-hybrid> / <two-level-hybrid2>
 
-    M_preconditioner.reset( new prec_raw_type( *(M_operator->matrixPtr()), this->parametersList(), true ) );
+    M_preconditioner.reset( new prec_raw_type( *(M_operator->matrixPtr()), list, true ) );
 
     if ( M_analyze )
     {
@@ -98,6 +125,19 @@ PreconditionerML::buildPreconditioner( operator_type& matrix )
     return ( EXIT_SUCCESS );
 }
 
+Int
+PreconditionerML::recomputePreconditioner( operator_type& matrix )
+{
+    if ( !M_preconditioner || !this->parametersList().get( "reuse: enable", false ) || !copyMatrixValues( matrix ) )
+        return buildPreconditioner( matrix );
+
+    // Keep the aggregates and the prolongators, recompute the Galerkin products and the smoothers
+    M_preconditioner->ReComputePreconditioner();
+    M_hierarchyReused = true;
+
+    return ( EXIT_SUCCESS );
+}
+
 void
 PreconditionerML::resetPreconditioner()
 {
@@ -136,6 +176,10 @@ PreconditionerML::createMLList( list_Type& list,
     Int PDEEquations         = dataFile((section + "/" + subSection + "/pde_equations").data(), 1, found);
     if ( found ) list.set( "PDE equations", PDEEquations );
 
+    // "default vectors" / "pre-computed" (the null space given by setNullSpace, if any)
+    std::string NullSpaceType = dataFile((section + "/" + subSection + "/null_space/type").data(), "default vectors", found);
+    if ( found ) list.set( "null space: type", NullSpaceType );
+
     Int CycleApplications    = dataFile((section + "/" + subSection + "/cycle_applications").data(), 1, found);
     if ( found ) list.set( "cycle applications", CycleApplications );
 
@@ -334,6 +378,10 @@ PreconditionerML::createMLList( list_Type& list,
     Int RepartitionZoltanDimensions    = dataFile( (section + "/" + subSection + "/repartition/Zoltan_dimensions").data(), 2, found );
     if ( found ) list.set( "repartition: Zoltan dimensions", RepartitionZoltanDimensions );
 
+    // Reuse of the hierarchy when only the values of the matrix change
+    bool ReuseEnable                   = dataFile( (section + "/" + subSection + "/reuse").data(), false, found );
+    if ( found ) list.set( "reuse: enable", ReuseEnable );
+
     if ( MLPrintParameterList && verbose )
     {
     	std::cout << "ML parameters list:" << std::endl;
@@ -404,6 +452,13 @@ PreconditionerML::setVerticesCoordinates(boost::shared_ptr<vector<Real> > xCoord
     M_visualizationDataAvailable = true;
 }
 
+void
+PreconditionerML::setNullSpace( const boost::shared_ptr<std::vector<Real> >& nullSpace, const UInt& numVectors )
+{
+    M_nullSpace = nullSpace;
+    M_nullSpaceDimension = numVectors;
+}
+
 
 // ===================================================
 // Get Methods
@@ -420,4 +475,53 @@ PreconditionerML::preconditioner()
     return M_preconditioner.get();
 }
 
+// ===================================================
+// Private Methods
+// ===================================================
+bool
+PreconditionerML::copyMatrixValues( const operator_type& matrix )
+{
+    Epetra_CrsMatrix& storedMatrix( *M_operator->matrixPtr() );
+    const Epetra_CrsMatrix& newMatrix( *matrix->matrixPtr() );
+
+    Int numEntries( 0 ), storedNumEntries( 0 );
+    Real* values( 0 );
+    Real* storedValues( 0 );
+    Int* indices( 0 );
+    Int* storedIndices( 0 );
+
+    // Same pattern on all the processors? Epetra_BlockMap::SameAs is collective:
+    // it is called on every processor, before the local tests can stop the comparison
+    const bool sameColumnMap( newMatrix.ColMap().SameAs( storedMatrix.ColMap() ) );
+
+    Int samePattern( sameColumnMap
+                     && newMatrix.NumMyRows() == storedMatrix.NumMyRows()
+                     && newMatrix.NumMyNonzeros() == storedMatrix.NumMyNonzeros() );
+    for ( Int iRow( 0 ); samePattern && iRow < newMatrix.NumMyRows(); ++iRow )
+    {
+        newMatrix.ExtractMyRowView( iRow, numEntries, values, indices );
+        storedMatrix.ExtractMyRowView( iRow, storedNumEntries, storedValues, storedIndices );
+
+        samePattern = ( numEntries == storedNumEntries );
+        for ( Int i( 0 ); samePattern && i < numEntries; ++i )
+            samePattern = ( indices[i] == storedIndices[i] );
+    }
+
+    Int globalSamePattern( 0 );
+    M_comm->MinAll( &samePattern, &globalSamePattern, 1 );
+    if ( !globalSamePattern )
+        return false;
+
+    for ( Int iRow( 0 ); iRow < newMatrix.NumMyRows(); ++iRow )
+    {
+        newMatrix.ExtractMyRowView( iRow, numEntries, values, indices );
+        storedMatrix.ExtractMyRowView( iRow, storedNumEntries, storedValues, storedIndices );
+
+        for ( Int i( 0 ); i < numEntries; ++i )
+            storedValues[i] = values[i];
+    }
+
+    return true;
+}
+
 } // namespace LifeV
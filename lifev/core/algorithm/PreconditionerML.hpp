@@ -115,6 +115,17 @@ public:
      */
     Int buildPreconditioner( operator_type& matrix );
 
+    //! Recompute the preconditioner for a matrix with the same pattern
+    /*!
+      If the reuse is enabled in the parameters list ("reuse: enable", i.e. ML/reuse in the data
+      file), the aggregates and the prolongators of the previous build are kept, and only the
+      coarse operators and the smoothers are computed again. The preconditioner is then built on
+      a copy of the matrix, where the new values are copied. Otherwise, or if the pattern of the
+      matrix has changed, the preconditioner is built from scratch.
+      @param matrix Matrix upon which recompute the preconditioner
+     */
+    Int recomputePreconditioner( operator_type& matrix );
+
     //! Reset the preconditioner
     void resetPreconditioner();
 
@@ -207,6 +218,22 @@ public:
                                 boost::shared_ptr<vector<Real> > yCoord,
                                 boost::shared_ptr<vector<Real> > zCoord);
 
+    //! Set the near null space used to build the tentative prolongators
+    /*!
+      Without it, ML uses the constant for each of the "PDE equations", which is a poor coarse
+      space for elasticity-like problems. For vector problems one should give the rigid body modes
+      of the space (see FESpace::rigidBodyModes). They are used at the next build of the preconditioner
+      only if /ML/null_space/type is set to "pre-computed" in the data file (the default is "default
+      vectors") and if the number of rows of the matrix matches.
+
+      Note: with LifeV the components of a vector field are not interleaved, so the null space is to
+      be used with /ML/pde_equations = 1; the block aggregation (pde_equations > 1) requires an
+      interleaved (nodal) numbering of the unknowns.
+      @param nullSpace the vectors of the null space, one after the other
+      @param numVectors the number of vectors
+     */
+    void setNullSpace( const boost::shared_ptr<std::vector<Real> >& nullSpace, const UInt& numVectors );
+
     //@}
 
 
@@ -225,6 +252,9 @@ public:
     //! Return the type of preconditioner
     std::string preconditionerType() { return M_precType; }
 
+    //! Return true if the last computation of the preconditioner has reused the hierarchy (see recomputePreconditioner)
+    const bool& hierarchyReused() const { return M_hierarchyReused; }
+
     //! Return true if the preconditioner is transposed
     bool UseTranspose() { return M_preconditioner->UseTranspose(); }
 
@@ -245,6 +275,13 @@ protected:
 
 private:
 
+    //! Copy the values of a matrix in the one of the preconditioner, if they have the same pattern
+    /*!
+      @param matrix Matrix to copy
+      @return false if the patterns differ on some processor (then nothing is copied)
+     */
+    bool copyMatrixValues( const operator_type& matrix );
+
     operator_type           M_operator;
 
     prec_type               M_preconditioner;
@@ -256,6 +293,11 @@ private:
     boost::shared_ptr<vector<Real> > M_yCoord;
     boost::shared_ptr<vector<Real> > M_zCoord;
 
+    boost::shared_ptr<std::vector<Real> > M_nullSpace;
+    UInt                    M_nullSpaceDimension;
+
+    bool                    M_hierarchyReused;
+
 };
 
 
@@ -0,0 +1,456 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Block preconditioners for saddle point problems (PCD, LSC, SIMPLE)
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/algorithm/PreconditionerSaddlePoint.hpp>
+
+#include <cmath>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+PreconditionerSaddlePoint::PreconditionerSaddlePoint( const commPtr_Type& comm ):
+        super                          ( comm ),
+        M_schurApproximation           ( LSC ),
+        M_numVelocityDofs              ( 0 ),
+        M_matrix                       (),
+        M_operator                     (),
+        M_velocityMap                  (),
+        M_pressureMap                  (),
+        M_velocityRows                 (),
+        M_pressureRows                 (),
+        M_velocityBlock                (),
+        M_gradientBlock                (),
+        M_divergenceBlock              (),
+        M_pressureBlock                (),
+        M_velocityMass                 (),
+        M_pressureMass                 (),
+        M_pressureLaplacian            (),
+        M_pressureConvectionDiffusion  (),
+        M_pressureOperator             (),
+        M_velocityDiagonalInverse      (),
+        M_pressureMassInverse          (),
+        M_schurSign                    ( 1. ),
+        M_velocityPreconditioner       (),
+        M_pressurePreconditioner       ()
+{
+
+}
+
+PreconditionerSaddlePoint::~PreconditionerSaddlePoint()
+{
+    // The inner preconditioners refer to the blocks: release them first
+    resetPreconditioner();
+}
+
+// ===================================================
+// Methods
+// ===================================================
+void
+PreconditionerSaddlePoint::createParametersList( list_Type&         list,
+                                                 const GetPot&      dataFile,
+                                                 const std::string& section,
+                                                 const std::string& subSection )
+{
+    // PCD / LSC / SIMPLE / SIMPLEC
+    list.set( "Schur approximation", dataFile( ( section + "/" + subSection + "/type" ).data(), "LSC" ) );
+}
+
+Int
+PreconditionerSaddlePoint::buildPreconditioner( operator_type& matrix )
+{
+    ASSERT( M_numVelocityDofs > 0, "PreconditionerSaddlePoint: the number of velocity unknowns is not set" );
+    ASSERT( M_velocityPreconditioner && M_pressurePreconditioner, "PreconditionerSaddlePoint: the inner preconditioners are not set" );
+
+    M_operator.reset();
+    M_matrix = matrix;
+
+    splitMatrix( *M_matrix );
+
+    // Diagonal approximation of the velocity block
+    if ( M_schurApproximation == LSC && M_velocityMass )
+    {
+        // The mass matrix is on the map of the monolithic matrix: keep its velocity rows
+        if ( !M_velocityMass->matrixPtr()->RowMap().SameAs( M_matrix->matrixPtr()->RowMap() ) )
+            ERROR_MSG( "PreconditionerSaddlePoint: the velocity mass matrix must have the rows of the monolithic matrix" );
+
+        epetraVectorPtr_Type massDiagonalInverse( inverseDiagonal( *M_velocityMass, false ) );
+        M_velocityDiagonalInverse.reset( new Epetra_Vector( *M_velocityMap->map( Unique ) ) );
+        for ( UInt i( 0 ); i < M_velocityRows.size(); ++i )
+            ( *M_velocityDiagonalInverse )[i] = ( *massDiagonalInverse )[ M_velocityRows[i] ];
+    }
+    else
+        M_velocityDiagonalInverse = inverseDiagonal( *M_velocityBlock, M_schurApproximation == SIMPLEC );
+
+    M_schurSign = schurComplementSign();
+
+    if ( M_schurApproximation == PCD )
+    {
+        ASSERT( M_pressureMass && M_pressureLaplacian && M_pressureConvectionDiffusion,
+                "PreconditionerSaddlePoint: PCD needs the pressure mass, Laplacian and convection-diffusion matrices" );
+
+        M_pressureMassInverse = inverseDiagonal( *M_pressureMass, true );
+        M_pressureOperator    = M_pressureLaplacian;
+    }
+    else
+    {
+        // B D^{-1} B^T
+        operator_raw_type scaledGradient( *M_gradientBlock );
+        scaledGradient.matrixPtr()->LeftScale( *M_velocityDiagonalInverse );
+
+        operator_raw_type product( *M_pressureMap );
+        M_divergenceBlock->multiply( false, scaledGradient, false, product );
+
+        // LSC: L = -B Q^{-1} B^T, SIMPLE: S = C - B D^{-1} B^T, both made positive
+        M_pressureOperator.reset( new operator_raw_type( *M_pressureMap ) );
+        if ( M_schurApproximation != LSC )
+            *M_pressureOperator += *M_pressureBlock * M_schurSign;
+        *M_pressureOperator += product * ( -M_schurSign );
+        M_pressureOperator->globalAssemble();
+    }
+
+    M_velocityPreconditioner->buildPreconditioner( M_velocityBlock );
+    M_pressurePreconditioner->buildPreconditioner( M_pressureOperator );
+
+    M_operator.reset( new InverseOperator( *this, M_matrix->matrixPtr()->RowMap() ) );
+
+    M_precType = "SaddlePoint_" + M_list.get( "Schur approximation", "LSC" );
+
+    this->M_preconditionerCreated = true;
+
+    return ( EXIT_SUCCESS );
+}
+
+void
+PreconditionerSaddlePoint::resetPreconditioner()
+{
+    M_operator.reset();
+
+    if ( M_velocityPreconditioner )
+        M_velocityPreconditioner->resetPreconditioner();
+    if ( M_pressurePreconditioner )
+        M_pressurePreconditioner->resetPreconditioner();
+
+    M_velocityBlock.reset();
+    M_gradientBlock.reset();
+    M_divergenceBlock.reset();
+    M_pressureBlock.reset();
+    M_pressureOperator.reset();
+    M_matrix.reset();
+
+    this->M_preconditionerCreated = false;
+}
+
+Real
+PreconditionerSaddlePoint::condest()
+{
+    return M_velocityPreconditioner ? M_velocityPreconditioner->condest() : 0.;
+}
+
+Int
+PreconditionerSaddlePoint::ApplyInverse( const Epetra_MultiVector& vector1, Epetra_MultiVector& vector2 ) const
+{
+    const Int numVectors( vector1.NumVectors() );
+    const Epetra_Map& velocityMap( *M_velocityMap->map( Unique ) );
+    const Epetra_Map& pressureMap( *M_pressureMap->map( Unique ) );
+
+    Epetra_MultiVector velocity( velocityMap, numVectors );
+    Epetra_MultiVector pressure( pressureMap, numVectors );
+    splitVector( vector1, velocity, pressure );
+
+    Epetra_MultiVector velocitySolution( velocityMap, numVectors );
+    Epetra_MultiVector pressureSolution( pressureMap, numVectors );
+    Epetra_MultiVector velocityTemp( velocityMap, numVectors );
+    Epetra_MultiVector pressureTemp( pressureMap, numVectors );
+
+    switch ( M_schurApproximation )
+    {
+    case PCD:
+
+        // p = M_p^{-1} F_p A_p^{-1} r_p
+        M_pressurePreconditioner->ApplyInverse( pressure, pressureTemp );
+        M_pressureConvectionDiffusion->matrixPtr()->Apply( pressureTemp, pressureSolution );
+        pressureSolution.Multiply( M_schurSign, *M_pressureMassInverse, pressureSolution, 0. );
+        break;
+
+    case LSC:
+
+        // p = -L^{-1} B Q^{-1} F Q^{-1} B^T L^{-1} r_p
+        M_pressurePreconditioner->ApplyInverse( pressure, pressureTemp );
+        M_gradientBlock->matrixPtr()->Apply( pressureTemp, velocityTemp );
+        velocityTemp.Multiply( 1., *M_velocityDiagonalInverse, velocityTemp, 0. );
+        M_velocityBlock->matrixPtr()->Apply( velocityTemp, velocitySolution );
+        velocitySolution.Multiply( 1., *M_velocityDiagonalInverse, velocitySolution, 0. );
+        M_divergenceBlock->matrixPtr()->Apply( velocitySolution, pressureTemp );
+        M_pressurePreconditioner->ApplyInverse( pressureTemp, pressureSolution );
+        pressureSolution.Scale( -1. );
+        break;
+
+    default:
+
+        // SIMPLE: u* = F^{-1} r_u, p = S^{-1} ( r_p - B u* ), u = u* - D^{-1} B^T p
+        M_velocityPreconditioner->ApplyInverse( velocity, velocityTemp );
+        M_divergenceBlock->matrixPtr()->Apply( velocityTemp, pressureTemp );
+        pressure.Update( -1., pressureTemp, 1. );
+        M_pressurePreconditioner->ApplyInverse( pressure, pressureSolution );
+        pressureSolution.Scale( M_schurSign );
+
+        M_gradientBlock->matrixPtr()->Apply( pressureSolution, velocitySolution );
+        velocitySolution.Multiply( -1., *M_velocityDiagonalInverse, velocitySolution, 0. );
+        velocitySolution.Update( 1., velocityTemp, 1. );
+
+        mergeVector( velocitySolution, pressureSolution, vector2 );
+        return 0;
+    }
+
+    // Block upper triangular: u = F^{-1} ( r_u - B^T p )
+    M_gradientBlock->matrixPtr()->Apply( pressureSolution, velocityTemp );
+    velocity.Update( -1., velocityTemp, 1. );
+    M_velocityPreconditioner->ApplyInverse( velocity, velocitySolution );
+
+    mergeVector( velocitySolution, pressureSolution, vector2 );
+    return 0;
+}
+
+void
+PreconditionerSaddlePoint::showMe( std::ostream& output ) const
+{
+    output << "PreconditionerSaddlePoint: " << M_precType << std::endl
+           << "  Velocity unknowns: " << M_numVelocityDofs << std::endl
+           << "  Schur complement sign: " << M_schurSign << std::endl;
+}
+
+// ===================================================
+// Set Methods
+// ===================================================
+void
+PreconditionerSaddlePoint::setDataFromGetPot( const GetPot& dataFile, const std::string& section )
+{
+    createParametersList( M_list, dataFile, section, "SaddlePoint" );
+
+    const std::string schurApproximation( M_list.get( "Schur approximation", "LSC" ) );
+    if ( schurApproximation == "PCD" )
+        M_schurApproximation = PCD;
+    else if ( schurApproximation == "LSC" )
+        M_schurApproximation = LSC;
+    else if ( schurApproximation == "SIMPLE" )
+        M_schurApproximation = SIMPLE;
+    else if ( schurApproximation == "SIMPLEC" )
+        M_schurApproximation = SIMPLEC;
+    else
+        ERROR_MSG( "PreconditionerSaddlePoint: unknown Schur complement approximation " + schurApproximation );
+
+    // Preconditioners of the velocity block and of the pressure matrix
+    M_velocityPreconditioner.reset( PRECFactory::instance().createObject( dataFile( ( section + "/velocity/prectype" ).data(), "ML" ) ) );
+    ASSERT( M_velocityPreconditioner.get() != 0, "PreconditionerSaddlePoint: velocity preconditioner not set" );
+    M_velocityPreconditioner->setDataFromGetPot( dataFile, section + "/velocity" );
+
+    M_pressurePreconditioner.reset( PRECFactory::instance().createObject( dataFile( ( section + "/pressure/prectype" ).data(), "ML" ) ) );
+    ASSERT( M_pressurePreconditioner.get() != 0, "PreconditionerSaddlePoint: pressure preconditioner not set" );
+    M_pressurePreconditioner->setDataFromGetPot( dataFile, section + "/pressure" );
+}
+
+void
+PreconditionerSaddlePoint::setPressureMatrices( const operator_type& mass, const operator_type& laplacian )
+{
+    M_pressureMass      = mass;
+    M_pressureLaplacian = laplacian;
+}
+
+void
+PreconditionerSaddlePoint::setPressureConvectionDiffusion( const operator_type& convectionDiffusion )
+{
+    M_pressureConvectionDiffusion = convectionDiffusion;
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+void
+PreconditionerSaddlePoint::splitMatrix( const operator_raw_type& matrix )
+{
+    const Epetra_FECrsMatrix& epetraMatrix( *matrix.matrixPtr() );
+    const Epetra_Map& rowMap( epetraMatrix.RowMap() );
+
+    const Int numVelocityDofs( M_numVelocityDofs );
+    const Int numPressureDofs( rowMap.NumGlobalElements() - numVelocityDofs );
+
+    // Velocity and pressure maps, both numbered from 0
+    M_velocityMap.reset( new MapEpetra( rowMap, 0, numVelocityDofs ) );
+    M_pressureMap.reset( new MapEpetra( rowMap, numVelocityDofs, numPressureDofs ) );
+
+    M_velocityRows.clear();
+    M_pressureRows.clear();
+    for ( Int iRow( 0 ); iRow < rowMap.NumMyElements(); ++iRow )
+    {
+        if ( rowMap.GID( iRow ) < numVelocityDofs )
+            M_velocityRows.push_back( iRow );
+        else
+            M_pressureRows.push_back( iRow );
+    }
+
+    const Int numEntries( matrix.meanNumEntries() );
+    M_velocityBlock.reset  ( new operator_raw_type( *M_velocityMap, numEntries ) );
+    M_gradientBlock.reset  ( new operator_raw_type( *M_velocityMap, numEntries ) );
+    M_divergenceBlock.reset( new operator_raw_type( *M_pressureMap, numEntries ) );
+    M_pressureBlock.reset  ( new operator_raw_type( *M_pressureMap, numEntries ) );
+
+    Int numRowEntries( 0 );
+    Real* values( 0 );
+    Int* indices( 0 );
+
+    std::vector<Int>  velocityColumns, pressureColumns;
+    std::vector<Real> velocityValues,  pressureValues;
+
+    for ( Int iRow( 0 ); iRow < rowMap.NumMyElements(); ++iRow )
+    {
+        epetraMatrix.ExtractMyRowView( iRow, numRowEntries, values, indices );
+
+        velocityColumns.clear();
+        pressureColumns.clear();
+        velocityValues.clear();
+        pressureValues.clear();
+        for ( Int i( 0 ); i < numRowEntries; ++i )
+        {
+            const Int column( epetraMatrix.GCID( indices[i] ) );
+            if ( column < numVelocityDofs )
+            {
+                velocityColumns.push_back( column );
+                velocityValues.push_back( values[i] );
+            }
+            else
+            {
+                pressureColumns.push_back( column - numVelocityDofs );
+                pressureValues.push_back( values[i] );
+            }
+        }
+
+        Int row( rowMap.GID( iRow ) );
+        operator_raw_type* velocityColumnsBlock( M_velocityBlock.get() );
+        operator_raw_type* pressureColumnsBlock( M_gradientBlock.get() );
+        if ( row >= numVelocityDofs )
+        {
+            row -= numVelocityDofs;
+            velocityColumnsBlock = M_divergenceBlock.get();
+            pressureColumnsBlock = M_pressureBlock.get();
+        }
+
+        if ( !velocityColumns.empty() )
+            velocityColumnsBlock->matrixPtr()->InsertGlobalValues( row, velocityColumns.size(), &velocityValues[0], &velocityColumns[0] );
+        if ( !pressureColumns.empty() )
+            pressureColumnsBlock->matrixPtr()->InsertGlobalValues( row, pressureColumns.size(), &pressureValues[0], &pressureColumns[0] );
+    }
+
+    M_velocityBlock->globalAssemble();
+    M_pressureBlock->globalAssemble();
+    M_gradientBlock->globalAssemble( M_pressureMap, M_velocityMap );
+    M_divergenceBlock->globalAssemble( M_velocityMap, M_pressureMap );
+}
+
+PreconditionerSaddlePoint::epetraVectorPtr_Type
+PreconditionerSaddlePoint::inverseDiagonal( const operator_raw_type& matrix, const bool& rowSum )
+{
+    const Epetra_FECrsMatrix& epetraMatrix( *matrix.matrixPtr() );
+    epetraVectorPtr_Type diagonal( new Epetra_Vector( epetraMatrix.RowMap() ) );
+
+    if ( rowSum )
+    {
+        Int numEntries( 0 );
+        Real* values( 0 );
+        Int* indices( 0 );
+        for ( Int iRow( 0 ); iRow < epetraMatrix.NumMyRows(); ++iRow )
+        {
+            epetraMatrix.ExtractMyRowView( iRow, numEntries, values, indices );
+            for ( Int i( 0 ); i < numEntries; ++i )
+                ( *diagonal )[iRow] += std::fabs( values[i] );
+        }
+    }
+    else
+        epetraMatrix.ExtractDiagonalCopy( *diagonal );
+
+    for ( Int iRow( 0 ); iRow < diagonal->MyLength(); ++iRow )
+        ( *diagonal )[iRow] = ( ( *diagonal )[iRow] != 0. ) ? 1. / ( *diagonal )[iRow] : 1.;
+
+    return diagonal;
+}
+
+Real
+PreconditionerSaddlePoint::schurComplementSign() const
+{
+    Epetra_Vector pressure( *M_pressureMap->map( Unique ) );
+    Epetra_Vector velocity( *M_velocityMap->map( Unique ) );
+    Epetra_Vector product( *M_pressureMap->map( Unique ) );
+
+    pressure.Random();
+    M_gradientBlock->matrixPtr()->Apply( pressure, velocity );
+    velocity.Multiply( 1., *M_velocityDiagonalInverse, velocity, 0. );
+    M_divergenceBlock->matrixPtr()->Apply( velocity, product );
+
+    // p^T ( -B D^{-1} B^T ) p
+    Real scalarProduct( 0. );
+    pressure.Dot( product, &scalarProduct );
+
+    return ( scalarProduct > 0. ) ? -1. : 1.;
+}
+
+void
+PreconditionerSaddlePoint::splitVector( const Epetra_MultiVector& vector,
+                                        Epetra_MultiVector&       velocity,
+                                        Epetra_MultiVector&       pressure ) const
+{
+    for ( Int iVector( 0 ); iVector < vector.NumVectors(); ++iVector )
+    {
+        for ( UInt i( 0 ); i < M_velocityRows.size(); ++i )
+            velocity[iVector][i] = vector[iVector][ M_velocityRows[i] ];
+        for ( UInt i( 0 ); i < M_pressureRows.size(); ++i )
+            pressure[iVector][i] = vector[iVector][ M_pressureRows[i] ];
+    }
+}
+
+void
+PreconditionerSaddlePoint::mergeVector( const Epetra_MultiVector& velocity,
+                                        const Epetra_MultiVector& pressure,
+                                        Epetra_MultiVector&       vector ) const
+{
+    for ( Int iVector( 0 ); iVector < vector.NumVectors(); ++iVector )
+    {
+        for ( UInt i( 0 ); i < M_velocityRows.size(); ++i )
+            vector[iVector][ M_velocityRows[i] ] = velocity[iVector][i];
+        for ( UInt i( 0 ); i < M_pressureRows.size(); ++i )
+            vector[iVector][ M_pressureRows[i] ] = pressure[iVector][i];
+    }
+}
+
+} // namespace LifeV
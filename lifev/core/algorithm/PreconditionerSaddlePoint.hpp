@@ -0,0 +1,329 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Block preconditioners for saddle point problems (PCD, LSC, SIMPLE)
+
+    @date 19-10-2012
+ */
+
+#ifndef PRECONDITIONERSADDLEPOINT_HPP
+#define PRECONDITIONERSADDLEPOINT_HPP 1
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_Operator.h>
+#include <Epetra_MultiVector.h>
+#include <Epetra_Vector.h>
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <boost/shared_ptr.hpp>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/algorithm/Preconditioner.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! PreconditionerSaddlePoint - Block preconditioners for the incompressible Navier-Stokes equations
+/*!
+  The system matrix is split in the velocity and pressure blocks
+  \f[
+  A = \left( \begin{array}{cc} F & B^T \\ B & C \end{array} \right),
+  \qquad S = C - B F^{-1} B^T,
+  \f]
+  the velocity unknowns being the first ones of the map (see setNumVelocityDofs()).
+  The inverse of the Schur complement S is approximated by:
+  <ul>
+    <li> PCD (pressure convection-diffusion): \f$ S^{-1} \approx M_p^{-1} F_p A_p^{-1} \f$, with the pressure
+         mass, Laplacian and convection-diffusion matrices given by the problem (setPressureMatrices(),
+         setPressureConvectionDiffusion());
+    <li> LSC (least-squares commutator): \f$ S^{-1} \approx -L^{-1} B Q^{-1} F Q^{-1} B^T L^{-1} \f$, with
+         \f$ L = B Q^{-1} B^T \f$ and Q the diagonal of the velocity mass (or of F);
+    <li> SIMPLE / SIMPLEC: \f$ S \approx C - B D^{-1} B^T \f$, with D the diagonal of F (SIMPLE)
+         or its absolute row sums (SIMPLEC).
+  </ul>
+  PCD and LSC are applied as a block upper triangular preconditioner, SIMPLE as the approximate
+  block LU factorization. The velocity block and the pressure matrices (\f$ A_p \f$, L or the
+  SIMPLE Schur complement) are approximated by preconditioners built by the PRECFactory, ML by default,
+  from the velocity and pressure subsections of the data file:
+
+  \code
+  [fluid/prec]
+      prectype = SaddlePoint
+      [./SaddlePoint]
+          type = PCD           # PCD / LSC / SIMPLE / SIMPLEC
+      [../velocity]
+          prectype = ML
+          [./ML]
+          ...
+      [../pressure]
+          prectype = ML
+          ...
+  \endcode
+
+  The sign of the Schur complement, which depends on the sign convention of the B block, is
+  detected when building the preconditioner, so that the pressure matrices given to the
+  multilevel preconditioners are positive.
+ */
+class PreconditionerSaddlePoint:
+        public Preconditioner
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef Preconditioner                       super;
+
+    typedef super::operator_raw_type             operator_raw_type;
+    typedef super::operator_type                 operator_type;
+
+    typedef boost::shared_ptr<Preconditioner>    preconditionerPtr_Type;
+    typedef boost::shared_ptr<MapEpetra>         mapPtr_Type;
+    typedef boost::shared_ptr<Epetra_Vector>     epetraVectorPtr_Type;
+
+    enum SchurApproximation
+    {
+        PCD,
+        LSC,
+        SIMPLE,
+        SIMPLEC
+    };
+
+    //@}
+
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param comm Communicator
+     */
+    PreconditionerSaddlePoint( const commPtr_Type& comm = commPtr_Type() );
+
+    //! Destructor
+    virtual ~PreconditionerSaddlePoint();
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Create the list of parameters of the preconditioner
+    /*!
+      @param list A Parameter list to be filled
+      @param dataFile A GetPot object containing the data about the preconditioner
+      @param section The section in "dataFile" where to find data about the preconditioner
+      @param subSection The subsection in "dataFile" where to find data about the preconditioner
+     */
+    void createParametersList( list_Type& list,
+                               const GetPot& dataFile,
+                               const std::string& section,
+                               const std::string& subSection = "SaddlePoint" );
+
+    //! Build the preconditioner on the given matrix
+    /*!
+      @param matrix Matrix upon which construct the preconditioner
+     */
+    Int buildPreconditioner( operator_type& matrix );
+
+    //! Reset the preconditioner
+    void resetPreconditioner();
+
+    //! Return an estimation of the condition number of the velocity preconditioner
+    Real condest();
+
+    //! Apply the inverse of the preconditioner on vector1 and store the result in vector2
+    /*!
+      @param vector1 Vector to which we apply the preconditioner
+      @param vector2 Vector to the store the result
+     */
+    Int ApplyInverse( const Epetra_MultiVector& vector1, Epetra_MultiVector& vector2 ) const;
+
+    //! Show informations about the preconditioner
+    void showMe( std::ostream& output = std::cout ) const;
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the data of the preconditioner using a GetPot object
+    /*!
+      @param dataFile A GetPot object containing the data about the preconditioner
+      @param section The section in "dataFile" where to find data about the preconditioner
+     */
+    void setDataFromGetPot( const GetPot& dataFile, const std::string& section );
+
+    //! Set the number of velocity unknowns, which are the first ones of the map of the matrix
+    void setNumVelocityDofs( const UInt& numVelocityDofs ) { M_numVelocityDofs = numVelocityDofs; }
+
+    //! Set the pressure mass and Laplacian matrices (PCD), on the pressure map numbered from 0
+    /*!
+      @param mass pressure mass matrix (lumped in the preconditioner)
+      @param laplacian pressure stiffness matrix
+     */
+    void setPressureMatrices( const operator_type& mass, const operator_type& laplacian );
+
+    //! Set the pressure convection-diffusion matrix F_p (PCD), on the pressure map numbered from 0
+    void setPressureConvectionDiffusion( const operator_type& convectionDiffusion );
+
+    //! Set the velocity mass matrix used to scale the LSC preconditioner (the diagonal of F otherwise)
+    /*!
+      @param mass velocity mass matrix, on the map of the monolithic matrix (only its velocity rows are used)
+     */
+    void setVelocityMass( const operator_type& mass ) { M_velocityMass = mass; }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Return the approximation of the Schur complement
+    const SchurApproximation& schurApproximation() const { return M_schurApproximation; }
+
+    //! Return a raw pointer on the preconditioner
+    super::prec_raw_type* preconditioner() { return M_operator.get(); }
+
+    //! Return a shared pointer on the preconditioner
+    super::prec_type preconditionerPtr() { return M_operator; }
+
+    //! Return the type of preconditioner
+    std::string preconditionerType() { return M_precType; }
+
+    //! Return the preconditioner of the velocity block
+    const preconditionerPtr_Type& velocityPreconditioner() const { return M_velocityPreconditioner; }
+
+    //! Return the preconditioner of the pressure matrix
+    const preconditionerPtr_Type& pressurePreconditioner() const { return M_pressurePreconditioner; }
+
+    //@}
+
+private:
+
+    //! The Epetra_Operator given to the iterative solver, which applies the inverse of the preconditioner
+    class InverseOperator:
+            public Epetra_Operator
+    {
+    public:
+        InverseOperator( const PreconditionerSaddlePoint& preconditioner, const Epetra_Map& map ) :
+                M_preconditioner( preconditioner ), M_map( map ) {}
+
+        virtual ~InverseOperator() {}
+
+        Int SetUseTranspose( bool /*useTranspose*/ ) { return -1; }
+        Int Apply( const Epetra_MultiVector& /*X*/, Epetra_MultiVector& /*Y*/ ) const { return -1; }
+        Int ApplyInverse( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const
+        {
+            return M_preconditioner.ApplyInverse( X, Y );
+        }
+        double NormInf() const { return 0.; }
+        const char* Label() const { return "PreconditionerSaddlePoint"; }
+        bool UseTranspose() const { return false; }
+        bool HasNormInf() const { return false; }
+        const Epetra_Comm& Comm() const { return M_map.Comm(); }
+        const Epetra_Map& OperatorDomainMap() const { return M_map; }
+        const Epetra_Map& OperatorRangeMap() const { return M_map; }
+
+    private:
+        const PreconditionerSaddlePoint& M_preconditioner;
+        const Epetra_Map& M_map;
+    };
+
+    //! @name Private Methods
+    //@{
+
+    //! Split the matrix in its four blocks
+    void splitMatrix( const operator_raw_type& matrix );
+
+    //! Diagonal of a matrix, or its absolute row sums, inverted
+    static epetraVectorPtr_Type inverseDiagonal( const operator_raw_type& matrix, const bool& rowSum );
+
+    //! Sign of \f$ -B D^{-1} B^T \f$, estimated on a random vector
+    Real schurComplementSign() const;
+
+    //! Split a vector of the whole system in its velocity and pressure parts
+    void splitVector( const Epetra_MultiVector& vector, Epetra_MultiVector& velocity, Epetra_MultiVector& pressure ) const;
+
+    //! Merge the velocity and pressure parts in a vector of the whole system
+    void mergeVector( const Epetra_MultiVector& velocity, const Epetra_MultiVector& pressure, Epetra_MultiVector& vector ) const;
+
+    //@}
+
+    SchurApproximation       M_schurApproximation;
+    UInt                     M_numVelocityDofs;
+
+    operator_type            M_matrix;
+    prec_type                M_operator;
+
+    mapPtr_Type              M_velocityMap;
+    mapPtr_Type              M_pressureMap;
+    std::vector<Int>         M_velocityRows;
+    std::vector<Int>         M_pressureRows;
+
+    operator_type            M_velocityBlock;
+    operator_type            M_gradientBlock;
+    operator_type            M_divergenceBlock;
+    operator_type            M_pressureBlock;
+
+    operator_type            M_velocityMass;
+    operator_type            M_pressureMass;
+    operator_type            M_pressureLaplacian;
+    operator_type            M_pressureConvectionDiffusion;
+    operator_type            M_pressureOperator;
+
+    epetraVectorPtr_Type     M_velocityDiagonalInverse;
+    epetraVectorPtr_Type     M_pressureMassInverse;
+    Real                     M_schurSign;
+
+    preconditionerPtr_Type   M_velocityPreconditioner;
+    preconditionerPtr_Type   M_pressurePreconditioner;
+};
+
+inline Preconditioner* createSaddlePoint() { return new PreconditionerSaddlePoint(); }
+namespace
+{
+static bool registerSaddlePoint = PRECFactory::instance().registerProduct( "SaddlePoint", &createSaddlePoint );
+}
+
+} // namespace LifeV
+
+#endif /* PRECONDITIONERSADDLEPOINT_HPP */
@@ -0,0 +1,488 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Reduced basis (POD) solver for linear problems with an affine parametric dependence
+
+    @date 19-10-2012
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_LAPACK.h>
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/algorithm/ReducedBasisSolver.hpp>
+#include <lifev/core/util/LifeChrono.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+ReducedBasisSolver::ReducedBasisSolver( const commPtr_Type& comm ) :
+        M_displayer                   ( comm ),
+        M_podTolerance                ( 1e-6 ),
+        M_maxBasisSize                ( 50 ),
+        M_errorTolerance              ( 1e-4 ),
+        M_stabilityLowerBound         ( 0. ),
+        M_enrichOnFallback            ( false ),
+        M_innerProduct                (),
+        M_fullSolver                  (),
+        M_snapshots                   (),
+        M_basis                       (),
+        M_singularValues              (),
+        M_affineMatrices              (),
+        M_affineRightHandSides        (),
+        M_reducedMatrices             (),
+        M_reducedRightHandSides       (),
+        M_basisGram                   (),
+        M_rightHandSideProducts       (),
+        M_rightHandSideMatrixProducts (),
+        M_matrixProducts              (),
+        M_reducedSolution             (),
+        M_errorEstimate               ( 0. ),
+        M_numReducedSolves            ( 0 ),
+        M_numFullSolves               ( 0 )
+{
+}
+
+// ===================================================
+// Offline Methods
+// ===================================================
+
+void
+ReducedBasisSolver::addSnapshot( const vector_Type& snapshot )
+{
+    M_snapshots.push_back( vectorPtr_Type( new vector_Type( snapshot, Unique ) ) );
+}
+
+void
+ReducedBasisSolver::buildBasis()
+{
+    if ( M_snapshots.empty() )
+        ERROR_MSG( "ReducedBasisSolver: no snapshots to build the basis" );
+
+    LifeChrono chrono;
+    chrono.start();
+
+    M_displayer.leaderPrint( " RB-  Computing the POD basis ...              " );
+
+    const Int numSnapshots( M_snapshots.size() );
+
+    // Correlation matrix of the snapshots
+    denseMatrix_Type correlation;
+    innerProducts( M_snapshots, applyInnerProduct( M_snapshots ), correlation );
+
+    // Eigenvalues (in ascending order) and eigenvectors of the correlation matrix
+    Epetra_LAPACK lapack;
+    std::vector<Real> eigenvalues( numSnapshots );
+    const Int lwork( 3 * numSnapshots );
+    std::vector<Real> work( lwork );
+    Int info( 0 );
+
+    lapack.SYEV( 'V', 'U', numSnapshots, correlation.A(), correlation.LDA(), &eigenvalues[0], &work[0], lwork, &info );
+    if ( info != 0 )
+        ERROR_MSG( "ReducedBasisSolver: the eigenvalue problem of the correlation matrix failed" );
+
+    Real totalEnergy( 0. );
+    M_singularValues.clear();
+    for ( Int k( numSnapshots - 1 ); k >= 0; --k )
+    {
+        totalEnergy += std::max( eigenvalues[k], 0. );
+        M_singularValues.push_back( std::sqrt( std::max( eigenvalues[k], 0. ) ) );
+    }
+
+    // Modes, until the discarded energy is small enough
+    M_basis.clear();
+    Real discardedEnergy( totalEnergy );
+    for ( Int k( numSnapshots - 1 ); k >= 0; --k )
+    {
+        if ( M_basis.size() >= M_maxBasisSize
+             || discardedEnergy <= M_podTolerance * totalEnergy
+             || eigenvalues[k] <= std::numeric_limits<Real>::epsilon() * totalEnergy )
+            break;
+
+        vectorPtr_Type mode( new vector_Type( M_snapshots[0]->map(), Unique ) );
+        for ( Int j( 0 ); j < numSnapshots; ++j )
+            mode->epetraVector().Update( correlation( j, k ) / std::sqrt( eigenvalues[k] ), M_snapshots[j]->epetraVector(), 1. );
+
+        M_basis.push_back( mode );
+        discardedEnergy -= eigenvalues[k];
+    }
+
+    M_snapshots.clear();
+
+    chrono.stop();
+    M_displayer.leaderPrintMax( "done in ", chrono.diff() );
+    M_displayer.leaderPrint( " RB-  Basis functions:                        ", M_basis.size(), "\n" );
+}
+
+void
+ReducedBasisSolver::addAffineMatrix( const matrixPtr_Type& matrix )
+{
+    M_affineMatrices.push_back( matrix );
+}
+
+void
+ReducedBasisSolver::addAffineRightHandSide( const vectorPtr_Type& rightHandSide )
+{
+    M_affineRightHandSides.push_back( rightHandSide );
+}
+
+void
+ReducedBasisSolver::buildReducedOperators()
+{
+    if ( M_basis.empty() )
+        ERROR_MSG( "ReducedBasisSolver: the basis has not been built" );
+    if ( M_affineMatrices.empty() || M_affineRightHandSides.empty() )
+        ERROR_MSG( "ReducedBasisSolver: affine terms not set" );
+
+    LifeChrono chrono;
+    chrono.start();
+
+    M_displayer.leaderPrint( " RB-  Computing the reduced operators ...      " );
+
+    const UInt basisSize( M_basis.size() );
+    const UInt numMatrices( M_affineMatrices.size() );
+    const UInt numRightHandSides( M_affineRightHandSides.size() );
+
+    // Images of the basis functions through the affine matrices, A_q zeta_n in position q * N + n
+    vectorList_Type matrixBasis;
+    matrixBasis.reserve( numMatrices * basisSize );
+    for ( UInt q( 0 ); q < numMatrices; ++q )
+        for ( UInt n( 0 ); n < basisSize; ++n )
+            matrixBasis.push_back( vectorPtr_Type( new vector_Type( *M_affineMatrices[q] * *M_basis[n] ) ) );
+
+    // Reduced matrices
+    denseMatrix_Type projection;
+    innerProducts( M_basis, matrixBasis, projection );
+
+    M_reducedMatrices.assign( numMatrices, denseMatrix_Type() );
+    for ( UInt q( 0 ); q < numMatrices; ++q )
+    {
+        M_reducedMatrices[q].Shape( basisSize, basisSize );
+        for ( UInt m( 0 ); m < basisSize; ++m )
+            for ( UInt n( 0 ); n < basisSize; ++n )
+                M_reducedMatrices[q]( m, n ) = projection( m, q * basisSize + n );
+    }
+
+    // Reduced right hand sides
+    innerProducts( M_basis, M_affineRightHandSides, projection );
+
+    M_reducedRightHandSides.assign( numRightHandSides, denseVector_Type() );
+    for ( UInt q( 0 ); q < numRightHandSides; ++q )
+    {
+        M_reducedRightHandSides[q].Size( basisSize );
+        for ( UInt m( 0 ); m < basisSize; ++m )
+            M_reducedRightHandSides[q]( m ) = projection( m, q );
+    }
+
+    // Inner products for the norms of the solution and of the residual
+    innerProducts( M_basis, M_basis, M_basisGram );
+    innerProducts( M_affineRightHandSides, M_affineRightHandSides, M_rightHandSideProducts );
+    innerProducts( M_affineRightHandSides, matrixBasis, M_rightHandSideMatrixProducts );
+    innerProducts( matrixBasis, matrixBasis, M_matrixProducts );
+
+    chrono.stop();
+    M_displayer.leaderPrintMax( "done in ", chrono.diff() );
+}
+
+// ===================================================
+// Online Methods
+// ===================================================
+
+Real
+ReducedBasisSolver::solveReduced( const std::vector<Real>& matrixCoefficients,
+                                  const std::vector<Real>& rightHandSideCoefficients )
+{
+    if ( matrixCoefficients.size() != M_reducedMatrices.size() )
+        ERROR_MSG( "ReducedBasisSolver: wrong number of matrix coefficients" );
+    if ( rightHandSideCoefficients.size() != M_reducedRightHandSides.size() )
+        ERROR_MSG( "ReducedBasisSolver: wrong number of right hand side coefficients" );
+
+    const Int basisSize( M_basis.size() );
+    const UInt numMatrices( matrixCoefficients.size() );
+    const UInt numRightHandSides( rightHandSideCoefficients.size() );
+
+    // Reduced system
+    denseMatrix_Type reducedMatrix( basisSize, basisSize );
+    M_reducedSolution.Size( basisSize );
+
+    for ( UInt q( 0 ); q < numMatrices; ++q )
+        for ( Int n( 0 ); n < basisSize; ++n )
+            for ( Int m( 0 ); m < basisSize; ++m )
+                reducedMatrix( m, n ) += matrixCoefficients[q] * M_reducedMatrices[q]( m, n );
+
+    for ( UInt q( 0 ); q < numRightHandSides; ++q )
+        for ( Int m( 0 ); m < basisSize; ++m )
+            M_reducedSolution( m ) += rightHandSideCoefficients[q] * M_reducedRightHandSides[q]( m );
+
+    Epetra_LAPACK lapack;
+    std::vector<Int> pivots( basisSize );
+    Int info( 0 );
+
+    lapack.GESV( basisSize, 1, reducedMatrix.A(), reducedMatrix.LDA(), &pivots[0], M_reducedSolution.Values(), basisSize, &info );
+    if ( info != 0 )
+        ERROR_MSG( "ReducedBasisSolver: the reduced matrix is singular" );
+
+    // Norm of the residual: (f, f) - 2 (f, A Z u) + (A Z u, A Z u)
+    std::vector<Real> matrixBasisCoefficients( numMatrices * basisSize );
+    for ( UInt q( 0 ); q < numMatrices; ++q )
+        for ( Int n( 0 ); n < basisSize; ++n )
+            matrixBasisCoefficients[ q * basisSize + n ] = matrixCoefficients[q] * M_reducedSolution( n );
+
+    Real rightHandSideNorm2( 0. );
+    for ( UInt p( 0 ); p < numRightHandSides; ++p )
+        for ( UInt q( 0 ); q < numRightHandSides; ++q )
+            rightHandSideNorm2 += rightHandSideCoefficients[p] * rightHandSideCoefficients[q] * M_rightHandSideProducts( p, q );
+
+    Real residualNorm2( rightHandSideNorm2 );
+    for ( UInt p( 0 ); p < numRightHandSides; ++p )
+        for ( UInt j( 0 ); j < matrixBasisCoefficients.size(); ++j )
+            residualNorm2 -= 2. * rightHandSideCoefficients[p] * matrixBasisCoefficients[j] * M_rightHandSideMatrixProducts( p, j );
+
+    for ( UInt i( 0 ); i < matrixBasisCoefficients.size(); ++i )
+        for ( UInt j( 0 ); j < matrixBasisCoefficients.size(); ++j )
+            residualNorm2 += matrixBasisCoefficients[i] * matrixBasisCoefficients[j] * M_matrixProducts( i, j );
+
+    const Real residualNorm( std::sqrt( std::max( residualNorm2, 0. ) ) );
+
+    // Error estimate
+    Real referenceNorm( 0. );
+    if ( M_stabilityLowerBound > 0. )
+    {
+        Real solutionNorm2( 0. );
+        for ( Int m( 0 ); m < basisSize; ++m )
+            for ( Int n( 0 ); n < basisSize; ++n )
+                solutionNorm2 += M_reducedSolution( m ) * M_reducedSolution( n ) * M_basisGram( m, n );
+
+        referenceNorm = M_stabilityLowerBound * std::sqrt( std::max( solutionNorm2, 0. ) );
+    }
+    else
+        referenceNorm = std::sqrt( std::max( rightHandSideNorm2, 0. ) );
+
+    if ( referenceNorm > 0. )
+        M_errorEstimate = residualNorm / referenceNorm;
+    else
+        M_errorEstimate = ( residualNorm > 0. ) ? std::numeric_limits<Real>::max() : 0.;
+
+    return M_errorEstimate;
+}
+
+void
+ReducedBasisSolver::reconstruct( vector_Type& solution ) const
+{
+    solution *= 0.;
+    for ( UInt n( 0 ); n < M_basis.size(); ++n )
+        solution.epetraVector().Update( M_reducedSolution( n ), M_basis[n]->epetraVector(), 1. );
+}
+
+bool
+ReducedBasisSolver::solve( const std::vector<Real>& matrixCoefficients,
+                           const std::vector<Real>& rightHandSideCoefficients,
+                           vector_Type& solution )
+{
+    if ( solveReduced( matrixCoefficients, rightHandSideCoefficients ) <= M_errorTolerance )
+    {
+        reconstruct( solution );
+        ++M_numReducedSolves;
+        return true;
+    }
+
+    M_displayer.leaderPrint( " RB-  Error estimate above the tolerance:      ", M_errorEstimate, "\n" );
+
+    if ( !M_fullSolver.get() )
+    {
+        reconstruct( solution );
+        return false;
+    }
+
+    solveFull( matrixCoefficients, rightHandSideCoefficients, solution );
+    ++M_numFullSolves;
+    return false;
+}
+
+void
+ReducedBasisSolver::showMe( std::ostream& output ) const
+{
+    if ( M_displayer.isLeader() )
+    {
+        output << "ReducedBasisSolver" << std::endl
+               << "  Basis functions:        " << M_basis.size() << std::endl
+               << "  Affine matrices:        " << M_affineMatrices.size() << std::endl
+               << "  Affine right hand sides " << M_affineRightHandSides.size() << std::endl
+               << "  Reduced solves:         " << M_numReducedSolves << std::endl
+               << "  Full solves:            " << M_numFullSolves << std::endl;
+    }
+}
+
+// ===================================================
+// Set Methods
+// ===================================================
+
+void
+ReducedBasisSolver::setDataFromGetPot( const GetPot& dataFile, const std::string& section )
+{
+    M_podTolerance        = dataFile( ( section + "/podTolerance" ).data(), 1e-6 );
+    M_maxBasisSize        = dataFile( ( section + "/maxBasisSize" ).data(), 50 );
+    M_errorTolerance      = dataFile( ( section + "/errorTolerance" ).data(), 1e-4 );
+    M_stabilityLowerBound = dataFile( ( section + "/stabilityLowerBound" ).data(), 0. );
+    M_enrichOnFallback    = dataFile( ( section + "/enrichOnFallback" ).data(), false );
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+void
+ReducedBasisSolver::innerProducts( const vectorList_Type& left, const vectorList_Type& right, denseMatrix_Type& result ) const
+{
+    const Int numRows( left.size() );
+    const Int numColumns( right.size() );
+
+    result.Shape( numRows, numColumns );
+    if ( numRows == 0 || numColumns == 0 )
+        return;
+
+    // Local contributions, stored by columns as the dense matrix
+    std::vector<Real> localProducts( numRows * numColumns, 0. );
+    for ( Int j( 0 ); j < numColumns; ++j )
+    {
+        const Real* rightValues( right[j]->epetraVector()[0] );
+        const Int myLength( right[j]->epetraVector().MyLength() );
+
+        for ( Int i( 0 ); i < numRows; ++i )
+        {
+            ASSERT( left[i]->epetraVector().MyLength() == myLength, "ReducedBasisSolver: the vectors have different maps" );
+
+            const Real* leftValues( left[i]->epetraVector()[0] );
+            Real product( 0. );
+            for ( Int k( 0 ); k < myLength; ++k )
+                product += leftValues[k] * rightValues[k];
+
+            localProducts[ j * numRows + i ] = product;
+        }
+    }
+
+    // One reduction for all the products
+    M_displayer.comm()->SumAll( &localProducts[0], result.A(), numRows * numColumns );
+}
+
+ReducedBasisSolver::vectorList_Type
+ReducedBasisSolver::applyInnerProduct( const vectorList_Type& vectors ) const
+{
+    if ( !M_innerProduct.get() )
+        return vectors;
+
+    vectorList_Type images;
+    images.reserve( vectors.size() );
+    for ( UInt i( 0 ); i < vectors.size(); ++i )
+        images.push_back( vectorPtr_Type( new vector_Type( *M_innerProduct * *vectors[i] ) ) );
+
+    return images;
+}
+
+void
+ReducedBasisSolver::solveFull( const std::vector<Real>& matrixCoefficients,
+                               const std::vector<Real>& rightHandSideCoefficients,
+                               vector_Type& solution )
+{
+    LifeChrono chrono;
+    chrono.start();
+
+    M_displayer.leaderPrint( " RB-  Solving the full problem ...             \n" );
+
+    // Full system
+    matrixPtr_Type matrix( new matrix_Type( M_affineMatrices[0]->map() ) );
+    for ( UInt q( 0 ); q < M_affineMatrices.size(); ++q )
+        matrix->add( matrixCoefficients[q], *M_affineMatrices[q] );
+    matrix->globalAssemble();
+
+    vectorPtr_Type rightHandSide( new vector_Type( M_affineRightHandSides[0]->map(), Unique ) );
+    for ( UInt q( 0 ); q < M_affineRightHandSides.size(); ++q )
+        rightHandSide->epetraVector().Update( rightHandSideCoefficients[q], M_affineRightHandSides[q]->epetraVector(), 1. );
+
+    vectorPtr_Type fullSolution( new vector_Type( rightHandSide->map(), Unique ) );
+
+    M_fullSolver->setOperator( matrix );
+    M_fullSolver->setRightHandSide( rightHandSide );
+    M_fullSolver->solve( fullSolution );
+
+    solution = *fullSolution;
+
+    // Greedy enrichment of the basis
+    if ( M_enrichOnFallback && M_basis.size() < M_maxBasisSize )
+    {
+        addBasisFunction( *fullSolution );
+        buildReducedOperators();
+    }
+
+    chrono.stop();
+    M_displayer.leaderPrintMax( " RB-  Full problem solved in ", chrono.diff() );
+}
+
+void
+ReducedBasisSolver::addBasisFunction( const vector_Type& vector )
+{
+    vectorList_Type function( 1, vectorPtr_Type( new vector_Type( vector, Unique ) ) );
+
+    denseMatrix_Type norm;
+    innerProducts( function, applyInnerProduct( function ), norm );
+    const Real initialNorm2( norm( 0, 0 ) );
+
+    // Gram-Schmidt, twice for stability
+    denseMatrix_Type coefficients;
+    for ( UInt pass( 0 ); pass < 2; ++pass )
+    {
+        innerProducts( M_basis, applyInnerProduct( function ), coefficients );
+        for ( UInt n( 0 ); n < M_basis.size(); ++n )
+            function[0]->epetraVector().Update( -coefficients( n, 0 ), M_basis[n]->epetraVector(), 1. );
+    }
+
+    innerProducts( function, applyInnerProduct( function ), norm );
+
+    // The vector is already represented by the basis
+    if ( norm( 0, 0 ) <= std::numeric_limits<Real>::epsilon() * initialNorm2 )
+        return;
+
+    *function[0] *= 1. / std::sqrt( norm( 0, 0 ) );
+    M_basis.push_back( function[0] );
+}
+
+} // namespace LifeV
@@ -0,0 +1,327 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Reduced basis (POD) solver for linear problems with an affine parametric dependence
+
+    @date 19-10-2012
+ */
+
+#ifndef REDUCEDBASISSOLVER_HPP
+#define REDUCEDBASISSOLVER_HPP 1
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_SerialDenseMatrix.h>
+#include <Epetra_SerialDenseVector.h>
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <boost/shared_ptr.hpp>
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/filter/GetPot.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/algorithm/LinearSolver.hpp>
+#include <lifev/core/util/Displayer.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! ReducedBasisSolver - Offline/online reduced basis solver for parametric linear systems
+/*!
+  The class solves many instances of a linear system whose matrix and right hand side depend
+  affinely on a set of parameters:
+  \f[
+  A(\mu) = \sum_{q=1}^{Q_a} \theta^a_q(\mu) A_q, \qquad f(\mu) = \sum_{q=1}^{Q_f} \theta^f_q(\mu) f_q,
+  \f]
+  e.g. the ADR problems assembled with ADRAssembler (one matrix for each diffusion coefficient of a
+  subdomain, for the advection, ...) or the hybrid systems of DarcySolverLinear (see matrixPtr()
+  and rightHandSidePtr() there).
+
+  <b>Offline stage.</b> The solutions of the full problem for a set of training parameters are
+  given with addSnapshot(). buildBasis() computes the POD basis \f$ Z = [\zeta_1 \dots \zeta_N] \f$
+  by the method of snapshots: the correlation matrix of the snapshots is computed with a single
+  reduction over the processors, and its (small) eigenvalue problem is solved by LAPACK on each
+  processor. The basis is truncated when the relative energy of the discarded modes is below
+  the POD tolerance, or when it reaches the maximum size. The affine terms are then given with
+  addAffineMatrix() and addAffineRightHandSide(), and buildReducedOperators() projects them
+  \f$ A^N_q = Z^T A_q Z \f$, \f$ f^N_q = Z^T f_q \f$ and stores the inner products needed
+  by the error estimate.
+
+  <b>Online stage.</b> For a new parameter, only the coefficients \f$ \theta^a_q, \theta^f_q \f$ are given:
+  solveReduced() solves the dense \f$ N \times N \f$ system and computes the norm of the residual
+  of the full problem without any operation of the size of the full problem:
+  \f[
+  \Delta(\mu) = \frac{\| f(\mu) - A(\mu) Z u_N(\mu) \|}{\alpha_{LB} \| Z u_N(\mu) \|},
+  \f]
+  which bounds the relative error (in the euclidean norm) when \f$ \alpha_{LB} \f$ is a lower bound of the
+  coercivity constant of \f$ A(\mu) \f$. When no lower bound is given, the relative residual
+  \f$ \| r(\mu) \| / \| f(\mu) \| \f$ is used instead. solve() reconstructs the full solution
+  \f$ Z u_N \f$ if the estimate is below the tolerance, otherwise it falls back to the full solver on
+  \f$ A(\mu) \f$ and \f$ f(\mu) \f$; the full solution can then be added to the basis.
+
+  Since the residual is computed by expanding its norm, the estimate cannot be smaller than about
+  the square root of the machine precision times the norm of the right hand side.
+
+  The boundary conditions have to be consistent with the affine decomposition, e.g. by imposing
+  homogeneous Dirichlet conditions on all the matrices (with a lifting of the data in the right hand sides).
+
+  The parameters are read from the data file:
+  \code
+  [reducedBasis]
+      podTolerance        = 1e-6   # relative energy of the discarded POD modes
+      maxBasisSize        = 50
+      errorTolerance      = 1e-4   # tolerance on the error estimate, above which the full solver is used
+      stabilityLowerBound = 0.     # lower bound of the coercivity constant (0: relative residual)
+      enrichOnFallback    = false  # add the full solutions to the basis
+  \endcode
+ */
+class ReducedBasisSolver
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef MatrixEpetra<Real>                  matrix_Type;
+    typedef boost::shared_ptr<matrix_Type>      matrixPtr_Type;
+    typedef VectorEpetra                        vector_Type;
+    typedef boost::shared_ptr<vector_Type>      vectorPtr_Type;
+    typedef std::vector<vectorPtr_Type>         vectorList_Type;
+
+    typedef Epetra_SerialDenseMatrix            denseMatrix_Type;
+    typedef Epetra_SerialDenseVector            denseVector_Type;
+
+    typedef LinearSolver                        solver_Type;
+    typedef boost::shared_ptr<solver_Type>      solverPtr_Type;
+
+    typedef Displayer::commPtr_Type             commPtr_Type;
+
+    //@}
+
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param comm Communicator
+     */
+    ReducedBasisSolver( const commPtr_Type& comm );
+
+    //! Destructor
+    virtual ~ReducedBasisSolver() {}
+
+    //@}
+
+
+    //! @name Offline Methods
+    //@{
+
+    //! Add a solution of the full problem to the snapshots
+    void addSnapshot( const vector_Type& snapshot );
+
+    //! Compute the POD basis from the snapshots
+    /*!
+      The snapshots are released once the basis has been computed.
+     */
+    void buildBasis();
+
+    //! Add a matrix of the affine decomposition of the operator
+    void addAffineMatrix( const matrixPtr_Type& matrix );
+
+    //! Add a vector of the affine decomposition of the right hand side
+    void addAffineRightHandSide( const vectorPtr_Type& rightHandSide );
+
+    //! Project the affine terms on the basis and compute the quantities used by the error estimate
+    void buildReducedOperators();
+
+    //@}
+
+
+    //! @name Online Methods
+    //@{
+
+    //! Solve the reduced problem
+    /*!
+      @param matrixCoefficients Coefficients of the affine matrices
+      @param rightHandSideCoefficients Coefficients of the affine right hand sides
+      @return The error estimate
+     */
+    Real solveReduced( const std::vector<Real>& matrixCoefficients,
+                       const std::vector<Real>& rightHandSideCoefficients );
+
+    //! Compute the full solution corresponding to the last reduced solution
+    void reconstruct( vector_Type& solution ) const;
+
+    //! Solve the problem, using the reduced basis when the error estimate is small enough
+    /*!
+      When the error estimate is above the tolerance, the full problem is solved (see setFullSolver())
+      and, if required, its solution is added to the basis. If no full solver is set, the reduced
+      solution is returned anyway.
+      @param matrixCoefficients Coefficients of the affine matrices
+      @param rightHandSideCoefficients Coefficients of the affine right hand sides
+      @param solution Output, full solution
+      @return true if the reduced solution has been accepted
+     */
+    bool solve( const std::vector<Real>& matrixCoefficients,
+                const std::vector<Real>& rightHandSideCoefficients,
+                vector_Type& solution );
+
+    //! Display the size of the basis and the number of reduced and full solves
+    void showMe( std::ostream& output = std::cout ) const;
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the parameters using a GetPot object
+    /*!
+      @param dataFile A GetPot object containing the data
+      @param section The section in "dataFile" where to find the parameters
+     */
+    void setDataFromGetPot( const GetPot& dataFile, const std::string& section );
+
+    //! Set the matrix of the inner product used by the POD (the euclidean one by default)
+    void setInnerProduct( const matrixPtr_Type& innerProduct ) { M_innerProduct = innerProduct; }
+
+    //! Set the linear solver of the full problem, used when the error estimate is too large
+    void setFullSolver( const solverPtr_Type& fullSolver ) { M_fullSolver = fullSolver; }
+
+    void setPODTolerance( const Real& podTolerance ) { M_podTolerance = podTolerance; }
+
+    void setMaxBasisSize( const UInt& maxBasisSize ) { M_maxBasisSize = maxBasisSize; }
+
+    void setErrorTolerance( const Real& errorTolerance ) { M_errorTolerance = errorTolerance; }
+
+    void setStabilityLowerBound( const Real& stabilityLowerBound ) { M_stabilityLowerBound = stabilityLowerBound; }
+
+    void setEnrichOnFallback( const bool& enrichOnFallback ) { M_enrichOnFallback = enrichOnFallback; }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of basis functions
+    UInt basisSize() const { return M_basis.size(); }
+
+    //! Basis functions
+    const vectorList_Type& basis() const { return M_basis; }
+
+    //! Singular values of the matrix of the snapshots, in decreasing order
+    const std::vector<Real>& singularValues() const { return M_singularValues; }
+
+    //! Coefficients of the last reduced solution
+    const denseVector_Type& reducedSolution() const { return M_reducedSolution; }
+
+    //! Error estimate of the last reduced solution
+    const Real& errorEstimate() const { return M_errorEstimate; }
+
+    //! Number of problems solved with the reduced basis
+    const UInt& numReducedSolves() const { return M_numReducedSolves; }
+
+    //! Number of problems solved with the full solver
+    const UInt& numFullSolves() const { return M_numFullSolves; }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    //! Inner products between two lists of vectors, computed with a single reduction
+    /*!
+      @param left Vectors of the rows
+      @param right Vectors of the columns
+      @param result Output, (left[i], right[j]) in position (i, j)
+     */
+    void innerProducts( const vectorList_Type& left, const vectorList_Type& right, denseMatrix_Type& result ) const;
+
+    //! Apply the inner product matrix to the vectors (the vectors themselves if not set)
+    vectorList_Type applyInnerProduct( const vectorList_Type& vectors ) const;
+
+    //! Solve the full problem and possibly add its solution to the basis
+    void solveFull( const std::vector<Real>& matrixCoefficients,
+                    const std::vector<Real>& rightHandSideCoefficients,
+                    vector_Type& solution );
+
+    //! Orthonormalize a vector against the basis and add it
+    void addBasisFunction( const vector_Type& vector );
+
+    //@}
+
+    Displayer                M_displayer;
+
+    Real                     M_podTolerance;
+    UInt                     M_maxBasisSize;
+    Real                     M_errorTolerance;
+    Real                     M_stabilityLowerBound;
+    bool                     M_enrichOnFallback;
+
+    matrixPtr_Type           M_innerProduct;
+    solverPtr_Type           M_fullSolver;
+
+    // Offline data
+    vectorList_Type          M_snapshots;
+    vectorList_Type          M_basis;
+    std::vector<Real>        M_singularValues;
+    std::vector<matrixPtr_Type> M_affineMatrices;
+    vectorList_Type          M_affineRightHandSides;
+
+    // Reduced operators
+    std::vector<denseMatrix_Type> M_reducedMatrices;
+    std::vector<denseVector_Type> M_reducedRightHandSides;
+    denseMatrix_Type         M_basisGram;
+
+    // Inner products for the error estimate
+    denseMatrix_Type         M_rightHandSideProducts;
+    denseMatrix_Type         M_rightHandSideMatrixProducts;
+    denseMatrix_Type         M_matrixProducts;
+
+    // Online data
+    denseVector_Type         M_reducedSolution;
+    Real                     M_errorEstimate;
+    UInt                     M_numReducedSolves;
+    UInt                     M_numFullSolves;
+};
+
+} // namespace LifeV
+
+#endif /* REDUCEDBASISSOLVER_HPP */
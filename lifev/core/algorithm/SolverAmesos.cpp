@@ -40,6 +40,8 @@
 #include <lifev/core/util/LifeChrono.hpp>
 #include <lifev/core/filter/GetPot.hpp>
 
+#include <sstream>
+
 namespace LifeV
 {
 
@@ -51,7 +53,10 @@ SolverAmesos::SolverAmesos( const commPtr_Type& comm ) :
         M_problem              (),
         M_solver               (),
         M_trilinosParameterList(),
-        M_displayer            ( comm )
+        M_displayer            ( comm ),
+        M_reuseFactorization   ( true ),
+        M_numSymbolicFactorizations( 0 ),
+        M_numNumericFactorizations ( 0 )
 {
 }
 
@@ -98,6 +103,63 @@ SolverAmesos::solveSystem( vector_type&    rhsFull,
     return 0;
 }
 
+Int
+SolverAmesos::solveSystem( const std::vector<vector_ptrtype>& rhsFull,
+                           std::vector<vector_ptrtype>&       solution )
+{
+    ASSERT( rhsFull.size() == solution.size(), "SolverAmesos::solveSystem: different numbers of right hand sides and solutions" );
+
+    const Int numVectors( rhsFull.size() );
+    if ( numVectors == 0 )
+        return 0;
+
+    // Gather the vectors in multivectors, to solve all the systems at once
+    const Epetra_BlockMap& map( rhsFull[0]->epetraVector().Map() );
+    Epetra_MultiVector rhs( map, numVectors );
+    Epetra_MultiVector lhs( map, numVectors );
+
+    for ( Int i( 0 ); i < numVectors; ++i )
+    {
+        rhs( i )->Update( 1., *rhsFull[i]->epetraVector()( 0 ), 0. );
+        lhs( i )->Update( 1., *solution[i]->epetraVector()( 0 ), 0. );
+    }
+
+    const Int error( solveSystem( rhs, lhs ) );
+
+    for ( Int i( 0 ); i < numVectors; ++i )
+        solution[i]->epetraVector()( 0 )->Update( 1., *lhs( i ), 0. );
+
+    return error;
+}
+
+Int
+SolverAmesos::solveSystem( Epetra_MultiVector& rhsFull,
+                           Epetra_MultiVector& solution )
+{
+    bool verbose = M_trilinosParameterList.get( "Verbose", true );
+    if ( verbose )
+    {
+        std::ostringstream message;
+        message << "SLV-  Amesos solving " << rhsFull.NumVectors() << " systems ...           ";
+        M_displayer.leaderPrint( message.str() );
+    }
+
+    LifeChrono chrono;
+    chrono.start();
+
+    M_problem.SetLHS( &solution );
+    M_problem.SetRHS( &rhsFull );
+
+    AMESOS_CHK_ERR( M_solver->Solve() );
+
+    chrono.stop();
+
+    if ( verbose )
+        M_displayer.leaderPrintMax( "done in " , chrono.diff() );
+
+    return 0;
+}
+
 void
 SolverAmesos::printStatus()
 {
@@ -161,16 +223,50 @@ void SolverAmesos::showMe( std::ostream& output ) const
 // ===================================================
 Int SolverAmesos::setMatrix( const matrix_type& matrix )
 {
-    M_matrix = matrix.matrixPtr();
-    M_problem.SetOperator( M_matrix.get() );
+    if ( !M_reuseFactorization )
+    {
+        M_matrix = matrix.matrixPtr();
+        M_problem.SetOperator( M_matrix.get() );
+
+        // After setting the matrix we can perform symbolic & numeric factorization
+        AMESOS_CHK_ERR( factorize( true ) );
 
-    // After setting the matrix we can perform symbolic & numeric factorization
-    AMESOS_CHK_ERR( M_solver->SymbolicFactorization() );
-    AMESOS_CHK_ERR( M_solver->NumericFactorization() );
+        return 0;
+    }
+
+    switch ( matrixChange( *matrix.matrixPtr() ) )
+    {
+    case 2:
+        // New pattern: the solver works on its own copy of the matrix
+        M_matrix.reset( new matrix_type::matrix_type( *matrix.matrixPtr() ) );
+        M_problem.SetOperator( M_matrix.get() );
+
+        AMESOS_CHK_ERR( factorize( true ) );
+        break;
+
+    case 1:
+        // Same pattern: the symbolic factorization is still valid
+        copyMatrixValues( *matrix.matrixPtr() );
+
+        AMESOS_CHK_ERR( factorize( false ) );
+        break;
+
+    default:
+        // Same matrix: the factorization is still valid
+        break;
+    }
 
     return 0;
 }
 
+void SolverAmesos::setReuseFactorization( const bool& reuseFactorization )
+{
+    M_reuseFactorization = reuseFactorization;
+
+    // The stored matrix may be the one of the user: the next matrix is factorized anyway
+    M_matrix.reset();
+}
+
 void SolverAmesos::setOperator( const Epetra_Operator& /*oper*/ )
 {
     ASSERT( false, "SolverAmesos::setOperator: not coded" );
@@ -198,6 +294,9 @@ void SolverAmesos::setDataFromGetPot( const GetPot& dataFile, const std::string&
 
     // Type of the solver
     M_trilinosParameterList.set( "SolverType", dataFile( ( section + "/amesos/solvertype"  ).data(), "Klu" ) );
+
+    // Reuse of the factorizations when the matrix does not change
+    setReuseFactorization( dataFile( ( section + "/amesos/reuse_factorization" ).data(), true ) );
 }
 
 void SolverAmesos::setParameters()
@@ -249,5 +348,98 @@ void SolverAmesos::createSolver( const std::string& solverType )
     }
 }
 
+Int SolverAmesos::matrixChange( const matrix_type::matrix_type& matrix ) const
+{
+    Int localChange( 0 );
+
+    // SameAs is collective, it must be called by all the processors
+    if ( !M_matrix.get() || !M_matrix->RowMap().SameAs( matrix.RowMap() )
+         || M_matrix->NumMyNonzeros() != matrix.NumMyNonzeros() )
+    {
+        localChange = 2;
+    }
+
+    Int numEntries( 0 ), storedNumEntries( 0 );
+    Real* values( 0 );
+    Real* storedValues( 0 );
+    Int* indices( 0 );
+    Int* storedIndices( 0 );
+
+    for ( Int iRow( 0 ); localChange < 2 && iRow < matrix.NumMyRows(); ++iRow )
+    {
+        matrix.ExtractMyRowView( iRow, numEntries, values, indices );
+        M_matrix->ExtractMyRowView( iRow, storedNumEntries, storedValues, storedIndices );
+
+        if ( numEntries != storedNumEntries )
+        {
+            localChange = 2;
+            break;
+        }
+
+        for ( Int i( 0 ); i < numEntries; ++i )
+        {
+            if ( matrix.ColMap().GID( indices[i] ) != M_matrix->ColMap().GID( storedIndices[i] ) )
+            {
+                localChange = 2;
+                break;
+            }
+            if ( values[i] != storedValues[i] )
+                localChange = 1;
+        }
+    }
+
+    Int change( 0 );
+    M_displayer.comm()->MaxAll( &localChange, &change, 1 );
+
+    return change;
+}
+
+Int SolverAmesos::factorize( const bool& symbolic )
+{
+    Int error( 0 );
+
+    if ( symbolic )
+    {
+        error = M_solver->SymbolicFactorization();
+        if ( error == 0 )
+            ++M_numSymbolicFactorizations;
+    }
+
+    if ( error == 0 )
+    {
+        error = M_solver->NumericFactorization();
+        if ( error == 0 )
+            ++M_numNumericFactorizations;
+    }
+
+    if ( error != 0 )
+    {
+        // The factors do not match the stored matrix: forget it, so that the next matrix
+        // is factorized again even if it is the same
+        M_problem.SetOperator( static_cast<Epetra_RowMatrix*>( 0 ) );
+        M_matrix.reset();
+    }
+
+    return error;
+}
+
+void SolverAmesos::copyMatrixValues( const matrix_type::matrix_type& matrix )
+{
+    Int numEntries( 0 ), storedNumEntries( 0 );
+    Real* values( 0 );
+    Real* storedValues( 0 );
+    Int* indices( 0 );
+    Int* storedIndices( 0 );
+
+    for ( Int iRow( 0 ); iRow < matrix.NumMyRows(); ++iRow )
+    {
+        matrix.ExtractMyRowView( iRow, numEntries, values, indices );
+        M_matrix->ExtractMyRowView( iRow, storedNumEntries, storedValues, storedIndices );
+
+        for ( Int i( 0 ); i < numEntries; ++i )
+            storedValues[i] = values[i];
+    }
+}
+
 } // namespace LifeV
 
@@ -55,6 +55,8 @@
 #include <lifev/core/array/MatrixEpetra.hpp>
 #include <lifev/core/util/Displayer.hpp>
 
+#include <vector>
+
 class GetPot;
 
 namespace LifeV
@@ -64,6 +66,12 @@ namespace LifeV
 /*!
   @author Simone Deparis   <simone.deparis@epfl.ch>
   @author Gilles Fourestey <gilles.fourestey@epfl.ch>
+
+  When the reuse of the factorization is enabled (default), the solver keeps its own copy of the
+  matrix and setMatrix compares the new matrix with it: if the sparsity pattern is the same, the
+  symbolic factorization is kept and only the values are copied and factorized again; if also
+  the values are the same, the numeric factorization is kept as well. If a factorization fails,
+  the copy is released and the next matrix is factorized from scratch.
 */
 class SolverAmesos
 {
@@ -125,6 +133,23 @@ public:
                      vector_type&    solution,
                      const matrix_ptrtype& /* unused */ );
 
+    //! Solves several systems with the same matrix
+    /*!
+      All the right hand sides are solved with a single call to the direct solver.
+      @param  rhsFull Right hand side vectors
+      @param  solution Vectors to store the solutions
+    */
+    Int solveSystem( const std::vector<vector_ptrtype>& rhsFull,
+                     std::vector<vector_ptrtype>&       solution );
+
+    //! Solves the systems whose right hand sides are the columns of a multivector
+    /*!
+      @param  rhsFull Right hand side vectors
+      @param  solution Multivector to store the solutions
+    */
+    Int solveSystem( Epetra_MultiVector& rhsFull,
+                     Epetra_MultiVector& solution );
+
     //! Display status of the solver
     void printStatus();
 
@@ -166,10 +191,19 @@ public:
 
     //! Set matrix from MatrixEpetra
     /*!
+      The matrix is factorized, unless the factorization of the previous matrix can be reused
+      (see setReuseFactorization).
       @param matrix Matrix of the system
      */
     Int setMatrix( const matrix_type& matrix );
 
+    //! Specify if the factorizations should be reused when the matrix does not change
+    /*!
+      @param reuseFactorization If set to true, the solver stores a copy of the matrix to detect
+             the changes of its pattern and of its values
+     */
+    void setReuseFactorization( const bool& reuseFactorization );
+
     //! Method to set a general linear operator (of class derived from Epetra_Operator) defining the linear system
     /*!
       @param oper Operator for the system
@@ -227,6 +261,12 @@ public:
     //! Return the true residual
     Real trueResidual();
 
+    //! Return the number of symbolic factorizations performed
+    const UInt& numSymbolicFactorizations() const { return M_numSymbolicFactorizations; }
+
+    //! Return the number of numeric factorizations performed
+    const UInt& numNumericFactorizations() const { return M_numNumericFactorizations; }
+
     //! Get the current parameters list
     /*!
      * @return Teuchos parameters list
@@ -246,6 +286,25 @@ private:
      */
     void createSolver( const std::string& solverType );
 
+    //! Compare a matrix with the stored one
+    /*!
+      The result is the same on all the processors.
+      @param matrix Matrix to compare
+      @return 0 if the matrices are equal, 1 if only the values differ, 2 if the patterns differ
+     */
+    Int matrixChange( const matrix_type::matrix_type& matrix ) const;
+
+    //! Factorize the stored matrix
+    /*!
+      If a factorization fails, the stored matrix is released.
+      @param symbolic If set to true, the symbolic factorization is performed before the numeric one
+      @return the Amesos error code, 0 on success
+     */
+    Int factorize( const bool& symbolic );
+
+    //! Copy the values of a matrix with the same pattern in the stored one
+    void copyMatrixValues( const matrix_type::matrix_type& matrix );
+
     //@}
 
     matrix_type::matrix_ptrtype M_matrix;
@@ -257,6 +316,12 @@ private:
     Teuchos::ParameterList      M_trilinosParameterList;
 
     Displayer                   M_displayer;
+
+    bool                        M_reuseFactorization;
+
+    UInt                        M_numSymbolicFactorizations;
+
+    UInt                        M_numNumericFactorizations;
 };
 
 } // namespace LifeV
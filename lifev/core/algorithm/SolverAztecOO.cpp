@@ -53,7 +53,8 @@ SolverAztecOO::SolverAztecOO() :
         M_tolerance            ( 0. ),
         M_maxIter              ( 0 ),
         M_maxIterForReuse      ( 0 ),
-        M_reusePreconditioner  (false)
+        M_reusePreconditioner  (false),
+        M_recomputePreconditionerValues( false )
 {
 	if( M_displayer->isLeader() )
 	{
@@ -70,7 +71,8 @@ SolverAztecOO::SolverAztecOO( const boost::shared_ptr<Epetra_Comm>& comm ) :
         M_tolerance            ( 0. ),
         M_maxIter              ( 0 ),
         M_maxIterForReuse      ( 0 ),
-        M_reusePreconditioner  (false)
+        M_reusePreconditioner  (false),
+        M_recomputePreconditionerValues( false )
 {
 	if( M_displayer->isLeader() )
 	{
@@ -210,6 +212,8 @@ Int SolverAztecOO::solveSystem( const vector_type& rhsFull,
         M_displayer->leaderPrint( "SLV-  maxIterSolver = " , M_maxIter );
         M_displayer->leaderPrint( "SLV-  retrying:          " );
 
+        // The preconditioner is built from scratch
+        resetPreconditioner();
         buildPreconditioner( baseMatrixForPreconditioner );
 
         chrono.stop();
@@ -244,9 +248,18 @@ void SolverAztecOO::buildPreconditioner( matrix_ptrtype& preconditioner )
 
     chrono.start();
 
-    M_displayer->leaderPrint( "SLV-  Computing the precond ...                " );
+    if ( M_recomputePreconditionerValues && isPreconditionerSet() )
+    {
+        M_displayer->leaderPrint( "SLV-  Recomputing the precond values ...       " );
 
-    M_preconditioner->buildPreconditioner( preconditioner );
+        M_preconditioner->recomputePreconditioner( preconditioner );
+    }
+    else
+    {
+        M_displayer->leaderPrint( "SLV-  Computing the precond ...                " );
+
+        M_preconditioner->buildPreconditioner( preconditioner );
+    }
 
     condest = M_preconditioner->condest();
     chrono.stop();
@@ -330,6 +343,7 @@ SolverAztecOO::setDataFromGetPot( const GetPot& dataFile, const std::string& sec
     M_maxIter         = dataFile( ( section + "/max_iter"      ).data(), 200 );
     M_maxIterForReuse = dataFile( ( section + "/max_iter_reuse").data(), static_cast<Int> ( M_maxIter*8./10.) );
     M_reusePreconditioner = dataFile( (section + "/reuse").data(), M_reusePreconditioner );
+    M_recomputePreconditionerValues = dataFile( (section + "/recompute_values").data(), M_recomputePreconditionerValues );
 
     M_TrilinosParameterList.set( "max_iter", M_maxIter );
 
@@ -381,6 +395,12 @@ SolverAztecOO::setReusePreconditioner( const bool reusePreconditioner )
     M_reusePreconditioner = reusePreconditioner;
 }
 
+void
+SolverAztecOO::setRecomputePreconditionerValues( const bool recomputePreconditionerValues )
+{
+    M_recomputePreconditionerValues = recomputePreconditionerValues;
+}
+
 boost::shared_ptr<Displayer>
 SolverAztecOO::displayer()
 {
@@ -260,6 +260,14 @@ public:
      */
     void setReusePreconditioner( const bool reusePreconditioner );
 
+    //! Specify if the preconditioner should be recomputed keeping the setup that depends only on the matrix pattern
+    /*!
+      When the preconditioner is not reused, it is recomputed with Preconditioner::recomputePreconditioner
+      instead of being built from scratch, unless it has been reset.
+      @param recomputePreconditionerValues If set to true, recompute only the values of the preconditioner
+     */
+    void setRecomputePreconditionerValues( const bool recomputePreconditionerValues );
+
     //! Return the displayer
     boost::shared_ptr<Displayer> displayer();
 
@@ -305,6 +313,7 @@ private:
     Int                          M_maxIter;
     Int                          M_maxIterForReuse;
     bool                         M_reusePreconditioner;
+    bool                         M_recomputePreconditionerValues;
 };
 
 template <typename PrecPtrOperator>
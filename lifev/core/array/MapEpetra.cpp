@@ -43,6 +43,7 @@
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 
 #include <Epetra_Util.h>
+#include <Epetra_Distributor.h>
 
 // Tell the compiler to ignore specific kind of warnings:
 #pragma GCC diagnostic warning "-Wunused-variable"
@@ -51,6 +52,8 @@
 #include <lifev/core/LifeV.hpp>
 #include <lifev/core/array/MapEpetra.hpp>
 
+#include <sstream>
+
 namespace LifeV
 {
 
@@ -62,7 +65,11 @@ MapEpetra::MapEpetra():
     M_uniqueMapEpetra(),
     M_exporter(),
     M_importer(),
-    M_commPtr()
+    M_commPtr(),
+    M_sendBuffer(),
+    M_receiveBuffer(),
+    M_receivePointer( 0 ),
+    M_receiveLength( 0 )
 {}
 
 MapEpetra::MapEpetra( Int  numGlobalElements,
@@ -73,7 +80,11 @@ MapEpetra::MapEpetra( Int  numGlobalElements,
     M_uniqueMapEpetra(),
     M_exporter(),
     M_importer(),
-    M_commPtr( commPtr )
+    M_commPtr( commPtr ),
+    M_sendBuffer(),
+    M_receiveBuffer(),
+    M_receivePointer( 0 ),
+    M_receiveLength( 0 )
 {
 
     //Sort MyGlobalElements to avoid a bug in Trilinos (9?) when multiplying two matrices (A * B^T)
@@ -93,7 +104,11 @@ MapEpetra::MapEpetra( const Int numGlobalElements,
     M_uniqueMapEpetra(),
     M_exporter(),
     M_importer(),
-    M_commPtr( commPtr )
+    M_commPtr( commPtr ),
+    M_sendBuffer(),
+    M_receiveBuffer(),
+    M_receivePointer( 0 ),
+    M_receiveLength( 0 )
 {
     std::vector<Int> myGlobalElements( numGlobalElements );
 
@@ -110,7 +125,11 @@ MapEpetra::MapEpetra( const Int           size,
     M_uniqueMapEpetra(),
     M_exporter(),
     M_importer(),
-    M_commPtr( commPtr )
+    M_commPtr( commPtr ),
+    M_sendBuffer(),
+    M_receiveBuffer(),
+    M_receivePointer( 0 ),
+    M_receiveLength( 0 )
 {
     Int numGlobalElements( size );
     Int numMyElements    ( numGlobalElements );
@@ -138,7 +157,11 @@ MapEpetra::MapEpetra( const map_type map ):
     M_uniqueMapEpetra(),
     M_exporter(),
     M_importer(),
-    M_commPtr()
+    M_commPtr(),
+    M_sendBuffer(),
+    M_receiveBuffer(),
+    M_receivePointer( 0 ),
+    M_receiveLength( 0 )
 {
     uniqueMap();
 }
@@ -148,7 +171,11 @@ MapEpetra::MapEpetra( const Epetra_BlockMap& blockMap, const Int offset, const I
     M_uniqueMapEpetra(),
     M_exporter(),
     M_importer(),
-    M_commPtr()
+    M_commPtr(),
+    M_sendBuffer(),
+    M_receiveBuffer(),
+    M_receivePointer( 0 ),
+    M_receiveLength( 0 )
 {
     std::vector<Int> myGlobalElements;
     Int* sourceGlobalElements( blockMap.MyGlobalElements() );
@@ -300,6 +327,39 @@ MapEpetra::showMe( std::ostream& output ) const
     output << "showMe must be implemented for the MapEpetra class" << std::endl;
 }
 
+void
+MapEpetra::beginImport( const Epetra_MultiVector& uniqueVector, Epetra_MultiVector& repeatedVector )
+{
+    ASSERT( uniqueVector.Map().SameAs( *getUniqueMap() ), "The source vector must be based on the unique map!" );
+    ASSERT( repeatedVector.Map().SameAs( *getRepeatedMap() ), "The target vector must be based on the repeated map!" );
+
+    // The importer transfers from the unique map to the repeated map
+    beginTransfer( importer(), uniqueVector, repeatedVector, Insert );
+}
+
+void
+MapEpetra::endImport( Epetra_MultiVector& repeatedVector )
+{
+    endTransfer( importer(), repeatedVector, Insert );
+}
+
+void
+MapEpetra::beginExport( const Epetra_MultiVector& repeatedVector, Epetra_MultiVector& uniqueVector,
+                        const Epetra_CombineMode& combineMode )
+{
+    ASSERT( repeatedVector.Map().SameAs( *getRepeatedMap() ), "The source vector must be based on the repeated map!" );
+    ASSERT( uniqueVector.Map().SameAs( *getUniqueMap() ), "The target vector must be based on the unique map!" );
+
+    // The exporter transfers from the repeated map to the unique map
+    beginTransfer( exporter(), repeatedVector, uniqueVector, combineMode );
+}
+
+void
+MapEpetra::endExport( Epetra_MultiVector& uniqueVector, const Epetra_CombineMode& combineMode )
+{
+    endTransfer( exporter(), uniqueVector, combineMode );
+}
+
 // ===================================================
 // Get Methods
 // ===================================================
@@ -338,7 +398,12 @@ MapEpetra::MapEpetra( const MapEpetra& epetraMap ) :
     M_repeatedMapEpetra(),
     M_uniqueMapEpetra(),
     M_exporter(),
-    M_importer()
+    M_importer(),
+    M_commPtr(),
+    M_sendBuffer(),
+    M_receiveBuffer(),
+    M_receivePointer( 0 ),
+    M_receiveLength( 0 )
 {
     this->operator=( epetraMap );
 }
@@ -397,6 +462,111 @@ MapEpetra::createImportExport()
 
 }
 
+template <typename TransferType>
+void
+MapEpetra::beginTransfer( const TransferType& transfer, const Epetra_MultiVector& source,
+                          Epetra_MultiVector& target, const Epetra_CombineMode& combineMode )
+{
+    ASSERT( combineMode == Add || combineMode == Insert, "Only the Add and Insert combine modes are supported!" );
+    ASSERT( M_receivePointer == 0, "A split-phase exchange is already pending on this map!" );
+
+    const Int numVectors( source.NumVectors() );
+
+    // The values that stay on the process: first the same IDs, then the permuted ones
+    for ( Int iVector( 0 ); iVector < numVectors; ++iVector )
+    {
+        const Real* sourceValues( source[iVector] );
+        Real* targetValues( target[iVector] );
+
+        for ( Int i( 0 ); i < transfer.NumSameIDs(); ++i )
+        {
+            if ( combineMode == Add )
+                targetValues[i] += sourceValues[i];
+            else
+                targetValues[i] = sourceValues[i];
+        }
+
+        for ( Int i( 0 ); i < transfer.NumPermuteIDs(); ++i )
+        {
+            if ( combineMode == Add )
+                targetValues[ transfer.PermuteToLIDs()[i] ] += sourceValues[ transfer.PermuteFromLIDs()[i] ];
+            else
+                targetValues[ transfer.PermuteToLIDs()[i] ] = sourceValues[ transfer.PermuteFromLIDs()[i] ];
+        }
+    }
+
+    // Pack the values for the other processes, the values of one ID are contiguous
+    M_sendBuffer.resize( std::max( transfer.NumExportIDs() * numVectors, 1 ) );
+    for ( Int i( 0 ); i < transfer.NumExportIDs(); ++i )
+    {
+        for ( Int iVector( 0 ); iVector < numVectors; ++iVector )
+        {
+            M_sendBuffer[ i * numVectors + iVector ] = source[iVector][ transfer.ExportLIDs()[i] ];
+        }
+    }
+
+    // The buffer is large enough for the distributor not to allocate a new one
+    M_receiveBuffer.resize( std::max( transfer.NumRemoteIDs() * numVectors, 1 ) );
+    M_receivePointer = reinterpret_cast<char*>( &M_receiveBuffer[0] );
+    M_receiveLength  = M_receiveBuffer.size() * sizeof( Real );
+
+    // Epetra builds no distributor when the source map is not distributed (e.g. on one process):
+    // all the values are local and have been copied above
+    if ( !transfer.SourceMap().DistributedGlobal() )
+        return;
+
+    const Int errorCode( transfer.Distributor().DoPosts( reinterpret_cast<char*>( &M_sendBuffer[0] ),
+                                                         numVectors * sizeof( Real ),
+                                                         M_receiveLength,
+                                                         M_receivePointer ) );
+    if ( errorCode != 0 )
+    {
+        std::ostringstream errorMessage;
+        errorMessage << "MapEpetra::beginTransfer: Epetra_Distributor::DoPosts failed with error code " << errorCode << "\n";
+        ERROR_MSG( errorMessage.str() );
+    }
+}
+
+template <typename TransferType>
+void
+MapEpetra::endTransfer( const TransferType& transfer, Epetra_MultiVector& target,
+                        const Epetra_CombineMode& combineMode )
+{
+    ASSERT( M_receivePointer != 0, "No split-phase exchange is pending on this map!" );
+
+    if ( transfer.SourceMap().DistributedGlobal() )
+    {
+        const Int errorCode( transfer.Distributor().DoWaits() );
+        if ( errorCode != 0 )
+        {
+            std::ostringstream errorMessage;
+            errorMessage << "MapEpetra::endTransfer: Epetra_Distributor::DoWaits failed with error code " << errorCode << "\n";
+            ERROR_MSG( errorMessage.str() );
+        }
+    }
+
+    const Int numVectors( target.NumVectors() );
+    const Real* receivedValues( reinterpret_cast<Real*>( M_receivePointer ) );
+
+    for ( Int i( 0 ); i < transfer.NumRemoteIDs(); ++i )
+    {
+        for ( Int iVector( 0 ); iVector < numVectors; ++iVector )
+        {
+            if ( combineMode == Add )
+                target[iVector][ transfer.RemoteLIDs()[i] ] += receivedValues[ i * numVectors + iVector ];
+            else
+                target[iVector][ transfer.RemoteLIDs()[i] ] = receivedValues[ i * numVectors + iVector ];
+        }
+    }
+
+    // The distributor may have replaced the buffer with its own
+    if ( M_receivePointer != reinterpret_cast<char*>( &M_receiveBuffer[0] ) )
+        delete[] M_receivePointer;
+
+    M_receivePointer = 0;
+    M_receiveLength  = 0;
+}
+
 void
 MapEpetra::bubbleSort(Epetra_IntSerialDenseVector& elements)
 {
@@ -49,6 +49,8 @@
 #include <Epetra_Export.h>
 #include <Epetra_Import.h>
 #include <Epetra_Comm.h>
+#include <Epetra_MultiVector.h>
+#include <Epetra_CombineMode.h>
 
 // Tell the compiler to ignore specific kind of warnings:
 #pragma GCC diagnostic warning "-Wunused-variable"
@@ -58,6 +60,8 @@
 
 #include <lifev/core/array/MapVector.hpp>
 
+#include <vector>
+
 
 namespace LifeV
 {
@@ -256,6 +260,52 @@ public:
 
     //@}
 
+
+    //! @name Split-phase communications
+    /*!
+      These methods split the import (unique to repeated) and the export (repeated to unique)
+      of a vector in two phases. The begin methods copy the values that stay on the process
+      and post the non blocking communications of the other values; the end methods wait for
+      the communications and unpack the received values. The computations that do not need the
+      values of the other processes can be done between the two calls.
+
+      The communication buffers are kept by the map and reused from one exchange to the next.
+      Only one exchange at a time can be pending on a map (and on the maps sharing its importer
+      and exporter).
+     */
+    //@{
+
+    //! Start the import of the values of a unique vector in a repeated vector
+    /*!
+      @param uniqueVector vector based on the unique map
+      @param repeatedVector vector based on the repeated map, its local values are set at once
+     */
+    void beginImport( const Epetra_MultiVector& uniqueVector, Epetra_MultiVector& repeatedVector );
+
+    //! Complete the import started by beginImport
+    /*!
+      @param repeatedVector the vector given to beginImport, its values owned by the other processes are set
+     */
+    void endImport( Epetra_MultiVector& repeatedVector );
+
+    //! Start the export of the values of a repeated vector in a unique vector
+    /*!
+      @param repeatedVector vector based on the repeated map
+      @param uniqueVector vector based on the unique map, its local contributions are combined at once
+      @param combineMode Add or Insert
+     */
+    void beginExport( const Epetra_MultiVector& repeatedVector, Epetra_MultiVector& uniqueVector,
+                      const Epetra_CombineMode& combineMode = Add );
+
+    //! Complete the export started by beginExport
+    /*!
+      @param uniqueVector the vector given to beginExport, the contributions of the other processes are combined
+      @param combineMode the combine mode given to beginExport
+     */
+    void endExport( Epetra_MultiVector& uniqueVector, const Epetra_CombineMode& combineMode = Add );
+
+    //@}
+
     //! @name Get Methods
     //@{
 
@@ -307,6 +357,16 @@ private:
     //! Reset and rebuild the importer and exporter for the map
     void  createImportExport();
 
+    //! Copy the local values and post the communications of a transfer (Epetra_Import or Epetra_Export)
+    template <typename TransferType>
+    void beginTransfer( const TransferType& transfer, const Epetra_MultiVector& source,
+                        Epetra_MultiVector& target, const Epetra_CombineMode& combineMode );
+
+    //! Wait for the communications of a transfer and combine the received values
+    template <typename TransferType>
+    void endTransfer( const TransferType& transfer, Epetra_MultiVector& target,
+                      const Epetra_CombineMode& combineMode );
+
     //! Sort the element given using a bubble sort algorithm
     /*!
       @param elements Epetra_IntSerialDenseVector vector to be sorted
@@ -321,6 +381,11 @@ private:
     importer_ptrtype   M_importer;
     comm_ptrtype       M_commPtr;
 
+    // Buffers of the split-phase communications
+    std::vector<Real>  M_sendBuffer;
+    std::vector<Real>  M_receiveBuffer;
+    char*              M_receivePointer;
+    Int                M_receiveLength;
 };
 
 typedef MapVector<MapEpetra> MapEpetraVector;
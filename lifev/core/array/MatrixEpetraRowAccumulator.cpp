@@ -0,0 +1,141 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the implementation of the MatrixEpetraRowAccumulator class
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/array/MatrixEpetraRowAccumulator.hpp>
+
+#include <algorithm>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructor
+// ===================================================
+
+MatrixEpetraRowAccumulator::MatrixEpetraRowAccumulator( const map_Type& map, const UInt& numEntriesPerRow )
+        :
+        M_repeatedMap( map.map( Repeated ) ),
+        M_rows( map.map( Repeated )->NumMyElements() )
+{
+    if ( numEntriesPerRow > 0 )
+    {
+        for ( UInt iRow(0); iRow < M_rows.size(); ++iRow )
+        {
+            M_rows[iRow].columns.reserve( numEntriesPerRow );
+            M_rows[iRow].values.reserve( numEntriesPerRow );
+        }
+    }
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+void MatrixEpetraRowAccumulator::addToCoefficients( Int const numRows, Int const numColumns,
+                                                    std::vector<Int> const& rowIndices, std::vector<Int> const& columnIndices,
+                                                    Real* const* const localValues,
+                                                    Int format )
+{
+    for ( Int iRow(0); iRow < numRows; ++iRow )
+    {
+        Row& row( M_rows[ localRow( rowIndices[iRow] ) ] );
+
+        for ( Int jColumn(0); jColumn < numColumns; ++jColumn )
+        {
+            const Real value( format == Epetra_FECrsMatrix::COLUMN_MAJOR ?
+                              localValues[jColumn][iRow] : localValues[iRow][jColumn] );
+
+            std::vector<Int>::iterator position( std::lower_bound( row.columns.begin(), row.columns.end(),
+                                                                   columnIndices[jColumn] ) );
+            const UInt index( position - row.columns.begin() );
+
+            if ( position == row.columns.end() || *position != columnIndices[jColumn] )
+            {
+                row.columns.insert( position, columnIndices[jColumn] );
+                row.values.insert( row.values.begin() + index, value );
+            }
+            else
+            {
+                row.values[index] += value;
+            }
+        }
+    }
+}
+
+void MatrixEpetraRowAccumulator::addTo( matrix_Type& matrix )
+{
+    std::vector<Int> rowIndex( 1 );
+
+    for ( UInt iRow(0); iRow < M_rows.size(); ++iRow )
+    {
+        Row& row( M_rows[iRow] );
+
+        if ( row.columns.empty() )
+        {
+            continue;
+        }
+
+        rowIndex[0] = M_repeatedMap->GID( iRow );
+
+        Real* rowValues( &row.values[0] );
+        matrix.addToCoefficients( 1, row.columns.size(), rowIndex, row.columns, &rowValues,
+                                  Epetra_FECrsMatrix::ROW_MAJOR );
+
+        row.columns.clear();
+        row.values.clear();
+    }
+}
+
+void MatrixEpetraRowAccumulator::clear()
+{
+    for ( UInt iRow(0); iRow < M_rows.size(); ++iRow )
+    {
+        M_rows[iRow].columns.clear();
+        M_rows[iRow].values.clear();
+    }
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+UInt MatrixEpetraRowAccumulator::localRow( const Int& globalRow ) const
+{
+    const Int lid( M_repeatedMap->LID( globalRow ) );
+
+    ASSERT( lid >= 0, "The row is not in the repeated map!" );
+
+    return static_cast<UInt>( lid );
+}
+
+} // Namespace LifeV
@@ -0,0 +1,142 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the MatrixEpetraRowAccumulator class
+
+    @date 19-10-2012
+ */
+
+#ifndef MATRIXEPETRAROWACCUMULATOR_H
+#define MATRIXEPETRAROWACCUMULATOR_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! MatrixEpetraRowAccumulator - Row-wise buffer for the threaded assembly of a MatrixEpetra
+/*!
+  The insertion of values in an Epetra_FECrsMatrix is not thread safe: the graph of the matrix
+  and the buffer of the non local rows are shared by all the rows. This class stores the values
+  row by row, each row being independent of the others, so that several threads can add values
+  at the same time as long as they do not add values in the same rows. This is the case when
+  the elements assembled at the same time share no degree of freedom (see ElementColoring).
+
+  The rows are the ones of the repeated map given in the constructor. Once all the values have been
+  added, addTo inserts them in the matrix with one insertion per row, and clears the buffer.
+
+  Each row is stored as two arrays (columns and values) sorted by column. The arrays keep their
+  capacity when the buffer is cleared, so that an accumulator used for several assemblies with the
+  same pattern (e.g. kept as a member of a solver) does not allocate memory after the first one.
+ */
+class MatrixEpetraRowAccumulator
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef MapEpetra                       map_Type;
+    typedef MatrixEpetra<Real>              matrix_Type;
+
+    //@}
+
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param map Map of the matrix, the rows that can be accumulated are the ones of its repeated map
+      @param numEntriesPerRow Estimated number of entries of each row, used to preallocate the rows
+     */
+    explicit MatrixEpetraRowAccumulator( const map_Type& map, const UInt& numEntriesPerRow = 0 );
+
+    //! Destructor
+    ~MatrixEpetraRowAccumulator() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Add a set of values, same arguments of MatrixEpetra::addToCoefficients
+    /*!
+      Calls on different threads are safe if they do not share any row index.
+     */
+    void addToCoefficients( Int const numRows, Int const numColumns,
+                            std::vector<Int> const& rowIndices, std::vector<Int> const& columnIndices,
+                            Real* const* const localValues,
+                            Int format = Epetra_FECrsMatrix::COLUMN_MAJOR );
+
+    //! Add the accumulated values to the matrix and clear the buffer
+    void addTo( matrix_Type& matrix );
+
+    //! Clear the buffer, the memory of the rows is kept
+    void clear();
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    MatrixEpetraRowAccumulator();
+
+    MatrixEpetraRowAccumulator( const MatrixEpetraRowAccumulator& );
+
+    MatrixEpetraRowAccumulator& operator=( const MatrixEpetraRowAccumulator& );
+
+    //! Local index of the row in the repeated map
+    UInt localRow( const Int& globalRow ) const;
+
+    //@}
+
+    //! Values of a row, sorted by global column
+    struct Row
+    {
+        std::vector<Int>  columns;
+        std::vector<Real> values;
+    };
+
+    map_Type::map_ptrtype M_repeatedMap;
+
+    std::vector<Row>      M_rows;
+};
+
+} // Namespace LifeV
+
+#endif /* MATRIXEPETRAROWACCUMULATOR_H */
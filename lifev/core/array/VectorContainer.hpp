@@ -39,8 +39,7 @@
 #ifndef VectorContainer_H
 #define VectorContainer_H 1
 
-#include <lifev/core/LifeV.hpp>
-#include <lifev/core/util/LifeDebug.hpp>
+#include <algorithm>
 
 #include <lifev/core/LifeV.hpp>
 #include <lifev/core/util/LifeDebug.hpp>
@@ -77,6 +76,11 @@ namespace LifeV
  *           the results can be different from what expected!
  *      <li> Up to now it has been tested only with \c VectorEpetra. However the design should be
  *           more or less compatible also with \c boost::numeric::ublas::vector.
+ *      <li> The reductions (\c dot, \c norm2, \c normInf, \c weightNorm2, \c blocksNorm2) and the \c update
+ *           methods work directly on the Epetra data of the vectors: the local contributions of all the
+ *           vectors are computed first and then reduced with a single \c SumAll (or \c MaxAll), i.e.,
+ *           one collective communication for the whole container instead of one for each vector.
+ *           They require the interface of \c VectorEpetra (\c epetraVector() and \c comm()).
  *  </ol>
  *
  */
@@ -336,19 +340,61 @@ public:
 
     //! Dot - Scalar product
     /*!
-     * Scalar product of the vectors
+     * Scalar product of the vectors (one reduction for the whole container)
      * @param vectorContainer - VectorContainer
      */
     Real dot( const VectorContainer< vector_Type, container_Type >& vectorContainer ) const;
 
     //! Dot - Scalar product
     /*!
-     * Scalar product of the vectors
+     * Scalar product of the vectors (one reduction for the whole container)
      * @param vectorContainer - VectorContainer
      * @param scalarProduct - result
      */
     void dot( const VectorContainer< vector_Type, container_Type >& vectorContainer, Real& scalarProduct );
 
+    //! Norm2
+    /*!
+     * Compute the Norm2 of the whole container (one reduction)
+     */
+    Real norm2() const;
+
+    //! NormInf
+    /*!
+     * Compute the infinity norm of the whole container (one reduction)
+     */
+    Real normInf() const;
+
+    //! Norm2 of each vector
+    /*!
+     * Compute the Norm2 of all the vectors of the container with a single reduction
+     * @param blocksNorm2 - output: the Norm2 of each vector
+     */
+    void blocksNorm2( std::vector< Real >& blocksNorm2 ) const;
+
+    //! Update
+    /*!
+     * this = alpha * vectorContainer + beta * this, in a single pass over each vector
+     * @param alpha - scalar coefficient of vectorContainer
+     * @param vectorContainer - VectorContainer
+     * @param beta - scalar coefficient of this
+     */
+    VectorContainer& update( const Real& alpha, const VectorContainer< vector_Type, container_Type >& vectorContainer,
+                             const Real& beta );
+
+    //! Update
+    /*!
+     * this = alpha * vectorContainerA + beta * vectorContainerB + gamma * this, in a single pass over each vector
+     * @param alpha - scalar coefficient of vectorContainerA
+     * @param vectorContainerA - VectorContainer
+     * @param beta - scalar coefficient of vectorContainerB
+     * @param vectorContainerB - VectorContainer
+     * @param gamma - scalar coefficient of this
+     */
+    VectorContainer& update( const Real& alpha, const VectorContainer< vector_Type, container_Type >& vectorContainerA,
+                             const Real& beta,  const VectorContainer< vector_Type, container_Type >& vectorContainerB,
+                             const Real& gamma );
+
     //! Abs
     /*!
      * Replace all the elements in the vectorContainer with their abs.
@@ -363,7 +409,7 @@ public:
 
     //! Norm2
     /*!
-     * Compute the weight Norm2 of the vector
+     * Compute the weight Norm2 of the vector (one reduction for the whole container)
      */
     Real weightNorm2();
 
@@ -1021,10 +1067,22 @@ VectorContainer< VectorType, ContainerType >::dot( const VectorContainer< vector
     debugStream( 3100 ) << "VectorContainer::dot( vectorContainer )" << "\n";
 #endif
 
-    Real scalarProduct = 0;
+    if ( M_container.empty() )
+        return 0.;
 
+    Real localScalarProduct( 0. );
     for ( UInt i( 0 ); i < vectorsNumber(); ++i )
-        scalarProduct += M_container[i]->dot( *( vectorContainer.M_container[i] ) );
+    {
+        const Real* x = M_container[i]->epetraVector()[0];
+        const Real* y = vectorContainer.M_container[i]->epetraVector()[0];
+        const Int length = M_container[i]->epetraVector().MyLength();
+
+        for ( Int j( 0 ); j < length; ++j )
+            localScalarProduct += x[j] * y[j];
+    }
+
+    Real scalarProduct( 0. );
+    M_container.front()->comm().SumAll( &localScalarProduct, &scalarProduct, 1 );
 
     return scalarProduct;
 }
@@ -1038,8 +1096,114 @@ VectorContainer< VectorType, ContainerType >::dot( const VectorContainer< vector
     debugStream( 3100 ) << "VectorContainer::dot( vectorContainer, scalarProduct )" << "\n";
 #endif
 
+    scalarProduct = dot( vectorContainer );
+}
+
+template< class VectorType, class ContainerType >
+Real
+VectorContainer< VectorType, ContainerType >::norm2() const
+{
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream( 3100 ) << "VectorContainer::norm2()" << "\n";
+#endif
+
+    return std::sqrt( dot( *this ) );
+}
+
+template< class VectorType, class ContainerType >
+Real
+VectorContainer< VectorType, ContainerType >::normInf() const
+{
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream( 3100 ) << "VectorContainer::normInf()" << "\n";
+#endif
+
+    if ( M_container.empty() )
+        return 0.;
+
+    Real localNormInf( 0. );
+    for ( constIterator_Type i = M_container.begin(); i != M_container.end(); ++i )
+    {
+        const Real* x = ( *i )->epetraVector()[0];
+        const Int length = ( *i )->epetraVector().MyLength();
+
+        for ( Int j( 0 ); j < length; ++j )
+            localNormInf = std::max( localNormInf, std::fabs( x[j] ) );
+    }
+
+    Real normInf( 0. );
+    M_container.front()->comm().MaxAll( &localNormInf, &normInf, 1 );
+
+    return normInf;
+}
+
+template< class VectorType, class ContainerType >
+void
+VectorContainer< VectorType, ContainerType >::blocksNorm2( std::vector< Real >& blocksNorm2 ) const
+{
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream( 3100 ) << "VectorContainer::blocksNorm2( blocksNorm2 )" << "\n";
+#endif
+
+    blocksNorm2.assign( vectorsNumber(), 0. );
+    if ( M_container.empty() )
+        return;
+
+    std::vector< Real > localSquaredNorms( vectorsNumber(), 0. );
+    UInt k( 0 );
+    for ( constIterator_Type i = M_container.begin(); i != M_container.end(); ++i, ++k )
+    {
+        const Real* x = ( *i )->epetraVector()[0];
+        const Int length = ( *i )->epetraVector().MyLength();
+
+        for ( Int j( 0 ); j < length; ++j )
+            localSquaredNorms[k] += x[j] * x[j];
+    }
+
+    M_container.front()->comm().SumAll( &localSquaredNorms[0], &blocksNorm2[0], vectorsNumber() );
+
     for ( UInt i( 0 ); i < vectorsNumber(); ++i )
-        scalarProduct += M_container[i]->Dot( *( vectorContainer.M_container[i] ) );
+        blocksNorm2[i] = std::sqrt( blocksNorm2[i] );
+}
+
+template< class VectorType, class ContainerType >
+VectorContainer< VectorType, ContainerType >&
+VectorContainer< VectorType, ContainerType >::update( const Real& alpha,
+                                                      const VectorContainer< vector_Type, container_Type >& vectorContainer,
+                                                      const Real& beta )
+{
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream( 3100 ) << "VectorContainer::update( alpha, vectorContainer, beta )" << "\n";
+#endif
+
+    for ( UInt i( 0 ); i < vectorsNumber(); ++i )
+        M_container[i]->epetraVector().Update( alpha, vectorContainer.M_container[i]->epetraVector(), beta );
+
+    return *this;
+}
+
+template< class VectorType, class ContainerType >
+VectorContainer< VectorType, ContainerType >&
+VectorContainer< VectorType, ContainerType >::update( const Real& alpha,
+                                                      const VectorContainer< vector_Type, container_Type >& vectorContainerA,
+                                                      const Real& beta,
+                                                      const VectorContainer< vector_Type, container_Type >& vectorContainerB,
+                                                      const Real& gamma )
+{
+
+#ifdef HAVE_LIFEV_DEBUG
+    debugStream( 3100 ) << "VectorContainer::update( alpha, vectorContainerA, beta, vectorContainerB, gamma )" << "\n";
+#endif
+
+    for ( UInt i( 0 ); i < vectorsNumber(); ++i )
+        M_container[i]->epetraVector().Update( alpha, vectorContainerA.M_container[i]->epetraVector(),
+                                               beta,  vectorContainerB.M_container[i]->epetraVector(), gamma );
+
+    return *this;
 }
 
 template< class VectorType, class ContainerType >
@@ -1079,13 +1243,13 @@ VectorContainer< VectorType, ContainerType >::weightNorm2()
     debugStream( 3100 ) << "VectorContainer::weightNorm2()" << "\n";
 #endif
 
-    Real PartialNorm, TotalNorm = 0;
+    std::vector< Real > blocksNorm;
+    blocksNorm2( blocksNorm );
 
-    for ( constIterator_Type i = M_container.begin(); i < M_container.end(); ++i )
-    {
-        ( *i )->norm2( PartialNorm );
-        TotalNorm += PartialNorm * ( *i )->size();
-    }
+    Real TotalNorm = 0;
+    UInt k( 0 );
+    for ( constIterator_Type i = M_container.begin(); i < M_container.end(); ++i, ++k )
+        TotalNorm += blocksNorm[k] * ( *i )->size();
 
     return TotalNorm / this->size();
 }
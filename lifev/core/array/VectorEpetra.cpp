@@ -581,6 +581,34 @@ Int VectorEpetra::globalToLocalRowId( const UInt row ) const
     return lrow;
 }
 
+void VectorEpetra::beginImport( const VectorEpetra& vector )
+{
+    ASSERT( M_mapType == Repeated && vector.M_mapType == Unique, "beginImport goes from a unique to a repeated vector!" );
+    ASSERT( M_epetraMap->mapsAreSimilar( *vector.M_epetraMap ), "The vectors must be based on the same map!" );
+
+    M_epetraMap->beginImport( vector.epetraVector(), *M_epetraVector );
+}
+
+void VectorEpetra::endImport()
+{
+    M_epetraMap->endImport( *M_epetraVector );
+}
+
+void VectorEpetra::beginExport( const VectorEpetra& vector )
+{
+    ASSERT( M_mapType == Unique && vector.M_mapType == Repeated, "beginExport goes from a repeated to a unique vector!" );
+    ASSERT( M_epetraMap->mapsAreSimilar( *vector.M_epetraMap ), "The vectors must be based on the same map!" );
+
+    *this *= 0.;
+
+    M_epetraMap->beginExport( vector.epetraVector(), *M_epetraVector, M_combineMode );
+}
+
+void VectorEpetra::endExport()
+{
+    M_epetraMap->endExport( *M_epetraVector, M_combineMode );
+}
+
 bool VectorEpetra::setCoefficient( const UInt row, const data_type& value, UInt offset )
 {
     Int lrow = globalToLocalRowId(row + offset);
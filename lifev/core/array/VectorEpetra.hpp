@@ -416,6 +416,32 @@ public:
         return M_epetraVector->GlobalAssemble( mode );
     }
 
+    //! Start the import of the values of a unique vector in this repeated vector
+    /*!
+      The two vectors must be based on the same MapEpetra. When the method returns, the values
+      owned by this process are already set, while the values owned by the other processes
+      are being communicated: they are available after endImport.
+      See MapEpetra::beginImport.
+      @param vector Unique vector to be imported
+     */
+    void beginImport( const VectorEpetra& vector );
+
+    //! Complete the import started by beginImport
+    void endImport();
+
+    //! Start the export of the values of a repeated vector in this unique vector
+    /*!
+      The two vectors must be based on the same MapEpetra. This vector is set to zero and
+      the values are combined with the combine mode of this vector (Add by default):
+      the local contributions when the method returns, the contributions of the other
+      processes after endExport. See MapEpetra::beginExport.
+      @param vector Repeated vector to be exported
+     */
+    void beginExport( const VectorEpetra& vector );
+
+    //! Complete the export started by beginExport
+    void endExport();
+
     //! Return the local Id of a global row
     /*!
       @param row Global row Id
@@ -0,0 +1,155 @@
+//@HEADER
+/*
+*******************************************************************************
+
+Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+Copyright (C) 2010, 2011, 2012 EPFL, Politecnico di Milano, Emory University
+
+This file is part of LifeV.
+
+LifeV is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LifeV is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+ * @file
+ * @brief Utility to partition a mesh in parallel and store the parts in a HDF5 container
+ *
+ * The mesh is partitioned with ParMETIS in as many parts as the MPI processes.
+ * Each process builds its own part and writes it in the HDF5 container with
+ * collective writes, using the layout of PartitionIO. The container is later
+ * read with PartitionIO::read by a simulation with the same number of processes.
+ *
+ * usage: mpirun -np N UtilityMeshPartitioner -o parts.h5
+ *
+ * without the options -o or --output the name of the container is taken from the data file.
+ *
+ * @date 19-10-2012
+ */
+
+#include <iostream>
+#include <string>
+
+#include "Epetra_config.h"
+
+#ifdef HAVE_HDF5
+#ifdef HAVE_MPI
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <mpi.h>
+
+#include <Epetra_MpiComm.h>
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/filter/GetPot.hpp>
+#include <lifev/core/mesh/MeshData.hpp>
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/filter/PartitionIO.hpp>
+#include <lifev/core/util/LifeChrono.hpp>
+
+using namespace LifeV;
+
+#endif /* HAVE_MPI */
+#endif /* HAVE_HDF5 */
+
+int main(int argc, char** argv)
+{
+#ifdef HAVE_HDF5
+#ifdef HAVE_MPI
+
+    typedef RegionMesh<LinearTetra> mesh_Type;
+
+    MPI_Init(&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> comm(new Epetra_MpiComm(MPI_COMM_WORLD));
+    const bool verbose(comm->MyPID() == 0);
+
+    GetPot commandLine(argc, argv);
+    const std::string dataFileName = commandLine.follow("data", 2, "-f", "--file");
+    GetPot dataFile(dataFileName);
+
+    const std::string partsFileName = commandLine.follow((dataFile("partitioner/hdf5_file_name", "parts.h5").c_str()), 2, "-o", "--output");
+    const bool transposeInFile(dataFile("partitioner/transpose", false));
+
+    if (verbose)
+    {
+        std::cout << "Number of parts: " << comm->NumProc() << std::endl;
+        std::cout << "Name of HDF5 container: " << partsFileName << std::endl;
+    }
+
+    LifeChrono chrono;
+
+    // Read the mesh
+    chrono.start();
+
+    MeshData meshData;
+    meshData.setup(dataFile, "space_discretization");
+
+    boost::shared_ptr<mesh_Type> fullMeshPtr(new mesh_Type( comm ) );
+    readMesh(*fullMeshPtr, meshData);
+
+    chrono.stop();
+    if (verbose)
+    {
+        std::cout << "Mesh read in " << chrono.diff() << " s" << std::endl;
+    }
+
+    // Partition the graph with ParMETIS and build the local part
+    chrono.start();
+
+    MeshPartitioner<mesh_Type> meshPart(fullMeshPtr, comm);
+
+    // Release the original mesh from the MeshPartitioner object and
+    // delete the RegionMesh object
+    meshPart.releaseUnpartitionedMesh();
+    fullMeshPtr.reset();
+
+    chrono.stop();
+    if (verbose)
+    {
+        std::cout << "Mesh partitioned in " << chrono.diff() << " s" << std::endl;
+    }
+
+    // Each process writes its part to the HDF5 container
+    chrono.start();
+
+    PartitionIO<mesh_Type> partitionIO(partsFileName, comm, transposeInFile);
+    partitionIO.write(meshPart.meshPartitions());
+
+    chrono.stop();
+    if (verbose)
+    {
+        std::cout << "Mesh parts written in " << chrono.diff() << " s" << std::endl;
+    }
+
+    MPI_Finalize();
+
+#else
+    std::cout << "This utility needs MPI to run. Aborting." << std::endl;
+    return(EXIT_FAILURE);
+#endif /* HAVE_MPI */
+#else
+    std::cout << "This utility needs HDF5 to run. Aborting." << std::endl;
+    return(EXIT_FAILURE);
+#endif /* HAVE_HDF5 */
+
+    return(EXIT_SUCCESS);
+}
@@ -56,6 +56,7 @@
 #include <lifev/core/array/MatrixElemental.hpp>
 #include <lifev/core/array/VectorElemental.hpp>
 #include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/MatrixEpetraRowAccumulator.hpp>
 #include <lifev/core/array/VectorEpetra.hpp>
 
 #include <lifev/core/fem/CurrentFE.hpp>
@@ -232,6 +233,72 @@ assembleMatrix( MatrixEpetra<Real>&   globalMatrix,
     globalMatrix.addToCoefficients( fe1NbDof, fe2NbDof, iList, jList, &matPtr[0], Epetra_FECrsMatrix::COLUMN_MAJOR );
 }
 
+//! Assembly procedure for the matrix, in a row accumulator
+/*!
+  Same as the previous method, the values are added to a MatrixEpetraRowAccumulator
+  so that elements sharing no degree of freedom can be assembled by different threads.
+ */
+template <typename DofType1, typename DofType2, typename LocalMatrixType>
+void
+assembleMatrix( MatrixEpetraRowAccumulator& globalMatrix,
+                UInt const&           elementID1,
+                UInt const&           elementID2,
+                LocalMatrixType&      localMatrix,
+                const UInt&           fe1NbDof,
+                const UInt&           fe2NbDof,
+                const DofType1&       dof1,
+                const DofType2&       dof2,
+                Int                   iOffset,
+                Int                   jOffset )
+
+{
+    // Global ID of the dofs
+    std::vector<Int> iList(fe1NbDof);
+    std::vector<Int> jList(fe2NbDof);
+
+    // Raw data to insert in the matrix
+    std::vector<Real*> matPtr(fe2NbDof);
+
+    for ( UInt k1 (0) ; k1 < fe1NbDof ; k1++ )
+    {
+        iList[k1] = dof1.localToGlobalMap( elementID1, k1 ) + iOffset ;
+    }
+
+    for ( UInt k2 (0) ; k2 < fe2NbDof ; k2++ )
+    {
+        jList[k2]  = dof2.localToGlobalMap( elementID2, k2 ) + jOffset ;
+        matPtr[k2] = &(localMatrix(static_cast<UInt>(0),k2));
+    }
+
+    globalMatrix.addToCoefficients( fe1NbDof, fe2NbDof, iList, jList, &matPtr[0], Epetra_FECrsMatrix::COLUMN_MAJOR );
+}
+
+//! Assembly procedure for the block of a local matrix, in a row accumulator
+template <typename DofType>
+void
+assembleMatrix( MatrixEpetraRowAccumulator& globalMatrix,
+                const UInt&           elementID,
+                MatrixElemental&      localMatrix,
+                const UInt&           feNbDof,
+                const DofType&        dof,
+                Int                   iblock,
+                Int                   jblock,
+                Int                   iOffset,
+                Int                   jOffset)
+
+{
+    MatrixElemental::matrix_view localView = localMatrix.block( iblock, jblock );
+
+    assembleMatrix( globalMatrix,
+                    elementID,
+                    elementID,
+                    localView,
+                    feNbDof,
+                    feNbDof,
+                    dof,
+                    dof, iOffset, jOffset);
+}
+
 //! Assembly procedure for the matrix
 /*!
   This method allows to transfer local contributions
@@ -263,6 +330,54 @@ assembleMatrix( MatrixEpetra<Real>& globalMatrix,
 
 }
 
+//! Assembly procedure for the product of a local matrix with a global vector
+/*!
+  This method adds to the global vector the product of a block of the local
+  matrix with the restriction of the vector "direction" to the element, so that
+  the operator can be applied without assembling its matrix.
+
+  The vector "direction" must be repeated. Since the rows of the element may
+  belong to other processors, globalAssemble has to be called on "product"
+  once all the elements have been treated.
+ */
+template <typename DofType1, typename DofType2>
+void
+assembleMatrixVectorProduct( VectorEpetra&       product,
+                             const VectorEpetra& direction,
+                             MatrixElemental&    localMatrix,
+                             const CurrentFE&    currentFE1,
+                             const CurrentFE&    currentFE2,
+                             const DofType1&     dof1,
+                             const DofType2&     dof2,
+                             Int                 iblock,
+                             Int                 jblock,
+                             Int                 iOffset,
+                             Int                 jOffset )
+
+{
+    MatrixElemental::matrix_view localView = localMatrix.block( iblock, jblock );
+
+    UInt elementID1 = currentFE1.currentLocalId();
+    UInt elementID2 = currentFE2.currentLocalId();
+
+    // Local values of the direction
+    std::vector<Real> localDirection( currentFE2.nbFEDof() );
+    for ( UInt k2 (0) ; k2 < currentFE2.nbFEDof() ; k2++ )
+    {
+        localDirection[k2] = direction( dof2.localToGlobalMap( elementID2, k2 ) + jOffset );
+    }
+
+    for ( UInt k1 (0) ; k1 < currentFE1.nbFEDof() ; k1++ )
+    {
+        Real value( 0. );
+        for ( UInt k2 (0) ; k2 < currentFE2.nbFEDof() ; k2++ )
+        {
+            value += localView( k1, k2 ) * localDirection[k2];
+        }
+        product.sumIntoGlobalValues( dof1.localToGlobalMap( elementID1, k1 ) + iOffset, value );
+    }
+}
+
 //! Assembly procedure for the transposed matrix
 /*!
   This method allows to transfer local contributions
@@ -1540,6 +1540,169 @@ void ipstab_div( const Real coef, MatrixElemental& elmat, const CurrentFE& fe1,
 
 }
 
+void ipstab_grad( const Real coef, MatrixElemental& elmat,
+                  const InteriorFacetCache& facets, const UInt& iFacet,
+                  const UInt& side1, const UInt& side2, int iblock, int jblock )
+{
+    /*
+      Interior penalty stabilization: coef*\int_{face} grad u1_i . grad v1_j
+      with the derivatives stored in the cache
+    */
+
+    MatrixElemental::matrix_view mat = elmat.block( iblock, jblock );
+
+    Real sum;
+
+    // Loop on rows
+    for ( UInt i( 0 ); i < facets.nbFEDof(); ++i )
+    {
+        // Loop on columns
+        for ( UInt j( 0 ); j < facets.nbFEDof(); ++j )
+        {
+            sum = 0.0;
+            // Loop on coordinates
+            for ( UInt icoor( 0 ); icoor < facets.nbCoor(); ++icoor )
+                for ( UInt ig( 0 ); ig < facets.nbQuadPt(); ++ig )
+                    sum += facets.dphi( iFacet, side1, i, icoor, ig ) * facets.dphi( iFacet, side2, j, icoor, ig )
+                           * facets.weightMeas( iFacet, ig );
+            mat( i, j ) += coef * sum;
+        }
+    }
+}
+
+void ipstab_grad( const Real coef, MatrixElemental& elmat,
+                  const InteriorFacetCache& facets, const UInt& iFacet,
+                  const UInt& side1, const UInt& side2, int iblock, int jblock, int nb )
+{
+    /*
+      Interior penalty stabilization: coef*\int_{face} grad u1_i . grad v1_j
+      with the derivatives stored in the cache, for each component
+    */
+
+    MatrixElemental::matrix_type mat_tmp( facets.nbFEDof(), facets.nbFEDof() );
+
+    Real sum;
+
+    // Loop on rows
+    for ( UInt i( 0 ); i < facets.nbFEDof(); ++i )
+    {
+        // Loop on columns
+        for ( UInt j( 0 ); j < facets.nbFEDof(); ++j )
+        {
+            sum = 0.0;
+            // Loop on coordinates
+            for ( UInt icoor( 0 ); icoor < facets.nbCoor(); ++icoor )
+                for ( UInt ig( 0 ); ig < facets.nbQuadPt(); ++ig )
+                    sum += facets.dphi( iFacet, side1, i, icoor, ig ) * facets.dphi( iFacet, side2, j, icoor, ig )
+                           * facets.weightMeas( iFacet, ig );
+            mat_tmp( i, j ) = coef * sum;
+        }
+    }
+
+    // copy on the components
+    for ( int icomp = 0; icomp < nb; icomp++ )
+    {
+        MatrixElemental::matrix_view mat_icomp = elmat.block( iblock + icomp, jblock + icomp );
+        mat_icomp += mat_tmp;
+    }
+}
+
+void ipstab_div( const Real coef, MatrixElemental& elmat,
+                 const InteriorFacetCache& facets, const UInt& iFacet,
+                 const UInt& side1, const UInt& side2, int iblock, int jblock )
+{
+    /*
+      Interior penalty stabilization: coef*\int_{face} div u . div v
+      with the derivatives stored in the cache
+    */
+
+    Real sum;
+
+    for ( UInt icoor( 0 ); icoor < facets.nbCoor(); ++icoor )
+    {
+        for ( UInt jcoor( 0 ); jcoor < facets.nbCoor(); ++jcoor )
+        {
+            MatrixElemental::matrix_view mat_icomp = elmat.block( iblock + icoor, jblock + jcoor );
+            // Loop on rows
+            for ( UInt i( 0 ); i < facets.nbFEDof(); ++i )
+            {
+                // Loop on columns
+                for ( UInt j( 0 ); j < facets.nbFEDof(); ++j )
+                {
+                    sum = 0.0;
+                    for ( UInt ig( 0 ); ig < facets.nbQuadPt(); ig++ )
+                        sum += facets.dphi( iFacet, side1, i, icoor, ig ) * facets.dphi( iFacet, side2, j, jcoor, ig )
+                               * facets.weightMeas( iFacet, ig );
+                    mat_icomp( i, j ) += coef * sum;
+                }
+            }
+        }
+    }
+}
+
+void ipstab_bgrad( const Real coef, MatrixElemental& elmat,
+                   const InteriorFacetCache& facets, const UInt& iFacet,
+                   const UInt& side1, const UInt& side2,
+                   const VectorElemental& beta, const CurrentBoundaryFE& bdfe,
+                   int iblock, int jblock, int nb )
+{
+    /*
+      Interior penalty stabilization: coef*\int_{face} (\beta1 . grad u1_i) . (\beta2 . grad v2_j)
+      with the derivatives stored in the cache
+    */
+
+    MatrixElemental::matrix_type mat_tmp( facets.nbFEDof(), facets.nbFEDof() );
+
+    Real sum;
+    UInt i, j;
+    UInt icoor, jcoor;
+    UInt ig;
+
+    //
+    // convection velocity \beta on the boundary quadrature points (same layout as the ipstab_bgrad above)
+    //
+    boost::multi_array<Real, 2> b(
+      boost::extents[facets.nbCoor()][facets.nbQuadPt()]);
+
+    for ( icoor = 0; icoor < facets.nbCoor(); ++icoor )
+    {
+        for ( ig = 0; ig < facets.nbQuadPt(); ig++ )
+        {
+            sum = 0;
+            for ( i = 0; i < bdfe.nbNode(); ++i )
+            {
+                sum += bdfe.phi( i, ig ) * beta.vec() [ icoor * bdfe.nbCoor() + i ];
+            }
+            b[ icoor ][ ig ] = sum;
+        }
+    }
+
+    // Loop on rows
+    for ( i = 0; i < facets.nbFEDof(); ++i )
+    {
+        // Loop on columns
+        for ( j = 0; j < facets.nbFEDof(); ++j )
+        {
+            sum = 0.0;
+            // Loop on coordinates
+            for ( icoor = 0; icoor < facets.nbCoor(); ++icoor )
+                for ( jcoor = 0; jcoor < facets.nbCoor(); ++jcoor )
+                    for ( ig = 0; ig < facets.nbQuadPt(); ig++ )
+                        sum += facets.dphi( iFacet, side1, i, icoor, ig ) * facets.dphi( iFacet, side2, j, jcoor, ig )
+                               *b[ icoor ][ ig ]*b[ jcoor ][ ig ]
+                               *facets.weightMeas( iFacet, ig );
+            mat_tmp( i, j ) = coef * sum;
+        }
+    }
+
+    // copy on the components
+    for ( int icomp = 0; icomp < nb; icomp++ )
+    {
+        MatrixElemental::matrix_view mat_icomp = elmat.block( iblock + icomp, jblock + icomp );
+        mat_icomp += mat_tmp;
+    }
+}
+
 void ipstab_bagrad( const Real coef, MatrixElemental& elmat,
                     const CurrentFE& fe1, const CurrentFE& fe2,
                     const VectorElemental& beta, const CurrentBoundaryFE& bdfe,
@@ -61,6 +61,7 @@
 #include <lifev/core/fem/CurrentBoundaryFE.hpp>
 #include <lifev/core/fem/CurrentFE.hpp>
 #include <lifev/core/fem/DOF.hpp>
+#include <lifev/core/fem/InteriorFacetCache.hpp>
 
 namespace LifeV
 {
@@ -622,6 +623,32 @@ void ipstab_bagrad( const Real           coef,
                     const CurrentBoundaryFE&   bdfe,
                     int iblock = 0, int jblock = 0 );
 
+//! \f$ coef < \nabla p1, \nabla q2 >\f$ on a facet stored in an InteriorFacetCache, side1 and side2 being 0 or 1
+void ipstab_grad( const Real coef, MatrixElemental& elmat,
+                  const InteriorFacetCache& facets, const UInt& iFacet,
+                  const UInt& side1, const UInt& side2, int iblock = 0, int jblock = 0 );
+
+//! \f$ coef < \nabla u1, \nabla v2 >\f$ on a facet stored in an InteriorFacetCache, copied on nb diagonal blocks
+void ipstab_grad( const Real coef, MatrixElemental& elmat,
+                  const InteriorFacetCache& facets, const UInt& iFacet,
+                  const UInt& side1, const UInt& side2, int iblock, int jblock, int nb );
+
+//! \f$ coef < \nabla\cdot  u1, \nabla\cdot  v2 >\f$ on a facet stored in an InteriorFacetCache
+void ipstab_div( const Real coef, MatrixElemental& elmat,
+                 const InteriorFacetCache& facets, const UInt& iFacet,
+                 const UInt& side1, const UInt& side2, int iblock = 0, int jblock = 0 );
+
+//! \f$ coef < \beta1 . \nabla u1, \beta2 . \nabla v2 >\f$ on a facet stored in an InteriorFacetCache
+/*!
+  The boundary finite element only gives the basis functions of the facet to interpolate beta,
+  it does not need to be updated on the facet.
+ */
+void ipstab_bgrad( const Real coef, MatrixElemental& elmat,
+                   const InteriorFacetCache& facets, const UInt& iFacet,
+                   const UInt& side1, const UInt& side2,
+                   const VectorElemental& beta, const CurrentBoundaryFE& bdfe,
+                   int iblock, int jblock, int nb );
+
 //!@}
 ///////////////////////////////////////
 
@@ -0,0 +1,379 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the batched procedures for the local assembly of the differential operators
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/fem/AssemblyElementalBatched.hpp>
+
+namespace LifeV
+{
+
+namespace AssemblyElemental
+{
+
+namespace
+{
+
+const UInt W( CurrentFEBatch::S_batchSize );
+
+// Add the packed values [iRow][jCol][lane] to the block (iblock,jblock) of the local matrix of each lane
+void addToBlock( std::vector<MatrixElemental>& localMatrices,
+                 const std::vector<Real>& values,
+                 const UInt& nbRows,
+                 const UInt& nbCols,
+                 const UInt& size,
+                 const UInt& iblock,
+                 const UInt& jblock )
+{
+    ASSERT( localMatrices.size() >= size, "Not enough local matrices for the batch!" );
+
+    for ( UInt lane(0); lane < size; ++lane )
+    {
+        MatrixElemental::matrix_view mat = localMatrices[lane].block( iblock, jblock );
+
+        for ( UInt iRow(0); iRow < nbRows; ++iRow )
+        {
+            for ( UInt jCol(0); jCol < nbCols; ++jCol )
+            {
+                mat( iRow, jCol ) += values[ ( iRow * nbCols + jCol ) * W + lane ];
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+void mass( std::vector<MatrixElemental>& localMass,
+           const CurrentFEBatch& massBatch,
+           const Real& coefficient,
+           const UInt& fieldDim )
+{
+    const UInt nbFEDof( massBatch.nbFEDof() );
+    const UInt nbQuadPt( massBatch.nbQuadPt() );
+
+    std::vector<Real> values( nbFEDof * nbFEDof * W );
+    Real localValue[W];
+
+    // Lower triangular + diagonal parts
+    for ( UInt iDof(0); iDof < nbFEDof; ++iDof )
+    {
+        for ( UInt jDof(0); jDof <= iDof; ++jDof )
+        {
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                localValue[lane] = 0.0;
+            }
+
+            for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+            {
+                const Real phiPhi( massBatch.phi( iDof, iQuadPt ) * massBatch.phi( jDof, iQuadPt ) );
+                const Real* wDet( massBatch.wDetJacobian( iQuadPt ) );
+
+                for ( UInt lane(0); lane < W; ++lane )
+                {
+                    localValue[lane] += phiPhi * wDet[lane];
+                }
+            }
+
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                values[ ( iDof * nbFEDof + jDof ) * W + lane ] = coefficient * localValue[lane];
+                values[ ( jDof * nbFEDof + iDof ) * W + lane ] = coefficient * localValue[lane];
+            }
+        }
+    }
+
+    for ( UInt iDim(0); iDim < fieldDim; ++iDim )
+    {
+        addToBlock( localMass, values, nbFEDof, nbFEDof, massBatch.size(), iDim, iDim );
+    }
+}
+
+void stiffness( std::vector<MatrixElemental>& localStiff,
+                const CurrentFEBatch& stiffBatch,
+                const Real& coefficient,
+                const UInt& fieldDim )
+{
+    const UInt nbFEDof( stiffBatch.nbFEDof() );
+    const UInt nbQuadPt( stiffBatch.nbQuadPt() );
+    const UInt nbCoor( stiffBatch.nbCoor() );
+
+    std::vector<Real> values( nbFEDof * nbFEDof * W );
+    Real localValue[W];
+
+    // Lower triangular + diagonal parts
+    for ( UInt iDof(0); iDof < nbFEDof; ++iDof )
+    {
+        for ( UInt jDof(0); jDof <= iDof; ++jDof )
+        {
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                localValue[lane] = 0.0;
+            }
+
+            for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+            {
+                const Real* wDet( stiffBatch.wDetJacobian( iQuadPt ) );
+
+                for ( UInt iDim(0); iDim < nbCoor; ++iDim )
+                {
+                    const Real* dphiI( stiffBatch.dphi( iDof, iDim, iQuadPt ) );
+                    const Real* dphiJ( stiffBatch.dphi( jDof, iDim, iQuadPt ) );
+
+                    for ( UInt lane(0); lane < W; ++lane )
+                    {
+                        localValue[lane] += dphiI[lane] * dphiJ[lane] * wDet[lane];
+                    }
+                }
+            }
+
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                values[ ( iDof * nbFEDof + jDof ) * W + lane ] = coefficient * localValue[lane];
+                values[ ( jDof * nbFEDof + iDof ) * W + lane ] = coefficient * localValue[lane];
+            }
+        }
+    }
+
+    for ( UInt iDim(0); iDim < fieldDim; ++iDim )
+    {
+        addToBlock( localStiff, values, nbFEDof, nbFEDof, stiffBatch.size(), iDim, iDim );
+    }
+}
+
+void advection( std::vector<MatrixElemental>& localAdv,
+                const CurrentFEBatch& advBatch,
+                const Real& coefficient,
+                const std::vector<Real>& beta,
+                const UInt& fieldDim )
+{
+    const UInt nbFEDof( advBatch.nbFEDof() );
+    const UInt nbQuadPt( advBatch.nbQuadPt() );
+    const UInt nbCoor( advBatch.nbCoor() );
+
+    ASSERT( beta.size() >= nbQuadPt * nbCoor * W, "Missing values of the advection field!" );
+
+    std::vector<Real> values( nbFEDof * nbFEDof * W );
+    Real localValue[W];
+
+    for ( UInt iDof(0); iDof < nbFEDof; ++iDof )
+    {
+        for ( UInt jDof(0); jDof < nbFEDof; ++jDof )
+        {
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                localValue[lane] = 0.0;
+            }
+
+            for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+            {
+                const Real phiI( advBatch.phi( iDof, iQuadPt ) );
+                const Real* wDet( advBatch.wDetJacobian( iQuadPt ) );
+
+                for ( UInt iDim(0); iDim < nbCoor; ++iDim )
+                {
+                    const Real* betaPack( &beta[ ( iQuadPt * nbCoor + iDim ) * W ] );
+                    const Real* dphiJ( advBatch.dphi( jDof, iDim, iQuadPt ) );
+
+                    for ( UInt lane(0); lane < W; ++lane )
+                    {
+                        localValue[lane] += betaPack[lane] * dphiJ[lane] * phiI * wDet[lane];
+                    }
+                }
+            }
+
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                values[ ( iDof * nbFEDof + jDof ) * W + lane ] = coefficient * localValue[lane];
+            }
+        }
+    }
+
+    for ( UInt iDim(0); iDim < fieldDim; ++iDim )
+    {
+        addToBlock( localAdv, values, nbFEDof, nbFEDof, advBatch.size(), iDim, iDim );
+    }
+}
+
+void stiffStrain( std::vector<MatrixElemental>& localStiff,
+                  const CurrentFEBatch& stiffBatch,
+                  const Real& coefficient )
+{
+    const UInt nbFEDof( stiffBatch.nbFEDof() );
+    const UInt nbQuadPt( stiffBatch.nbQuadPt() );
+    const UInt nbCoor( stiffBatch.nbCoor() );
+    const Real halfCoefficient( 0.5 * coefficient );
+
+    // grad u : grad v part, in the diagonal blocks
+    stiffness( localStiff, stiffBatch, halfCoefficient, nbCoor );
+
+    // grad u : (grad v)^T part, in all the blocks
+    std::vector<Real> values( nbFEDof * nbFEDof * W );
+    Real localValue[W];
+
+    for ( UInt iCoor(0); iCoor < nbCoor; ++iCoor )
+    {
+        for ( UInt jCoor(0); jCoor < nbCoor; ++jCoor )
+        {
+            for ( UInt iDof(0); iDof < nbFEDof; ++iDof )
+            {
+                for ( UInt jDof(0); jDof < nbFEDof; ++jDof )
+                {
+                    for ( UInt lane(0); lane < W; ++lane )
+                    {
+                        localValue[lane] = 0.0;
+                    }
+
+                    for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+                    {
+                        const Real* wDet( stiffBatch.wDetJacobian( iQuadPt ) );
+                        const Real* dphiI( stiffBatch.dphi( iDof, jCoor, iQuadPt ) );
+                        const Real* dphiJ( stiffBatch.dphi( jDof, iCoor, iQuadPt ) );
+
+                        for ( UInt lane(0); lane < W; ++lane )
+                        {
+                            localValue[lane] += dphiI[lane] * dphiJ[lane] * wDet[lane];
+                        }
+                    }
+
+                    for ( UInt lane(0); lane < W; ++lane )
+                    {
+                        values[ ( iDof * nbFEDof + jDof ) * W + lane ] = halfCoefficient * localValue[lane];
+                    }
+                }
+            }
+
+            addToBlock( localStiff, values, nbFEDof, nbFEDof, stiffBatch.size(), iCoor, jCoor );
+        }
+    }
+}
+
+void grad( std::vector<MatrixElemental>& localGrad,
+           const CurrentFEBatch& uBatch,
+           const CurrentFEBatch& pBatch,
+           const Real& coefficient )
+{
+    const UInt nbUDof( uBatch.nbFEDof() );
+    const UInt nbPDof( pBatch.nbFEDof() );
+    const UInt nbQuadPt( uBatch.nbQuadPt() );
+    const UInt nbCoor( uBatch.nbCoor() );
+
+    ASSERT( pBatch.nbQuadPt() == nbQuadPt, "The batches must use the same quadrature rule!" );
+
+    std::vector<Real> values( nbUDof * nbPDof * W );
+    Real localValue[W];
+
+    for ( UInt iCoor(0); iCoor < nbCoor; ++iCoor )
+    {
+        for ( UInt iDof(0); iDof < nbUDof; ++iDof )
+        {
+            for ( UInt jDof(0); jDof < nbPDof; ++jDof )
+            {
+                for ( UInt lane(0); lane < W; ++lane )
+                {
+                    localValue[lane] = 0.0;
+                }
+
+                for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+                {
+                    const Real phiP( pBatch.phi( jDof, iQuadPt ) );
+                    const Real* dphiU( uBatch.dphi( iDof, iCoor, iQuadPt ) );
+                    const Real* wDet( uBatch.wDetJacobian( iQuadPt ) );
+
+                    for ( UInt lane(0); lane < W; ++lane )
+                    {
+                        localValue[lane] -= phiP * dphiU[lane] * wDet[lane];
+                    }
+                }
+
+                for ( UInt lane(0); lane < W; ++lane )
+                {
+                    values[ ( iDof * nbPDof + jDof ) * W + lane ] = coefficient * localValue[lane];
+                }
+            }
+        }
+
+        addToBlock( localGrad, values, nbUDof, nbPDof, uBatch.size(), iCoor, 0 );
+    }
+}
+
+void divergence( std::vector<MatrixElemental>& localDiv,
+                 const CurrentFEBatch& uBatch,
+                 const CurrentFEBatch& pBatch,
+                 const Real& coefficient )
+{
+    const UInt nbUDof( uBatch.nbFEDof() );
+    const UInt nbPDof( pBatch.nbFEDof() );
+    const UInt nbQuadPt( uBatch.nbQuadPt() );
+    const UInt nbCoor( uBatch.nbCoor() );
+
+    ASSERT( pBatch.nbQuadPt() == nbQuadPt, "The batches must use the same quadrature rule!" );
+
+    std::vector<Real> values( nbPDof * nbUDof * W );
+    Real localValue[W];
+
+    for ( UInt iCoor(0); iCoor < nbCoor; ++iCoor )
+    {
+        for ( UInt iDof(0); iDof < nbPDof; ++iDof )
+        {
+            for ( UInt jDof(0); jDof < nbUDof; ++jDof )
+            {
+                for ( UInt lane(0); lane < W; ++lane )
+                {
+                    localValue[lane] = 0.0;
+                }
+
+                for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+                {
+                    const Real phiP( pBatch.phi( iDof, iQuadPt ) );
+                    const Real* dphiU( uBatch.dphi( jDof, iCoor, iQuadPt ) );
+                    const Real* wDet( uBatch.wDetJacobian( iQuadPt ) );
+
+                    for ( UInt lane(0); lane < W; ++lane )
+                    {
+                        localValue[lane] -= phiP * dphiU[lane] * wDet[lane];
+                    }
+                }
+
+                for ( UInt lane(0); lane < W; ++lane )
+                {
+                    values[ ( iDof * nbUDof + jDof ) * W + lane ] = coefficient * localValue[lane];
+                }
+            }
+        }
+
+        addToBlock( localDiv, values, nbPDof, nbUDof, uBatch.size(), 0, iCoor );
+    }
+}
+
+} // Namespace AssemblyElemental
+
+} // Namespace LifeV
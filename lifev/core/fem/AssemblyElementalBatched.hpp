@@ -0,0 +1,153 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the batched procedures for the local assembly of the differential operators
+
+    These procedures compute the local matrices of the cells of a CurrentFEBatch in lock-step:
+    each quadrature sum is evaluated for all the cells of the batch at once, the innermost loop
+    running over the lanes of the batch. The local matrices are then added to one MatrixElemental
+    per lane, so that they can be assembled with the usual assembleMatrix.
+
+    The results are the same of the corresponding procedures in AssemblyElemental.hpp, up to round-off.
+
+    @date 19-10-2012
+ */
+
+#ifndef ASSEMBLYELEMENTALBATCHED_H
+#define ASSEMBLYELEMENTALBATCHED_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixElemental.hpp>
+#include <lifev/core/fem/CurrentFEBatch.hpp>
+#include <lifev/core/fem/DOF.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+namespace AssemblyElemental
+{
+
+//! @name Batched procedures
+//@{
+
+//! Interpolation of a vectorial field in the quadrature nodes of the cells of the batch
+/*!
+  The values are stored with the lane as fastest index: localValues[ ( iQuadPt * fieldDim + iDim ) * S_batchSize + lane ].
+  The lanes that are not assembled are set to zero.
+ */
+template<typename globalVector>
+void interpolate( std::vector<Real>& localValues,
+                  const CurrentFEBatch& interpBatch,
+                  const UInt& fieldDim,
+                  const DOF& betaDof,
+                  const globalVector& beta )
+{
+    const UInt W( CurrentFEBatch::S_batchSize );
+    const UInt nbQuadPt( interpBatch.nbQuadPt() );
+    const UInt nbFEDof( interpBatch.nbFEDof() );
+    const UInt totalDof( betaDof.numTotalDof() );
+
+    localValues.assign( nbQuadPt * fieldDim * W, 0.0 );
+
+    for ( UInt lane(0); lane < interpBatch.size(); ++lane )
+    {
+        const UInt elementID( interpBatch.localId( lane ) );
+
+        for ( UInt iDof(0); iDof < nbFEDof; ++iDof )
+        {
+            const UInt globalDof( betaDof.localToGlobalMap( elementID, iDof ) );
+
+            for ( UInt iterDim(0); iterDim < fieldDim; ++iterDim )
+            {
+                const Real betaValue( beta[ globalDof + iterDim * totalDof ] );
+
+                for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+                {
+                    localValues[ ( iQuadPt * fieldDim + iterDim ) * W + lane ] += betaValue * interpBatch.phi( iDof, iQuadPt );
+                }
+            }
+        }
+    }
+}
+
+//! Mass matrix, copied in the fieldDim diagonal blocks of the local matrix of each lane
+void mass( std::vector<MatrixElemental>& localMass,
+           const CurrentFEBatch& massBatch,
+           const Real& coefficient,
+           const UInt& fieldDim );
+
+//! Stiffness matrix, copied in the fieldDim diagonal blocks of the local matrix of each lane
+void stiffness( std::vector<MatrixElemental>& localStiff,
+                const CurrentFEBatch& stiffBatch,
+                const Real& coefficient,
+                const UInt& fieldDim );
+
+//! Advection matrix (beta . grad u, v), copied in the fieldDim diagonal blocks of the local matrix of each lane
+/*!
+  @param beta Values of the advection field in the quadrature nodes, as given by the batched interpolate
+ */
+void advection( std::vector<MatrixElemental>& localAdv,
+                const CurrentFEBatch& advBatch,
+                const Real& coefficient,
+                const std::vector<Real>& beta,
+                const UInt& fieldDim );
+
+//! Stiffness matrix of the symmetric gradient: coefficient * ( e(u) , e(v) ), as stiff_strain
+void stiffStrain( std::vector<MatrixElemental>& localStiff,
+                  const CurrentFEBatch& stiffBatch,
+                  const Real& coefficient );
+
+//! Gradient matrix: - coefficient * \int q_j \frac{\partial v_i}{\partial x_icoor}, in the blocks (icoor,0), as grad
+/*!
+  The two batches must be updated on the same cells with the same quadrature rule.
+ */
+void grad( std::vector<MatrixElemental>& localGrad,
+           const CurrentFEBatch& uBatch,
+           const CurrentFEBatch& pBatch,
+           const Real& coefficient );
+
+//! Divergence matrix: - coefficient * \int q_i \frac{\partial v_j}{\partial x_icoor}, in the blocks (0,icoor)
+/*!
+  This is the transposed of the gradient matrix. The two batches must be updated on the same
+  cells with the same quadrature rule.
+ */
+void divergence( std::vector<MatrixElemental>& localDiv,
+                 const CurrentFEBatch& uBatch,
+                 const CurrentFEBatch& pBatch,
+                 const Real& coefficient );
+
+//@}
+
+} // Namespace AssemblyElemental
+
+} // Namespace LifeV
+
+#endif /* ASSEMBLYELEMENTALBATCHED_H */
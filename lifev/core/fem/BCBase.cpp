@@ -89,6 +89,9 @@ BCBase::BCBase( const bcName_Type& name, const bcFlag_Type& flag,
         M_isStored_BcVector( false ),
         M_isStored_BcFunctionVectorDependent(false),
         M_offset( -1 ),
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
 	if ( M_mode != Component )
@@ -113,6 +116,9 @@ BCBase::BCBase( const bcName_Type& name,
         M_isStored_BcVector( false ),
         M_isStored_BcFunctionVectorDependent(false),
         M_offset( -1 ),
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
     UInt numberOfComponents;
@@ -173,6 +179,9 @@ BCBase::BCBase( const bcName_Type& name,
         M_isStored_BcVector( false ),
         M_isStored_BcFunctionVectorDependent(false),
         M_offset( -1 ),
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
     if ( M_mode != Full )
@@ -204,6 +213,9 @@ BCBase::BCBase( const bcName_Type& name,
         M_isStored_BcVector( true ),
         M_isStored_BcFunctionVectorDependent(false),
         M_offset( -1 ),
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
 	if ( mode != Component )
@@ -229,6 +241,9 @@ BCBase::BCBase( const bcName_Type& name,
         M_isStored_BcVector( true ),
         M_isStored_BcFunctionVectorDependent(false),
         M_offset( 0 ), // The others are initialize to -1 we should follow a common convention.
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
     UInt numberOfComponents;
@@ -282,6 +297,9 @@ BCBase::BCBase( const bcName_Type& name,
         M_isStored_BcVector( true ),
         M_isStored_BcFunctionVectorDependent(false),
         M_offset( -1 ),
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
     if ( mode != Full )
@@ -312,6 +330,9 @@ BCBase::BCBase( const bcName_Type&     name,
         M_isStored_BcVector( false ),
         M_isStored_BcFunctionVectorDependent(true),
         M_offset( 0 ), // The others are initialize to -1 we should follow a common convention.
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
 	if ( M_mode != Component )
@@ -336,6 +357,9 @@ BCBase::BCBase( const bcName_Type&  name,
         M_isStored_BcVector( false ),
         M_isStored_BcFunctionVectorDependent(true),
         M_offset( -1 ),
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
 
@@ -387,6 +411,9 @@ BCBase::BCBase( const bcName_Type&  name,
         M_isStored_BcVector( false ),
         M_isStored_BcFunctionVectorDependent(true),
         M_offset( -1 ),
+        M_spatialProfiles(),
+        M_numProfilePoints( 0 ),
+        M_profilesGeometryVersion( 0 ),
         M_finalized( false )
 {
     if ( M_mode != Full )
@@ -414,6 +441,9 @@ BCBase::BCBase( const BCBase& bcBase ) :
         M_idSet                                 ( ),
         M_idVector                              ( ),
         M_offset                                ( bcBase.M_offset ),
+        M_spatialProfiles                       ( ),
+        M_numProfilePoints                      ( 0 ),
+        M_profilesGeometryVersion               ( 0 ),
         M_finalized                             ( bcBase.M_finalized )
 {
     // If the shared_ptr is not empty we make a true copy
@@ -506,6 +536,11 @@ const BCFunctionBase* BCBase::pointerToFunctor() const
     return M_bcFunction.get();
 }
 
+const BCFunctionSeparable* BCBase::pointerToSeparableFunctor() const
+{
+    return dynamic_cast<const BCFunctionSeparable*>( M_bcFunction.get() );
+}
+
 const BCFunctionUDepBase* BCBase::pointerToFunctorUDep() const
 {
     return M_bcFunctionFEVectorDependent.get();
@@ -594,6 +629,8 @@ BCBase & BCBase::operator=( const BCBase& BCb )
     M_offset  = BCb.M_offset;
     M_finalized = BCb.M_finalized;
     M_components = BCb.M_components;
+    M_spatialProfiles.clear();
+    M_numProfilePoints = 0;
 
     // Important!!: The set member M_idSet is always empty at this
     // point, it is just an auxiliary container used at the moment of
@@ -661,6 +698,10 @@ BCBase::setBCFunction( const BCFunctionBase& bcFunction )
     M_bcFunction = bcFunction.clone();
     M_isStored_BcVector = false;
     M_isStored_BcFunctionVectorDependent=false;
+
+    // The profiles of the previous function are not valid anymore
+    M_spatialProfiles.clear();
+    M_numProfilePoints = 0;
 }
 
 void
@@ -671,6 +712,15 @@ BCBase::setBCFunction( const BCFunctionUDepBase& bcFunctionFEVectorDependent )
     M_isStored_BcFunctionVectorDependent=true;
 }
 
+void
+BCBase::setSpatialProfiles( const std::vector<Real>& spatialProfiles, const UInt& numProfilePoints,
+                            const UInt& geometryVersion )
+{
+    M_spatialProfiles = spatialProfiles;
+    M_numProfilePoints = numProfilePoints;
+    M_profilesGeometryVersion = geometryVersion;
+}
+
 
 // ===================================================
 // Get Methods
@@ -752,6 +802,17 @@ bool BCBase::isUDep() const
     return M_isStored_BcFunctionVectorDependent;
 }
 
+bool BCBase::isSeparable() const
+{
+    return !M_isStored_BcVector && !M_isStored_BcFunctionVectorDependent && pointerToSeparableFunctor() != 0;
+}
+
+bool BCBase::hasSpatialProfiles( const UInt& numProfilePoints, const UInt& geometryVersion ) const
+{
+    return isSeparable() && !M_spatialProfiles.empty() && M_numProfilePoints == numProfilePoints
+           && M_profilesGeometryVersion == geometryVersion;
+}
+
 
 // ===================================================
 // Private Methods
@@ -386,6 +386,31 @@ public:
      */
     const BCFunctionUDepBase* pointerToFunctorUDep() const;
 
+    //! Returns a pointer to the BCFunctionSeparable object
+    /*!
+       @return pointer to the BCFunctionSeparable object, 0 if the function is not separable
+     */
+    const BCFunctionSeparable* pointerToSeparableFunctor() const;
+
+    //! Value of a separable function from the precomputed spatial profiles
+    /*!
+       To be called only if hasSpatialProfiles() is true.
+       @param timeCoefficients time coefficients of the separable function (see BCFunctionSeparable::timeCoefficients)
+       @param i index of the identifier in the list
+       @param iPoint index of the point in the identifier (the quadrature node for Natural conditions, 0 otherwise)
+       @param j index of the component in the list of components of this boundary condition
+       @return the value of the function in the point
+     */
+    Real separableValue( const std::vector<Real>& timeCoefficients, const ID& i, const ID& iPoint, const ID& j ) const
+    {
+        const UInt numTerms( timeCoefficients.size() );
+        const Real* profiles( &M_spatialProfiles[ ( ( i * M_numProfilePoints + iPoint ) * M_components.size() + j ) * numTerms ] );
+        Real value( 0. );
+        for ( UInt k( 0 ); k < numTerms; ++k )
+            value += timeCoefficients[ k ] * profiles[ k ];
+        return value;
+    }
+
     //! Returns a pointer to the BCVector object
     /*!
        @return pointer to the BCVector object
@@ -516,6 +541,17 @@ public:
      */
     void setBCFunction( const BCFunctionUDepBase& bcFunctionFEVectorDependent );
 
+    //! Set the values of the spatial profiles of a separable function
+    /*!
+       The values are ordered by identifier, point, component and term (see BCHandler::bcUpdate)
+       @param spatialProfiles values of the spatial profiles
+       @param numProfilePoints number of points per identifier
+       @param geometryVersion version of the mesh geometry on which the points have been computed
+              (see MeshTransformer::geometryVersion), 0 if the points do not depend on it
+     */
+    void setSpatialProfiles( const std::vector<Real>& spatialProfiles, const UInt& numProfilePoints,
+                             const UInt& geometryVersion = 0 );
+
     //! Set the BC offset
     /*!
        @param bcOffset to be set in BCBase class
@@ -605,6 +641,21 @@ public:
      */
     bool isUDep() const;
 
+    //! Returns True if the BCBase is based on a BCFunctionSeparable function, False otherwise
+    /*!
+       @return True if the BCBase is based on a BCFunctionSeparable function, False otherwise
+     */
+    bool isSeparable() const;
+
+    //! Returns True if the spatial profiles of the separable function have been computed
+    /*!
+       @param numProfilePoints expected number of points per identifier
+       @param geometryVersion current version of the mesh geometry, the profiles computed on another one
+              are not valid anymore
+       @return True if the spatial profiles are available for numProfilePoints points per identifier
+     */
+    bool hasSpatialProfiles( const UInt& numProfilePoints = 1, const UInt& geometryVersion = 0 ) const;
+
 
     //@}
 private:
@@ -635,6 +686,12 @@ private:
 
     int M_offset; //!< boundary condition offset
 
+    std::vector<Real> M_spatialProfiles; //!< values of the spatial profiles of a separable function
+
+    UInt M_numProfilePoints; //!< number of points per identifier in M_spatialProfiles
+
+    UInt M_profilesGeometryVersion; //!< version of the mesh geometry of the points of M_spatialProfiles
+
     bool M_finalized; //!< True, when M_idVector is finalized
 
     //!< Copy content of M_idSet into M_idVector, clear M_idSet
@@ -40,6 +40,8 @@
 #include <lifev/core/LifeV.hpp>
 #include <lifev/core/fem/BCFunction.hpp>
 
+#include <boost/bind.hpp>
+
 namespace LifeV
 {
 
@@ -152,6 +154,93 @@ createBCFunctionRobin( BCFunctionBase const* __bc )
 }
 
 
+//==================================================
+// BCFunctionSeparable
+//==================================================
+
+//==================================================
+// Constructors
+//==================================================
+
+BCFunctionSeparable::BCFunctionSeparable()
+        :
+        BCFunctionBase(),
+        M_timeFunctions(),
+        M_spaceFunctions()
+{
+    setFunction( boost::bind( &BCFunctionSeparable::evaluate, this, _1, _2, _3, _4, _5 ) );
+}
+
+BCFunctionSeparable::BCFunctionSeparable( const timeFunction_Type& timeFunction, const spaceFunction_Type& spaceFunction )
+        :
+        BCFunctionBase(),
+        M_timeFunctions( 1, timeFunction ),
+        M_spaceFunctions( 1, spaceFunction )
+{
+    setFunction( boost::bind( &BCFunctionSeparable::evaluate, this, _1, _2, _3, _4, _5 ) );
+}
+
+BCFunctionSeparable::BCFunctionSeparable( const BCFunctionSeparable& bcFunctionSeparable )
+        :
+        BCFunctionBase(),
+        M_timeFunctions( bcFunctionSeparable.M_timeFunctions ),
+        M_spaceFunctions( bcFunctionSeparable.M_spaceFunctions )
+{
+    // The function of the base class must be bound to this object, not to the copied one
+    setFunction( boost::bind( &BCFunctionSeparable::evaluate, this, _1, _2, _3, _4, _5 ) );
+}
+
+
+//==================================================
+// Operators
+//==================================================
+
+BCFunctionSeparable&
+BCFunctionSeparable::operator=( const BCFunctionSeparable& bcFunctionSeparable )
+{
+    if ( this != &bcFunctionSeparable )
+    {
+        M_timeFunctions  = bcFunctionSeparable.M_timeFunctions;
+        M_spaceFunctions = bcFunctionSeparable.M_spaceFunctions;
+    }
+    return *this;
+}
+
+
+//==================================================
+// Methods
+//==================================================
+
+void
+BCFunctionSeparable::addTerm( const timeFunction_Type& timeFunction, const spaceFunction_Type& spaceFunction )
+{
+    M_timeFunctions.push_back( timeFunction );
+    M_spaceFunctions.push_back( spaceFunction );
+}
+
+void
+BCFunctionSeparable::timeCoefficients( const Real& t, std::vector<Real>& timeCoefficients ) const
+{
+    timeCoefficients.resize( M_timeFunctions.size() );
+    for ( UInt k( 0 ); k < M_timeFunctions.size(); ++k )
+        timeCoefficients[ k ] = M_timeFunctions[ k ]( t );
+}
+
+
+//==================================================
+// Private Methods
+//==================================================
+
+Real
+BCFunctionSeparable::evaluate( const Real& t, const Real& x, const Real& y, const Real& z, const ID& component ) const
+{
+    Real value( 0. );
+    for ( UInt k( 0 ); k < M_timeFunctions.size(); ++k )
+        value += M_timeFunctions[ k ]( t ) * M_spaceFunctions[ k ]( x, y, z, component );
+    return value;
+}
+
+
 //==================================================
 // BCFunctionUDepBase
 //==================================================
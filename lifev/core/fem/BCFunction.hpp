@@ -337,6 +337,154 @@ private:
 };
 
 
+//! BCFunctionSeparable - class that holds a boundary data separable in time and space.
+/*!
+  This class holds a function of the form
+
+  @verbatim
+  f(t, x, y, z, component) = sum_k a_k(t) g_k(x, y, z, component)
+  @endverbatim
+
+  where the time coefficients and the spatial profiles given by the user must have the following signatures
+
+  @verbatim
+  Real a(const Real& t)
+  Real g(const Real& x, const Real& y, const Real& z, const ID& component)
+  @endverbatim
+
+  The terms are added with @c addTerm(a, g). The class can be used everywhere a BCFunctionBase is expected,
+  the @c operator() summing the terms. Moreover, @c BCHandler::bcUpdate evaluates the spatial profiles
+  on the boundary DOFs (Essential conditions) and quadrature nodes (Natural conditions) once, so that
+  the functions in BCManage.hpp evaluate only the time coefficients at each time step.
+
+  On a moving mesh, the profiles of the Essential conditions are evaluated on the coordinates of the
+  DOFs stored by @c bcUpdate, which are also the ones used for any other BCFunctionBase. The profiles
+  of the Natural conditions are tagged with the version of the mesh geometry (see
+  MeshTransformer::geometryVersion): once the mesh is moved, @c bcNaturalManage evaluates the whole
+  function on the new quadrature nodes, as for any other BCFunctionBase.
+*/
+class BCFunctionSeparable : public BCFunctionBase
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef BCFunctionBase::function_Type function_Type;
+    typedef boost::function<Real ( const Real& )> timeFunction_Type;
+    typedef boost::function<Real ( const Real&, const Real&, const Real&, const ID& )> spaceFunction_Type;
+
+    //@}
+
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Empty constructor
+    /*!
+      The user must supply the terms by calling addTerm(..)
+    */
+    BCFunctionSeparable();
+
+    //! Constructor for a function with a single term
+    /*!
+      @param timeFunction The time coefficient a(t)
+      @param spaceFunction The spatial profile g(x,y,z,component)
+    */
+    BCFunctionSeparable( const timeFunction_Type& timeFunction, const spaceFunction_Type& spaceFunction );
+
+    //! Copy Constructor
+    /*!
+      @param bcFunctionSeparable The BCFunctionSeparable
+    */
+    BCFunctionSeparable( const BCFunctionSeparable& bcFunctionSeparable );
+
+    //! Destructor
+    virtual ~BCFunctionSeparable() {}
+
+    //@}
+
+
+    //! @name Operators
+    //@{
+
+    //! Assignment operator
+    /*!
+      @param bcFunctionSeparable The BCFunctionSeparable object
+      @return Reference to a new BCFunctionSeparable object which is a copy of bcFunctionSeparable
+    */
+    BCFunctionSeparable&
+    operator=( const BCFunctionSeparable& bcFunctionSeparable );
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Clone the current object
+    /*!
+      @return Pointer to the cloned object
+    */
+    BCFunctionBase::BCFunctionBasePtr_Type clone() const
+    {
+        BCFunctionBase::BCFunctionBasePtr_Type copy ( new BCFunctionSeparable( *this ) );
+        return copy;
+    }
+
+    //! Add the term a(t) g(x,y,z,component)
+    /*!
+      @param timeFunction The time coefficient a(t)
+      @param spaceFunction The spatial profile g(x,y,z,component)
+    */
+    void addTerm( const timeFunction_Type& timeFunction, const spaceFunction_Type& spaceFunction );
+
+    //! Evaluate the time coefficients
+    /*!
+      @param t Time
+      @param timeCoefficients Vector filled with the coefficients a_k(t)
+    */
+    void timeCoefficients( const Real& t, std::vector<Real>& timeCoefficients ) const;
+
+    //! Evaluate the spatial profile of the k-th term
+    /*!
+      @param k Index of the term
+      @param x Coordinate
+      @param y Coordinate
+      @param z Coordinate
+      @param component The component of the vector function
+      @return The selected component of the k-th spatial profile evaluated in (x,y,z)
+    */
+    Real spatialProfile( const UInt& k, const Real& x, const Real& y, const Real& z, const ID& component ) const
+    { return M_spaceFunctions[ k ]( x, y, z, component ); }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Get the number of terms
+    /*!
+      @return Number of terms of the function
+    */
+    UInt numberOfTerms() const { return M_timeFunctions.size(); }
+
+    //@}
+
+private:
+
+    //! Sum of the terms, used as the user defined function of the base class
+    Real evaluate( const Real& t, const Real& x, const Real& y, const Real& z, const ID& component ) const;
+
+    //! time coefficients a_k(t)
+    std::vector<timeFunction_Type>  M_timeFunctions;
+
+    //! spatial profiles g_k(x,y,z,component)
+    std::vector<spaceFunction_Type> M_spaceFunctions;
+};
+
+
 //! BCFunctionUDepBase - class that holds the function used for prescribing boundary conditions.
 /*!
    @author Miguel Fernandez
@@ -337,6 +337,9 @@ public:
       In particular, if two Essential boundary conditions share the same DOF, it will be prescribed the condition with the largest flag.
       This behavior is due to the fact that the largest boundary condition is the last to be prescribed.
 
+      The spatial profiles of the BCFunctionSeparable functions are evaluated on the DOFs (Essential conditions)
+      and on the quadrature nodes of the current mesh geometry (Natural conditions), see BCFunctionSeparable.
+
       Finally M_bcUpdateDone is set to true, and it is possible to prescribed boundary conditions using functions in BCManage.hpp.
 
       @param mesh The mesh
@@ -795,6 +798,56 @@ BCHandler::bcUpdate( Mesh& mesh, CurrentBoundaryFE& boundaryFE, const DOF& dof )
         bcBaseIterator->copyIdSetIntoIdVector();
     }
 
+    // ============================================================================
+    // The spatial profiles of the separable functions are evaluated once for all:
+    // on the DOFs for Essential conditions, on the quadrature nodes for Natural ones
+    // ============================================================================
+    for ( bcBaseIterator = M_bcList.begin(); bcBaseIterator != M_bcList.end(); ++bcBaseIterator )
+    {
+        if ( !bcBaseIterator->isSeparable() )
+            continue;
+
+        const BCFunctionSeparable& separableFunction( *bcBaseIterator->pointerToSeparableFunctor() );
+        const UInt numTerms( separableFunction.numberOfTerms() );
+        const UInt numComponents( bcBaseIterator->numberOfComponents() );
+        std::vector<Real> spatialProfiles;
+
+        switch ( bcBaseIterator->type() )
+        {
+        case Essential:
+        case EssentialEdges:
+        case EssentialVertices:
+            spatialProfiles.reserve( bcBaseIterator->list_size() * numComponents * numTerms );
+            for ( ID i = 0; i < bcBaseIterator->list_size(); ++i )
+            {
+                const BCIdentifierEssential* identifier( static_cast< const BCIdentifierEssential* >( ( *bcBaseIterator )[ i ] ) );
+                for ( ID j = 0; j < numComponents; ++j )
+                    for ( UInt k = 0; k < numTerms; ++k )
+                        spatialProfiles.push_back( separableFunction.spatialProfile( k, identifier->x(), identifier->y(), identifier->z(),
+                                                                                     bcBaseIterator->component( j ) ) );
+            }
+            bcBaseIterator->setSpatialProfiles( spatialProfiles, 1 );
+            break;
+
+        case Natural:
+            spatialProfiles.reserve( bcBaseIterator->list_size() * boundaryFE.nbQuadPt() * numComponents * numTerms );
+            for ( ID i = 0; i < bcBaseIterator->list_size(); ++i )
+            {
+                boundaryFE.updateMeasNormalQuadPt( mesh.boundaryFacet( ( *bcBaseIterator )[ i ]->id() ) );
+                for ( UInt iq = 0; iq < boundaryFE.nbQuadPt(); ++iq )
+                    for ( ID j = 0; j < numComponents; ++j )
+                        for ( UInt k = 0; k < numTerms; ++k )
+                            spatialProfiles.push_back( separableFunction.spatialProfile( k, boundaryFE.quadPt( iq, 0 ), boundaryFE.quadPt( iq, 1 ),
+                                                                                         boundaryFE.quadPt( iq, 2 ), bcBaseIterator->component( j ) ) );
+            }
+            bcBaseIterator->setSpatialProfiles( spatialProfiles, boundaryFE.nbQuadPt(), mesh.meshTransformer().geometryVersion() );
+            break;
+
+        default:
+            break;
+        }
+    }
+
     M_bcUpdateDone = true;
 } // bcUpdate
 
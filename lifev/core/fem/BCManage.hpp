@@ -1074,6 +1074,26 @@ bcEssentialManage( MatrixType& matrix,
             }
         }
     }
+    else if ( boundaryCond.hasSpatialProfiles() )
+    { //! If BC is given by a separable function, only the time coefficients are evaluated
+
+        std::vector<Real> timeCoefficients;
+        boundaryCond.pointerToSeparableFunctor()->timeCoefficients( time, timeCoefficients );
+
+        // Loop on BC identifiers
+        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
+        {
+            // Loop on components involved in this boundary condition
+            for ( ID j = 0; j < nComp; ++j )
+            {
+                // Global Dof
+                idDof = boundaryCond[ i ] ->id() + boundaryCond.component( j ) * totalDof + offset;
+
+                datumVec.push_back( boundaryCond.separableValue( timeCoefficients, i, 0, j ) );
+                idDofVec.push_back(idDof);
+            }
+        }
+    }
     else
     { //! If BC is given under a functional form
 
@@ -1328,6 +1348,26 @@ bcEssentialManageRhs( VectorType&     rightHandSide,
             }
         }
     }
+    else if ( boundaryCond.hasSpatialProfiles() )
+    {  //! If BC is given by a separable function, only the time coefficients are evaluated
+
+        std::vector<Real> timeCoefficients;
+        boundaryCond.pointerToSeparableFunctor()->timeCoefficients( time, timeCoefficients );
+
+        // Loop on BC identifiers
+        for ( ID i = 0; i < boundaryCond.list_size(); ++i )
+        {
+            // Loop on components involved in this boundary condition
+            for ( ID j = 0; j < nComp; ++j )
+            {
+                // Global Dof
+                idDof = boundaryCond[ i ] ->id() + boundaryCond.component( j ) * totalDof + offset;
+
+                idDofVec.push_back( idDof );
+                datumVec.push_back( diagonalizeCoef * boundaryCond.separableValue( timeCoefficients, i, 0, j ) );
+            }
+        }
+    }
     else
     {  //! If BC is given under a functional form
 
@@ -1531,8 +1571,16 @@ bcNaturalManage( VectorType& rightHandSide,
     {  //! If BC is given under a functional form
 
         DataType x, y, z;
+        Real datum;
         VectorType rhsRepeated(rightHandSide.map(),Repeated);
 
+        // With a separable function the spatial profiles on the quadrature nodes are already known,
+        // unless the mesh has moved since they have been computed
+        const bool separable( boundaryCond.hasSpatialProfiles( currentBdFE.nbQuadPt(), mesh.meshTransformer().geometryVersion() ) );
+        std::vector<Real> timeCoefficients;
+        if ( separable )
+            boundaryCond.pointerToSeparableFunctor()->timeCoefficients( time, timeCoefficients );
+
         // Loop on BC identifiers
         for ( ID i = 0; i < boundaryCond.list_size(); ++i )
         {
@@ -1541,7 +1589,10 @@ bcNaturalManage( VectorType& rightHandSide,
             // Number of the current boundary face
             ibF = pId->id();
             // Updating face stuff
-            currentBdFE.updateMeasNormalQuadPt( mesh.boundaryFacet( ibF ) );
+            if ( separable )
+                currentBdFE.updateMeasNormal( mesh.boundaryFacet( ibF ) );
+            else
+                currentBdFE.updateMeasNormalQuadPt( mesh.boundaryFacet( ibF ) );
             // Loop on total DOF per Face
             for ( ID idofF = 0; idofF < nDofF; ++idofF )
             {
@@ -1552,23 +1603,30 @@ bcNaturalManage( VectorType& rightHandSide,
                     // Loop on quadrature points
                     for ( int iq = 0; iq < (int)currentBdFE.nbQuadPt(); ++iq )
                     {
-                        // quadrature point coordinates
-                        x = currentBdFE.quadPt(iq, 0);
-                        y = currentBdFE.quadPt(iq, 1);
-                        z = currentBdFE.quadPt(iq, 2);
+                        if ( separable )
+                            datum = boundaryCond.separableValue( timeCoefficients, i, iq, j );
+                        else
+                        {
+                            // quadrature point coordinates
+                            x = currentBdFE.quadPt(iq, 0);
+                            y = currentBdFE.quadPt(iq, 1);
+                            z = currentBdFE.quadPt(iq, 2);
+
+                            datum = boundaryCond( time, x, y, z, boundaryCond.component( j ) );
+                        }
 
                         switch (boundaryCond.mode())
                         {
                         case Full:
-                            rhsRepeated[ idDof ] += currentBdFE.phi( int( idofF ), iq ) * boundaryCond( time, x, y, z, boundaryCond.component( j ) ) *
+                            rhsRepeated[ idDof ] += currentBdFE.phi( int( idofF ), iq ) * datum *
                                                     currentBdFE.weightMeas( iq );
                             break;
                         case Component:
-                            rhsRepeated[ idDof ] += currentBdFE.phi( int( idofF ), iq ) * boundaryCond( time, x, y, z, boundaryCond.component( j ) ) *
+                            rhsRepeated[ idDof ] += currentBdFE.phi( int( idofF ), iq ) * datum *
                                                     currentBdFE.weightMeas( iq );
                             break;
                         case Normal:
-                            rhsRepeated[ idDof ] += boundaryCond( time, x, y, z, boundaryCond.component( j ) )*
+                            rhsRepeated[ idDof ] += datum *
                                                     currentBdFE.phi( int( idofF ), iq )*
                                                     currentBdFE.weightMeas( iq )*currentBdFE.normal( int(j), iq );
                             break;
@@ -54,6 +54,7 @@ CurrentFE::CurrentFE( const ReferenceFE& refFE, const GeometricMap& geoMap, cons
         M_refFE( &refFE ),
         M_geoMap( &geoMap),
         M_quadRule(new QuadratureRule(qr)),
+        M_geometryCache(),
 
 
         M_cellNodes(boost::extents[geoMap.nbDof()][nDimensions]),
@@ -171,6 +172,7 @@ CurrentFE::CurrentFE( const ReferenceFE& refFE, const GeometricMap& geoMap )
         M_refFE( & refFE ),
         M_geoMap( &geoMap ),
         M_quadRule( 0 ),
+        M_geometryCache(),
 
 
         M_cellNodes(boost::extents[geoMap.nbDof()][nDimensions]),
@@ -511,6 +513,85 @@ void CurrentFE::update(const std::vector<std::vector<Real> >& pts, const flag_Ty
     };
 }
 
+void CurrentFE::updateCached(const std::vector<std::vector<Real> >& pts, const flag_Type& upFlag)
+{
+    ASSERT(M_nbQuadPt!=0," No quadrature rule defined, cannot update!");
+
+    const flag_Type geometryFlag( UPDATE_ONLY_JACOBIAN
+                                  | UPDATE_ONLY_T_INVERSE_JACOBIAN
+                                  | UPDATE_ONLY_DET_JACOBIAN
+                                  | UPDATE_ONLY_W_DET_JACOBIAN );
+
+    M_cellNodesUpdated=false;
+    if ( (upFlag & UPDATE_ONLY_CELL_NODES) != 0)
+    {
+        computeCellNodes(pts);
+    };
+
+    M_quadNodesUpdated=false;
+    if ( (upFlag & UPDATE_ONLY_QUAD_NODES) != 0)
+    {
+        computeQuadNodes();
+    };
+
+    M_jacobianUpdated=false;
+    M_tInverseJacobianUpdated=false;
+    M_detJacobianUpdated=false;
+    M_wDetJacobianUpdated=false;
+    if ( (upFlag & geometryFlag) != 0)
+    {
+        if ( M_geometryCache->isStored(M_currentLocalId) )
+        {
+            M_geometryCache->restore(M_currentLocalId,
+                                     M_jacobian.data(),
+                                     M_tInverseJacobian.data(),
+                                     M_detJacobian.data(),
+                                     M_wDetJacobian.data());
+
+            M_jacobianUpdated=true;
+            M_tInverseJacobianUpdated=true;
+            M_detJacobianUpdated=true;
+            M_wDetJacobianUpdated=true;
+        }
+        else
+        {
+            // All the geometric quantities are computed, to be stored
+            if (!M_cellNodesUpdated)
+            {
+                computeCellNodes(pts);
+            }
+            computeJacobian();
+            computeTInverseJacobian();
+            computeDetJacobian();
+            computeWDetJacobian();
+
+            M_geometryCache->store(M_currentLocalId,
+                                   M_jacobian.data(),
+                                   M_tInverseJacobian.data(),
+                                   M_detJacobian.data(),
+                                   M_wDetJacobian.data());
+        }
+    };
+
+    M_dphiUpdated=false;
+    if ( (upFlag & UPDATE_ONLY_DPHI) != 0)
+    {
+        computeDphi();
+    };
+
+    M_d2phiUpdated=false;
+    if ( (upFlag & UPDATE_ONLY_D2PHI) != 0)
+    {
+        computeD2phi();
+    };
+
+    M_phiVectUpdated=false;
+    if ( (upFlag & UPDATE_ONLY_PHI_VECT) != 0)
+    {
+        computePhiVect();
+    };
+}
+
 void CurrentFE::update(const std::vector<GeoVector>& pts, const flag_Type& upFlag)
 {
     std::vector< std::vector <Real > > newpts(pts.size(), std::vector<Real> (pts[0].size()));
@@ -50,6 +50,7 @@
 #include <lifev/core/fem/ReferenceFEHybrid.hpp>
 
 #include <lifev/core/fem/QuadratureRule.hpp>
+#include <lifev/core/fem/CurrentFEGeometryCache.hpp>
 
 #include <boost/multi_array.hpp>
 
@@ -345,6 +346,17 @@ public:
      */
     void setQuadRule(const QuadratureRule& newQuadRule);
 
+    //! Setter for the geometry cache
+    /*! When a cache compatible with the quadrature rule is set, the jacobian, its transposed inverse
+      and its (weighted) determinant are read from the cache by the update method using an element,
+      instead of being recomputed. An empty pointer disables the cache.
+      @param geometryCache The cache shared by the CurrentFE built on the same mesh and quadrature rule
+     */
+    void setGeometryCache(const boost::shared_ptr<CurrentFEGeometryCache>& geometryCache)
+    {
+        M_geometryCache = geometryCache;
+    }
+
     //@}
 
 
@@ -417,6 +429,12 @@ public:
         return M_nbCoor;
     };
 
+    //! Getter for the geometry cache
+    inline const boost::shared_ptr<CurrentFEGeometryCache>& geometryCache() const
+    {
+        return M_geometryCache;
+    }
+
     //@}
 
 
@@ -565,6 +583,9 @@ private:
     //! Update only the nodes of the cells to the current one.
     void computeCellNodes(const std::vector<std::vector< Real> >& pts);
 
+    //! Update method using the geometry cache for the current cell.
+    void updateCached(const std::vector<std::vector<Real> >& pts, const flag_Type& upFlag);
+
     //! Update the location of the quadrature in the current cell.
     void computeQuadNodes();
 
@@ -621,6 +642,8 @@ private:
     const GeometricMap* M_geoMap;
     QuadratureRule* M_quadRule;
 
+    boost::shared_ptr<CurrentFEGeometryCache> M_geometryCache;
+
 
     // Internal storage for the data
 
@@ -797,7 +820,15 @@ void CurrentFE::update(const MeshElementMarked& geoele, const flag_Type& upFlag)
             pts[i][icoor] = geoele.point(i).coordinate(icoor);
         }
     }
-    update(pts,upFlag);
+
+    if ( M_geometryCache && M_geometryCache->isCompatible(*M_quadRule, M_nbCoor) )
+    {
+        updateCached(pts,upFlag);
+    }
+    else
+    {
+        update(pts,upFlag);
+    }
 }
 
 
@@ -0,0 +1,236 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the implementation of the CurrentFEBatch class
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/fem/CurrentFEBatch.hpp>
+
+namespace LifeV
+{
+
+const UInt CurrentFEBatch::S_batchSize;
+
+CurrentFEBatch::CurrentFEBatch( const ReferenceFE& refFE, const GeometricMap& geoMap, const QuadratureRule& qr )
+        :
+        M_refFE( &refFE ),
+        M_nbNode( refFE.nbDof() ),
+        M_nbCoor( refFE.nbCoor() ),
+        M_nbGeoNode( geoMap.nbDof() ),
+        M_nbQuadPt( qr.nbQuadPt() ),
+        M_size( 0 ),
+        M_localId( S_batchSize, 0 ),
+        M_weight( qr.nbQuadPt() ),
+        M_phi( refFE.nbDof() * qr.nbQuadPt() ),
+        M_dphiRef( refFE.nbDof() * refFE.nbCoor() * qr.nbQuadPt() ),
+        M_dphiGeometricMap( geoMap.nbDof() * refFE.nbCoor() * qr.nbQuadPt() ),
+        M_cellNodes( geoMap.nbDof() * refFE.nbCoor() * S_batchSize ),
+        M_wDetJacobian( qr.nbQuadPt() * S_batchSize ),
+        M_dphi( refFE.nbDof() * refFE.nbCoor() * qr.nbQuadPt() * S_batchSize ),
+        M_wDetJacobianUpdated( false ),
+        M_dphiUpdated( false )
+{
+    ASSERT( M_nbCoor > 0 && M_nbCoor <= 3, "Dimension (nbCoor): only 1, 2 or 3!" );
+
+    for ( UInt iQuadPt(0); iQuadPt < M_nbQuadPt; ++iQuadPt )
+    {
+        M_weight[ iQuadPt ] = qr.weight( iQuadPt );
+
+        for ( UInt iNode(0); iNode < M_nbNode; ++iNode )
+        {
+            M_phi[ iNode * M_nbQuadPt + iQuadPt ] = refFE.phi( iNode, qr.quadPointCoor( iQuadPt ) );
+
+            for ( UInt iCoor(0); iCoor < M_nbCoor; ++iCoor )
+            {
+                M_dphiRef[ ( iNode * M_nbCoor + iCoor ) * M_nbQuadPt + iQuadPt ] =
+                    refFE.dPhi( iNode, iCoor, qr.quadPointCoor( iQuadPt ) );
+            }
+        }
+
+        for ( UInt iNode(0); iNode < M_nbGeoNode; ++iNode )
+        {
+            for ( UInt iCoor(0); iCoor < M_nbCoor; ++iCoor )
+            {
+                M_dphiGeometricMap[ ( iNode * M_nbCoor + iCoor ) * M_nbQuadPt + iQuadPt ] =
+                    geoMap.dPhi( iNode, iCoor, qr.quadPointCoor( iQuadPt ) );
+            }
+        }
+    }
+}
+
+void CurrentFEBatch::computeGeometry( const bool& computeDphi )
+{
+    const UInt W( S_batchSize );
+
+    // Jacobian and transposed inverse in the current quadrature node, for all the lanes
+    Real jacobian[3][3][W];
+    Real tInverseJacobian[3][3][W];
+    Real detJacobian[W];
+
+    for ( UInt iQuadPt(0); iQuadPt < M_nbQuadPt; ++iQuadPt )
+    {
+        // Jacobian of the geometric map
+        for ( UInt iCoor(0); iCoor < M_nbCoor; ++iCoor )
+        {
+            for ( UInt jCoor(0); jCoor < M_nbCoor; ++jCoor )
+            {
+                Real* jacobianPack( jacobian[iCoor][jCoor] );
+
+                for ( UInt lane(0); lane < W; ++lane )
+                {
+                    jacobianPack[lane] = 0.0;
+                }
+
+                for ( UInt iNode(0); iNode < M_nbGeoNode; ++iNode )
+                {
+                    const Real dphiGeo( M_dphiGeometricMap[ ( iNode * M_nbCoor + jCoor ) * M_nbQuadPt + iQuadPt ] );
+                    const Real* nodePack( &M_cellNodes[ ( iNode * M_nbCoor + iCoor ) * W ] );
+
+                    for ( UInt lane(0); lane < W; ++lane )
+                    {
+                        jacobianPack[lane] += nodePack[lane] * dphiGeo;
+                    }
+                }
+            }
+        }
+
+        // Determinant and transposed inverse, same formulas of CurrentFE
+        switch ( M_nbCoor )
+        {
+        case 1:
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                detJacobian[lane] = jacobian[0][0][lane];
+                tInverseJacobian[0][0][lane] = 1.0 / jacobian[0][0][lane];
+            }
+            break;
+
+        case 2:
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                const Real a( jacobian[0][0][lane] );
+                const Real b( jacobian[0][1][lane] );
+                const Real c( jacobian[1][0][lane] );
+                const Real d( jacobian[1][1][lane] );
+
+                const Real det( a * d - b * c );
+
+                detJacobian[lane] = det;
+                tInverseJacobian[0][0][lane] =  d / det;
+                tInverseJacobian[0][1][lane] = -c / det;
+                tInverseJacobian[1][0][lane] = -b / det;
+                tInverseJacobian[1][1][lane] =  a / det;
+            }
+            break;
+
+        case 3:
+            for ( UInt lane(0); lane < W; ++lane )
+            {
+                const Real a( jacobian[0][0][lane] );
+                const Real b( jacobian[0][1][lane] );
+                const Real c( jacobian[0][2][lane] );
+                const Real d( jacobian[1][0][lane] );
+                const Real e( jacobian[1][1][lane] );
+                const Real f( jacobian[1][2][lane] );
+                const Real g( jacobian[2][0][lane] );
+                const Real h( jacobian[2][1][lane] );
+                const Real i( jacobian[2][2][lane] );
+
+                const Real ei( e * i );
+                const Real fh( f * h );
+                const Real bi( b * i );
+                const Real ch( c * h );
+                const Real bf( b * f );
+                const Real ce( c * e );
+
+                const Real det( a * ( ei - fh ) + d * ( ch - bi ) + g * ( bf - ce ) );
+
+                detJacobian[lane] = det;
+
+                tInverseJacobian[0][0][lane] = ( ei - fh ) / det;
+                tInverseJacobian[0][1][lane] = ( -d * i + f * g ) / det;
+                tInverseJacobian[0][2][lane] = ( d * h - e * g ) / det;
+
+                tInverseJacobian[1][0][lane] = ( -bi + ch ) / det;
+                tInverseJacobian[1][1][lane] = ( a * i - c * g ) / det;
+                tInverseJacobian[1][2][lane] = ( -a * h + b * g ) / det;
+
+                tInverseJacobian[2][0][lane] = ( bf - ce ) / det;
+                tInverseJacobian[2][1][lane] = ( -a * f + c * d ) / det;
+                tInverseJacobian[2][2][lane] = ( a * e - b * d ) / det;
+            }
+            break;
+
+        default:
+            ERROR_MSG( "Dimension (nbCoor): only 1, 2 or 3!" );
+            break;
+        }
+
+        // Weighted determinant
+        Real* wDetPack( &M_wDetJacobian[ iQuadPt * W ] );
+        for ( UInt lane(0); lane < W; ++lane )
+        {
+            wDetPack[lane] = detJacobian[lane] * M_weight[ iQuadPt ];
+        }
+
+        // Derivatives of the basis functions in the current cells
+        if ( computeDphi )
+        {
+            for ( UInt iNode(0); iNode < M_nbNode; ++iNode )
+            {
+                for ( UInt iCoor(0); iCoor < M_nbCoor; ++iCoor )
+                {
+                    Real* dphiPack( &M_dphi[ ( ( iNode * M_nbCoor + iCoor ) * M_nbQuadPt + iQuadPt ) * W ] );
+
+                    for ( UInt lane(0); lane < W; ++lane )
+                    {
+                        dphiPack[lane] = 0.0;
+                    }
+
+                    for ( UInt jCoor(0); jCoor < M_nbCoor; ++jCoor )
+                    {
+                        const Real dphiRef( M_dphiRef[ ( iNode * M_nbCoor + jCoor ) * M_nbQuadPt + iQuadPt ] );
+                        const Real* tInversePack( tInverseJacobian[iCoor][jCoor] );
+
+                        for ( UInt lane(0); lane < W; ++lane )
+                        {
+                            dphiPack[lane] += tInversePack[lane] * dphiRef;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    M_wDetJacobianUpdated = true;
+    M_dphiUpdated = computeDphi;
+}
+
+} // Namespace LifeV
@@ -0,0 +1,268 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the CurrentFEBatch class
+
+    @date 19-10-2012
+ */
+
+#ifndef CURRENTFEBATCH_H
+#define CURRENTFEBATCH_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/fem/CurrentFE.hpp>
+
+#include <vector>
+
+//! Number of elements processed in lock-step by the batched assembly
+/*!
+  The default is the number of double precision values in an AVX register.
+  It can be changed at configure time, e.g. 2 for SSE2 or 8 for AVX-512.
+ */
+#ifndef LIFEV_ASSEMBLY_BATCH_SIZE
+#define LIFEV_ASSEMBLY_BATCH_SIZE 4
+#endif
+
+namespace LifeV
+{
+
+//! CurrentFEBatch - The values of a finite element on a batch of cells
+/*!
+  This class is the batched counterpart of CurrentFE: it computes the weighted determinant of the
+  jacobian and the derivatives of the basis functions on S_batchSize cells at the same time.
+
+  All the values depending on the cell are stored as a structure of arrays, the index of the
+  cell in the batch (the "lane") being the fastest one. Each of them is then a contiguous pack of
+  S_batchSize values, e.g. wDetJacobian(iQuadPt) points to the weighted determinants of all the
+  cells of the batch in the quadrature node iQuadPt. The loops over the lanes have a length known at
+  compile time and no dependencies, so that they are mapped by the compiler on the SIMD units.
+
+  The values that do not depend on the cell (basis functions and reference derivatives in the
+  quadrature nodes) are computed once in the constructor.
+
+  When the number of cells left is smaller than the batch size, the last lanes replicate the last
+  cell, so that all the lanes contain valid values; only the first size() lanes have to be assembled.
+
+  The kernels using this class are in AssemblyElementalBatched.hpp.
+ */
+class CurrentFEBatch
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    //! Number of cells in a batch
+    static const UInt S_batchSize = LIFEV_ASSEMBLY_BATCH_SIZE;
+
+    //@}
+
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param refFE Reference finite element used
+      @param geoMap Geometric mapping used
+      @param qr Quadrature rule used
+     */
+    CurrentFEBatch( const ReferenceFE& refFE, const GeometricMap& geoMap, const QuadratureRule& qr );
+
+    //! Destructor
+    ~CurrentFEBatch() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Update the batch with the cells firstElement, ..., firstElement + S_batchSize - 1 of the mesh
+    /*!
+      @param mesh The mesh
+      @param firstElement Local index of the first cell of the batch
+      @param upFlag Flag of the quantities to update: UPDATE_PHI only sets the cells,
+      UPDATE_WDET computes the weighted determinants, UPDATE_DPHI the derivatives of the basis functions
+     */
+    template<typename MeshType>
+    void update( const MeshType& mesh, const UInt& firstElement, const flag_Type& upFlag );
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of cells in the batch that have to be assembled
+    const UInt& size() const
+    {
+        return M_size;
+    }
+
+    //! Local ID of the cell in the given lane
+    const UInt& localId( const UInt& lane ) const
+    {
+        return M_localId[ lane ];
+    }
+
+    //! Number of basis functions
+    const UInt& nbFEDof() const
+    {
+        return M_nbNode;
+    }
+
+    //! Number of quadrature nodes
+    const UInt& nbQuadPt() const
+    {
+        return M_nbQuadPt;
+    }
+
+    //! Number of coordinates
+    const UInt& nbCoor() const
+    {
+        return M_nbCoor;
+    }
+
+    //! Reference finite element
+    const ReferenceFE& refFE() const
+    {
+        return *M_refFE;
+    }
+
+    //! Value of the basis function in the quadrature node (the same for all the cells)
+    const Real& phi( const UInt& node, const UInt& quadNode ) const
+    {
+        return M_phi[ node * M_nbQuadPt + quadNode ];
+    }
+
+    //! Pack of the weighted determinants of the jacobian in the quadrature node
+    const Real* wDetJacobian( const UInt& quadNode ) const
+    {
+        ASSERT( M_wDetJacobianUpdated, "Weighted jacobian determinant is not updated!" );
+        return &M_wDetJacobian[ quadNode * S_batchSize ];
+    }
+
+    //! Pack of the derivatives of the basis function in the quadrature node
+    const Real* dphi( const UInt& node, const UInt& derivative, const UInt& quadNode ) const
+    {
+        ASSERT( M_dphiUpdated, "Basis derivatives are not updated!" );
+        return &M_dphi[ ( ( node * M_nbCoor + derivative ) * M_nbQuadPt + quadNode ) * S_batchSize ];
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    CurrentFEBatch();
+
+    CurrentFEBatch( const CurrentFEBatch& );
+
+    CurrentFEBatch& operator=( const CurrentFEBatch& );
+
+    //! Compute the geometric quantities from the packed cell nodes
+    void computeGeometry( const bool& computeDphi );
+
+    //@}
+
+    const ReferenceFE* M_refFE;
+
+    const UInt M_nbNode;
+    const UInt M_nbCoor;
+    const UInt M_nbGeoNode;
+    const UInt M_nbQuadPt;
+
+    UInt M_size;
+    std::vector<UInt> M_localId;
+
+    // Values independent of the cell: [node][quadNode] and [node][coor][quadNode]
+    std::vector<Real> M_weight;
+    std::vector<Real> M_phi;
+    std::vector<Real> M_dphiRef;
+    std::vector<Real> M_dphiGeometricMap;
+
+    // Values of the cells, the lane is the fastest index
+    // M_cellNodes: [geoNode][coor][lane]
+    // M_wDetJacobian: [quadNode][lane]
+    // M_dphi: [node][coor][quadNode][lane]
+    std::vector<Real> M_cellNodes;
+    std::vector<Real> M_wDetJacobian;
+    std::vector<Real> M_dphi;
+
+    bool M_wDetJacobianUpdated;
+    bool M_dphiUpdated;
+};
+
+
+// ===================================================
+// Template implementation
+// ===================================================
+
+template<typename MeshType>
+void CurrentFEBatch::update( const MeshType& mesh, const UInt& firstElement, const flag_Type& upFlag )
+{
+    const UInt nbElements( mesh.numElements() );
+
+    ASSERT( firstElement < nbElements, "The batch is outside of the mesh!" );
+
+    M_size = std::min( static_cast<UInt>( S_batchSize ), nbElements - firstElement );
+
+    for ( UInt lane(0); lane < S_batchSize; ++lane )
+    {
+        // The last lanes replicate the last cell
+        const UInt iElement( firstElement + std::min( lane, M_size - 1 ) );
+
+        M_localId[ lane ] = mesh.element( iElement ).localId();
+
+        for ( UInt iNode(0); iNode < M_nbGeoNode; ++iNode )
+        {
+            for ( UInt iCoor(0); iCoor < M_nbCoor; ++iCoor )
+            {
+                M_cellNodes[ ( iNode * M_nbCoor + iCoor ) * S_batchSize + lane ] =
+                    mesh.element( iElement ).point( iNode ).coordinate( iCoor );
+            }
+        }
+    }
+
+    M_wDetJacobianUpdated = false;
+    M_dphiUpdated = false;
+
+    if ( ( upFlag & ( UPDATE_ONLY_W_DET_JACOBIAN | UPDATE_ONLY_DPHI ) ) != 0 )
+    {
+        computeGeometry( ( upFlag & UPDATE_ONLY_DPHI ) != 0 );
+    }
+}
+
+} // Namespace LifeV
+
+#endif /* CURRENTFEBATCH_H */
@@ -0,0 +1,123 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the implementation of the CurrentFEGeometryCache class
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/fem/CurrentFEGeometryCache.hpp>
+
+#include <algorithm>
+
+namespace LifeV
+{
+
+CurrentFEGeometryCache::CurrentFEGeometryCache( const UInt& numElements,
+                                                const UInt& nbCoor,
+                                                const QuadratureRule& qr,
+                                                const geometryVersionFunction_Type& geometryVersion )
+        :
+        M_quadRuleName( qr.name() ),
+        M_nbCoor( nbCoor ),
+        M_nbQuadPt( qr.nbQuadPt() ),
+        M_matrixSize( nbCoor * nbCoor * qr.nbQuadPt() ),
+        M_geometryVersionFunction( geometryVersion ),
+        M_geometryVersion( geometryVersion() ),
+        M_isStored( numElements, false ),
+        M_jacobian( numElements * M_matrixSize ),
+        M_tInverseJacobian( numElements * M_matrixSize ),
+        M_detJacobian( numElements * M_nbQuadPt ),
+        M_wDetJacobian( numElements * M_nbQuadPt )
+{
+}
+
+bool CurrentFEGeometryCache::isCompatible( const QuadratureRule& qr, const UInt& nbCoor ) const
+{
+    return nbCoor == M_nbCoor && qr.nbQuadPt() == M_nbQuadPt && qr.name() == M_quadRuleName;
+}
+
+bool CurrentFEGeometryCache::isStored( const UInt& localId )
+{
+    // The mesh has moved since the values were stored
+    const UInt geometryVersion( M_geometryVersionFunction() );
+    if ( geometryVersion != M_geometryVersion )
+    {
+        invalidate();
+        M_geometryVersion = geometryVersion;
+    }
+
+    return localId < M_isStored.size() && M_isStored[localId];
+}
+
+void CurrentFEGeometryCache::store( const UInt& localId,
+                                    const Real* jacobian,
+                                    const Real* tInverseJacobian,
+                                    const Real* detJacobian,
+                                    const Real* wDetJacobian )
+{
+    if ( localId >= M_isStored.size() )
+    {
+        return;
+    }
+
+    std::copy( jacobian, jacobian + M_matrixSize, M_jacobian.begin() + localId * M_matrixSize );
+    std::copy( tInverseJacobian, tInverseJacobian + M_matrixSize, M_tInverseJacobian.begin() + localId * M_matrixSize );
+    std::copy( detJacobian, detJacobian + M_nbQuadPt, M_detJacobian.begin() + localId * M_nbQuadPt );
+    std::copy( wDetJacobian, wDetJacobian + M_nbQuadPt, M_wDetJacobian.begin() + localId * M_nbQuadPt );
+
+    M_isStored[localId] = true;
+}
+
+void CurrentFEGeometryCache::restore( const UInt& localId,
+                                      Real* jacobian,
+                                      Real* tInverseJacobian,
+                                      Real* detJacobian,
+                                      Real* wDetJacobian ) const
+{
+    ASSERT( localId < M_isStored.size() && M_isStored[localId], "The values of the element are not stored!" );
+
+    std::vector<Real>::const_iterator matrixBegin( M_jacobian.begin() + localId * M_matrixSize );
+    std::copy( matrixBegin, matrixBegin + M_matrixSize, jacobian );
+
+    matrixBegin = M_tInverseJacobian.begin() + localId * M_matrixSize;
+    std::copy( matrixBegin, matrixBegin + M_matrixSize, tInverseJacobian );
+
+    std::vector<Real>::const_iterator quadBegin( M_detJacobian.begin() + localId * M_nbQuadPt );
+    std::copy( quadBegin, quadBegin + M_nbQuadPt, detJacobian );
+
+    quadBegin = M_wDetJacobian.begin() + localId * M_nbQuadPt;
+    std::copy( quadBegin, quadBegin + M_nbQuadPt, wDetJacobian );
+}
+
+void CurrentFEGeometryCache::invalidate()
+{
+    std::fill( M_isStored.begin(), M_isStored.end(), false );
+}
+
+} // Namespace LifeV
@@ -0,0 +1,195 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the CurrentFEGeometryCache class
+
+    @date 19-10-2012
+ */
+
+#ifndef CURRENTFEGEOMETRYCACHE_H
+#define CURRENTFEGEOMETRYCACHE_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/fem/QuadratureRule.hpp>
+
+#include <boost/function.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! CurrentFEGeometryCache - Storage of the geometric quantities of the elements of a mesh
+/*!
+  This class stores, for each element of a mesh and for a given quadrature rule, the quantities
+  computed by CurrentFE::update that depend only on the geometry of the element:
+  <ul>
+  <li> the jacobian of the geometric map; </li>
+  <li> the transposed inverse of the jacobian; </li>
+  <li> the determinant of the jacobian; </li>
+  <li> the determinant of the jacobian times the quadrature weights. </li>
+  </ul>
+
+  The values of an element are stored the first time that a CurrentFE using the cache is updated on it,
+  and read back in the following updates. This saves the computations when the same static mesh is
+  assembled many times (e.g. at each time step).
+
+  The cache is invalidated when the geometry version given at the construction changes, typically
+  the counter of the MeshTransformer of the mesh, which is increased by MeshTransformer::moveMesh and
+  MeshTransformer::transformMesh. If the points of the mesh are changed in other ways, the cache has
+  to be invalidated by hand with the method invalidate.
+
+  The memory needed is (2 nbCoor^2 + 2) nbQuadPt Real for each element, so the cache is opt-in,
+  see FESpace::setGeometryCache.
+ */
+class CurrentFEGeometryCache
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    //! Function returning the current version of the geometry
+    typedef boost::function<UInt ()> geometryVersionFunction_Type;
+
+    //@}
+
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param numElements Number of elements of the mesh
+      @param nbCoor Number of coordinates of the reference element
+      @param qr Quadrature rule used by the CurrentFE
+      @param geometryVersion Function returning the current version of the geometry
+     */
+    CurrentFEGeometryCache( const UInt& numElements,
+                            const UInt& nbCoor,
+                            const QuadratureRule& qr,
+                            const geometryVersionFunction_Type& geometryVersion );
+
+    //! Destructor
+    ~CurrentFEGeometryCache() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Check if the cache can be used by a CurrentFE with the given quadrature rule and number of coordinates
+    bool isCompatible( const QuadratureRule& qr, const UInt& nbCoor ) const;
+
+    //! Check if the values of the element are stored, the cache is cleared if the geometry has changed
+    bool isStored( const UInt& localId );
+
+    //! Store the values of an element
+    /*!
+      The arrays are stored as in the boost::multi_array used by CurrentFE.
+      @param localId Local id of the element
+      @param jacobian Jacobian, nbCoor x nbCoor x nbQuadPt values
+      @param tInverseJacobian Transposed inverse of the jacobian, nbCoor x nbCoor x nbQuadPt values
+      @param detJacobian Determinant of the jacobian, nbQuadPt values
+      @param wDetJacobian Weighted determinant of the jacobian, nbQuadPt values
+     */
+    void store( const UInt& localId,
+                const Real* jacobian,
+                const Real* tInverseJacobian,
+                const Real* detJacobian,
+                const Real* wDetJacobian );
+
+    //! Copy the values of an element, with the same layout of the method store
+    void restore( const UInt& localId,
+                  Real* jacobian,
+                  Real* tInverseJacobian,
+                  Real* detJacobian,
+                  Real* wDetJacobian ) const;
+
+    //! Clear all the stored values
+    void invalidate();
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of elements
+    UInt numElements() const
+    {
+        return M_isStored.size();
+    }
+
+    //! Number of quadrature nodes
+    const UInt& nbQuadPt() const
+    {
+        return M_nbQuadPt;
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    CurrentFEGeometryCache();
+
+    CurrentFEGeometryCache( const CurrentFEGeometryCache& );
+
+    CurrentFEGeometryCache& operator=( const CurrentFEGeometryCache& );
+
+    //@}
+
+    // Name of the quadrature rule
+    std::string M_quadRuleName;
+
+    UInt M_nbCoor;
+    UInt M_nbQuadPt;
+
+    // Number of values of the matrices for each element
+    UInt M_matrixSize;
+
+    geometryVersionFunction_Type M_geometryVersionFunction;
+    UInt M_geometryVersion;
+
+    std::vector<bool> M_isStored;
+
+    std::vector<Real> M_jacobian;
+    std::vector<Real> M_tInverseJacobian;
+    std::vector<Real> M_detJacobian;
+    std::vector<Real> M_wDetJacobian;
+};
+
+} // Namespace LifeV
+
+#endif /* CURRENTFEGEOMETRYCACHE_H */
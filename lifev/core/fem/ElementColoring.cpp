@@ -0,0 +1,129 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the implementation of the ElementColoring class
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/fem/ElementColoring.hpp>
+
+#include <map>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructor
+// ===================================================
+
+ElementColoring::ElementColoring()
+        :
+        M_dofs(),
+        M_colors()
+{
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+void ElementColoring::addDOF( const DOF& dof )
+{
+    ASSERT( M_dofs.empty() || M_dofs[0]->numElements() == dof.numElements(),
+            "The DOF tables must have the same number of elements!" );
+
+    M_dofs.push_back( &dof );
+    M_colors.clear();
+}
+
+void ElementColoring::compute()
+{
+    ASSERT( !M_dofs.empty(), "No DOF table to color the elements!" );
+
+    M_colors.clear();
+
+    const UInt numElements( M_dofs[0]->numElements() );
+
+    // Colors already used around each degree of freedom, for each DOF table
+    std::vector< std::map< ID, std::vector<UInt> > > dofColors( M_dofs.size() );
+
+    std::vector<bool> forbidden;
+
+    for ( UInt iElement(0); iElement < numElements; ++iElement )
+    {
+        forbidden.assign( M_colors.size(), false );
+
+        for ( UInt iTable(0); iTable < M_dofs.size(); ++iTable )
+        {
+            const DOF& dof( *M_dofs[iTable] );
+
+            for ( UInt iDof(0); iDof < dof.numLocalDof(); ++iDof )
+            {
+                const std::vector<UInt>& colors( dofColors[iTable][ dof.localToGlobalMap( iElement, iDof ) ] );
+
+                for ( UInt iColor(0); iColor < colors.size(); ++iColor )
+                {
+                    forbidden[ colors[iColor] ] = true;
+                }
+            }
+        }
+
+        // First free color, or a new one
+        UInt color( 0 );
+        while ( color < forbidden.size() && forbidden[color] )
+        {
+            ++color;
+        }
+
+        if ( color == M_colors.size() )
+        {
+            M_colors.push_back( elementList_Type() );
+        }
+
+        M_colors[color].push_back( iElement );
+
+        for ( UInt iTable(0); iTable < M_dofs.size(); ++iTable )
+        {
+            const DOF& dof( *M_dofs[iTable] );
+
+            for ( UInt iDof(0); iDof < dof.numLocalDof(); ++iDof )
+            {
+                dofColors[iTable][ dof.localToGlobalMap( iElement, iDof ) ].push_back( color );
+            }
+        }
+    }
+}
+
+void ElementColoring::clear()
+{
+    M_dofs.clear();
+    M_colors.clear();
+}
+
+} // Namespace LifeV
@@ -0,0 +1,150 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the ElementColoring class
+
+    @date 19-10-2012
+ */
+
+#ifndef ELEMENTCOLORING_H
+#define ELEMENTCOLORING_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/fem/DOF.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! ElementColoring - Partition of the local elements in sets sharing no degree of freedom
+/*!
+  The elements are colored with a greedy algorithm, in the order of their local ID: each element
+  gets the first color that is not used by an element sharing one of its degrees of freedom, in any
+  of the DOF tables given with addDOF. The elements of one color can then be assembled at the same
+  time by different threads without writing in the same rows of the global matrices.
+
+  Usage:
+  \code
+  ElementColoring coloring;
+  coloring.addDOF( velocityFESpace.dof() );
+  coloring.addDOF( pressureFESpace.dof() );
+  coloring.compute();
+  for ( UInt iColor(0); iColor < coloring.numColors(); ++iColor )
+      // the elements coloring.elements( iColor ) can be assembled concurrently
+  \endcode
+
+  The DOF tables must stay alive until compute() is called.
+ */
+class ElementColoring
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef std::vector<UInt> elementList_Type;
+
+    //@}
+
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Empty constructor
+    ElementColoring();
+
+    //! Destructor
+    ~ElementColoring() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Add a DOF table whose degrees of freedom must not be shared inside a color
+    void addDOF( const DOF& dof );
+
+    //! Compute the coloring of the elements
+    /*!
+      All the DOF tables must have the same number of elements.
+     */
+    void compute();
+
+    //! Remove the DOF tables and the coloring
+    void clear();
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Tell if the coloring has been computed
+    bool isComputed() const
+    {
+        return !M_colors.empty();
+    }
+
+    //! Number of colors
+    UInt numColors() const
+    {
+        return M_colors.size();
+    }
+
+    //! Local IDs of the elements of the given color, in increasing order
+    const elementList_Type& elements( const UInt& color ) const
+    {
+        ASSERT( color < M_colors.size(), "No such color!" );
+        return M_colors[color];
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    ElementColoring( const ElementColoring& );
+
+    ElementColoring& operator=( const ElementColoring& );
+
+    //@}
+
+    std::vector<const DOF*> M_dofs;
+
+    std::vector<elementList_Type> M_colors;
+};
+
+} // Namespace LifeV
+
+#endif /* ELEMENTCOLORING_H */
@@ -590,10 +590,12 @@ static const QuadratureRule quad_rule_tetra[ NB_QUAD_RULE_TETRA ] =
  *
  *=======================================================================*/
 //! total number of quadrature rules in 3D on hexa
-#define NB_QUAD_RULE_HEXA 2
+#define NB_QUAD_RULE_HEXA 4
 //! id of the quadrature rules on quadrangles
 #define QUAD_RULE_HEXA_1PT     1
 #define QUAD_RULE_HEXA_8PT     2
+#define QUAD_RULE_HEXA_27PT    3
+#define QUAD_RULE_HEXA_64PT    4
 //----------------------------------------------------------------------
 
 static const QuadraturePoint pt_hexa_1pt[ 1 ] =
@@ -618,13 +620,122 @@ static const QuadraturePoint pt_hexa_8pt[ 8 ] =
 const QuadratureRule quadRuleHexa8pt( pt_hexa_8pt,
                                 QUAD_RULE_HEXA_8PT,
                                 "Quadrature rule 8 points on a hexa", HEXA, 8, 3 );
+//----------------------------------------------------------------------
+// Tensor product of the Gauss Legendre rules on the segment: the points
+// are ordered with the x index running fastest, then y, then z.
+static const QuadraturePoint pt_hexa_27pt[ 27 ] =
+{
+    QuadraturePoint( q3ptx2, q3ptx2, q3ptx2, q3ptw2 * q3ptw2 * q3ptw2 ),
+    QuadraturePoint( q3ptx1, q3ptx2, q3ptx2, q3ptw1 * q3ptw2 * q3ptw2 ),
+    QuadraturePoint( q3ptx3, q3ptx2, q3ptx2, q3ptw3 * q3ptw2 * q3ptw2 ),
+    QuadraturePoint( q3ptx2, q3ptx1, q3ptx2, q3ptw2 * q3ptw1 * q3ptw2 ),
+    QuadraturePoint( q3ptx1, q3ptx1, q3ptx2, q3ptw1 * q3ptw1 * q3ptw2 ),
+    QuadraturePoint( q3ptx3, q3ptx1, q3ptx2, q3ptw3 * q3ptw1 * q3ptw2 ),
+    QuadraturePoint( q3ptx2, q3ptx3, q3ptx2, q3ptw2 * q3ptw3 * q3ptw2 ),
+    QuadraturePoint( q3ptx1, q3ptx3, q3ptx2, q3ptw1 * q3ptw3 * q3ptw2 ),
+    QuadraturePoint( q3ptx3, q3ptx3, q3ptx2, q3ptw3 * q3ptw3 * q3ptw2 ),
+    QuadraturePoint( q3ptx2, q3ptx2, q3ptx1, q3ptw2 * q3ptw2 * q3ptw1 ),
+    QuadraturePoint( q3ptx1, q3ptx2, q3ptx1, q3ptw1 * q3ptw2 * q3ptw1 ),
+    QuadraturePoint( q3ptx3, q3ptx2, q3ptx1, q3ptw3 * q3ptw2 * q3ptw1 ),
+    QuadraturePoint( q3ptx2, q3ptx1, q3ptx1, q3ptw2 * q3ptw1 * q3ptw1 ),
+    QuadraturePoint( q3ptx1, q3ptx1, q3ptx1, q3ptw1 * q3ptw1 * q3ptw1 ),
+    QuadraturePoint( q3ptx3, q3ptx1, q3ptx1, q3ptw3 * q3ptw1 * q3ptw1 ),
+    QuadraturePoint( q3ptx2, q3ptx3, q3ptx1, q3ptw2 * q3ptw3 * q3ptw1 ),
+    QuadraturePoint( q3ptx1, q3ptx3, q3ptx1, q3ptw1 * q3ptw3 * q3ptw1 ),
+    QuadraturePoint( q3ptx3, q3ptx3, q3ptx1, q3ptw3 * q3ptw3 * q3ptw1 ),
+    QuadraturePoint( q3ptx2, q3ptx2, q3ptx3, q3ptw2 * q3ptw2 * q3ptw3 ),
+    QuadraturePoint( q3ptx1, q3ptx2, q3ptx3, q3ptw1 * q3ptw2 * q3ptw3 ),
+    QuadraturePoint( q3ptx3, q3ptx2, q3ptx3, q3ptw3 * q3ptw2 * q3ptw3 ),
+    QuadraturePoint( q3ptx2, q3ptx1, q3ptx3, q3ptw2 * q3ptw1 * q3ptw3 ),
+    QuadraturePoint( q3ptx1, q3ptx1, q3ptx3, q3ptw1 * q3ptw1 * q3ptw3 ),
+    QuadraturePoint( q3ptx3, q3ptx1, q3ptx3, q3ptw3 * q3ptw1 * q3ptw3 ),
+    QuadraturePoint( q3ptx2, q3ptx3, q3ptx3, q3ptw2 * q3ptw3 * q3ptw3 ),
+    QuadraturePoint( q3ptx1, q3ptx3, q3ptx3, q3ptw1 * q3ptw3 * q3ptw3 ),
+    QuadraturePoint( q3ptx3, q3ptx3, q3ptx3, q3ptw3 * q3ptw3 * q3ptw3 )
+};
+const QuadratureRule quadRuleHexa27pt( pt_hexa_27pt,
+                                 QUAD_RULE_HEXA_27PT,
+                                 "Quadrature rule 27 points on a hexa", HEXA, 27, 5 );
+//----------------------------------------------------------------------
+static const QuadraturePoint pt_hexa_64pt[ 64 ] =
+{
+    QuadraturePoint( q4ptx3, q4ptx3, q4ptx3, q4ptw3 * q4ptw3 * q4ptw3 ),
+    QuadraturePoint( q4ptx1, q4ptx3, q4ptx3, q4ptw1 * q4ptw3 * q4ptw3 ),
+    QuadraturePoint( q4ptx2, q4ptx3, q4ptx3, q4ptw2 * q4ptw3 * q4ptw3 ),
+    QuadraturePoint( q4ptx4, q4ptx3, q4ptx3, q4ptw4 * q4ptw3 * q4ptw3 ),
+    QuadraturePoint( q4ptx3, q4ptx1, q4ptx3, q4ptw3 * q4ptw1 * q4ptw3 ),
+    QuadraturePoint( q4ptx1, q4ptx1, q4ptx3, q4ptw1 * q4ptw1 * q4ptw3 ),
+    QuadraturePoint( q4ptx2, q4ptx1, q4ptx3, q4ptw2 * q4ptw1 * q4ptw3 ),
+    QuadraturePoint( q4ptx4, q4ptx1, q4ptx3, q4ptw4 * q4ptw1 * q4ptw3 ),
+    QuadraturePoint( q4ptx3, q4ptx2, q4ptx3, q4ptw3 * q4ptw2 * q4ptw3 ),
+    QuadraturePoint( q4ptx1, q4ptx2, q4ptx3, q4ptw1 * q4ptw2 * q4ptw3 ),
+    QuadraturePoint( q4ptx2, q4ptx2, q4ptx3, q4ptw2 * q4ptw2 * q4ptw3 ),
+    QuadraturePoint( q4ptx4, q4ptx2, q4ptx3, q4ptw4 * q4ptw2 * q4ptw3 ),
+    QuadraturePoint( q4ptx3, q4ptx4, q4ptx3, q4ptw3 * q4ptw4 * q4ptw3 ),
+    QuadraturePoint( q4ptx1, q4ptx4, q4ptx3, q4ptw1 * q4ptw4 * q4ptw3 ),
+    QuadraturePoint( q4ptx2, q4ptx4, q4ptx3, q4ptw2 * q4ptw4 * q4ptw3 ),
+    QuadraturePoint( q4ptx4, q4ptx4, q4ptx3, q4ptw4 * q4ptw4 * q4ptw3 ),
+    QuadraturePoint( q4ptx3, q4ptx3, q4ptx1, q4ptw3 * q4ptw3 * q4ptw1 ),
+    QuadraturePoint( q4ptx1, q4ptx3, q4ptx1, q4ptw1 * q4ptw3 * q4ptw1 ),
+    QuadraturePoint( q4ptx2, q4ptx3, q4ptx1, q4ptw2 * q4ptw3 * q4ptw1 ),
+    QuadraturePoint( q4ptx4, q4ptx3, q4ptx1, q4ptw4 * q4ptw3 * q4ptw1 ),
+    QuadraturePoint( q4ptx3, q4ptx1, q4ptx1, q4ptw3 * q4ptw1 * q4ptw1 ),
+    QuadraturePoint( q4ptx1, q4ptx1, q4ptx1, q4ptw1 * q4ptw1 * q4ptw1 ),
+    QuadraturePoint( q4ptx2, q4ptx1, q4ptx1, q4ptw2 * q4ptw1 * q4ptw1 ),
+    QuadraturePoint( q4ptx4, q4ptx1, q4ptx1, q4ptw4 * q4ptw1 * q4ptw1 ),
+    QuadraturePoint( q4ptx3, q4ptx2, q4ptx1, q4ptw3 * q4ptw2 * q4ptw1 ),
+    QuadraturePoint( q4ptx1, q4ptx2, q4ptx1, q4ptw1 * q4ptw2 * q4ptw1 ),
+    QuadraturePoint( q4ptx2, q4ptx2, q4ptx1, q4ptw2 * q4ptw2 * q4ptw1 ),
+    QuadraturePoint( q4ptx4, q4ptx2, q4ptx1, q4ptw4 * q4ptw2 * q4ptw1 ),
+    QuadraturePoint( q4ptx3, q4ptx4, q4ptx1, q4ptw3 * q4ptw4 * q4ptw1 ),
+    QuadraturePoint( q4ptx1, q4ptx4, q4ptx1, q4ptw1 * q4ptw4 * q4ptw1 ),
+    QuadraturePoint( q4ptx2, q4ptx4, q4ptx1, q4ptw2 * q4ptw4 * q4ptw1 ),
+    QuadraturePoint( q4ptx4, q4ptx4, q4ptx1, q4ptw4 * q4ptw4 * q4ptw1 ),
+    QuadraturePoint( q4ptx3, q4ptx3, q4ptx2, q4ptw3 * q4ptw3 * q4ptw2 ),
+    QuadraturePoint( q4ptx1, q4ptx3, q4ptx2, q4ptw1 * q4ptw3 * q4ptw2 ),
+    QuadraturePoint( q4ptx2, q4ptx3, q4ptx2, q4ptw2 * q4ptw3 * q4ptw2 ),
+    QuadraturePoint( q4ptx4, q4ptx3, q4ptx2, q4ptw4 * q4ptw3 * q4ptw2 ),
+    QuadraturePoint( q4ptx3, q4ptx1, q4ptx2, q4ptw3 * q4ptw1 * q4ptw2 ),
+    QuadraturePoint( q4ptx1, q4ptx1, q4ptx2, q4ptw1 * q4ptw1 * q4ptw2 ),
+    QuadraturePoint( q4ptx2, q4ptx1, q4ptx2, q4ptw2 * q4ptw1 * q4ptw2 ),
+    QuadraturePoint( q4ptx4, q4ptx1, q4ptx2, q4ptw4 * q4ptw1 * q4ptw2 ),
+    QuadraturePoint( q4ptx3, q4ptx2, q4ptx2, q4ptw3 * q4ptw2 * q4ptw2 ),
+    QuadraturePoint( q4ptx1, q4ptx2, q4ptx2, q4ptw1 * q4ptw2 * q4ptw2 ),
+    QuadraturePoint( q4ptx2, q4ptx2, q4ptx2, q4ptw2 * q4ptw2 * q4ptw2 ),
+    QuadraturePoint( q4ptx4, q4ptx2, q4ptx2, q4ptw4 * q4ptw2 * q4ptw2 ),
+    QuadraturePoint( q4ptx3, q4ptx4, q4ptx2, q4ptw3 * q4ptw4 * q4ptw2 ),
+    QuadraturePoint( q4ptx1, q4ptx4, q4ptx2, q4ptw1 * q4ptw4 * q4ptw2 ),
+    QuadraturePoint( q4ptx2, q4ptx4, q4ptx2, q4ptw2 * q4ptw4 * q4ptw2 ),
+    QuadraturePoint( q4ptx4, q4ptx4, q4ptx2, q4ptw4 * q4ptw4 * q4ptw2 ),
+    QuadraturePoint( q4ptx3, q4ptx3, q4ptx4, q4ptw3 * q4ptw3 * q4ptw4 ),
+    QuadraturePoint( q4ptx1, q4ptx3, q4ptx4, q4ptw1 * q4ptw3 * q4ptw4 ),
+    QuadraturePoint( q4ptx2, q4ptx3, q4ptx4, q4ptw2 * q4ptw3 * q4ptw4 ),
+    QuadraturePoint( q4ptx4, q4ptx3, q4ptx4, q4ptw4 * q4ptw3 * q4ptw4 ),
+    QuadraturePoint( q4ptx3, q4ptx1, q4ptx4, q4ptw3 * q4ptw1 * q4ptw4 ),
+    QuadraturePoint( q4ptx1, q4ptx1, q4ptx4, q4ptw1 * q4ptw1 * q4ptw4 ),
+    QuadraturePoint( q4ptx2, q4ptx1, q4ptx4, q4ptw2 * q4ptw1 * q4ptw4 ),
+    QuadraturePoint( q4ptx4, q4ptx1, q4ptx4, q4ptw4 * q4ptw1 * q4ptw4 ),
+    QuadraturePoint( q4ptx3, q4ptx2, q4ptx4, q4ptw3 * q4ptw2 * q4ptw4 ),
+    QuadraturePoint( q4ptx1, q4ptx2, q4ptx4, q4ptw1 * q4ptw2 * q4ptw4 ),
+    QuadraturePoint( q4ptx2, q4ptx2, q4ptx4, q4ptw2 * q4ptw2 * q4ptw4 ),
+    QuadraturePoint( q4ptx4, q4ptx2, q4ptx4, q4ptw4 * q4ptw2 * q4ptw4 ),
+    QuadraturePoint( q4ptx3, q4ptx4, q4ptx4, q4ptw3 * q4ptw4 * q4ptw4 ),
+    QuadraturePoint( q4ptx1, q4ptx4, q4ptx4, q4ptw1 * q4ptw4 * q4ptw4 ),
+    QuadraturePoint( q4ptx2, q4ptx4, q4ptx4, q4ptw2 * q4ptw4 * q4ptw4 ),
+    QuadraturePoint( q4ptx4, q4ptx4, q4ptx4, q4ptw4 * q4ptw4 * q4ptw4 )
+};
+const QuadratureRule quadRuleHexa64pt( pt_hexa_64pt,
+                                 QUAD_RULE_HEXA_64PT,
+                                 "Quadrature rule 64 points on a hexa", HEXA, 64, 7 );
 /*----------------------------------------------------------------------
   Set of all quadrature rules on hexa
   ----------------------------------------------------------------------*/
 static const QuadratureRule quad_rule_hexa[ NB_QUAD_RULE_HEXA ] =
 {
     quadRuleHexa1pt,
-    quadRuleHexa8pt
+    quadRuleHexa8pt,
+    quadRuleHexa27pt,
+    quadRuleHexa64pt
 };
 
 
@@ -4075,6 +4186,19 @@ const ReferenceFEScalar feHexaQ1( "Lagrange Q1 on a hexaedra", FE_Q1_3D, HEXA, 1
                             fct_Q1_3D, derfct_Q1_3D, der2fct_Q1_3D, refcoor_Q1_3D,
                             STANDARD_PATTERN, &feQuadQ1,&lagrangianTransform );
 
+//======================================================================
+//
+//                            Q2  (3D)
+//
+//======================================================================
+/*
+  Vertices, midpoints of the edges, centers of the faces and center of
+  the cell, numbered as the points of QuadraticHexa.
+*/
+const ReferenceFEScalar feHexaQ2( "Lagrange Q2 on a hexaedra", FE_Q2_3D, HEXA, 1, 1, 1, 1, 27, 3,
+                            fct_Q2_3D, derfct_Q2_3D, der2fct_Q2_3D, refcoor_Q2_3D,
+                            STANDARD_PATTERN, &feQuadQ2,&lagrangianTransform );
+
 //======================================================================
 //
 //                            RT0 (3D)
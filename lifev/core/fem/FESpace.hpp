@@ -47,6 +47,8 @@
 #include <sstream>
 #include <utility>
 
+#include <boost/bind.hpp>
+
 #include <lifev/core/LifeV.hpp>
 
 #include <lifev/core/fem/BCHandler.hpp>
@@ -352,6 +354,60 @@ public:
     //! Return the polynomial degree of the finite element used
     UInt polynomialDegree() const;
 
+    //! Local elements whose degrees of freedom are all owned by this process
+    /*!
+      An interior element has all its degrees of freedom in the unique map of this process:
+      the values it needs in a repeated vector are available as soon as a split-phase import
+      has been started (see VectorEpetra::beginImport), so it can be assembled while the other
+      values are being communicated. The other elements (see interfaceElements()) must wait
+      for the end of the import.
+
+      The two lists are computed at the first call and kept, since the mesh and the degrees
+      of freedom of the space do not change.
+     */
+    const std::vector<UInt>& interiorElements() const
+    {
+        splitElementsByOwnership();
+        return M_interiorElements;
+    }
+
+    //! Local elements with at least one degree of freedom owned by another process
+    const std::vector<UInt>& interfaceElements() const
+    {
+        splitElementsByOwnership();
+        return M_interfaceElements;
+    }
+
+    //! Compute the rigid body modes of the space from the coordinates of its nodes
+    /*!
+      The modes are the near null space of elasticity-like operators (the three translations and
+      the three rotations in 3D, two translations and one rotation in 2D, the constant for a scalar
+      field) that multilevel preconditioners need to build a good coarse space for vector problems.
+
+      They are stored one after the other, as the rows of this process in the unique map: the entry
+      of the mode k for the local row i is modes[ k * numRows + i ]. The map can be larger than the one
+      of the space (e.g. the map of a monolithic problem), offset being the position of the first
+      degree of freedom of the space in it: the other rows get the constant in the first mode.
+
+      Only the Lagrangian elements, whose degrees of freedom are nodal values, give meaningful modes.
+      Operators acting on each component separately (e.g. a vector Laplacian) do not vanish on the
+      rotations: their near null space is made of the translations only.
+
+      @param modes the modes
+      @param map the map of the rows of the matrix
+      @param offset the offset of the space in the map
+      @param rotations if false, only the translations are computed
+      @return the number of modes
+     */
+    UInt rigidBodyModes( std::vector<Real>& modes, const map_Type& map, const UInt& offset = 0,
+                         const bool& rotations = true ) const;
+
+    //! Compute the rigid body modes of the space on its own map
+    UInt rigidBodyModes( std::vector<Real>& modes ) const
+    {
+        return rigidBodyModes( modes, *M_map );
+    }
+
     //@}
 
     //! @name Set Methods
@@ -363,6 +419,16 @@ public:
      */
     void setQuadRule(const QuadratureRule& Qr);
 
+    //! Enable or disable the geometry cache
+    /*!
+      When enabled, the jacobians of the geometric map and their determinants are stored
+      for each element and quadrature rule, see CurrentFEGeometryCache. The cache is used by fe()
+      and by the CurrentFE that get it with geometryCache(). It is invalidated when the mesh
+      is moved with its MeshTransformer.
+      @param useCache True to enable the cache
+     */
+    void setGeometryCache( const bool& useCache = true );
+
     //@}
 
 
@@ -407,6 +473,9 @@ public:
     const UInt&         dim()      const { return M_dim; }
     const UInt&         fieldDim() const { return M_fieldDim; }
 
+    //! Returns the geometry cache for the given quadrature rule, an empty pointer if the cache is disabled
+    boost::shared_ptr<CurrentFEGeometryCache> geometryCache( const QuadratureRule& qr );
+
     //@}
 
 
@@ -428,6 +497,9 @@ private:
     //! Set space
     inline void setSpace( const std::string& space, UInt dimension );
 
+    //! Compute the interior and interface elements, once
+    void splitElementsByOwnership() const;
+
 
     //! This is a generic function called by feToFEInterpolate method.
     //! It allows to interpolate vectors between any two continuous and scalar FE spaces. It is used when other specialized functions are not provided
@@ -516,6 +588,15 @@ private:
     //! Map
     mapPtr_Type                             M_map;
 
+    //! Geometry caches, one for each quadrature rule
+    bool                                    M_useGeometryCache;
+    std::vector<boost::shared_ptr<CurrentFEGeometryCache> > M_geometryCaches;
+
+    //! Elements split according to the ownership of their degrees of freedom
+    mutable bool                            M_elementsSplit;
+    mutable std::vector<UInt>               M_interiorElements;
+    mutable std::vector<UInt>               M_interfaceElements;
+
 };
 
 // ===================================================
@@ -540,7 +621,12 @@ FESpace( MeshPartitioner<MeshType>&  mesh,
         M_dim           ( M_dof->numTotalDof() ),
         M_fe            ( new CurrentFE  ( *M_refFE, getGeometricMap( *M_mesh ), *M_Qr ) ),
         M_feBd          ( ),
-        M_map           ( new map_Type() )
+        M_map           ( new map_Type() ),
+        M_useGeometryCache ( false ),
+        M_geometryCaches ( ),
+        M_elementsSplit  ( false ),
+        M_interiorElements  ( ),
+        M_interfaceElements ( )
 {
     resetBoundaryFE();
     createMap(commptr);
@@ -558,7 +644,12 @@ FESpace( MeshPartitioner<MeshType>& mesh,
         M_dof           ( ),
         M_fe            ( ),
         M_feBd          ( ),
-        M_map           ( new map_Type() )
+        M_map           ( new map_Type() ),
+        M_useGeometryCache ( false ),
+        M_geometryCaches ( ),
+        M_elementsSplit  ( false ),
+        M_interiorElements  ( ),
+        M_interfaceElements ( )
 {
     // Set spaceMap
     M_spaceMap["P1"]        = P1;
@@ -596,7 +687,12 @@ FESpace( meshPtr_Type           mesh,
         M_dim           ( M_dof->numTotalDof() ),
         M_fe            ( new CurrentFE( *M_refFE, getGeometricMap( *M_mesh ), *M_Qr ) ),
         M_feBd          ( ),
-        M_map           ( new map_Type() )
+        M_map           ( new map_Type() ),
+        M_useGeometryCache ( false ),
+        M_geometryCaches ( ),
+        M_elementsSplit  ( false ),
+        M_interiorElements  ( ),
+        M_interfaceElements ( )
 {
     createMap(commptr);
     resetBoundaryFE();
@@ -614,7 +710,12 @@ FESpace( meshPtr_Type         mesh,
         M_dof           ( ),
         M_fe            ( ),
         M_feBd          ( ),
-        M_map           ( new map_Type() )
+        M_map           ( new map_Type() ),
+        M_useGeometryCache ( false ),
+        M_geometryCaches ( ),
+        M_elementsSplit  ( false ),
+        M_interiorElements  ( ),
+        M_interfaceElements ( )
 {
     // Set spaceMap
     M_spaceMap["P1"]        = P1;
@@ -1623,6 +1724,50 @@ setQuadRule(const QuadratureRule& Qr)
 {
     M_Qr = &Qr;
     M_fe.reset( new CurrentFE( *M_refFE, getGeometricMap( *M_mesh ), *M_Qr ) );
+    M_fe->setGeometryCache( geometryCache( *M_Qr ) );
+}
+
+template <typename MeshType, typename MapType>
+void
+FESpace<MeshType, MapType>::
+setGeometryCache( const bool& useCache )
+{
+    M_useGeometryCache = useCache;
+    M_geometryCaches.clear();
+    M_fe->setGeometryCache( geometryCache( *M_Qr ) );
+}
+
+// ===================================================
+// Get Methods
+// ===================================================
+
+template <typename MeshType, typename MapType>
+boost::shared_ptr<CurrentFEGeometryCache>
+FESpace<MeshType, MapType>::
+geometryCache( const QuadratureRule& qr )
+{
+    if ( !M_useGeometryCache )
+    {
+        return boost::shared_ptr<CurrentFEGeometryCache>();
+    }
+
+    const UInt nbCoor( M_refFE->nbCoor() );
+
+    for ( UInt i(0); i < M_geometryCaches.size(); ++i )
+    {
+        if ( M_geometryCaches[i]->isCompatible( qr, nbCoor ) )
+        {
+            return M_geometryCaches[i];
+        }
+    }
+
+    boost::shared_ptr<CurrentFEGeometryCache> newCache(
+        new CurrentFEGeometryCache( M_mesh->numElements(), nbCoor, qr,
+                                    boost::bind( &MeshUtility::MeshTransformer<mesh_Type>::geometryVersion,
+                                                 &M_mesh->meshTransformer() ) ) );
+    M_geometryCaches.push_back( newCache );
+
+    return newCache;
 }
 
 
@@ -1990,5 +2135,111 @@ polynomialDegree() const
     return 0;
 }
 
+template<typename MeshType, typename MapType>
+void
+FESpace<MeshType,MapType>::
+splitElementsByOwnership() const
+{
+    if ( M_elementsSplit )
+        return;
+
+    M_interiorElements.clear();
+    M_interfaceElements.clear();
+
+    // The components of a degree of freedom are owned by the same process
+    const typename map_Type::map_type& uniqueMap( *M_map->map( Unique ) );
+
+    for ( UInt iElement( 0 ); iElement < M_mesh->numElements(); ++iElement )
+    {
+        bool isInterior( true );
+        for ( UInt iDof( 0 ); iDof < M_dof->numLocalDof() && isInterior; ++iDof )
+        {
+            isInterior = uniqueMap.LID( static_cast<Int>( M_dof->localToGlobalMap( iElement, iDof ) ) ) >= 0;
+        }
+
+        if ( isInterior )
+            M_interiorElements.push_back( iElement );
+        else
+            M_interfaceElements.push_back( iElement );
+    }
+
+    M_elementsSplit = true;
+}
+
+template<typename MeshType, typename MapType>
+UInt
+FESpace<MeshType,MapType>::
+rigidBodyModes( std::vector<Real>& modes, const map_Type& map, const UInt& offset, const bool& rotations ) const
+{
+    const typename map_Type::map_type& uniqueMap( *map.map( Unique ) );
+    const UInt numRows( uniqueMap.NumMyElements() );
+
+    UInt numModes( M_fieldDim );
+    if ( rotations && M_fieldDim == 2 )
+        numModes = 3;
+    else if ( rotations && M_fieldDim == 3 )
+        numModes = 6;
+
+    modes.assign( numModes * numRows, 0. );
+
+    // The rows which are not in the space get the constant
+    for ( UInt iRow( 0 ); iRow < numRows; ++iRow )
+    {
+        const Int globalRow( uniqueMap.GID( iRow ) );
+        if ( globalRow < static_cast<Int>( offset ) || globalRow >= static_cast<Int>( offset + M_fieldDim * M_dim ) )
+            modes[iRow] = 1.;
+    }
+
+    // The coordinates of the nodes are the quadrature nodes on the reference nodes
+    QuadratureRule interpQuad;
+    interpQuad.setDimensionShape( shapeDimension( M_refFE->shape() ), M_refFE->shape() );
+    interpQuad.setPoints( M_refFE->refCoor(), std::vector<Real>( M_refFE->nbDof(), 0 ) );
+    CurrentFE interpCFE( *M_refFE, getGeometricMap( *M_mesh ), interpQuad );
+
+    for ( UInt iElement( 0 ); iElement < M_mesh->numElements(); ++iElement )
+    {
+        interpCFE.update( M_mesh->element( iElement ), UPDATE_QUAD_NODES );
+
+        for ( UInt iDof( 0 ); iDof < M_dof->numLocalDof(); ++iDof )
+        {
+            const Real x( interpCFE.quadNode( iDof, 0 ) );
+            const Real y( interpCFE.quadNode( iDof, 1 ) );
+            const Real z( interpCFE.quadNode( iDof, 2 ) );
+
+            for ( UInt iComponent( 0 ); iComponent < M_fieldDim; ++iComponent )
+            {
+                const Int localRow( uniqueMap.LID( static_cast<Int>( M_dof->localToGlobalMap( iElement, iDof )
+                                                                     + iComponent * M_dim + offset ) ) );
+                if ( localRow < 0 )
+                    continue;
+
+                // Translations
+                modes[ iComponent * numRows + localRow ] = 1.;
+
+                // Rotations: around z in 2D, around z, x and y in 3D
+                if ( !rotations )
+                    continue;
+
+                if ( M_fieldDim == 2 )
+                {
+                    const Real rotationZ[2] = { -y, x };
+                    modes[ 2 * numRows + localRow ] = rotationZ[iComponent];
+                }
+                else if ( M_fieldDim == 3 )
+                {
+                    const Real rotationZ[3] = { -y, x, 0. };
+                    const Real rotationX[3] = { 0., -z, y };
+                    const Real rotationY[3] = { z, 0., -x };
+                    modes[ 3 * numRows + localRow ] = rotationZ[iComponent];
+                    modes[ 4 * numRows + localRow ] = rotationX[iComponent];
+                    modes[ 5 * numRows + localRow ] = rotationY[iComponent];
+                }
+            }
+        }
+    }
+
+    return numModes;
+}
+
 } // end of the namespace
 #endif
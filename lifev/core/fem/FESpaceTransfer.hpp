@@ -0,0 +1,456 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the FESpaceTransfer class
+
+    @date 19-10-2012
+ */
+
+#ifndef FESPACETRANSFER_H
+#define FESPACETRANSFER_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+#include <boost/shared_ptr.hpp>
+
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/PointLocator.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! FESpaceTransfer - Transfer of finite element functions between spaces on different meshes
+/*!
+  The two finite element spaces can be built on different meshes, with different partitions,
+  for instance to restart a simulation on a refined mesh or to exchange fields between domains
+  meshed separately. They must have the same number of components.
+
+  The transfer is a sparse matrix from the source space to the target space, built once by setup()
+  and applied with a single matrix-vector product. Two methods are available:
+  <ul>
+  <li> Interpolation: the value in each degree of freedom of the target space is the value of the
+       source function in the node of this degree of freedom (the target space must be Lagrangian);
+  <li> L2Projection: the projection of the source function on the target space, with the lumped mass
+       matrix of the target space, so that the transfer matrix stays sparse. The integrals of the
+       source function are computed with the quadrature rule of the target space, and the lumped
+       mass only accounts for the quadrature nodes found in the source mesh: constants are then
+       transferred exactly. The lumped masses are positive only when the target space has one
+       degree of freedom per vertex and no other (P1, Q1): the setup stops with an error otherwise,
+       since the lumped mass of the vertices of P2 tetrahedra, for instance, vanishes.
+  </ul>
+
+  The points are located in the source mesh by a PointLocator. The points that are not found
+  (outside the source mesh, up to the tolerance) give zero rows, their number can be checked with
+  numMissingPoints().
+
+  Usage:
+  \code
+  FESpaceTransfer< mesh_Type, mesh_Type > transfer( coarseFESpace, fineFESpace );
+  transfer.setup( FESpaceTransfer< mesh_Type, mesh_Type >::Interpolation );
+  transfer.transfer( coarseSolution, fineSolution );
+  \endcode
+ */
+template <typename SourceMeshType, typename TargetMeshType, typename MapType = MapEpetra>
+class FESpaceTransfer
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef FESpace<SourceMeshType, MapType>                sourceFESpace_Type;
+    typedef boost::shared_ptr<sourceFESpace_Type>           sourceFESpacePtr_Type;
+
+    typedef FESpace<TargetMeshType, MapType>                targetFESpace_Type;
+    typedef boost::shared_ptr<targetFESpace_Type>           targetFESpacePtr_Type;
+
+    typedef PointLocator<SourceMeshType>                    locator_Type;
+    typedef boost::shared_ptr<locator_Type>                 locatorPtr_Type;
+
+    typedef MatrixEpetra<Real>                              matrix_Type;
+    typedef boost::shared_ptr<matrix_Type>                  matrixPtr_Type;
+
+    typedef VectorEpetra                                    vector_Type;
+
+    typedef typename locator_Type::pointList_Type           pointList_Type;
+
+    enum TransferMethod { Interpolation, L2Projection };
+
+    //@}
+
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param sourceFESpace the space of the functions to transfer
+      @param targetFESpace the space of the transferred functions
+     */
+    FESpaceTransfer( const sourceFESpacePtr_Type& sourceFESpace, const targetFESpacePtr_Type& targetFESpace );
+
+    //! Destructor
+    ~FESpaceTransfer() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Build the transfer matrix
+    /*!
+      This method is collective. It must be called again when one of the meshes moves.
+      @param method Interpolation or L2Projection (P1 or Q1 target space only)
+     */
+    void setup( const TransferMethod& method = Interpolation );
+
+    //! Transfer a function
+    /*!
+      @param source the function in the source space
+      @param target the function in the target space, with Unique map
+     */
+    void transfer( const vector_Type& source, vector_Type& target ) const;
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the tolerance used to locate the points in the source mesh (see PointLocator)
+    void setTolerance( const Real& tolerance )
+    {
+        M_tolerance = tolerance;
+    }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! The transfer matrix, from the source map to the target map
+    const matrixPtr_Type& matrixPtr() const
+    {
+        return M_matrix;
+    }
+
+    //! The locator of the points in the source mesh
+    const locatorPtr_Type& locatorPtr() const
+    {
+        return M_locator;
+    }
+
+    //! Number of points of this processor not found in the source mesh during the last setup
+    const UInt& numMissingPoints() const
+    {
+        return M_numMissingPoints;
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    FESpaceTransfer( const FESpaceTransfer& );
+
+    FESpaceTransfer& operator=( const FESpaceTransfer& );
+
+    //! Fill the matrix with the values of the source basis functions in the target nodes
+    void assembleInterpolation();
+
+    //! Fill the matrix with the lumped L2 projection on the target space (P1 or Q1)
+    void assembleL2Projection();
+
+    //@}
+
+    sourceFESpacePtr_Type       M_sourceFESpace;
+
+    targetFESpacePtr_Type       M_targetFESpace;
+
+    locatorPtr_Type             M_locator;
+
+    matrixPtr_Type              M_matrix;
+
+    Real                        M_tolerance;
+
+    UInt                        M_numMissingPoints;
+};
+
+// ===================================================
+// Constructor
+// ===================================================
+
+template <typename SourceMeshType, typename TargetMeshType, typename MapType>
+FESpaceTransfer<SourceMeshType, TargetMeshType, MapType>::FESpaceTransfer( const sourceFESpacePtr_Type& sourceFESpace,
+                                                                           const targetFESpacePtr_Type& targetFESpace )
+        :
+        M_sourceFESpace( sourceFESpace ),
+        M_targetFESpace( targetFESpace ),
+        M_locator(),
+        M_matrix(),
+        M_tolerance( 1e-10 ),
+        M_numMissingPoints( 0 )
+{
+    ASSERT( M_sourceFESpace->fieldDim() == M_targetFESpace->fieldDim(),
+            "The two spaces must have the same number of components!" );
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+template <typename SourceMeshType, typename TargetMeshType, typename MapType>
+void FESpaceTransfer<SourceMeshType, TargetMeshType, MapType>::setup( const TransferMethod& method )
+{
+    M_locator.reset( new locator_Type( M_sourceFESpace->mesh(), M_sourceFESpace->map().commPtr(), M_tolerance ) );
+    M_locator->setup();
+
+    M_matrix.reset( new matrix_Type( M_targetFESpace->map() ) );
+    M_numMissingPoints = 0;
+
+    switch ( method )
+    {
+    case Interpolation:
+        assembleInterpolation();
+        break;
+    case L2Projection:
+        if ( M_targetFESpace->refFE().nbDofPerVertex() != 1 || M_targetFESpace->refFE().nbDofPerEdge() != 0
+             || M_targetFESpace->refFE().nbDofPerFace() != 0 || M_targetFESpace->refFE().nbDofPerVolume() != 0 )
+        {
+            ERROR_MSG( "The lumped L2 projection needs a target space with only one degree of freedom per vertex (P1, Q1)!" );
+        }
+        assembleL2Projection();
+        break;
+    }
+}
+
+template <typename SourceMeshType, typename TargetMeshType, typename MapType>
+void FESpaceTransfer<SourceMeshType, TargetMeshType, MapType>::transfer( const vector_Type& source, vector_Type& target ) const
+{
+    ASSERT( M_matrix.get(), "The transfer matrix is not built: call setup first!" );
+
+    if ( source.mapType() != Unique )
+    {
+        transfer( vector_Type( source, Unique ), target );
+        return;
+    }
+
+    M_matrix->multiply( false, source, target );
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template <typename SourceMeshType, typename TargetMeshType, typename MapType>
+void FESpaceTransfer<SourceMeshType, TargetMeshType, MapType>::assembleInterpolation()
+{
+    const targetFESpace_Type& targetFESpace( *M_targetFESpace );
+    const ReferenceFE& targetRefFE( targetFESpace.refFE() );
+
+    // A "quadrature" on the nodes of the target finite element, to get their coordinates
+    QuadratureRule nodesQuadrature;
+    nodesQuadrature.setDimensionShape( shapeDimension( targetRefFE.shape() ), targetRefFE.shape() );
+    nodesQuadrature.setPoints( targetRefFE.refCoor(), std::vector<Real>( targetRefFE.nbDof(), 0 ) );
+
+    CurrentFE nodesFE( targetRefFE, getGeometricMap( *targetFESpace.mesh() ), nodesQuadrature );
+
+    // The nodes of the degrees of freedom owned by this processor, each one once
+    const typename MapType::map_type& uniqueMap( *targetFESpace.map().map( Unique ) );
+    const UInt numElements( targetFESpace.mesh()->numElements() );
+    const UInt numLocalDof( targetFESpace.dof().numLocalDof() );
+
+    std::vector<bool> done( uniqueMap.NumMyElements(), false );
+    std::vector<ID> rows;
+    pointList_Type nodes;
+    typename locator_Type::point_Type node;
+
+    for ( UInt iElement( 0 ); iElement < numElements; ++iElement )
+    {
+        nodesFE.update( targetFESpace.mesh()->element( iElement ), UPDATE_QUAD_NODES );
+
+        for ( UInt iDof( 0 ); iDof < numLocalDof; ++iDof )
+        {
+            const ID globalDof( targetFESpace.dof().localToGlobalMap( iElement, iDof ) );
+            const Int localDof( uniqueMap.LID( static_cast<Int>( globalDof ) ) );
+
+            if ( localDof < 0 || done[localDof] )
+            {
+                continue;
+            }
+            done[localDof] = true;
+
+            for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+            {
+                node[iCoor] = nodesFE.quadNode( iDof, iCoor );
+            }
+            nodes.push_back( node );
+            rows.push_back( globalDof );
+        }
+    }
+
+    std::vector<ID> dofs;
+    std::vector<Real> weights;
+    std::vector<bool> found;
+    M_locator->interpolationCoefficients( *M_sourceFESpace, nodes, dofs, weights, found );
+
+    // The same coefficients for all the components
+    const UInt fieldDim( targetFESpace.fieldDim() );
+    const UInt sourceNumLocalDof( M_sourceFESpace->dof().numLocalDof() );
+    const UInt sourceNumTotalDof( M_sourceFESpace->dof().numTotalDof() );
+    const UInt targetNumTotalDof( targetFESpace.dof().numTotalDof() );
+
+    for ( UInt iNode( 0 ); iNode < nodes.size(); ++iNode )
+    {
+        if ( !found[iNode] )
+        {
+            ++M_numMissingPoints;
+            continue;
+        }
+
+        for ( UInt iDof( 0 ); iDof < sourceNumLocalDof; ++iDof )
+        {
+            const Real weight( weights[sourceNumLocalDof * iNode + iDof] );
+            if ( weight == 0. )
+            {
+                continue;
+            }
+
+            for ( UInt iComponent( 0 ); iComponent < fieldDim; ++iComponent )
+            {
+                M_matrix->addToCoefficient( rows[iNode] + iComponent * targetNumTotalDof,
+                                            dofs[sourceNumLocalDof * iNode + iDof] + iComponent * sourceNumTotalDof,
+                                            weight );
+            }
+        }
+    }
+
+    M_matrix->globalAssemble( M_sourceFESpace->mapPtr(), targetFESpace.mapPtr() );
+}
+
+template <typename SourceMeshType, typename TargetMeshType, typename MapType>
+void FESpaceTransfer<SourceMeshType, TargetMeshType, MapType>::assembleL2Projection()
+{
+    const targetFESpace_Type& targetFESpace( *M_targetFESpace );
+
+    CurrentFE targetFE( targetFESpace.refFE(), getGeometricMap( *targetFESpace.mesh() ), targetFESpace.qr() );
+
+    const UInt numElements( targetFESpace.mesh()->numElements() );
+    const UInt numQuadraturePoints( targetFESpace.qr().nbQuadPt() );
+
+    // The quadrature nodes of all the target elements
+    pointList_Type nodes( numElements * numQuadraturePoints );
+    for ( UInt iElement( 0 ); iElement < numElements; ++iElement )
+    {
+        targetFE.update( targetFESpace.mesh()->element( iElement ), UPDATE_QUAD_NODES );
+
+        for ( UInt iQuad( 0 ); iQuad < numQuadraturePoints; ++iQuad )
+        {
+            for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+            {
+                nodes[numQuadraturePoints * iElement + iQuad][iCoor] = targetFE.quadNode( iQuad, iCoor );
+            }
+        }
+    }
+
+    std::vector<ID> dofs;
+    std::vector<Real> weights;
+    std::vector<bool> found;
+    M_locator->interpolationCoefficients( *M_sourceFESpace, nodes, dofs, weights, found );
+
+    const UInt fieldDim( targetFESpace.fieldDim() );
+    const UInt numLocalDof( targetFESpace.dof().numLocalDof() );
+    const UInt sourceNumLocalDof( M_sourceFESpace->dof().numLocalDof() );
+    const UInt sourceNumTotalDof( M_sourceFESpace->dof().numTotalDof() );
+    const UInt targetNumTotalDof( targetFESpace.dof().numTotalDof() );
+
+    // Mixed mass matrix and lumped mass of the target space, restricted to the nodes found
+    vector_Type lumpedMass( targetFESpace.map(), Unique );
+
+    for ( UInt iElement( 0 ); iElement < numElements; ++iElement )
+    {
+        targetFE.update( targetFESpace.mesh()->element( iElement ), UPDATE_PHI | UPDATE_WDET );
+
+        for ( UInt iQuad( 0 ); iQuad < numQuadraturePoints; ++iQuad )
+        {
+            const UInt iNode( numQuadraturePoints * iElement + iQuad );
+            if ( !found[iNode] )
+            {
+                ++M_numMissingPoints;
+                continue;
+            }
+
+            for ( UInt iDof( 0 ); iDof < numLocalDof; ++iDof )
+            {
+                const Real phiWeight( targetFE.phi( iDof, iQuad ) * targetFE.wDetJacobian( iQuad ) );
+                const ID row( targetFESpace.dof().localToGlobalMap( iElement, iDof ) );
+
+                for ( UInt iComponent( 0 ); iComponent < fieldDim; ++iComponent )
+                {
+                    lumpedMass.sumIntoGlobalValues( row + iComponent * targetNumTotalDof, phiWeight );
+
+                    for ( UInt jDof( 0 ); jDof < sourceNumLocalDof; ++jDof )
+                    {
+                        const Real weight( weights[sourceNumLocalDof * iNode + jDof] );
+                        if ( weight == 0. )
+                        {
+                            continue;
+                        }
+
+                        M_matrix->addToCoefficient( row + iComponent * targetNumTotalDof,
+                                                    dofs[sourceNumLocalDof * iNode + jDof] + iComponent * sourceNumTotalDof,
+                                                    phiWeight * weight );
+                    }
+                }
+            }
+        }
+    }
+
+    lumpedMass.globalAssemble();
+    M_matrix->globalAssemble( M_sourceFESpace->mapPtr(), targetFESpace.mapPtr() );
+
+    // Rows scaled by the inverse of the lumped mass, positive for the vertex degrees of freedom
+    // (the rows without mass are empty)
+    vector_Type inverseLumpedMass( targetFESpace.map(), Unique );
+    inverseLumpedMass.epetraVector().Reciprocal( lumpedMass.epetraVector() );
+    M_matrix->matrixPtr()->LeftScale( *inverseLumpedMass.epetraVector()( 0 ) );
+}
+
+} // Namespace LifeV
+
+#endif /* FESPACETRANSFER_H */
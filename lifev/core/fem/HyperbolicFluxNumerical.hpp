@@ -178,6 +178,12 @@ public:
     //! Virtual destructor.
     virtual ~AbstractNumericalFlux ();
 
+    //! Return a copy of the numerical flux.
+    /*!
+      @return Pointer to a new copy of the current numerical flux, the caller takes the ownership.
+    */
+    virtual AbstractNumericalFlux<Mesh, SolverType>* clone () const = 0;
+
     //@}
 
     //! @name Operators
@@ -259,13 +265,13 @@ public:
       @param unknown The value of the unknown.
       @return The value of \f$ \mathbf{ \hat{ F } } \cdot \mathbf{ n }\f$ in the point \f$ (x, y, z, t, u) \f$.
     */
-    inline Real physicalFluxDotNormal ( const normal_Type& normal,
-                                        const UInt&        iElem,
-                                        const Real&        t,
-                                        const Real&        x,
-                                        const Real&        y,
-                                        const Real&        z,
-                                        const Real&        unknown ) const
+    virtual Real physicalFluxDotNormal ( const normal_Type& normal,
+                                         const UInt&        iElem,
+                                         const Real&        t,
+                                         const Real&        x,
+                                         const Real&        y,
+                                         const Real&        z,
+                                         const Real&        unknown ) const
     {
         return computeFunctionDotNormal ( M_physicalFlux, normal, iElem, t, x, y, z, +1 ) ( unknown );
     }
@@ -281,13 +287,13 @@ public:
       @param unknown The value of the unknown.
       @return The value of \f$ \mathbf{ \hat{ F^\prime } } \cdot \mathbf{ n }\f$ in the point \f$ (x, y, z, t, u) \f$.
     */
-    inline Real firstDerivativePhysicalFluxDotNormal ( const normal_Type& normal,
-                                                       const UInt&        iElem,
-                                                       const Real&        t,
-                                                       const Real&        x,
-                                                       const Real&        y,
-                                                       const Real&        z,
-                                                       const Real&        unknown ) const
+    virtual Real firstDerivativePhysicalFluxDotNormal ( const normal_Type& normal,
+                                                        const UInt&        iElem,
+                                                        const Real&        t,
+                                                        const Real&        x,
+                                                        const Real&        y,
+                                                        const Real&        z,
+                                                        const Real&        unknown ) const
     {
         return computeFunctionDotNormal ( M_firstDerivativePhysicalFlux, normal, iElem, t, x, y, z, +1 ) ( unknown );
     }
@@ -310,14 +316,57 @@ public:
       @note We assume left and right side of \f$ e \f$ is given by: the normal direction goes
       from the left side to the right side.
     */
-    Real normInfinity ( const Real&        leftState,
-                        const Real&        rightState,
-                        const normal_Type& normal,
-                        const UInt&        iElem,
-                        const Real&        t = 0,
-                        const Real&        x = 0,
-                        const Real&        y = 0,
-                        const Real&        z = 0 ) const;
+    virtual Real normInfinity ( const Real&        leftState,
+                                const Real&        rightState,
+                                const normal_Type& normal,
+                                const UInt&        iElem,
+                                const Real&        t = 0,
+                                const Real&        x = 0,
+                                const Real&        y = 0,
+                                const Real&        z = 0 ) const;
+
+    //! Computes the numerical flux integrated on a face.
+    /*!
+      Evaluates \f$ \int_e \hat{\mathbf{F}} \cdot \mathbf{n} \f$ with one call for all the quadrature nodes
+      of the face. The default implementation calls operator() in each node, the numerical fluxes with a
+      closed form override it to evaluate the nodes without virtual calls.
+      @param leftState Left value of the unknown respect to the face.
+      @param rightState Right value of the unknown respect to the face.
+      @param normals Normals in the quadrature nodes, three components for each node.
+      @param quadPoints Quadrature nodes, three coordinates for each node.
+      @param weightMeas Quadrature weights times the measure of the face.
+      @param nbQuadPt Number of quadrature nodes.
+      @param iElem The ID of the left element in the mesh.
+      @param t Current time.
+      @return The integral of the numerical flux on the face.
+    */
+    virtual Real faceFlux ( const Real& leftState,
+                            const Real& rightState,
+                            const Real* normals,
+                            const Real* quadPoints,
+                            const Real* weightMeas,
+                            const UInt& nbQuadPt,
+                            const UInt& iElem,
+                            const Real& t ) const;
+
+    //! Computes the maximum of normInfinity on the quadrature nodes of a face.
+    /*!
+      @param leftState Left value of the unknown respect to the face.
+      @param rightState Right value of the unknown respect to the face.
+      @param normals Normals in the quadrature nodes, three components for each node.
+      @param quadPoints Quadrature nodes, three coordinates for each node.
+      @param nbQuadPt Number of quadrature nodes.
+      @param iElem The ID of the current element in the mesh.
+      @param t Current time.
+      @return The maximum on the face of \f$ \Vert \mathbf{F}^\prime \cdot \mathbf{n} \Vert_{L^\infty(a, b)} \f$.
+    */
+    virtual Real faceNormInfinity ( const Real& leftState,
+                                    const Real& rightState,
+                                    const Real* normals,
+                                    const Real* quadPoints,
+                                    const UInt& nbQuadPt,
+                                    const UInt& iElem,
+                                    const Real& t ) const;
 
     //@}
 
@@ -462,6 +511,58 @@ normInfinity ( const Real& leftState, const Real& rightState, const normal_Type&
 
 } // getNormInfty
 
+// Integrate the numerical flux on a face
+template< typename Mesh, typename SolverType >
+Real
+AbstractNumericalFlux<Mesh, SolverType>::
+faceFlux ( const Real& leftState, const Real& rightState, const Real* normals, const Real* quadPoints,
+           const Real* weightMeas, const UInt& nbQuadPt, const UInt& iElem, const Real& t ) const
+{
+
+    Real flux( 0. );
+    normal_Type normal( 3 );
+
+    for ( UInt ig(0); ig < nbQuadPt; ++ig )
+    {
+        for ( UInt icoor(0); icoor < 3; ++icoor )
+        {
+            normal( icoor ) = normals[ 3 * ig + icoor ];
+        }
+
+        flux += (*this)( leftState, rightState, normal, iElem, t,
+                         quadPoints[ 3 * ig ], quadPoints[ 3 * ig + 1 ], quadPoints[ 3 * ig + 2 ] ) * weightMeas[ ig ];
+    }
+
+    return flux;
+
+} // faceFlux
+
+// Maximum of the norm infinity on a face
+template< typename Mesh, typename SolverType >
+Real
+AbstractNumericalFlux<Mesh, SolverType>::
+faceNormInfinity ( const Real& leftState, const Real& rightState, const Real* normals, const Real* quadPoints,
+                   const UInt& nbQuadPt, const UInt& iElem, const Real& t ) const
+{
+
+    Real maxNorm( 0. );
+    normal_Type normal( 3 );
+
+    for ( UInt ig(0); ig < nbQuadPt; ++ig )
+    {
+        for ( UInt icoor(0); icoor < 3; ++icoor )
+        {
+            normal( icoor ) = normals[ 3 * ig + icoor ];
+        }
+
+        maxNorm = std::max( maxNorm, normInfinity( leftState, rightState, normal, iElem, t,
+                                                   quadPoints[ 3 * ig ], quadPoints[ 3 * ig + 1 ], quadPoints[ 3 * ig + 2 ] ) );
+    }
+
+    return maxNorm;
+
+} // faceNormInfinity
+
 // Create the fluxDotNormal function
 template < typename Mesh, typename SolverType >
 boost::function< Real ( const Real& ) >
@@ -560,6 +661,15 @@ public:
     //! Virtual destructor
     virtual ~GodunovNumericalFlux ();
 
+    //! Return a copy of the numerical flux.
+    /*!
+      @return Pointer to a new copy of the current numerical flux, the caller takes the ownership.
+    */
+    virtual AbstractNumericalFlux<Mesh, SolverType>* clone () const
+    {
+        return new GodunovNumericalFlux<Mesh, SolverType>( *this );
+    }
+
     //@}
 
     //! @name Operators
@@ -683,6 +793,407 @@ operator() ( const Real& leftState, const Real& rightState, const normal_Type& n
 
 } // operator()
 
+// ######################################################################### //
+
+//! LinearFluxPolicy Closed form evaluations for the linear flux \f$ \mathbf{F}( u ) = \mathbf{b} u \f$.
+/*!
+  Flux policy to be used with PolicyNumericalFlux. A flux policy is a class which gives, for a face with
+  normal speed \f$ c = \mathbf{b} \cdot \mathbf{n} \f$, the following inline methods:
+  <ol>
+  <li> normalSpeed( normal ), the value of \f$ c \f$; </li>
+  <li> fluxDotNormal( u, c ), the value of \f$ \mathbf{F}( u ) \cdot \mathbf{n} \f$; </li>
+  <li> firstDerivativeDotNormal( u, c ), the value of \f$ \mathbf{F}^\prime( u ) \cdot \mathbf{n} \f$; </li>
+  <li> godunov( a, b, c ), the closed form of the Godunov flux between the states \f$ a \f$ and \f$ b \f$; </li>
+  <li> maxSpeed( a, b, c ), the value of \f$ \Vert \mathbf{F}^\prime \cdot \mathbf{n} \Vert_{L^\infty(a, b)} \f$. </li>
+  </ol>
+  For the linear flux the Godunov flux is the upwind flux.
+*/
+class LinearFluxPolicy
+{
+
+public:
+
+    //! Constructor for the class
+    /*!
+      @param direction The constant advection field \f$ \mathbf{b} \f$.
+    */
+    explicit LinearFluxPolicy ( const Vector& direction ) : M_direction ( direction ) {}
+
+    //! Compute \f$ \mathbf{b} \cdot \mathbf{n} \f$.
+    template< typename NormalType >
+    inline Real normalSpeed ( const NormalType& normal ) const
+    {
+        Real speed( 0. );
+        for ( UInt nDim(0); nDim < static_cast<UInt>( M_direction.size() ); ++nDim )
+        {
+            speed += M_direction[ nDim ] * normal[ nDim ];
+        }
+        return speed;
+    }
+
+    inline Real fluxDotNormal ( const Real& unknown, const Real& speed ) const
+    {
+        return speed * unknown;
+    }
+
+    inline Real firstDerivativeDotNormal ( const Real& /*unknown*/, const Real& speed ) const
+    {
+        return speed;
+    }
+
+    inline Real godunov ( const Real& leftState, const Real& rightState, const Real& speed ) const
+    {
+        return speed * ( speed > 0. ? leftState : rightState );
+    }
+
+    inline Real maxSpeed ( const Real& /*leftState*/, const Real& /*rightState*/, const Real& speed ) const
+    {
+        return std::fabs( speed );
+    }
+
+private:
+
+    //! Advection field.
+    Vector M_direction;
+
+}; // LinearFluxPolicy
+
+//! BurgersScalarFlux Scalar function \f$ g( u ) = u^2 / 2 \f$ for ConvexFluxPolicy.
+struct BurgersScalarFlux
+{
+    static inline Real value ( const Real& unknown ) { return 0.5 * unknown * unknown; }
+    static inline Real firstDerivative ( const Real& unknown ) { return unknown; }
+    static inline Real argMin () { return 0.; }
+};
+
+//! ConvexFluxPolicy Closed form evaluations for the flux \f$ \mathbf{F}( u ) = \mathbf{b} g( u ) \f$ with \f$ g \f$ convex.
+/*!
+  Flux policy to be used with PolicyNumericalFlux, see LinearFluxPolicy for the interface.
+  The template parameter ScalarFlux gives the static methods value( u ), firstDerivative( u ) and argMin(),
+  the point where \f$ g \f$ attains its minimum. See BurgersScalarFlux.
+  <br>
+  The function \f$ c g \f$, with \f$ c = \mathbf{b} \cdot \mathbf{n} \f$, is convex if \f$ c \geq 0 \f$ and concave
+  otherwise, hence the minimum and the maximum on an interval in the Godunov flux are attained either
+  at the end points or in argMin and no root finding is needed.
+*/
+template< typename ScalarFlux >
+class ConvexFluxPolicy : public LinearFluxPolicy
+{
+
+public:
+
+    //! Constructor for the class
+    /*!
+      @param direction The constant field \f$ \mathbf{b} \f$.
+    */
+    explicit ConvexFluxPolicy ( const Vector& direction ) : LinearFluxPolicy ( direction ) {}
+
+    inline Real fluxDotNormal ( const Real& unknown, const Real& speed ) const
+    {
+        return speed * ScalarFlux::value( unknown );
+    }
+
+    inline Real firstDerivativeDotNormal ( const Real& unknown, const Real& speed ) const
+    {
+        return speed * ScalarFlux::firstDerivative( unknown );
+    }
+
+    inline Real godunov ( const Real& leftState, const Real& rightState, const Real& speed ) const
+    {
+        const Real lower( std::min( leftState, rightState ) );
+        const Real upper( std::max( leftState, rightState ) );
+        const Real valueMin( ScalarFlux::value( std::min( std::max( ScalarFlux::argMin(), lower ), upper ) ) );
+        const Real valueMax( std::max( ScalarFlux::value( leftState ), ScalarFlux::value( rightState ) ) );
+
+        // min of c g if leftState <= rightState, max of c g otherwise
+        if ( ( leftState <= rightState ) == ( speed >= 0. ) )
+        {
+            return speed * valueMin;
+        }
+        return speed * valueMax;
+    }
+
+    inline Real maxSpeed ( const Real& leftState, const Real& rightState, const Real& speed ) const
+    {
+        // g' is monotone, the maximum of its absolute value is attained at the end points
+        return std::fabs( speed ) * std::max( std::fabs( ScalarFlux::firstDerivative( leftState ) ),
+                                              std::fabs( ScalarFlux::firstDerivative( rightState ) ) );
+    }
+
+}; // ConvexFluxPolicy
+
+typedef ConvexFluxPolicy< BurgersScalarFlux > BurgersFluxPolicy;
+
+//! PolicyNumericalFlux Numerical flux with closed form evaluations given by a compile time flux policy.
+/*!
+  This class implements the physical flux evaluations of AbstractNumericalFlux using a flux policy, see
+  LinearFluxPolicy and ConvexFluxPolicy. All the evaluations are inlined and do not require neither
+  boost::function calls nor the Brent algorithm, as GodunovNumericalFlux does.
+  The numerical scheme is given by the derived classes GodunovPolicyNumericalFlux and RusanovPolicyNumericalFlux.
+  HyperbolicSolver calls faceFlux() and faceNormInfinity() once for each face, hence with these classes the
+  flux policy is inlined in the loop on the quadrature nodes and there is one virtual call per face.
+  @note The flux policies do not depend on external fields, setExternalField has no effect.
+*/
+template< typename Mesh,
+          typename FluxPolicy,
+          typename SolverType = LifeV::SolverAztecOO >
+class PolicyNumericalFlux : public AbstractNumericalFlux<Mesh, SolverType>
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef AbstractNumericalFlux<Mesh, SolverType>         flux_Type;
+    typedef typename flux_Type::vectorFunction_Type         vectorFunction_Type;
+    typedef typename flux_Type::dataFile_Type               dataFile_Type;
+    typedef typename flux_Type::normal_Type                 normal_Type;
+    typedef FluxPolicy                                      fluxPolicy_Type;
+
+    //@}
+
+    //! @name Constructors and destructor
+    //@{
+
+    //! Constructor for the class
+    /*!
+      @param fluxPolicy Flux policy for the problem.
+      @param fESpace Finite element space of the hyperbolic problem.
+      @param data Data for the problem.
+      @param section Section for read the data from GetPot file.
+    */
+    PolicyNumericalFlux ( const fluxPolicy_Type&          fluxPolicy,
+                          const FESpace<Mesh, MapEpetra>& fESpace,
+                          const dataFile_Type&            data,
+                          const std::string&              section = "numerical_flux/" ):
+        flux_Type   ( vectorFunction_Type(), vectorFunction_Type(), fESpace, data, section ),
+        M_fluxPolicy( fluxPolicy )
+    {}
+
+    //! Virtual destructor
+    virtual ~PolicyNumericalFlux () {}
+
+    //@}
+
+    //! @name Get Methods
+    //@{
+
+    //! Return the flux policy.
+    const fluxPolicy_Type& fluxPolicy () const
+    {
+        return M_fluxPolicy;
+    }
+
+    virtual Real physicalFluxDotNormal ( const normal_Type& normal,
+                                         const UInt&        /*iElem*/,
+                                         const Real&        /*t*/,
+                                         const Real&        /*x*/,
+                                         const Real&        /*y*/,
+                                         const Real&        /*z*/,
+                                         const Real&        unknown ) const
+    {
+        return M_fluxPolicy.fluxDotNormal( unknown, M_fluxPolicy.normalSpeed( normal ) );
+    }
+
+    virtual Real firstDerivativePhysicalFluxDotNormal ( const normal_Type& normal,
+                                                        const UInt&        /*iElem*/,
+                                                        const Real&        /*t*/,
+                                                        const Real&        /*x*/,
+                                                        const Real&        /*y*/,
+                                                        const Real&        /*z*/,
+                                                        const Real&        unknown ) const
+    {
+        return M_fluxPolicy.firstDerivativeDotNormal( unknown, M_fluxPolicy.normalSpeed( normal ) );
+    }
+
+    virtual Real normInfinity ( const Real&        leftState,
+                                const Real&        rightState,
+                                const normal_Type& normal,
+                                const UInt&        /*iElem*/,
+                                const Real&        /*t*/ = 0,
+                                const Real&        /*x*/ = 0,
+                                const Real&        /*y*/ = 0,
+                                const Real&        /*z*/ = 0 ) const
+    {
+        return M_fluxPolicy.maxSpeed( leftState, rightState, M_fluxPolicy.normalSpeed( normal ) );
+    }
+
+    //! Maximum of normInfinity on the quadrature nodes of a face, evaluated without virtual calls.
+    virtual Real faceNormInfinity ( const Real& leftState,
+                                    const Real& rightState,
+                                    const Real* normals,
+                                    const Real* /*quadPoints*/,
+                                    const UInt& nbQuadPt,
+                                    const UInt& /*iElem*/,
+                                    const Real& /*t*/ ) const
+    {
+        Real maxNorm( 0. );
+        for ( UInt ig(0); ig < nbQuadPt; ++ig )
+        {
+            maxNorm = std::max( maxNorm, M_fluxPolicy.maxSpeed( leftState, rightState,
+                                                                M_fluxPolicy.normalSpeed( normals + 3 * ig ) ) );
+        }
+        return maxNorm;
+    }
+
+    //@}
+
+protected:
+
+    //! Flux policy.
+    fluxPolicy_Type M_fluxPolicy;
+
+}; // PolicyNumericalFlux
+
+//! GodunovPolicyNumericalFlux Godunov flux in closed form given by a flux policy.
+/*!
+  Same flux of GodunovNumericalFlux, but the minimum and the maximum of \f$ \mathbf{F} \cdot \mathbf{n} \f$
+  are given in closed form by the flux policy.
+*/
+template< typename Mesh,
+          typename FluxPolicy,
+          typename SolverType = LifeV::SolverAztecOO >
+class GodunovPolicyNumericalFlux : public PolicyNumericalFlux<Mesh, FluxPolicy, SolverType>
+{
+
+public:
+
+    typedef PolicyNumericalFlux<Mesh, FluxPolicy, SolverType> policyFlux_Type;
+    typedef typename policyFlux_Type::dataFile_Type           dataFile_Type;
+    typedef typename policyFlux_Type::normal_Type             normal_Type;
+
+    //! Constructor for the class, see PolicyNumericalFlux.
+    GodunovPolicyNumericalFlux ( const FluxPolicy&               fluxPolicy,
+                                 const FESpace<Mesh, MapEpetra>& fESpace,
+                                 const dataFile_Type&            data,
+                                 const std::string&              section = "numerical_flux/" ):
+        policyFlux_Type ( fluxPolicy, fESpace, data, section )
+    {}
+
+    //! Virtual destructor
+    virtual ~GodunovPolicyNumericalFlux () {}
+
+    //! Return a copy of the numerical flux.
+    virtual AbstractNumericalFlux<Mesh, SolverType>* clone () const
+    {
+        return new GodunovPolicyNumericalFlux<Mesh, FluxPolicy, SolverType>( *this );
+    }
+
+    //! Computes the face contribution of the flux, see GodunovNumericalFlux.
+    virtual Real operator() ( const Real&        leftState,
+                              const Real&        rightState,
+                              const normal_Type& normal,
+                              const UInt&        /*iElem*/,
+                              const Real&        /*t*/ = 0,
+                              const Real&        /*x*/ = 0,
+                              const Real&        /*y*/ = 0,
+                              const Real&        /*z*/ = 0 ) const
+    {
+        return this->M_fluxPolicy.godunov( leftState, rightState, this->M_fluxPolicy.normalSpeed( normal ) );
+    }
+
+    //! Integrate the flux on a face, the flux policy is inlined in each quadrature node.
+    virtual Real faceFlux ( const Real& leftState,
+                            const Real& rightState,
+                            const Real* normals,
+                            const Real* /*quadPoints*/,
+                            const Real* weightMeas,
+                            const UInt& nbQuadPt,
+                            const UInt& /*iElem*/,
+                            const Real& /*t*/ ) const
+    {
+        Real flux( 0. );
+        for ( UInt ig(0); ig < nbQuadPt; ++ig )
+        {
+            flux += this->M_fluxPolicy.godunov( leftState, rightState,
+                                                this->M_fluxPolicy.normalSpeed( normals + 3 * ig ) ) * weightMeas[ ig ];
+        }
+        return flux;
+    }
+
+}; // GodunovPolicyNumericalFlux
+
+//! RusanovPolicyNumericalFlux Rusanov (local Lax-Friedrichs) flux in closed form given by a flux policy.
+/*!
+  It computes
+  \f[
+  \hat{\mathbf{F}} \cdot \mathbf{n} (a,b) = \frac{1}{2} \left( \mathbf{F}(a) + \mathbf{F}(b) \right) \cdot \mathbf{n}
+  - \frac{1}{2} \Vert \mathbf{F}^\prime \cdot \mathbf{n} \Vert_{L^\infty(a, b)} ( b - a )\,.
+  \f]
+*/
+template< typename Mesh,
+          typename FluxPolicy,
+          typename SolverType = LifeV::SolverAztecOO >
+class RusanovPolicyNumericalFlux : public PolicyNumericalFlux<Mesh, FluxPolicy, SolverType>
+{
+
+public:
+
+    typedef PolicyNumericalFlux<Mesh, FluxPolicy, SolverType> policyFlux_Type;
+    typedef typename policyFlux_Type::dataFile_Type           dataFile_Type;
+    typedef typename policyFlux_Type::normal_Type             normal_Type;
+
+    //! Constructor for the class, see PolicyNumericalFlux.
+    RusanovPolicyNumericalFlux ( const FluxPolicy&               fluxPolicy,
+                                 const FESpace<Mesh, MapEpetra>& fESpace,
+                                 const dataFile_Type&            data,
+                                 const std::string&              section = "numerical_flux/" ):
+        policyFlux_Type ( fluxPolicy, fESpace, data, section )
+    {}
+
+    //! Virtual destructor
+    virtual ~RusanovPolicyNumericalFlux () {}
+
+    //! Return a copy of the numerical flux.
+    virtual AbstractNumericalFlux<Mesh, SolverType>* clone () const
+    {
+        return new RusanovPolicyNumericalFlux<Mesh, FluxPolicy, SolverType>( *this );
+    }
+
+    //! Computes the face contribution of the flux.
+    virtual Real operator() ( const Real&        leftState,
+                              const Real&        rightState,
+                              const normal_Type& normal,
+                              const UInt&        /*iElem*/,
+                              const Real&        /*t*/ = 0,
+                              const Real&        /*x*/ = 0,
+                              const Real&        /*y*/ = 0,
+                              const Real&        /*z*/ = 0 ) const
+    {
+        return rusanov( leftState, rightState, this->M_fluxPolicy.normalSpeed( normal ) );
+    }
+
+    //! Integrate the flux on a face, the flux policy is inlined in each quadrature node.
+    virtual Real faceFlux ( const Real& leftState,
+                            const Real& rightState,
+                            const Real* normals,
+                            const Real* /*quadPoints*/,
+                            const Real* weightMeas,
+                            const UInt& nbQuadPt,
+                            const UInt& /*iElem*/,
+                            const Real& /*t*/ ) const
+    {
+        Real flux( 0. );
+        for ( UInt ig(0); ig < nbQuadPt; ++ig )
+        {
+            flux += rusanov( leftState, rightState, this->M_fluxPolicy.normalSpeed( normals + 3 * ig ) ) * weightMeas[ ig ];
+        }
+        return flux;
+    }
+
+private:
+
+    //! Rusanov flux for the normal speed \f$ c \f$.
+    inline Real rusanov ( const Real& leftState, const Real& rightState, const Real& speed ) const
+    {
+        return 0.5 * ( this->M_fluxPolicy.fluxDotNormal( leftState, speed )
+                       + this->M_fluxPolicy.fluxDotNormal( rightState, speed )
+                       - this->M_fluxPolicy.maxSpeed( leftState, rightState, speed ) * ( rightState - leftState ) );
+    }
+
+}; // RusanovPolicyNumericalFlux
+
 } // Namespace LifeV
 
 #endif //_HYPERBOLICNUMERICALFLUXES_H_
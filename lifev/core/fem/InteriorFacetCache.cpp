@@ -0,0 +1,178 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the implementation of the InteriorFacetCache class
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/fem/InteriorFacetCache.hpp>
+
+namespace LifeV
+{
+
+// ===================================================
+// Constructor
+// ===================================================
+
+InteriorFacetCache::InteriorFacetCache()
+        :
+        M_nbFEDof( 0 ),
+        M_nbCoor( 0 ),
+        M_nbQuadPt( 0 ),
+        M_isBuilt( false ),
+        M_geometryVersion( 0 ),
+        M_facetId(),
+        M_elements(),
+        M_positionInElement1(),
+        M_isInterface(),
+        M_measure(),
+        M_weightMeas(),
+        M_normal(),
+        M_refQuadPt(),
+        M_detJacobian(),
+        M_dphi()
+{
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+void InteriorFacetCache::addFacet( const UInt& facetId,
+                                   const UInt& element1,
+                                   const UInt& element2,
+                                   const UInt& positionInElement1,
+                                   const bool& isInterface,
+                                   const CurrentBoundaryFE& feBd,
+                                   const CurrentFE& fe1,
+                                   const CurrentFE& fe2 )
+{
+    if ( M_facetId.empty() )
+    {
+        M_nbFEDof = fe1.nbFEDof();
+        M_nbCoor = fe1.nbCoor();
+        M_nbQuadPt = feBd.nbQuadPt();
+    }
+
+    ASSERT( fe1.nbFEDof() == M_nbFEDof && fe1.nbCoor() == M_nbCoor && feBd.nbQuadPt() == M_nbQuadPt,
+            "The finite elements do not match the cache!" );
+
+    M_facetId.push_back( facetId );
+    M_elements.push_back( element1 );
+    M_elements.push_back( element2 );
+    M_positionInElement1.push_back( positionInElement1 );
+    M_isInterface.push_back( isInterface );
+
+    M_measure.push_back( feBd.measure() );
+    M_detJacobian.push_back( fe1.detJacobian( 0 ) );
+    M_detJacobian.push_back( fe2.detJacobian( 0 ) );
+
+    const CurrentFE* fe[ 2 ] = { &fe1, &fe2 };
+    const UInt dphiBegin( M_dphi.size() );
+    M_dphi.resize( dphiBegin + 2 * M_nbFEDof * M_nbCoor * M_nbQuadPt );
+
+    // Translations of the geometric maps
+    Real b[ 2 ][ 3 ];
+    for ( UInt side( 0 ); side < 2; ++side )
+    {
+        fe[ side ]->coorMap( b[ side ][ 0 ], b[ side ][ 1 ], b[ side ][ 2 ], 0, 0, 0 );
+    }
+
+    Real x[ 3 ], rx[ 3 ], drp[ 3 ];
+    for ( UInt iQuadPt( 0 ); iQuadPt < M_nbQuadPt; ++iQuadPt )
+    {
+        M_weightMeas.push_back( feBd.weightMeas( iQuadPt ) );
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            M_normal.push_back( iCoor < M_nbCoor ? feBd.normal( iCoor, iQuadPt ) : 0. );
+        }
+
+        feBd.coorQuadPt( x[ 0 ], x[ 1 ], x[ 2 ], iQuadPt );
+
+        for ( UInt side( 0 ); side < 2; ++side )
+        {
+            // Local coordinates of the quadrature node (affine map)
+            for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+            {
+                rx[ iCoor ] = 0.;
+            }
+            for ( UInt iCoor( 0 ); iCoor < M_nbCoor; ++iCoor )
+            {
+                for ( UInt jCoor( 0 ); jCoor < M_nbCoor; ++jCoor )
+                {
+                    rx[ iCoor ] += fe[ side ]->tInvJac( jCoor, iCoor, 0 ) * ( x[ jCoor ] - b[ side ][ jCoor ] );
+                }
+            }
+
+            if ( side == 0 )
+            {
+                M_refQuadPt.insert( M_refQuadPt.end(), rx, rx + 3 );
+            }
+
+            for ( UInt iDof( 0 ); iDof < M_nbFEDof; ++iDof )
+            {
+                // First derivatives on the reference element
+                for ( UInt iCoor( 0 ); iCoor < M_nbCoor; ++iCoor )
+                {
+                    drp[ iCoor ] = fe[ side ]->refFE().dPhi( iDof, iCoor, rx[ 0 ], rx[ 1 ], rx[ 2 ] );
+                }
+
+                // First derivatives on the current element
+                for ( UInt iCoor( 0 ); iCoor < M_nbCoor; ++iCoor )
+                {
+                    Real sum( 0. );
+                    for ( UInt jCoor( 0 ); jCoor < M_nbCoor; ++jCoor )
+                    {
+                        sum += fe[ side ]->tInvJac( iCoor, jCoor, 0 ) * drp[ jCoor ];
+                    }
+                    M_dphi[ dphiBegin + ( ( side * M_nbFEDof + iDof ) * M_nbCoor + iCoor ) * M_nbQuadPt + iQuadPt ] = sum;
+                }
+            }
+        }
+    }
+}
+
+void InteriorFacetCache::clear()
+{
+    M_isBuilt = false;
+
+    M_facetId.clear();
+    M_elements.clear();
+    M_positionInElement1.clear();
+    M_isInterface.clear();
+
+    M_measure.clear();
+    M_weightMeas.clear();
+    M_normal.clear();
+    M_refQuadPt.clear();
+    M_detJacobian.clear();
+    M_dphi.clear();
+}
+
+} // Namespace LifeV
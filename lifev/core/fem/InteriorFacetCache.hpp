@@ -0,0 +1,283 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the InteriorFacetCache class
+
+    @date 19-10-2012
+ */
+
+#ifndef INTERIORFACETCACHE_H
+#define INTERIORFACETCACHE_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/mesh/MeshEntity.hpp>
+#include <lifev/core/fem/CurrentFE.hpp>
+#include <lifev/core/fem/CurrentBoundaryFE.hpp>
+#include <lifev/core/fem/GeometricMap.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! InteriorFacetCache - Storage of the geometric quantities of the interior facets of a mesh
+/*!
+  The interior penalty stabilizations integrate, on each interior facet, the derivatives of the basis functions
+  of the two adjacent elements. Computing them requires to update a CurrentBoundaryFE on the facet and two
+  CurrentFE on the elements, and to map the quadrature nodes of the facet back to the two reference elements.
+
+  This class does these computations once for all the interior facets of a mesh and stores, for each of them:
+  <ul>
+  <li> the ids of the two adjacent elements and the position of the facet in the first one; </li>
+  <li> the measure of the facet, the weighted measure and the normal in the quadrature nodes; </li>
+  <li> the coordinates of the quadrature nodes in the first reference element; </li>
+  <li> the determinant of the jacobian of the two elements; </li>
+  <li> the derivatives of the basis functions of the two elements in the quadrature nodes. </li>
+  </ul>
+
+  Only affine geometric maps are supported, as in the interior penalty elemental operations (ipstab_grad, ...).
+  The facets whose adjacent elements are not both known (e.g. on the boundary of a partition) are not stored.
+
+  The cache has to be built again when the mesh moves, see isUpToDate.
+ */
+class InteriorFacetCache
+{
+
+public:
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Empty constructor
+    InteriorFacetCache();
+
+    //! Destructor
+    ~InteriorFacetCache() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Compute and store the quantities of all the interior facets of the mesh
+    /*!
+      @param mesh The mesh
+      @param refFE Reference finite element of the unknown
+      @param qr Quadrature rule used to update the CurrentFE on the elements (it plays no role for affine maps)
+      @param feBd Boundary finite element whose quadrature rule is used on the facets
+      @param geometryVersion Version of the geometry of the mesh, see MeshTransformer::geometryVersion
+     */
+    template <typename MeshType>
+    void build( const MeshType& mesh,
+                const ReferenceFE& refFE,
+                const QuadratureRule& qr,
+                CurrentBoundaryFE& feBd,
+                const UInt& geometryVersion = 0 );
+
+    //! Store the quantities of a facet
+    /*!
+      The CurrentBoundaryFE has to be updated on the facet with updateMeasNormalQuadPt,
+      the CurrentFEs on the adjacent elements with the flags UPDATE_DPHI | UPDATE_WDET.
+     */
+    void addFacet( const UInt& facetId,
+                   const UInt& element1,
+                   const UInt& element2,
+                   const UInt& positionInElement1,
+                   const bool& isInterface,
+                   const CurrentBoundaryFE& feBd,
+                   const CurrentFE& fe1,
+                   const CurrentFE& fe2 );
+
+    //! Check if the cache has been built for the given version of the geometry
+    bool isUpToDate( const UInt& geometryVersion ) const
+    {
+        return M_isBuilt && geometryVersion == M_geometryVersion;
+    }
+
+    //! Clear all the stored values
+    void clear();
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of stored facets
+    UInt numFacets() const
+    {
+        return M_facetId.size();
+    }
+
+    //! Number of basis functions on each element
+    const UInt& nbFEDof() const
+    {
+        return M_nbFEDof;
+    }
+
+    //! Number of coordinates of the elements
+    const UInt& nbCoor() const
+    {
+        return M_nbCoor;
+    }
+
+    //! Number of quadrature nodes on the facets
+    const UInt& nbQuadPt() const
+    {
+        return M_nbQuadPt;
+    }
+
+    //! Id of the facet in the mesh
+    const UInt& facetId( const UInt& iFacet ) const
+    {
+        return M_facetId[iFacet];
+    }
+
+    //! Id of the adjacent element on the given side (0 or 1)
+    const UInt& element( const UInt& iFacet, const UInt& side ) const
+    {
+        return M_elements[ 2 * iFacet + side ];
+    }
+
+    //! Position of the facet in the first adjacent element
+    const UInt& positionInFirstElement( const UInt& iFacet ) const
+    {
+        return M_positionInElement1[iFacet];
+    }
+
+    //! True if the facet is flagged on a subdomain interface or on the physical boundary
+    bool isInterface( const UInt& iFacet ) const
+    {
+        return M_isInterface[iFacet];
+    }
+
+    //! Measure of the facet
+    const Real& measure( const UInt& iFacet ) const
+    {
+        return M_measure[iFacet];
+    }
+
+    //! Quadrature weight times the measure of the facet, as CurrentBoundaryFE::weightMeas
+    const Real& weightMeas( const UInt& iFacet, const UInt& iQuadPt ) const
+    {
+        return M_weightMeas[ iFacet * M_nbQuadPt + iQuadPt ];
+    }
+
+    //! Normal in the quadrature node, as CurrentBoundaryFE::normal
+    const Real& normal( const UInt& iFacet, const UInt& coor, const UInt& iQuadPt ) const
+    {
+        return M_normal[ ( iFacet * M_nbQuadPt + iQuadPt ) * 3 + coor ];
+    }
+
+    //! Coordinate of the quadrature node in the reference element of the first adjacent element
+    const Real& refQuadPt( const UInt& iFacet, const UInt& iQuadPt, const UInt& coor ) const
+    {
+        return M_refQuadPt[ ( iFacet * M_nbQuadPt + iQuadPt ) * 3 + coor ];
+    }
+
+    //! Determinant of the jacobian of the adjacent element on the given side
+    const Real& detJacobian( const UInt& iFacet, const UInt& side ) const
+    {
+        return M_detJacobian[ 2 * iFacet + side ];
+    }
+
+    //! Derivative of a basis function of the adjacent element on the given side in a quadrature node, as CurrentFE::dphi
+    const Real& dphi( const UInt& iFacet, const UInt& side, const UInt& node, const UInt& derivative, const UInt& iQuadPt ) const
+    {
+        return M_dphi[ ( ( ( 2 * iFacet + side ) * M_nbFEDof + node ) * M_nbCoor + derivative ) * M_nbQuadPt + iQuadPt ];
+    }
+
+    //@}
+
+private:
+
+    UInt M_nbFEDof;
+    UInt M_nbCoor;
+    UInt M_nbQuadPt;
+
+    bool M_isBuilt;
+    UInt M_geometryVersion;
+
+    std::vector<UInt> M_facetId;
+    std::vector<UInt> M_elements;
+    std::vector<UInt> M_positionInElement1;
+    std::vector<bool> M_isInterface;
+
+    std::vector<Real> M_measure;
+    std::vector<Real> M_weightMeas;
+    std::vector<Real> M_normal;
+    std::vector<Real> M_refQuadPt;
+    std::vector<Real> M_detJacobian;
+    std::vector<Real> M_dphi;
+};
+
+// ===================================================
+// Template implementation
+// ===================================================
+
+template <typename MeshType>
+void InteriorFacetCache::build( const MeshType& mesh,
+                                const ReferenceFE& refFE,
+                                const QuadratureRule& qr,
+                                CurrentBoundaryFE& feBd,
+                                const UInt& geometryVersion )
+{
+    clear();
+
+    CurrentFE fe1( refFE, getGeometricMap( mesh ), qr );
+    CurrentFE fe2( refFE, getGeometricMap( mesh ), qr );
+
+    for ( UInt iFacet( mesh.numBoundaryFacets() ); iFacet < mesh.numFacets(); ++iFacet )
+    {
+        const UInt element1( mesh.facet( iFacet ).firstAdjacentElementIdentity() );
+        const UInt element2( mesh.facet( iFacet ).secondAdjacentElementIdentity() );
+
+        if ( element1 == NotAnId || element2 == NotAnId || element1 == element2 )
+        {
+            continue;
+        }
+
+        feBd.updateMeasNormalQuadPt( mesh.facet( iFacet ) );
+        fe1.update( mesh.element( element1 ), UPDATE_DPHI | UPDATE_WDET );
+        fe2.update( mesh.element( element2 ), UPDATE_DPHI | UPDATE_WDET );
+
+        addFacet( iFacet, element1, element2, mesh.facet( iFacet ).firstAdjacentElementPosition(),
+                  Flag::testOneSet( mesh.facet( iFacet ).flag(),
+                                    EntityFlags::SUBDOMAIN_INTERFACE | EntityFlags::PHYSICAL_BOUNDARY ),
+                  feBd, fe1, fe2 );
+    }
+
+    M_isBuilt = true;
+    M_geometryVersion = geometryVersion;
+}
+
+} // Namespace LifeV
+
+#endif /* INTERIORFACETCACHE_H */
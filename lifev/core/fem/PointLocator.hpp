@@ -0,0 +1,803 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the PointLocator class
+
+    @date 19-10-2012
+ */
+
+#ifndef POINTLOCATOR_H
+#define POINTLOCATOR_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_Comm.h>
+#include <Epetra_Distributor.h>
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <boost/shared_ptr.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/fem/GeometricMap.hpp>
+#include <lifev/core/mesh/BoundingBoxTree.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace LifeV
+{
+
+//! PointLocator - Find the elements containing given points and evaluate finite element functions there
+/*!
+  The FESpace::feInterpolateValue and FESpace::feInterpolateGradient methods need the element
+  containing the point. This class finds it:
+  <ul>
+  <li> a BoundingBoxTree on the bounding boxes of the local elements gives the few elements that
+       can contain a point; the point is then mapped back to the reference element of each of them
+       (Newton iterations on the geometric map, exact in one step for affine maps) until it falls
+       inside one of them;
+  <li> a second BoundingBoxTree on the bounding boxes of the partitions of all the processors
+       tells which processors can own a point.
+  </ul>
+
+  The interpolate method evaluates a finite element function in a list of points given on each
+  processor: the points are sent to the processors whose partition box contains them, located and
+  evaluated there, and the values are sent back, with a single exchange for the whole list.
+
+  Usage:
+  \code
+  PointLocator< mesh_Type > locator( localMeshPtr, comm );
+  locator.setup();
+  locator.interpolate( uFESpace, velocity, probes, values, found );
+  \endcode
+
+  setup() must be called again when the mesh moves. The tolerance is relative to the reference
+  element, so that points on the faces of the elements are found in spite of the round-off.
+
+  The locate methods use internal work arrays and must not be called concurrently on the same object.
+ */
+template <typename MeshType>
+class PointLocator
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef MeshType                                    mesh_Type;
+    typedef boost::shared_ptr<mesh_Type>                meshPtr_Type;
+
+    typedef Epetra_Comm                                 comm_Type;
+    typedef boost::shared_ptr<comm_Type>                commPtr_Type;
+
+    typedef BoundingBoxTree::point_Type                 point_Type;
+    typedef std::vector<point_Type>                     pointList_Type;
+
+    //@}
+
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param mesh the local mesh
+      @param comm the communicator of the processors sharing the mesh
+      @param tolerance tolerance on the reference coordinates of the points
+     */
+    PointLocator( const meshPtr_Type& mesh, const commPtr_Type& comm, const Real& tolerance = 1e-10 );
+
+    //! Destructor
+    ~PointLocator() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Build the trees of the local elements and of the partitions
+    /*!
+      This method is collective.
+     */
+    void setup();
+
+    //! Find the local element containing a point
+    /*!
+      @param point the point to locate
+      @return the local ID of the element, NotAnId if the point is not in the local mesh
+     */
+    ID locate( const point_Type& point ) const
+    {
+        point_Type referencePoint;
+        return locate( point, referencePoint );
+    }
+
+    //! Find the local element containing a point and the coordinates of the point on the reference element
+    ID locate( const point_Type& point, point_Type& referencePoint ) const;
+
+    //! Processors whose partition can contain a point
+    void candidateProcessors( const point_Type& point, std::vector<UInt>& processors ) const
+    {
+        M_partitionTree.candidates( point, processors );
+    }
+
+    //! Interpolate a finite element function in a list of points
+    /*!
+      This method is collective, each processor can give its own list of points.
+
+      @param feSpace the finite element space of the function
+      @param vector the values of the function (with Unique or Repeated map)
+      @param points the points where the function is evaluated
+      @param values the values in the points, feSpace.fieldDim() values for each point
+      @param found tell for each point if it has been found in the mesh (otherwise its values are zero)
+     */
+    template <typename FESpaceType, typename VectorType>
+    void interpolate( const FESpaceType& feSpace, const VectorType& vector, const pointList_Type& points,
+                      std::vector<Real>& values, std::vector<bool>& found ) const;
+
+    //! Degrees of freedom and basis functions of a finite element space in a list of points
+    /*!
+      This method is collective, each processor can give its own list of points. For each point,
+      the numLocalDof() degrees of freedom of the element containing it are given with the values
+      of their basis functions in the point, so that the value of a scalar function is the sum of
+      weights[ i ] * u[ dofs[ i ] ]. These are the coefficients of an interpolation operator.
+
+      @param feSpace the finite element space
+      @param points the points where the basis functions are evaluated
+      @param dofs feSpace.dof().numLocalDof() global IDs (of the scalar space) for each point
+      @param weights the values of the basis functions, in the same order
+      @param found tell for each point if it has been found in the mesh (otherwise its weights are zero)
+     */
+    template <typename FESpaceType>
+    void interpolationCoefficients( const FESpaceType& feSpace, const pointList_Type& points,
+                                    std::vector<ID>& dofs, std::vector<Real>& weights, std::vector<bool>& found ) const;
+
+    //@}
+
+
+    //! @name Set Methods
+    //@{
+
+    //! Set the tolerance on the reference coordinates
+    void setTolerance( const Real& tolerance )
+    {
+        M_tolerance = tolerance;
+    }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Tolerance on the reference coordinates
+    const Real& tolerance() const
+    {
+        return M_tolerance;
+    }
+
+    //! Tree of the local elements
+    const BoundingBoxTree& elementTree() const
+    {
+        return M_elementTree;
+    }
+
+    //! Tree of the partitions of the processors
+    const BoundingBoxTree& partitionTree() const
+    {
+        return M_partitionTree;
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    PointLocator( const PointLocator& );
+
+    PointLocator& operator=( const PointLocator& );
+
+    //! Map a point back to the reference element of an element, return false if the Newton iterations fail
+    bool referenceCoordinates( const ID& element, const point_Type& point, point_Type& referencePoint ) const;
+
+    //! Tell if a point of the reference element is inside it (up to the tolerance)
+    bool isInReferenceElement( const point_Type& referencePoint ) const;
+
+    //! Evaluate all the components of a function in a point of the reference element of an element
+    template <typename FESpaceType, typename VectorType>
+    void evaluate( const FESpaceType& feSpace, const VectorType& repeatedVector, const ID& element,
+                   const point_Type& referencePoint, Real* values ) const;
+
+    //! Global IDs of the degrees of freedom of an element and values of their basis functions in a point
+    template <typename FESpaceType>
+    void basisFunctions( const FESpaceType& feSpace, const ID& element, const point_Type& referencePoint, Real* values ) const;
+
+    //! Send the points to the processors that can own them and collect the replies computed there
+    /*!
+      The reply object gives the number of values sent back for each point with size(), and computes
+      them with operator()( element, referencePoint, values ). A point on the interface between two
+      partitions gets the reply of the first processor that finds it.
+     */
+    template <typename ReplyType>
+    void exchange( const pointList_Type& points, const ReplyType& reply,
+                   std::vector<Real>& replies, std::vector<bool>& found ) const;
+
+    //@}
+
+    //! Reply with the values of a function
+    template <typename FESpaceType, typename VectorType>
+    class ValuesReply
+    {
+    public:
+        ValuesReply( const PointLocator& locator, const FESpaceType& feSpace, const VectorType& repeatedVector ) :
+                M_locator( locator ), M_feSpace( feSpace ), M_vector( repeatedVector ) {}
+
+        UInt size() const
+        {
+            return M_feSpace.fieldDim();
+        }
+
+        void operator()( const ID& element, const point_Type& referencePoint, Real* values ) const
+        {
+            M_locator.evaluate( M_feSpace, M_vector, element, referencePoint, values );
+        }
+
+    private:
+        const PointLocator& M_locator;
+        const FESpaceType& M_feSpace;
+        const VectorType& M_vector;
+    };
+
+    //! Reply with the degrees of freedom and the basis functions
+    template <typename FESpaceType>
+    class BasisFunctionsReply
+    {
+    public:
+        BasisFunctionsReply( const PointLocator& locator, const FESpaceType& feSpace ) :
+                M_locator( locator ), M_feSpace( feSpace ) {}
+
+        UInt size() const
+        {
+            return 2 * M_feSpace.dof().numLocalDof();
+        }
+
+        void operator()( const ID& element, const point_Type& referencePoint, Real* values ) const
+        {
+            M_locator.basisFunctions( M_feSpace, element, referencePoint, values );
+        }
+
+    private:
+        const PointLocator& M_locator;
+        const FESpaceType& M_feSpace;
+    };
+
+    meshPtr_Type                M_mesh;
+
+    commPtr_Type                M_comm;
+
+    Real                        M_tolerance;
+
+    const GeometricMap*         M_geoMap;
+
+    BoundingBoxTree             M_elementTree;
+
+    BoundingBoxTree             M_partitionTree;
+
+    mutable std::vector<UInt>   M_candidates;
+
+    mutable GeoVector           M_geoVector;
+};
+
+// ===================================================
+// Constructor
+// ===================================================
+
+template <typename MeshType>
+PointLocator<MeshType>::PointLocator( const meshPtr_Type& mesh, const commPtr_Type& comm, const Real& tolerance )
+        :
+        M_mesh( mesh ),
+        M_comm( comm ),
+        M_tolerance( tolerance ),
+        M_geoMap( &getGeometricMap( *mesh ) ),
+        M_elementTree(),
+        M_partitionTree(),
+        M_candidates(),
+        M_geoVector( 3 )
+{
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+template <typename MeshType>
+void PointLocator<MeshType>::setup()
+{
+    const UInt numElements( M_mesh->numElements() );
+    const UInt numPoints( M_geoMap->nbDof() );
+
+    // Bounding boxes of the local elements, enlarged with the tolerance
+    std::vector<point_Type> boxesMin( numElements );
+    std::vector<point_Type> boxesMax( numElements );
+
+    Real partition[6];
+    for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+    {
+        partition[iCoor] = std::numeric_limits<Real>::max();
+        partition[iCoor + 3] = -std::numeric_limits<Real>::max();
+    }
+
+    for ( UInt iElement( 0 ); iElement < numElements; ++iElement )
+    {
+        const typename mesh_Type::element_Type& element( M_mesh->element( iElement ) );
+
+        point_Type boxMin( element.point( 0 ).coordinates() );
+        point_Type boxMax( boxMin );
+        for ( UInt iPoint( 1 ); iPoint < numPoints; ++iPoint )
+        {
+            for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+            {
+                boxMin[iCoor] = std::min( boxMin[iCoor], element.point( iPoint ).coordinate( iCoor ) );
+                boxMax[iCoor] = std::max( boxMax[iCoor], element.point( iPoint ).coordinate( iCoor ) );
+            }
+        }
+
+        Real size( 0. );
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            size = std::max( size, boxMax[iCoor] - boxMin[iCoor] );
+        }
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            boxesMin[iElement][iCoor] = boxMin[iCoor] - M_tolerance * size;
+            boxesMax[iElement][iCoor] = boxMax[iCoor] + M_tolerance * size;
+
+            partition[iCoor] = std::min( partition[iCoor], boxesMin[iElement][iCoor] );
+            partition[iCoor + 3] = std::max( partition[iCoor + 3], boxesMax[iElement][iCoor] );
+        }
+    }
+
+    M_elementTree.build( boxesMin, boxesMax );
+
+    // Bounding boxes of the partitions (an empty partition has an empty box)
+    const UInt numProcessors( M_comm->NumProc() );
+    std::vector<Real> partitions( 6 * numProcessors );
+    M_comm->GatherAll( partition, &partitions[0], 6 );
+
+    boxesMin.resize( numProcessors );
+    boxesMax.resize( numProcessors );
+    for ( UInt iProcessor( 0 ); iProcessor < numProcessors; ++iProcessor )
+    {
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            boxesMin[iProcessor][iCoor] = partitions[6 * iProcessor + iCoor];
+            boxesMax[iProcessor][iCoor] = partitions[6 * iProcessor + iCoor + 3];
+        }
+    }
+
+    M_partitionTree.build( boxesMin, boxesMax, 1 );
+}
+
+template <typename MeshType>
+ID PointLocator<MeshType>::locate( const point_Type& point, point_Type& referencePoint ) const
+{
+    M_elementTree.candidates( point, M_candidates );
+
+    for ( UInt i( 0 ); i < M_candidates.size(); ++i )
+    {
+        if ( referenceCoordinates( M_candidates[i], point, referencePoint ) && isInReferenceElement( referencePoint ) )
+        {
+            return M_candidates[i];
+        }
+    }
+
+    return NotAnId;
+}
+
+template <typename MeshType>
+template <typename FESpaceType, typename VectorType>
+void PointLocator<MeshType>::interpolate( const FESpaceType& feSpace, const VectorType& vector, const pointList_Type& points,
+                                          std::vector<Real>& values, std::vector<bool>& found ) const
+{
+    // The vector has to be repeated, so if it is not, we make is repeated and call this function again.
+    if ( vector.mapType() != Repeated )
+    {
+        VectorType repeatedVector( vector, Repeated );
+        interpolate( feSpace, repeatedVector, points, values, found );
+        return;
+    }
+
+    exchange( points, ValuesReply<FESpaceType, VectorType>( *this, feSpace, vector ), values, found );
+}
+
+template <typename MeshType>
+template <typename FESpaceType>
+void PointLocator<MeshType>::interpolationCoefficients( const FESpaceType& feSpace, const pointList_Type& points,
+                                                        std::vector<ID>& dofs, std::vector<Real>& weights,
+                                                        std::vector<bool>& found ) const
+{
+    const UInt numLocalDof( feSpace.dof().numLocalDof() );
+    const UInt numPoints( points.size() );
+
+    std::vector<Real> replies;
+    exchange( points, BasisFunctionsReply<FESpaceType>( *this, feSpace ), replies, found );
+
+    dofs.assign( numLocalDof * numPoints, 0 );
+    weights.assign( numLocalDof * numPoints, 0. );
+    for ( UInt iPoint( 0 ); iPoint < numPoints; ++iPoint )
+    {
+        for ( UInt iDof( 0 ); iDof < numLocalDof; ++iDof )
+        {
+            dofs[numLocalDof * iPoint + iDof] = static_cast<ID>( replies[2 * ( numLocalDof * iPoint + iDof )] );
+            weights[numLocalDof * iPoint + iDof] = replies[2 * ( numLocalDof * iPoint + iDof ) + 1];
+        }
+    }
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template <typename MeshType>
+bool PointLocator<MeshType>::referenceCoordinates( const ID& element, const point_Type& point, point_Type& referencePoint ) const
+{
+    const typename mesh_Type::element_Type& geoElement( M_mesh->element( element ) );
+
+    const UInt nDimensions( M_geoMap->nbCoor() );
+    const UInt numPoints( M_geoMap->nbDof() );
+    const UInt maxIterations( 20 );
+
+    // Newton iterations from the origin of the reference element
+    M_geoVector[0] = 0.;
+    M_geoVector[1] = 0.;
+    M_geoVector[2] = 0.;
+
+    Real jacobian[3][3];
+    Real residual[3];
+
+    for ( UInt iteration( 0 ); iteration < maxIterations; ++iteration )
+    {
+        // Residual x( xi ) - x and Jacobian of the geometric map
+        for ( UInt iCoor( 0 ); iCoor < nDimensions; ++iCoor )
+        {
+            residual[iCoor] = -point[iCoor];
+            for ( UInt jCoor( 0 ); jCoor < nDimensions; ++jCoor )
+            {
+                jacobian[iCoor][jCoor] = 0.;
+            }
+        }
+        for ( UInt iPoint( 0 ); iPoint < numPoints; ++iPoint )
+        {
+            const Real phi( M_geoMap->phi( iPoint, M_geoVector ) );
+            for ( UInt iCoor( 0 ); iCoor < nDimensions; ++iCoor )
+            {
+                const Real coordinate( geoElement.point( iPoint ).coordinate( iCoor ) );
+                residual[iCoor] += coordinate * phi;
+                for ( UInt jCoor( 0 ); jCoor < nDimensions; ++jCoor )
+                {
+                    jacobian[iCoor][jCoor] += coordinate * M_geoMap->dPhi( iPoint, jCoor, M_geoVector );
+                }
+            }
+        }
+
+        // Gaussian elimination with partial pivoting
+        Real scale( 0. );
+        for ( UInt iCoor( 0 ); iCoor < nDimensions; ++iCoor )
+        {
+            for ( UInt jCoor( 0 ); jCoor < nDimensions; ++jCoor )
+            {
+                scale = std::max( scale, std::abs( jacobian[iCoor][jCoor] ) );
+            }
+        }
+        for ( UInt k( 0 ); k < nDimensions; ++k )
+        {
+            UInt pivot( k );
+            for ( UInt iCoor( k + 1 ); iCoor < nDimensions; ++iCoor )
+            {
+                if ( std::abs( jacobian[iCoor][k] ) > std::abs( jacobian[pivot][k] ) )
+                {
+                    pivot = iCoor;
+                }
+            }
+            if ( std::abs( jacobian[pivot][k] ) <= 1e-14 * scale )
+            {
+                return false;
+            }
+            if ( pivot != k )
+            {
+                for ( UInt jCoor( k ); jCoor < nDimensions; ++jCoor )
+                {
+                    std::swap( jacobian[k][jCoor], jacobian[pivot][jCoor] );
+                }
+                std::swap( residual[k], residual[pivot] );
+            }
+            for ( UInt iCoor( k + 1 ); iCoor < nDimensions; ++iCoor )
+            {
+                const Real factor( jacobian[iCoor][k] / jacobian[k][k] );
+                for ( UInt jCoor( k ); jCoor < nDimensions; ++jCoor )
+                {
+                    jacobian[iCoor][jCoor] -= factor * jacobian[k][jCoor];
+                }
+                residual[iCoor] -= factor * residual[k];
+            }
+        }
+
+        Real increment( 0. );
+        for ( Int k( nDimensions - 1 ); k >= 0; --k )
+        {
+            Real delta( residual[k] );
+            for ( UInt jCoor( k + 1 ); jCoor < nDimensions; ++jCoor )
+            {
+                delta -= jacobian[k][jCoor] * residual[jCoor];
+            }
+            delta /= jacobian[k][k];
+            residual[k] = delta;
+
+            M_geoVector[k] -= delta;
+            increment = std::max( increment, std::abs( delta ) );
+        }
+
+        if ( increment < 1e-12 )
+        {
+            for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+            {
+                referencePoint[iCoor] = M_geoVector[iCoor];
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+template <typename MeshType>
+bool PointLocator<MeshType>::isInReferenceElement( const point_Type& referencePoint ) const
+{
+    const UInt nDimensions( M_geoMap->nbCoor() );
+
+    switch ( M_geoMap->shape() )
+    {
+    case LINE:
+    case QUAD:
+    case HEXA:
+        // The reference element is [0,1]^n
+        for ( UInt iCoor( 0 ); iCoor < nDimensions; ++iCoor )
+        {
+            if ( referencePoint[iCoor] < -M_tolerance || referencePoint[iCoor] > 1. + M_tolerance )
+            {
+                return false;
+            }
+        }
+        return true;
+
+    case TRIANGLE:
+    case TETRA:
+    {
+        // The reference element is the unit simplex
+        Real sum( 0. );
+        for ( UInt iCoor( 0 ); iCoor < nDimensions; ++iCoor )
+        {
+            if ( referencePoint[iCoor] < -M_tolerance )
+            {
+                return false;
+            }
+            sum += referencePoint[iCoor];
+        }
+        return sum <= 1. + M_tolerance;
+    }
+
+    default:
+        ERROR_MSG( "Point location not implemented for this element shape" );
+    }
+
+    return false;
+}
+
+template <typename MeshType>
+template <typename FESpaceType, typename VectorType>
+void PointLocator<MeshType>::evaluate( const FESpaceType& feSpace, const VectorType& repeatedVector, const ID& element,
+                                       const point_Type& referencePoint, Real* values ) const
+{
+    const UInt fieldDim( feSpace.fieldDim() );
+    const UInt numLocalDof( feSpace.dof().numLocalDof() );
+    const UInt numTotalDof( feSpace.dof().numTotalDof() );
+
+    for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+    {
+        M_geoVector[iCoor] = referencePoint[iCoor];
+    }
+
+    for ( UInt iComponent( 0 ); iComponent < fieldDim; ++iComponent )
+    {
+        values[iComponent] = 0.;
+    }
+
+    for ( UInt iDof( 0 ); iDof < numLocalDof; ++iDof )
+    {
+        const Real phi( feSpace.refFE().phi( iDof, M_geoVector ) );
+        const ID globalDof( feSpace.dof().localToGlobalMap( element, iDof ) );
+
+        for ( UInt iComponent( 0 ); iComponent < fieldDim; ++iComponent )
+        {
+            values[iComponent] += repeatedVector[ iComponent * numTotalDof + globalDof ] * phi;
+        }
+    }
+}
+
+template <typename MeshType>
+template <typename FESpaceType>
+void PointLocator<MeshType>::basisFunctions( const FESpaceType& feSpace, const ID& element,
+                                             const point_Type& referencePoint, Real* values ) const
+{
+    const UInt numLocalDof( feSpace.dof().numLocalDof() );
+
+    for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+    {
+        M_geoVector[iCoor] = referencePoint[iCoor];
+    }
+
+    // The IDs are exact in double precision
+    for ( UInt iDof( 0 ); iDof < numLocalDof; ++iDof )
+    {
+        values[2 * iDof] = feSpace.dof().localToGlobalMap( element, iDof );
+        values[2 * iDof + 1] = feSpace.refFE().phi( iDof, M_geoVector );
+    }
+}
+
+template <typename MeshType>
+template <typename ReplyType>
+void PointLocator<MeshType>::exchange( const pointList_Type& points, const ReplyType& reply,
+                                       std::vector<Real>& replies, std::vector<bool>& found ) const
+{
+    const UInt replySize( reply.size() );
+    const UInt numPoints( points.size() );
+
+    replies.assign( replySize * numPoints, 0. );
+    found.assign( numPoints, false );
+
+    point_Type referencePoint;
+
+    // Serial case: no communication
+    if ( M_comm->NumProc() == 1 )
+    {
+        for ( UInt iPoint( 0 ); iPoint < numPoints; ++iPoint )
+        {
+            const ID element( locate( points[iPoint], referencePoint ) );
+            if ( element != NotAnId )
+            {
+                reply( element, referencePoint, &replies[replySize * iPoint] );
+                found[iPoint] = true;
+            }
+        }
+        return;
+    }
+
+    // Send each point to the processors whose partition can contain it, grouped by processor
+    // (the reverse communication of Epetra_Distributor requires the sends to be grouped)
+    std::vector< std::pair<Int, UInt> > sends;
+    sends.reserve( numPoints );
+
+    std::vector<UInt> processors;
+    for ( UInt iPoint( 0 ); iPoint < numPoints; ++iPoint )
+    {
+        M_partitionTree.candidates( points[iPoint], processors );
+        for ( UInt i( 0 ); i < processors.size(); ++i )
+        {
+            sends.push_back( std::make_pair( static_cast<Int>( processors[i] ), iPoint ) );
+        }
+    }
+    std::sort( sends.begin(), sends.end() );
+
+    const UInt numSends( sends.size() );
+    std::vector<Int> sendProcessors( numSends );
+    std::vector<Real> sendCoordinates( 3 * numSends );
+    for ( UInt iSend( 0 ); iSend < numSends; ++iSend )
+    {
+        sendProcessors[iSend] = sends[iSend].first;
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            sendCoordinates[3 * iSend + iCoor] = points[ sends[iSend].second ][iCoor];
+        }
+    }
+
+    boost::scoped_ptr<Epetra_Distributor> distributor( M_comm->CreateDistributor() );
+
+    Int numReceives( 0 );
+    distributor->CreateFromSends( numSends, numSends > 0 ? &sendProcessors[0] : 0, true, numReceives );
+
+    Int receiveLength( 0 );
+    char* receiveBuffer( 0 );
+    distributor->Do( numSends > 0 ? reinterpret_cast<char*>( &sendCoordinates[0] ) : 0,
+                     3 * sizeof( Real ), receiveLength, receiveBuffer );
+
+    // Locate the received points and compute their replies, preceded by a flag
+    const UInt answerSize( replySize + 1 );
+    std::vector<Real> answers( answerSize * numReceives, 0. );
+
+    const Real* receivedCoordinates( reinterpret_cast<const Real*>( receiveBuffer ) );
+    point_Type point;
+    for ( Int iReceive( 0 ); iReceive < numReceives; ++iReceive )
+    {
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            point[iCoor] = receivedCoordinates[3 * iReceive + iCoor];
+        }
+
+        const ID element( locate( point, referencePoint ) );
+        if ( element != NotAnId )
+        {
+            answers[answerSize * iReceive] = 1.;
+            reply( element, referencePoint, &answers[answerSize * iReceive + 1] );
+        }
+    }
+
+    delete[] receiveBuffer;
+
+    // Send the replies back, they come in the order of the sends
+    Int replyLength( 0 );
+    char* replyBuffer( 0 );
+    distributor->DoReverse( numReceives > 0 ? reinterpret_cast<char*>( &answers[0] ) : 0,
+                            answerSize * sizeof( Real ), replyLength, replyBuffer );
+
+    // A point on the interface between partitions takes the values of the first processor
+    const Real* receivedAnswers( reinterpret_cast<const Real*>( replyBuffer ) );
+    for ( UInt iSend( 0 ); iSend < numSends; ++iSend )
+    {
+        const UInt iPoint( sends[iSend].second );
+        if ( found[iPoint] || receivedAnswers[answerSize * iSend] == 0. )
+        {
+            continue;
+        }
+
+        found[iPoint] = true;
+        for ( UInt i( 0 ); i < replySize; ++i )
+        {
+            replies[replySize * iPoint + i] = receivedAnswers[answerSize * iSend + i + 1];
+        }
+    }
+
+    delete[] replyBuffer;
+}
+
+} // Namespace LifeV
+
+#endif /* POINTLOCATOR_H */
@@ -388,6 +388,8 @@ extern const QuadratureRule quadRuleTetra64pt;
 
 extern const QuadratureRule quadRuleHexa1pt;
 extern const QuadratureRule quadRuleHexa8pt;
+extern const QuadratureRule quadRuleHexa27pt;
+extern const QuadratureRule quadRuleHexa64pt;
 
 
 }
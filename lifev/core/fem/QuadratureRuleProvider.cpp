@@ -40,7 +40,7 @@ namespace LifeV {
 
 const UInt QuadratureRuleProvider::S_maxExactnessTetra = 7;
 const UInt QuadratureRuleProvider::S_maxExactnessPrism = 0;
-const UInt QuadratureRuleProvider::S_maxExactnessHexa = 3;
+const UInt QuadratureRuleProvider::S_maxExactnessHexa = 7;
 const UInt QuadratureRuleProvider::S_maxExactnessQuad = 5;
 const UInt QuadratureRuleProvider::S_maxExactnessTriangle = 5;
 const UInt QuadratureRuleProvider::S_maxExactnessLine = 3;
@@ -164,7 +164,7 @@ provideMaximal(const ReferenceShapes& shape)
         break;
 
     case HEXA:
-        return quadRuleHexa8pt;
+        return quadRuleHexa64pt;
         break;
 
     case QUAD:
@@ -272,13 +272,21 @@ provideExactnessHexa(const UInt& exactness)
     case 3:
         return quadRuleHexa8pt;
         break;
+    case 4:
+    case 5:
+        return quadRuleHexa27pt;
+        break;
+    case 6:
+    case 7:
+        return quadRuleHexa64pt;
+        break;
     default:
         std::cerr << " QuadratureRuleProvider: No quadrature rule can be furnished with such an exactness (hexa) ";
         std::cerr << std::endl;
         abort();
     };
 
-    return quadRuleHexa8pt;
+    return quadRuleHexa64pt;
 }
 
 const QuadratureRule&
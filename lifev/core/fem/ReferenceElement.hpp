@@ -1990,6 +1990,252 @@ static const ReferenceElement::function_Type der2fct_Q1_3D[ 72 ] =
 };
 
 
+//======================================================================
+//
+//                            Q2  (3D)
+//
+//======================================================================
+/*
+                      8-------7
+                     /.      /|
+                    / .     / |
+                   5_______6  |
+                   |  .    |  |
+                   |  4....|..3
+                   | .     | /
+                   |.      |/
+                   1_______2
+
+  Nodes 1-8 are the vertices, 9-20 the midpoints of the edges (in the
+  order of LinearHexa::edgeToPoint), 21-26 the centers of the faces (in
+  the order of LinearHexa::faceToPoint) and 27 the center of the cell,
+  i.e. the numbering of QuadraticHexa.
+
+  Each basis function is the product of three 1D quadratic Lagrange
+  functions, associated to the 1D nodes 0 (index 0), 1 (index 1) and
+  0.5 (index 2). The functions are then generated from templates on these
+  three indices, instead of being written one by one.
+*/
+
+//! 1D quadratic Lagrange function (or its derivative of order nbDer) associated to the 1D node index
+inline Real lagrange1D_Q2_3D( const UInt& index, const UInt& nbDer, const Real& x )
+{
+    switch ( 3 * index + nbDer )
+    {
+    case 0: return 2. * ( x - 0.5 ) * ( x - 1. );
+    case 1: return 4. * x - 3.;
+    case 2: return 4.;
+    case 3: return 2. * x * ( x - 0.5 );
+    case 4: return 4. * x - 1.;
+    case 5: return 4.;
+    case 6: return 4. * x * ( 1. - x );
+    case 7: return 4. - 8. * x;
+    case 8: return -8.;
+    default: return 0.;
+    }
+}
+
+template <UInt I, UInt J, UInt K>
+Real fctTensor_Q2_3D( const GeoVector& v )
+{
+    return lagrange1D_Q2_3D( I, 0, v[ 0 ] ) * lagrange1D_Q2_3D( J, 0, v[ 1 ] ) * lagrange1D_Q2_3D( K, 0, v[ 2 ] );
+}
+
+template <UInt I, UInt J, UInt K, UInt D>
+Real derfctTensor_Q2_3D( const GeoVector& v )
+{
+    return lagrange1D_Q2_3D( I, D == 0, v[ 0 ] )
+           * lagrange1D_Q2_3D( J, D == 1, v[ 1 ] )
+           * lagrange1D_Q2_3D( K, D == 2, v[ 2 ] );
+}
+
+template <UInt I, UInt J, UInt K, UInt D1, UInt D2>
+Real der2fctTensor_Q2_3D( const GeoVector& v )
+{
+    return lagrange1D_Q2_3D( I, ( D1 == 0 ) + ( D2 == 0 ), v[ 0 ] )
+           * lagrange1D_Q2_3D( J, ( D1 == 1 ) + ( D2 == 1 ), v[ 1 ] )
+           * lagrange1D_Q2_3D( K, ( D1 == 2 ) + ( D2 == 2 ), v[ 2 ] );
+}
+
+static const Real refcoor_Q2_3D[ 81 ] =
+{
+    0. , 0. , 0. ,
+    1. , 0. , 0. ,
+    1. , 1. , 0. ,
+    0. , 1. , 0. ,
+    0. , 0. , 1. ,
+    1. , 0. , 1. ,
+    1. , 1. , 1. ,
+    0. , 1. , 1. ,
+    0.5, 0. , 0. ,
+    1. , 0.5, 0. ,
+    0.5, 1. , 0. ,
+    0. , 0.5, 0. ,
+    0. , 0. , 0.5,
+    1. , 0. , 0.5,
+    1. , 1. , 0.5,
+    0. , 1. , 0.5,
+    0.5, 0. , 1. ,
+    1. , 0.5, 1. ,
+    0.5, 1. , 1. ,
+    0. , 0.5, 1. ,
+    0.5, 0.5, 0. ,
+    0. , 0.5, 0.5,
+    0.5, 0. , 0.5,
+    1. , 0.5, 0.5,
+    0.5, 1. , 0.5,
+    0.5, 0.5, 1. ,
+    0.5, 0.5, 0.5
+};
+
+static const ReferenceElement::function_Type fct_Q2_3D[ 27 ] =
+{
+    fctTensor_Q2_3D<0,0,0>,
+    fctTensor_Q2_3D<1,0,0>,
+    fctTensor_Q2_3D<1,1,0>,
+    fctTensor_Q2_3D<0,1,0>,
+    fctTensor_Q2_3D<0,0,1>,
+    fctTensor_Q2_3D<1,0,1>,
+    fctTensor_Q2_3D<1,1,1>,
+    fctTensor_Q2_3D<0,1,1>,
+    fctTensor_Q2_3D<2,0,0>,
+    fctTensor_Q2_3D<1,2,0>,
+    fctTensor_Q2_3D<2,1,0>,
+    fctTensor_Q2_3D<0,2,0>,
+    fctTensor_Q2_3D<0,0,2>,
+    fctTensor_Q2_3D<1,0,2>,
+    fctTensor_Q2_3D<1,1,2>,
+    fctTensor_Q2_3D<0,1,2>,
+    fctTensor_Q2_3D<2,0,1>,
+    fctTensor_Q2_3D<1,2,1>,
+    fctTensor_Q2_3D<2,1,1>,
+    fctTensor_Q2_3D<0,2,1>,
+    fctTensor_Q2_3D<2,2,0>,
+    fctTensor_Q2_3D<0,2,2>,
+    fctTensor_Q2_3D<2,0,2>,
+    fctTensor_Q2_3D<1,2,2>,
+    fctTensor_Q2_3D<2,1,2>,
+    fctTensor_Q2_3D<2,2,1>,
+    fctTensor_Q2_3D<2,2,2>
+};
+
+static const ReferenceElement::function_Type derfct_Q2_3D[ 81 ] =
+{
+    derfctTensor_Q2_3D<0,0,0,0>, derfctTensor_Q2_3D<0,0,0,1>, derfctTensor_Q2_3D<0,0,0,2>,
+    derfctTensor_Q2_3D<1,0,0,0>, derfctTensor_Q2_3D<1,0,0,1>, derfctTensor_Q2_3D<1,0,0,2>,
+    derfctTensor_Q2_3D<1,1,0,0>, derfctTensor_Q2_3D<1,1,0,1>, derfctTensor_Q2_3D<1,1,0,2>,
+    derfctTensor_Q2_3D<0,1,0,0>, derfctTensor_Q2_3D<0,1,0,1>, derfctTensor_Q2_3D<0,1,0,2>,
+    derfctTensor_Q2_3D<0,0,1,0>, derfctTensor_Q2_3D<0,0,1,1>, derfctTensor_Q2_3D<0,0,1,2>,
+    derfctTensor_Q2_3D<1,0,1,0>, derfctTensor_Q2_3D<1,0,1,1>, derfctTensor_Q2_3D<1,0,1,2>,
+    derfctTensor_Q2_3D<1,1,1,0>, derfctTensor_Q2_3D<1,1,1,1>, derfctTensor_Q2_3D<1,1,1,2>,
+    derfctTensor_Q2_3D<0,1,1,0>, derfctTensor_Q2_3D<0,1,1,1>, derfctTensor_Q2_3D<0,1,1,2>,
+    derfctTensor_Q2_3D<2,0,0,0>, derfctTensor_Q2_3D<2,0,0,1>, derfctTensor_Q2_3D<2,0,0,2>,
+    derfctTensor_Q2_3D<1,2,0,0>, derfctTensor_Q2_3D<1,2,0,1>, derfctTensor_Q2_3D<1,2,0,2>,
+    derfctTensor_Q2_3D<2,1,0,0>, derfctTensor_Q2_3D<2,1,0,1>, derfctTensor_Q2_3D<2,1,0,2>,
+    derfctTensor_Q2_3D<0,2,0,0>, derfctTensor_Q2_3D<0,2,0,1>, derfctTensor_Q2_3D<0,2,0,2>,
+    derfctTensor_Q2_3D<0,0,2,0>, derfctTensor_Q2_3D<0,0,2,1>, derfctTensor_Q2_3D<0,0,2,2>,
+    derfctTensor_Q2_3D<1,0,2,0>, derfctTensor_Q2_3D<1,0,2,1>, derfctTensor_Q2_3D<1,0,2,2>,
+    derfctTensor_Q2_3D<1,1,2,0>, derfctTensor_Q2_3D<1,1,2,1>, derfctTensor_Q2_3D<1,1,2,2>,
+    derfctTensor_Q2_3D<0,1,2,0>, derfctTensor_Q2_3D<0,1,2,1>, derfctTensor_Q2_3D<0,1,2,2>,
+    derfctTensor_Q2_3D<2,0,1,0>, derfctTensor_Q2_3D<2,0,1,1>, derfctTensor_Q2_3D<2,0,1,2>,
+    derfctTensor_Q2_3D<1,2,1,0>, derfctTensor_Q2_3D<1,2,1,1>, derfctTensor_Q2_3D<1,2,1,2>,
+    derfctTensor_Q2_3D<2,1,1,0>, derfctTensor_Q2_3D<2,1,1,1>, derfctTensor_Q2_3D<2,1,1,2>,
+    derfctTensor_Q2_3D<0,2,1,0>, derfctTensor_Q2_3D<0,2,1,1>, derfctTensor_Q2_3D<0,2,1,2>,
+    derfctTensor_Q2_3D<2,2,0,0>, derfctTensor_Q2_3D<2,2,0,1>, derfctTensor_Q2_3D<2,2,0,2>,
+    derfctTensor_Q2_3D<0,2,2,0>, derfctTensor_Q2_3D<0,2,2,1>, derfctTensor_Q2_3D<0,2,2,2>,
+    derfctTensor_Q2_3D<2,0,2,0>, derfctTensor_Q2_3D<2,0,2,1>, derfctTensor_Q2_3D<2,0,2,2>,
+    derfctTensor_Q2_3D<1,2,2,0>, derfctTensor_Q2_3D<1,2,2,1>, derfctTensor_Q2_3D<1,2,2,2>,
+    derfctTensor_Q2_3D<2,1,2,0>, derfctTensor_Q2_3D<2,1,2,1>, derfctTensor_Q2_3D<2,1,2,2>,
+    derfctTensor_Q2_3D<2,2,1,0>, derfctTensor_Q2_3D<2,2,1,1>, derfctTensor_Q2_3D<2,2,1,2>,
+    derfctTensor_Q2_3D<2,2,2,0>, derfctTensor_Q2_3D<2,2,2,1>, derfctTensor_Q2_3D<2,2,2,2>
+};
+
+static const ReferenceElement::function_Type der2fct_Q2_3D[ 243 ] =
+{
+    der2fctTensor_Q2_3D<0,0,0,0,0>, der2fctTensor_Q2_3D<0,0,0,0,1>, der2fctTensor_Q2_3D<0,0,0,0,2>,
+    der2fctTensor_Q2_3D<0,0,0,1,0>, der2fctTensor_Q2_3D<0,0,0,1,1>, der2fctTensor_Q2_3D<0,0,0,1,2>,
+    der2fctTensor_Q2_3D<0,0,0,2,0>, der2fctTensor_Q2_3D<0,0,0,2,1>, der2fctTensor_Q2_3D<0,0,0,2,2>,
+    der2fctTensor_Q2_3D<1,0,0,0,0>, der2fctTensor_Q2_3D<1,0,0,0,1>, der2fctTensor_Q2_3D<1,0,0,0,2>,
+    der2fctTensor_Q2_3D<1,0,0,1,0>, der2fctTensor_Q2_3D<1,0,0,1,1>, der2fctTensor_Q2_3D<1,0,0,1,2>,
+    der2fctTensor_Q2_3D<1,0,0,2,0>, der2fctTensor_Q2_3D<1,0,0,2,1>, der2fctTensor_Q2_3D<1,0,0,2,2>,
+    der2fctTensor_Q2_3D<1,1,0,0,0>, der2fctTensor_Q2_3D<1,1,0,0,1>, der2fctTensor_Q2_3D<1,1,0,0,2>,
+    der2fctTensor_Q2_3D<1,1,0,1,0>, der2fctTensor_Q2_3D<1,1,0,1,1>, der2fctTensor_Q2_3D<1,1,0,1,2>,
+    der2fctTensor_Q2_3D<1,1,0,2,0>, der2fctTensor_Q2_3D<1,1,0,2,1>, der2fctTensor_Q2_3D<1,1,0,2,2>,
+    der2fctTensor_Q2_3D<0,1,0,0,0>, der2fctTensor_Q2_3D<0,1,0,0,1>, der2fctTensor_Q2_3D<0,1,0,0,2>,
+    der2fctTensor_Q2_3D<0,1,0,1,0>, der2fctTensor_Q2_3D<0,1,0,1,1>, der2fctTensor_Q2_3D<0,1,0,1,2>,
+    der2fctTensor_Q2_3D<0,1,0,2,0>, der2fctTensor_Q2_3D<0,1,0,2,1>, der2fctTensor_Q2_3D<0,1,0,2,2>,
+    der2fctTensor_Q2_3D<0,0,1,0,0>, der2fctTensor_Q2_3D<0,0,1,0,1>, der2fctTensor_Q2_3D<0,0,1,0,2>,
+    der2fctTensor_Q2_3D<0,0,1,1,0>, der2fctTensor_Q2_3D<0,0,1,1,1>, der2fctTensor_Q2_3D<0,0,1,1,2>,
+    der2fctTensor_Q2_3D<0,0,1,2,0>, der2fctTensor_Q2_3D<0,0,1,2,1>, der2fctTensor_Q2_3D<0,0,1,2,2>,
+    der2fctTensor_Q2_3D<1,0,1,0,0>, der2fctTensor_Q2_3D<1,0,1,0,1>, der2fctTensor_Q2_3D<1,0,1,0,2>,
+    der2fctTensor_Q2_3D<1,0,1,1,0>, der2fctTensor_Q2_3D<1,0,1,1,1>, der2fctTensor_Q2_3D<1,0,1,1,2>,
+    der2fctTensor_Q2_3D<1,0,1,2,0>, der2fctTensor_Q2_3D<1,0,1,2,1>, der2fctTensor_Q2_3D<1,0,1,2,2>,
+    der2fctTensor_Q2_3D<1,1,1,0,0>, der2fctTensor_Q2_3D<1,1,1,0,1>, der2fctTensor_Q2_3D<1,1,1,0,2>,
+    der2fctTensor_Q2_3D<1,1,1,1,0>, der2fctTensor_Q2_3D<1,1,1,1,1>, der2fctTensor_Q2_3D<1,1,1,1,2>,
+    der2fctTensor_Q2_3D<1,1,1,2,0>, der2fctTensor_Q2_3D<1,1,1,2,1>, der2fctTensor_Q2_3D<1,1,1,2,2>,
+    der2fctTensor_Q2_3D<0,1,1,0,0>, der2fctTensor_Q2_3D<0,1,1,0,1>, der2fctTensor_Q2_3D<0,1,1,0,2>,
+    der2fctTensor_Q2_3D<0,1,1,1,0>, der2fctTensor_Q2_3D<0,1,1,1,1>, der2fctTensor_Q2_3D<0,1,1,1,2>,
+    der2fctTensor_Q2_3D<0,1,1,2,0>, der2fctTensor_Q2_3D<0,1,1,2,1>, der2fctTensor_Q2_3D<0,1,1,2,2>,
+    der2fctTensor_Q2_3D<2,0,0,0,0>, der2fctTensor_Q2_3D<2,0,0,0,1>, der2fctTensor_Q2_3D<2,0,0,0,2>,
+    der2fctTensor_Q2_3D<2,0,0,1,0>, der2fctTensor_Q2_3D<2,0,0,1,1>, der2fctTensor_Q2_3D<2,0,0,1,2>,
+    der2fctTensor_Q2_3D<2,0,0,2,0>, der2fctTensor_Q2_3D<2,0,0,2,1>, der2fctTensor_Q2_3D<2,0,0,2,2>,
+    der2fctTensor_Q2_3D<1,2,0,0,0>, der2fctTensor_Q2_3D<1,2,0,0,1>, der2fctTensor_Q2_3D<1,2,0,0,2>,
+    der2fctTensor_Q2_3D<1,2,0,1,0>, der2fctTensor_Q2_3D<1,2,0,1,1>, der2fctTensor_Q2_3D<1,2,0,1,2>,
+    der2fctTensor_Q2_3D<1,2,0,2,0>, der2fctTensor_Q2_3D<1,2,0,2,1>, der2fctTensor_Q2_3D<1,2,0,2,2>,
+    der2fctTensor_Q2_3D<2,1,0,0,0>, der2fctTensor_Q2_3D<2,1,0,0,1>, der2fctTensor_Q2_3D<2,1,0,0,2>,
+    der2fctTensor_Q2_3D<2,1,0,1,0>, der2fctTensor_Q2_3D<2,1,0,1,1>, der2fctTensor_Q2_3D<2,1,0,1,2>,
+    der2fctTensor_Q2_3D<2,1,0,2,0>, der2fctTensor_Q2_3D<2,1,0,2,1>, der2fctTensor_Q2_3D<2,1,0,2,2>,
+    der2fctTensor_Q2_3D<0,2,0,0,0>, der2fctTensor_Q2_3D<0,2,0,0,1>, der2fctTensor_Q2_3D<0,2,0,0,2>,
+    der2fctTensor_Q2_3D<0,2,0,1,0>, der2fctTensor_Q2_3D<0,2,0,1,1>, der2fctTensor_Q2_3D<0,2,0,1,2>,
+    der2fctTensor_Q2_3D<0,2,0,2,0>, der2fctTensor_Q2_3D<0,2,0,2,1>, der2fctTensor_Q2_3D<0,2,0,2,2>,
+    der2fctTensor_Q2_3D<0,0,2,0,0>, der2fctTensor_Q2_3D<0,0,2,0,1>, der2fctTensor_Q2_3D<0,0,2,0,2>,
+    der2fctTensor_Q2_3D<0,0,2,1,0>, der2fctTensor_Q2_3D<0,0,2,1,1>, der2fctTensor_Q2_3D<0,0,2,1,2>,
+    der2fctTensor_Q2_3D<0,0,2,2,0>, der2fctTensor_Q2_3D<0,0,2,2,1>, der2fctTensor_Q2_3D<0,0,2,2,2>,
+    der2fctTensor_Q2_3D<1,0,2,0,0>, der2fctTensor_Q2_3D<1,0,2,0,1>, der2fctTensor_Q2_3D<1,0,2,0,2>,
+    der2fctTensor_Q2_3D<1,0,2,1,0>, der2fctTensor_Q2_3D<1,0,2,1,1>, der2fctTensor_Q2_3D<1,0,2,1,2>,
+    der2fctTensor_Q2_3D<1,0,2,2,0>, der2fctTensor_Q2_3D<1,0,2,2,1>, der2fctTensor_Q2_3D<1,0,2,2,2>,
+    der2fctTensor_Q2_3D<1,1,2,0,0>, der2fctTensor_Q2_3D<1,1,2,0,1>, der2fctTensor_Q2_3D<1,1,2,0,2>,
+    der2fctTensor_Q2_3D<1,1,2,1,0>, der2fctTensor_Q2_3D<1,1,2,1,1>, der2fctTensor_Q2_3D<1,1,2,1,2>,
+    der2fctTensor_Q2_3D<1,1,2,2,0>, der2fctTensor_Q2_3D<1,1,2,2,1>, der2fctTensor_Q2_3D<1,1,2,2,2>,
+    der2fctTensor_Q2_3D<0,1,2,0,0>, der2fctTensor_Q2_3D<0,1,2,0,1>, der2fctTensor_Q2_3D<0,1,2,0,2>,
+    der2fctTensor_Q2_3D<0,1,2,1,0>, der2fctTensor_Q2_3D<0,1,2,1,1>, der2fctTensor_Q2_3D<0,1,2,1,2>,
+    der2fctTensor_Q2_3D<0,1,2,2,0>, der2fctTensor_Q2_3D<0,1,2,2,1>, der2fctTensor_Q2_3D<0,1,2,2,2>,
+    der2fctTensor_Q2_3D<2,0,1,0,0>, der2fctTensor_Q2_3D<2,0,1,0,1>, der2fctTensor_Q2_3D<2,0,1,0,2>,
+    der2fctTensor_Q2_3D<2,0,1,1,0>, der2fctTensor_Q2_3D<2,0,1,1,1>, der2fctTensor_Q2_3D<2,0,1,1,2>,
+    der2fctTensor_Q2_3D<2,0,1,2,0>, der2fctTensor_Q2_3D<2,0,1,2,1>, der2fctTensor_Q2_3D<2,0,1,2,2>,
+    der2fctTensor_Q2_3D<1,2,1,0,0>, der2fctTensor_Q2_3D<1,2,1,0,1>, der2fctTensor_Q2_3D<1,2,1,0,2>,
+    der2fctTensor_Q2_3D<1,2,1,1,0>, der2fctTensor_Q2_3D<1,2,1,1,1>, der2fctTensor_Q2_3D<1,2,1,1,2>,
+    der2fctTensor_Q2_3D<1,2,1,2,0>, der2fctTensor_Q2_3D<1,2,1,2,1>, der2fctTensor_Q2_3D<1,2,1,2,2>,
+    der2fctTensor_Q2_3D<2,1,1,0,0>, der2fctTensor_Q2_3D<2,1,1,0,1>, der2fctTensor_Q2_3D<2,1,1,0,2>,
+    der2fctTensor_Q2_3D<2,1,1,1,0>, der2fctTensor_Q2_3D<2,1,1,1,1>, der2fctTensor_Q2_3D<2,1,1,1,2>,
+    der2fctTensor_Q2_3D<2,1,1,2,0>, der2fctTensor_Q2_3D<2,1,1,2,1>, der2fctTensor_Q2_3D<2,1,1,2,2>,
+    der2fctTensor_Q2_3D<0,2,1,0,0>, der2fctTensor_Q2_3D<0,2,1,0,1>, der2fctTensor_Q2_3D<0,2,1,0,2>,
+    der2fctTensor_Q2_3D<0,2,1,1,0>, der2fctTensor_Q2_3D<0,2,1,1,1>, der2fctTensor_Q2_3D<0,2,1,1,2>,
+    der2fctTensor_Q2_3D<0,2,1,2,0>, der2fctTensor_Q2_3D<0,2,1,2,1>, der2fctTensor_Q2_3D<0,2,1,2,2>,
+    der2fctTensor_Q2_3D<2,2,0,0,0>, der2fctTensor_Q2_3D<2,2,0,0,1>, der2fctTensor_Q2_3D<2,2,0,0,2>,
+    der2fctTensor_Q2_3D<2,2,0,1,0>, der2fctTensor_Q2_3D<2,2,0,1,1>, der2fctTensor_Q2_3D<2,2,0,1,2>,
+    der2fctTensor_Q2_3D<2,2,0,2,0>, der2fctTensor_Q2_3D<2,2,0,2,1>, der2fctTensor_Q2_3D<2,2,0,2,2>,
+    der2fctTensor_Q2_3D<0,2,2,0,0>, der2fctTensor_Q2_3D<0,2,2,0,1>, der2fctTensor_Q2_3D<0,2,2,0,2>,
+    der2fctTensor_Q2_3D<0,2,2,1,0>, der2fctTensor_Q2_3D<0,2,2,1,1>, der2fctTensor_Q2_3D<0,2,2,1,2>,
+    der2fctTensor_Q2_3D<0,2,2,2,0>, der2fctTensor_Q2_3D<0,2,2,2,1>, der2fctTensor_Q2_3D<0,2,2,2,2>,
+    der2fctTensor_Q2_3D<2,0,2,0,0>, der2fctTensor_Q2_3D<2,0,2,0,1>, der2fctTensor_Q2_3D<2,0,2,0,2>,
+    der2fctTensor_Q2_3D<2,0,2,1,0>, der2fctTensor_Q2_3D<2,0,2,1,1>, der2fctTensor_Q2_3D<2,0,2,1,2>,
+    der2fctTensor_Q2_3D<2,0,2,2,0>, der2fctTensor_Q2_3D<2,0,2,2,1>, der2fctTensor_Q2_3D<2,0,2,2,2>,
+    der2fctTensor_Q2_3D<1,2,2,0,0>, der2fctTensor_Q2_3D<1,2,2,0,1>, der2fctTensor_Q2_3D<1,2,2,0,2>,
+    der2fctTensor_Q2_3D<1,2,2,1,0>, der2fctTensor_Q2_3D<1,2,2,1,1>, der2fctTensor_Q2_3D<1,2,2,1,2>,
+    der2fctTensor_Q2_3D<1,2,2,2,0>, der2fctTensor_Q2_3D<1,2,2,2,1>, der2fctTensor_Q2_3D<1,2,2,2,2>,
+    der2fctTensor_Q2_3D<2,1,2,0,0>, der2fctTensor_Q2_3D<2,1,2,0,1>, der2fctTensor_Q2_3D<2,1,2,0,2>,
+    der2fctTensor_Q2_3D<2,1,2,1,0>, der2fctTensor_Q2_3D<2,1,2,1,1>, der2fctTensor_Q2_3D<2,1,2,1,2>,
+    der2fctTensor_Q2_3D<2,1,2,2,0>, der2fctTensor_Q2_3D<2,1,2,2,1>, der2fctTensor_Q2_3D<2,1,2,2,2>,
+    der2fctTensor_Q2_3D<2,2,1,0,0>, der2fctTensor_Q2_3D<2,2,1,0,1>, der2fctTensor_Q2_3D<2,2,1,0,2>,
+    der2fctTensor_Q2_3D<2,2,1,1,0>, der2fctTensor_Q2_3D<2,2,1,1,1>, der2fctTensor_Q2_3D<2,2,1,1,2>,
+    der2fctTensor_Q2_3D<2,2,1,2,0>, der2fctTensor_Q2_3D<2,2,1,2,1>, der2fctTensor_Q2_3D<2,2,1,2,2>,
+    der2fctTensor_Q2_3D<2,2,2,0,0>, der2fctTensor_Q2_3D<2,2,2,0,1>, der2fctTensor_Q2_3D<2,2,2,0,2>,
+    der2fctTensor_Q2_3D<2,2,2,1,0>, der2fctTensor_Q2_3D<2,2,2,1,1>, der2fctTensor_Q2_3D<2,2,2,1,2>,
+    der2fctTensor_Q2_3D<2,2,2,2,0>, der2fctTensor_Q2_3D<2,2,2,2,1>, der2fctTensor_Q2_3D<2,2,2,2,2>
+};
+
+
 //!======================================================================
 //!
 //!                           RT0  (3D)
@@ -156,6 +156,7 @@ extern const ReferenceFEScalar feTetraP2tilde;
 
 extern const ReferenceFEScalar feHexaQ0;
 extern const ReferenceFEScalar feHexaQ1;
+extern const ReferenceFEScalar feHexaQ2;
 
 } // Namespace LifeV
 
@@ -0,0 +1,580 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the implementation of the TensorProductHexa class
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/fem/TensorProductHexa.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace LifeV
+{
+
+namespace
+{
+
+const Real S_tolerance( 1e-12 );
+
+// Reference coordinates of the vertices of the hexahedra (same order as refcoor_Q1_3D)
+const UInt S_vertexCoor[8][3] =
+{
+    {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+    {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}
+};
+
+// Index of the value in the 1D nodes, or nodes.size() if it is not found
+UInt findNode( const std::vector<Real>& nodes, const Real& value )
+{
+    for ( UInt iNode(0); iNode < nodes.size(); ++iNode )
+    {
+        if ( std::fabs( nodes[iNode] - value ) < S_tolerance )
+        {
+            return iNode;
+        }
+    }
+    return nodes.size();
+}
+
+// The 1D nodes are the x coordinates, in the order in which they appear. The lexicographic
+// index of each point is computed, false is returned if the points are not a full tensor grid.
+bool tensorGrid( const std::vector<Real>& coordinates, std::vector<Real>& nodes1D, std::vector<UInt>& lexIndex )
+{
+    const UInt nbPoints( coordinates.size() / 3 );
+
+    nodes1D.clear();
+    for ( UInt iPoint(0); iPoint < nbPoints; ++iPoint )
+    {
+        if ( findNode( nodes1D, coordinates[ 3 * iPoint ] ) == nodes1D.size() )
+        {
+            nodes1D.push_back( coordinates[ 3 * iPoint ] );
+        }
+    }
+
+    const UInt n( nodes1D.size() );
+    if ( n * n * n != nbPoints )
+    {
+        return false;
+    }
+
+    lexIndex.resize( nbPoints );
+    std::vector<bool> found( nbPoints, false );
+
+    for ( UInt iPoint(0); iPoint < nbPoints; ++iPoint )
+    {
+        UInt index[3];
+        for ( UInt iCoor(0); iCoor < 3; ++iCoor )
+        {
+            index[iCoor] = findNode( nodes1D, coordinates[ 3 * iPoint + iCoor ] );
+            if ( index[iCoor] == n )
+            {
+                return false;
+            }
+        }
+
+        lexIndex[iPoint] = index[0] + n * ( index[1] + n * index[2] );
+
+        if ( found[ lexIndex[iPoint] ] )
+        {
+            return false;
+        }
+        found[ lexIndex[iPoint] ] = true;
+    }
+
+    return true;
+}
+
+// Lagrange polynomial of the given node and its derivative
+Real lagrange1D( const std::vector<Real>& nodes, const UInt& node, const Real& x )
+{
+    Real value( 1.0 );
+    for ( UInt iNode(0); iNode < nodes.size(); ++iNode )
+    {
+        if ( iNode != node )
+        {
+            value *= ( x - nodes[iNode] ) / ( nodes[node] - nodes[iNode] );
+        }
+    }
+    return value;
+}
+
+Real derLagrange1D( const std::vector<Real>& nodes, const UInt& node, const Real& x )
+{
+    Real value( 0.0 );
+    for ( UInt jNode(0); jNode < nodes.size(); ++jNode )
+    {
+        if ( jNode == node )
+        {
+            continue;
+        }
+
+        Real term( 1.0 / ( nodes[node] - nodes[jNode] ) );
+        for ( UInt iNode(0); iNode < nodes.size(); ++iNode )
+        {
+            if ( iNode != node && iNode != jNode )
+            {
+                term *= ( x - nodes[iNode] ) / ( nodes[node] - nodes[iNode] );
+            }
+        }
+        value += term;
+    }
+    return value;
+}
+
+} // anonymous namespace
+
+// ===================================================
+// Constructor
+// ===================================================
+
+TensorProductHexa::TensorProductHexa( const ReferenceFE& refFE, const QuadratureRule& qr )
+        :
+        M_nbFEDof( refFE.nbDof() ),
+        M_nbQuadPt( qr.nbQuadPt() ),
+        M_nbNode1D( 0 ),
+        M_nbQuadPt1D( 0 )
+{
+    ASSERT( isTensorProduct( refFE, qr ), "The finite element or the quadrature rule is not a tensor product!" );
+
+    std::vector<Real> nodes1D;
+    tensorNodes( refFE, nodes1D, M_dofLex );
+
+    std::vector<Real> quadNodes1D;
+    tensorRule( qr, quadNodes1D, M_weight1D );
+
+    M_nbNode1D = nodes1D.size();
+    M_nbQuadPt1D = quadNodes1D.size();
+
+    M_phi1D.resize( M_nbQuadPt1D * M_nbNode1D );
+    M_dphi1D.resize( M_nbQuadPt1D * M_nbNode1D );
+    M_geoPhi1D.resize( M_nbQuadPt1D * 2 );
+    M_geoDphi1D.resize( M_nbQuadPt1D * 2 );
+
+    for ( UInt iQuadPt(0); iQuadPt < M_nbQuadPt1D; ++iQuadPt )
+    {
+        const Real x( quadNodes1D[iQuadPt] );
+
+        for ( UInt iNode(0); iNode < M_nbNode1D; ++iNode )
+        {
+            M_phi1D[ iQuadPt * M_nbNode1D + iNode ] = lagrange1D( nodes1D, iNode, x );
+            M_dphi1D[ iQuadPt * M_nbNode1D + iNode ] = derLagrange1D( nodes1D, iNode, x );
+        }
+
+        M_geoPhi1D[ iQuadPt * 2 ] = 1.0 - x;
+        M_geoPhi1D[ iQuadPt * 2 + 1 ] = x;
+        M_geoDphi1D[ iQuadPt * 2 ] = -1.0;
+        M_geoDphi1D[ iQuadPt * 2 + 1 ] = 1.0;
+    }
+
+    M_wDetJacobian.resize( M_nbQuadPt );
+    M_invMetric.resize( 6 * M_nbQuadPt );
+
+    const UInt maxSize( std::max( M_nbNode1D, M_nbQuadPt1D ) );
+    for ( UInt iWork(0); iWork < 6; ++iWork )
+    {
+        M_work[iWork].resize( maxSize * maxSize * maxSize );
+    }
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+bool TensorProductHexa::isTensorProduct( const ReferenceFE& refFE, const QuadratureRule& qr )
+{
+    if ( refFE.type() != FE_Q1_3D && refFE.type() != FE_Q2_3D )
+    {
+        return false;
+    }
+
+    std::vector<Real> nodes1D;
+    std::vector<UInt> lexIndex;
+    std::vector<Real> quadNodes1D;
+    std::vector<Real> weights1D;
+
+    return tensorNodes( refFE, nodes1D, lexIndex ) && tensorRule( qr, quadNodes1D, weights1D );
+}
+
+void TensorProductHexa::applyMass( const Real* u, Real* v, const Real& coefficient ) const
+{
+    const UInt n( M_nbNode1D );
+    const UInt q( M_nbQuadPt1D );
+
+    Real* uLex( &M_work[0][0] );
+    Real* xValues( &M_work[1][0] );
+    Real* xyValues( &M_work[2][0] );
+    Real* values( &M_work[3][0] );
+
+    for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+    {
+        uLex[ M_dofLex[iDof] ] = u[iDof];
+    }
+
+    // Values in the quadrature nodes, one direction at a time
+    std::fill( xValues, xValues + n * n * q, 0.0 );
+    applyDirection( &M_phi1D[0], n, 1, q, n, 1, n * n, uLex, xValues );
+
+    std::fill( xyValues, xyValues + n * q * q, 0.0 );
+    applyDirection( &M_phi1D[0], n, 1, q, n, q, n, xValues, xyValues );
+
+    std::fill( values, values + M_nbQuadPt, 0.0 );
+    applyDirection( &M_phi1D[0], n, 1, q, n, q * q, 1, xyValues, values );
+
+    for ( UInt iQuadPt(0); iQuadPt < M_nbQuadPt; ++iQuadPt )
+    {
+        values[iQuadPt] *= coefficient * M_wDetJacobian[iQuadPt];
+    }
+
+    // Back to the dofs with the transposed operators
+    std::fill( xyValues, xyValues + n * q * q, 0.0 );
+    applyDirection( &M_phi1D[0], 1, n, n, q, q * q, 1, values, xyValues );
+
+    std::fill( xValues, xValues + n * n * q, 0.0 );
+    applyDirection( &M_phi1D[0], 1, n, n, q, q, n, xyValues, xValues );
+
+    std::fill( uLex, uLex + M_nbFEDof, 0.0 );
+    applyDirection( &M_phi1D[0], 1, n, n, q, 1, n * n, xValues, uLex );
+
+    for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+    {
+        v[iDof] += uLex[ M_dofLex[iDof] ];
+    }
+}
+
+void TensorProductHexa::applyStiffness( const Real* u, Real* v, const Real& coefficient ) const
+{
+    const UInt n( M_nbNode1D );
+    const UInt q( M_nbQuadPt1D );
+    const Real* phi( &M_phi1D[0] );
+    const Real* dphi( &M_dphi1D[0] );
+
+    for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+    {
+        M_work[0][ M_dofLex[iDof] ] = u[iDof];
+    }
+
+    // Direction x: values (work 1) and derivatives (work 2), [z][y][qx]
+    std::fill( M_work[1].begin(), M_work[1].end(), 0.0 );
+    std::fill( M_work[2].begin(), M_work[2].end(), 0.0 );
+    applyDirection( phi, n, 1, q, n, 1, n * n, &M_work[0][0], &M_work[1][0] );
+    applyDirection( dphi, n, 1, q, n, 1, n * n, &M_work[0][0], &M_work[2][0] );
+
+    // Direction y: values/values (work 3), values/derivatives (work 4), derivatives/values (work 5), [z][qy][qx]
+    std::fill( M_work[3].begin(), M_work[3].end(), 0.0 );
+    std::fill( M_work[4].begin(), M_work[4].end(), 0.0 );
+    std::fill( M_work[5].begin(), M_work[5].end(), 0.0 );
+    applyDirection( phi, n, 1, q, n, q, n, &M_work[1][0], &M_work[3][0] );
+    applyDirection( dphi, n, 1, q, n, q, n, &M_work[1][0], &M_work[4][0] );
+    applyDirection( phi, n, 1, q, n, q, n, &M_work[2][0], &M_work[5][0] );
+
+    // Direction z: reference gradient in the quadrature nodes, x (work 1), y (work 2), z (work 0)
+    std::fill( M_work[0].begin(), M_work[0].end(), 0.0 );
+    std::fill( M_work[1].begin(), M_work[1].end(), 0.0 );
+    std::fill( M_work[2].begin(), M_work[2].end(), 0.0 );
+    applyDirection( phi, n, 1, q, n, q * q, 1, &M_work[5][0], &M_work[1][0] );
+    applyDirection( phi, n, 1, q, n, q * q, 1, &M_work[4][0], &M_work[2][0] );
+    applyDirection( dphi, n, 1, q, n, q * q, 1, &M_work[3][0], &M_work[0][0] );
+
+    // Flux in the quadrature nodes
+    Real* gradX( &M_work[1][0] );
+    Real* gradY( &M_work[2][0] );
+    Real* gradZ( &M_work[0][0] );
+
+    for ( UInt iQuadPt(0); iQuadPt < M_nbQuadPt; ++iQuadPt )
+    {
+        const Real* metric( &M_invMetric[ 6 * iQuadPt ] );
+
+        const Real gx( coefficient * gradX[iQuadPt] );
+        const Real gy( coefficient * gradY[iQuadPt] );
+        const Real gz( coefficient * gradZ[iQuadPt] );
+
+        gradX[iQuadPt] = metric[0] * gx + metric[1] * gy + metric[2] * gz;
+        gradY[iQuadPt] = metric[1] * gx + metric[3] * gy + metric[4] * gz;
+        gradZ[iQuadPt] = metric[2] * gx + metric[4] * gy + metric[5] * gz;
+    }
+
+    // Transposed direction z
+    std::fill( M_work[3].begin(), M_work[3].end(), 0.0 );
+    std::fill( M_work[4].begin(), M_work[4].end(), 0.0 );
+    std::fill( M_work[5].begin(), M_work[5].end(), 0.0 );
+    applyDirection( phi, 1, n, n, q, q * q, 1, gradX, &M_work[3][0] );
+    applyDirection( phi, 1, n, n, q, q * q, 1, gradY, &M_work[4][0] );
+    applyDirection( dphi, 1, n, n, q, q * q, 1, gradZ, &M_work[5][0] );
+
+    // Transposed direction y: terms with values (work 0) and derivatives (work 1) in x
+    std::fill( M_work[0].begin(), M_work[0].end(), 0.0 );
+    std::fill( M_work[1].begin(), M_work[1].end(), 0.0 );
+    applyDirection( phi, 1, n, n, q, q, n, &M_work[5][0], &M_work[0][0] );
+    applyDirection( dphi, 1, n, n, q, q, n, &M_work[4][0], &M_work[0][0] );
+    applyDirection( phi, 1, n, n, q, q, n, &M_work[3][0], &M_work[1][0] );
+
+    // Transposed direction x
+    std::fill( M_work[2].begin(), M_work[2].end(), 0.0 );
+    applyDirection( phi, 1, n, n, q, 1, n * n, &M_work[0][0], &M_work[2][0] );
+    applyDirection( dphi, 1, n, n, q, 1, n * n, &M_work[1][0], &M_work[2][0] );
+
+    for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+    {
+        v[iDof] += M_work[2][ M_dofLex[iDof] ];
+    }
+}
+
+void TensorProductHexa::mass( MatrixElemental& localMass, const Real& coefficient, const UInt& fieldDim ) const
+{
+    std::vector<Real> unit( M_nbFEDof, 0.0 );
+    std::vector<Real> column( M_nbFEDof );
+
+    for ( UInt jDof(0); jDof < M_nbFEDof; ++jDof )
+    {
+        unit[jDof] = 1.0;
+        std::fill( column.begin(), column.end(), 0.0 );
+
+        applyMass( &unit[0], &column[0], coefficient );
+
+        for ( UInt iFieldDim(0); iFieldDim < fieldDim; ++iFieldDim )
+        {
+            MatrixElemental::matrix_view mat = localMass.block( iFieldDim, iFieldDim );
+
+            for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+            {
+                mat( iDof, jDof ) += column[iDof];
+            }
+        }
+
+        unit[jDof] = 0.0;
+    }
+}
+
+void TensorProductHexa::stiffness( MatrixElemental& localStiff, const Real& coefficient, const UInt& fieldDim ) const
+{
+    std::vector<Real> unit( M_nbFEDof, 0.0 );
+    std::vector<Real> column( M_nbFEDof );
+
+    for ( UInt jDof(0); jDof < M_nbFEDof; ++jDof )
+    {
+        unit[jDof] = 1.0;
+        std::fill( column.begin(), column.end(), 0.0 );
+
+        applyStiffness( &unit[0], &column[0], coefficient );
+
+        for ( UInt iFieldDim(0); iFieldDim < fieldDim; ++iFieldDim )
+        {
+            MatrixElemental::matrix_view mat = localStiff.block( iFieldDim, iFieldDim );
+
+            for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+            {
+                mat( iDof, jDof ) += column[iDof];
+            }
+        }
+
+        unit[jDof] = 0.0;
+    }
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+void TensorProductHexa::computeGeometry()
+{
+    const UInt q( M_nbQuadPt1D );
+
+    for ( UInt iz(0); iz < q; ++iz )
+    {
+        for ( UInt iy(0); iy < q; ++iy )
+        {
+            for ( UInt ix(0); ix < q; ++ix )
+            {
+                const UInt iQuadPt( ix + q * ( iy + q * iz ) );
+
+                // Jacobian of the trilinear map
+                Real jacobian[3][3] = { {0, 0, 0}, {0, 0, 0}, {0, 0, 0} };
+
+                for ( UInt iVertex(0); iVertex < 8; ++iVertex )
+                {
+                    const UInt a( S_vertexCoor[iVertex][0] );
+                    const UInt b( S_vertexCoor[iVertex][1] );
+                    const UInt c( S_vertexCoor[iVertex][2] );
+
+                    const Real phiX( M_geoPhi1D[ ix * 2 + a ] );
+                    const Real phiY( M_geoPhi1D[ iy * 2 + b ] );
+                    const Real phiZ( M_geoPhi1D[ iz * 2 + c ] );
+
+                    const Real dphi[3] =
+                    {
+                        M_geoDphi1D[ ix * 2 + a ] * phiY * phiZ,
+                        phiX * M_geoDphi1D[ iy * 2 + b ] * phiZ,
+                        phiX * phiY * M_geoDphi1D[ iz * 2 + c ]
+                    };
+
+                    for ( UInt iCoor(0); iCoor < 3; ++iCoor )
+                    {
+                        for ( UInt jCoor(0); jCoor < 3; ++jCoor )
+                        {
+                            jacobian[iCoor][jCoor] += M_vertices[iVertex][iCoor] * dphi[jCoor];
+                        }
+                    }
+                }
+
+                // Determinant and inverse, same formulas of CurrentFE
+                const Real a( jacobian[0][0] );
+                const Real b( jacobian[0][1] );
+                const Real c( jacobian[0][2] );
+                const Real d( jacobian[1][0] );
+                const Real e( jacobian[1][1] );
+                const Real f( jacobian[1][2] );
+                const Real g( jacobian[2][0] );
+                const Real h( jacobian[2][1] );
+                const Real i( jacobian[2][2] );
+
+                const Real ei( e * i );
+                const Real fh( f * h );
+                const Real bi( b * i );
+                const Real ch( c * h );
+                const Real bf( b * f );
+                const Real ce( c * e );
+
+                const Real det( a * ( ei - fh ) + d * ( ch - bi ) + g * ( bf - ce ) );
+
+                // inverse[k][l] = d xhat_k / d x_l
+                const Real inverse[3][3] =
+                {
+                    { ( ei - fh ) / det, ( ch - bi ) / det, ( bf - ce ) / det },
+                    { ( f * g - d * i ) / det, ( a * i - c * g ) / det, ( c * d - a * f ) / det },
+                    { ( d * h - e * g ) / det, ( b * g - a * h ) / det, ( a * e - b * d ) / det }
+                };
+
+                const Real wDet( M_weight1D[ix] * M_weight1D[iy] * M_weight1D[iz] * det );
+                M_wDetJacobian[iQuadPt] = wDet;
+
+                // w det(J) J^{-1} J^{-T}
+                Real* metric( &M_invMetric[ 6 * iQuadPt ] );
+                UInt index( 0 );
+                for ( UInt k(0); k < 3; ++k )
+                {
+                    for ( UInt l(k); l < 3; ++l )
+                    {
+                        metric[index] = wDet * ( inverse[k][0] * inverse[l][0]
+                                                 + inverse[k][1] * inverse[l][1]
+                                                 + inverse[k][2] * inverse[l][2] );
+                        ++index;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TensorProductHexa::applyDirection( const Real* matrix, const UInt& rowStride, const UInt& colStride,
+                                        const UInt& rows, const UInt& cols,
+                                        const UInt& before, const UInt& after,
+                                        const Real* in, Real* out )
+{
+    for ( UInt iAfter(0); iAfter < after; ++iAfter )
+    {
+        for ( UInt iRow(0); iRow < rows; ++iRow )
+        {
+            Real* target( out + ( iAfter * rows + iRow ) * before );
+
+            for ( UInt iCol(0); iCol < cols; ++iCol )
+            {
+                const Real value( matrix[ iRow * rowStride + iCol * colStride ] );
+                const Real* source( in + ( iAfter * cols + iCol ) * before );
+
+                for ( UInt iBefore(0); iBefore < before; ++iBefore )
+                {
+                    target[iBefore] += value * source[iBefore];
+                }
+            }
+        }
+    }
+}
+
+bool TensorProductHexa::tensorNodes( const ReferenceFE& refFE, std::vector<Real>& nodes1D, std::vector<UInt>& lexIndex )
+{
+    std::vector<Real> coordinates( 3 * refFE.nbDof() );
+
+    for ( UInt iDof(0); iDof < refFE.nbDof(); ++iDof )
+    {
+        for ( UInt iCoor(0); iCoor < 3; ++iCoor )
+        {
+            coordinates[ 3 * iDof + iCoor ] = refFE.refCoor( iDof, iCoor );
+        }
+    }
+
+    return tensorGrid( coordinates, nodes1D, lexIndex );
+}
+
+bool TensorProductHexa::tensorRule( const QuadratureRule& qr, std::vector<Real>& nodes1D, std::vector<Real>& weights1D )
+{
+    const UInt nbQuadPt( qr.nbQuadPt() );
+    std::vector<Real> coordinates( 3 * nbQuadPt );
+
+    for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+    {
+        for ( UInt iCoor(0); iCoor < 3; ++iCoor )
+        {
+            coordinates[ 3 * iQuadPt + iCoor ] = qr.quadPointCoor( iQuadPt, iCoor );
+        }
+    }
+
+    std::vector<UInt> lexIndex;
+    if ( !tensorGrid( coordinates, nodes1D, lexIndex ) )
+    {
+        return false;
+    }
+
+    // The weights of the reference hexahedra sum to 1, so the 1D weight of a node
+    // is the sum of the weights of the quadrature nodes with the same x
+    const UInt n( nodes1D.size() );
+    weights1D.assign( n, 0.0 );
+
+    for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+    {
+        weights1D[ lexIndex[iQuadPt] % n ] += qr.weight( iQuadPt );
+    }
+
+    for ( UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt )
+    {
+        const UInt ix( lexIndex[iQuadPt] % n );
+        const UInt iy( ( lexIndex[iQuadPt] / n ) % n );
+        const UInt iz( lexIndex[iQuadPt] / ( n * n ) );
+
+        if ( std::fabs( weights1D[ix] * weights1D[iy] * weights1D[iz] - qr.weight( iQuadPt ) ) > S_tolerance )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // Namespace LifeV
@@ -0,0 +1,305 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the TensorProductHexa class
+
+    @date 19-10-2012
+ */
+
+#ifndef TENSORPRODUCTHEXA_H
+#define TENSORPRODUCTHEXA_H 1
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixElemental.hpp>
+#include <lifev/core/fem/ReferenceFE.hpp>
+#include <lifev/core/fem/QuadratureRule.hpp>
+#include <lifev/core/fem/DOF.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! TensorProductHexa - Sum factorized mass and stiffness operators for Lagrange elements on hexahedra
+/*!
+  The basis functions of the Lagrange elements on hexahedra (feHexaQ1, feHexaQ2) are tensor
+  products of 1D Lagrange polynomials, and the Gauss rules on hexahedra (quadRuleHexa8pt,
+  quadRuleHexa27pt, quadRuleHexa64pt) are tensor products of 1D Gauss rules. The values and the
+  reference gradients of a function in all the quadrature nodes can then be computed with three
+  successive 1D contractions, one per direction, instead of a full (nbQuadPt x nbFEDof) product.
+  For n 1D nodes and q 1D quadrature nodes the cost of an application is O(q n^3) instead of
+  O(q^3 n^3), that is n^4 instead of n^6 operations when q and n are similar.
+
+  The geometry is trilinear (geoBilinearHexa): for each cell, update() stores the weighted
+  determinant and the symmetric tensor w det(J) J^{-1} J^{-T} in the quadrature nodes. The local
+  operator is then applied to a vector of local values (applyMass, applyStiffness) or, column by
+  column, used to fill a MatrixElemental (mass, stiffness).
+
+  The global matrix free application loops over the cells of the mesh and never builds a local matrix.
+
+  The degrees of freedom and the quadrature nodes do not have to be numbered lexicographically:
+  the constructor finds the 1D nodes from the reference coordinates and checks the tensor structure.
+ */
+class TensorProductHexa
+{
+
+public:
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Constructor
+    /*!
+      @param refFE Lagrange finite element on hexahedra (Q1 or Q2)
+      @param qr Tensor product quadrature rule on hexahedra
+     */
+    TensorProductHexa( const ReferenceFE& refFE, const QuadratureRule& qr );
+
+    //! Destructor
+    ~TensorProductHexa() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Tell if the finite element and the quadrature rule can be used by this class
+    static bool isTensorProduct( const ReferenceFE& refFE, const QuadratureRule& qr );
+
+    //! Update the geometric quantities for the given cell
+    /*!
+      Only the 8 vertices of the cell are used (trilinear geometry).
+     */
+    template<typename ElementType>
+    void update( const ElementType& element );
+
+    //! Add coefficient * M u to v, u and v being local values in the numbering of the finite element
+    void applyMass( const Real* u, Real* v, const Real& coefficient ) const;
+
+    //! Add coefficient * A u to v, A being the stiffness matrix of the cell
+    void applyStiffness( const Real* u, Real* v, const Real& coefficient ) const;
+
+    //! Mass matrix, copied in the fieldDim diagonal blocks of the local matrix (as AssemblyElemental::mass)
+    void mass( MatrixElemental& localMass, const Real& coefficient, const UInt& fieldDim ) const;
+
+    //! Stiffness matrix, copied in the fieldDim diagonal blocks of the local matrix (as AssemblyElemental::stiffness)
+    void stiffness( MatrixElemental& localStiff, const Real& coefficient, const UInt& fieldDim ) const;
+
+    //! Matrix free application of the global stiffness matrix: v += coefficient * A u
+    /*!
+      @param u Repeated vector, the values of the dofs of all the local cells must be available
+      @param v Vector where the contributions are summed, globalAssemble has to be called afterwards
+     */
+    template<typename MeshType, typename VectorType>
+    void applyStiffness( const MeshType& mesh, const DOF& dof, const VectorType& u, VectorType& v,
+                         const Real& coefficient, const UInt& fieldDim );
+
+    //! Matrix free application of the global mass matrix: v += coefficient * M u
+    template<typename MeshType, typename VectorType>
+    void applyMass( const MeshType& mesh, const DOF& dof, const VectorType& u, VectorType& v,
+                    const Real& coefficient, const UInt& fieldDim );
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of basis functions
+    const UInt& nbFEDof() const
+    {
+        return M_nbFEDof;
+    }
+
+    //! Number of 1D nodes per direction
+    const UInt& nbNode1D() const
+    {
+        return M_nbNode1D;
+    }
+
+    //! Number of 1D quadrature nodes per direction
+    const UInt& nbQuadPt1D() const
+    {
+        return M_nbQuadPt1D;
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    TensorProductHexa();
+
+    TensorProductHexa( const TensorProductHexa& );
+
+    TensorProductHexa& operator=( const TensorProductHexa& );
+
+    //! Compute the geometric quantities from M_vertices
+    void computeGeometry();
+
+    //! Apply a 1D operator along one direction of a tensor of values
+    /*!
+      The input is seen as [after][cols][before] and the result [after][rows][before] is added to
+      out. The entry (r,c) of the operator is matrix[ r * rowStride + c * colStride ].
+     */
+    static void applyDirection( const Real* matrix, const UInt& rowStride, const UInt& colStride,
+                                const UInt& rows, const UInt& cols,
+                                const UInt& before, const UInt& after,
+                                const Real* in, Real* out );
+
+    //! Find the 1D nodes of the finite element, return false if they are not a tensor grid
+    static bool tensorNodes( const ReferenceFE& refFE, std::vector<Real>& nodes1D, std::vector<UInt>& lexIndex );
+
+    //! Find the 1D nodes and weights of the quadrature rule, return false if it is not a tensor product
+    static bool tensorRule( const QuadratureRule& qr, std::vector<Real>& nodes1D, std::vector<Real>& weights1D );
+
+    //@}
+
+    const UInt M_nbFEDof;
+    const UInt M_nbQuadPt;
+    UInt M_nbNode1D;
+    UInt M_nbQuadPt1D;
+
+    // Lexicographic index (x fastest) of each dof
+    std::vector<UInt> M_dofLex;
+
+    // 1D basis functions and derivatives in the 1D quadrature nodes: [quadNode][node]
+    std::vector<Real> M_phi1D;
+    std::vector<Real> M_dphi1D;
+    std::vector<Real> M_weight1D;
+
+    // 1D linear basis functions and derivatives for the geometry: [quadNode][node]
+    std::vector<Real> M_geoPhi1D;
+    std::vector<Real> M_geoDphi1D;
+
+    // Vertices of the current cell: [vertex][coor]
+    Real M_vertices[8][3];
+
+    // Values in the quadrature nodes of the current cell, in lexicographic order (x fastest)
+    // M_wDetJacobian: [quadNode], M_invMetric: [quadNode][6] (xx, xy, xz, yy, yz, zz)
+    std::vector<Real> M_wDetJacobian;
+    std::vector<Real> M_invMetric;
+
+    // Work arrays
+    mutable std::vector<Real> M_work[6];
+};
+
+
+// ===================================================
+// Template implementation
+// ===================================================
+
+template<typename ElementType>
+void TensorProductHexa::update( const ElementType& element )
+{
+    for ( UInt iVertex(0); iVertex < 8; ++iVertex )
+    {
+        for ( UInt iCoor(0); iCoor < 3; ++iCoor )
+        {
+            M_vertices[iVertex][iCoor] = element.point( iVertex ).coordinate( iCoor );
+        }
+    }
+
+    computeGeometry();
+}
+
+template<typename MeshType, typename VectorType>
+void TensorProductHexa::applyStiffness( const MeshType& mesh, const DOF& dof, const VectorType& u, VectorType& v,
+                                        const Real& coefficient, const UInt& fieldDim )
+{
+    const UInt nbElements( mesh.numElements() );
+    const UInt nbTotalDof( dof.numTotalDof() );
+
+    std::vector<Real> localU( M_nbFEDof );
+    std::vector<Real> localV( M_nbFEDof );
+
+    for ( UInt iElement(0); iElement < nbElements; ++iElement )
+    {
+        update( mesh.element( iElement ) );
+
+        const UInt elementID( mesh.element( iElement ).localId() );
+
+        for ( UInt iDim(0); iDim < fieldDim; ++iDim )
+        {
+            for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+            {
+                localU[iDof] = u[ dof.localToGlobalMap( elementID, iDof ) + iDim * nbTotalDof ];
+                localV[iDof] = 0.0;
+            }
+
+            applyStiffness( &localU[0], &localV[0], coefficient );
+
+            for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+            {
+                v.sumIntoGlobalValues( dof.localToGlobalMap( elementID, iDof ) + iDim * nbTotalDof, localV[iDof] );
+            }
+        }
+    }
+}
+
+template<typename MeshType, typename VectorType>
+void TensorProductHexa::applyMass( const MeshType& mesh, const DOF& dof, const VectorType& u, VectorType& v,
+                                   const Real& coefficient, const UInt& fieldDim )
+{
+    const UInt nbElements( mesh.numElements() );
+    const UInt nbTotalDof( dof.numTotalDof() );
+
+    std::vector<Real> localU( M_nbFEDof );
+    std::vector<Real> localV( M_nbFEDof );
+
+    for ( UInt iElement(0); iElement < nbElements; ++iElement )
+    {
+        update( mesh.element( iElement ) );
+
+        const UInt elementID( mesh.element( iElement ).localId() );
+
+        for ( UInt iDim(0); iDim < fieldDim; ++iDim )
+        {
+            for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+            {
+                localU[iDof] = u[ dof.localToGlobalMap( elementID, iDof ) + iDim * nbTotalDof ];
+                localV[iDof] = 0.0;
+            }
+
+            applyMass( &localU[0], &localV[0], coefficient );
+
+            for ( UInt iDof(0); iDof < M_nbFEDof; ++iDof )
+            {
+                v.sumIntoGlobalValues( dof.localToGlobalMap( elementID, iDof ) + iDim * nbTotalDof, localV[iDof] );
+            }
+        }
+    }
+}
+
+} // Namespace LifeV
+
+#endif /* TENSORPRODUCTHEXA_H */
@@ -65,7 +65,10 @@ namespace LifeV {
 
   This class is used to write the mesh parts produced by (offline) mesh
   partitioning into a single HDF5 container. This part is done with a single
-  MPI process (usually on a workstation).
+  MPI process (usually on a workstation), or with several MPI processes, each
+  one writing its own mesh parts with collective writes (the number of parts
+  must be the same on all the processes). The parts are stored in the order
+  of the ranks of the writing processes.
 
   The class is later used during an online simulation (multiple MPI processes,
   on a cluster, supercomputer etc.) to read the mesh parts.
@@ -198,7 +201,9 @@ public:
                const bool transposeInFile = false);
     //! Write method
     /*!
-     * Call this method to write the mesh parts to disk
+     * Call this method to write the mesh parts to disk. With several MPI
+     * processes, each process passes its own mesh parts (the same number on
+     * each process) and they are written collectively to the same file
      * \param meshParts pointer to a vector containing pointers to the mesh
      *        parts (RegionMesh objects). This pointer is released after
      *        writing, so the mesh parts can be cleared from memory
@@ -266,6 +271,8 @@ private:
     UInt M_maxNumFaces;
     UInt M_maxNumElements;
     UInt M_numParts;
+    UInt M_numLocalParts;
+    UInt M_partOffset;
     // Counters when loading the mesh part
     UInt M_numPoints;
     UInt M_numEdges;
@@ -318,7 +325,28 @@ template<typename MeshType>
 void LifeV::PartitionIO<MeshType>::write(const meshPartsPtr_Type& meshParts)
 {
     M_meshPartsOut = meshParts;
-    M_numParts = M_meshPartsOut->size();
+    M_numLocalParts = M_meshPartsOut->size();
+
+    // Each process writes its own parts, after the parts of the processes
+    // with lower rank
+    Int numLocalParts = M_numLocalParts;
+    Int numParts = 0;
+    Int partsUpToMe = 0;
+    Int minNumLocalParts = 0;
+    Int maxNumLocalParts = 0;
+    M_comm->SumAll(&numLocalParts, &numParts, 1);
+    M_comm->ScanSum(&numLocalParts, &partsUpToMe, 1);
+    M_comm->MinAll(&numLocalParts, &minNumLocalParts, 1);
+    M_comm->MaxAll(&numLocalParts, &maxNumLocalParts, 1);
+    M_numParts = numParts;
+    M_partOffset = partsUpToMe - numLocalParts;
+
+    // The collective writes need the same number of calls on each process.
+    // The test gives the same result on all the processes
+    if (minNumLocalParts != maxNumLocalParts)
+    {
+        ERROR_MSG("Error: each process must write the same number of mesh parts");
+    }
 
     createHDF5File();
     writeStats();
@@ -408,7 +436,7 @@ void LifeV::PartitionIO<MeshType>::writeStats()
 
     // Fill buffer
     M_uintBuffer.resize(15);
-    for (UInt i = 0; i < M_numParts; ++i) {
+    for (UInt i = 0; i < M_numLocalParts; ++i) {
         mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
         M_uintBuffer[0] = M_numParts;
         // Next one is unused. I'll put it to keep compatibility
@@ -435,16 +463,28 @@ void LifeV::PartitionIO<MeshType>::writeStats()
 
         hsize_t currentOffset[2];
         if (! M_transposeInFile) {
-            currentOffset[0] = i;
+            currentOffset[0] = M_partOffset + i;
             currentOffset[1] = 0;
         } else {
             currentOffset[0] = 0;
-            currentOffset[1] = i;
+            currentOffset[1] = M_partOffset + i;
         }
         writeData(filespace, memspace, plistId, intDataset, H5T_NATIVE_UINT,
                   currentOffset, currentCount, &M_uintBuffer[0]);
     }
 
+    // The size of the tables is the maximum over all the processes
+    Int localMaxima[4] = {static_cast<Int>(M_maxNumPoints),
+                          static_cast<Int>(M_maxNumEdges),
+                          static_cast<Int>(M_maxNumFaces),
+                          static_cast<Int>(M_maxNumElements)};
+    Int globalMaxima[4] = {0, 0, 0, 0};
+    M_comm->MaxAll(localMaxima, globalMaxima, 4);
+    M_maxNumPoints = globalMaxima[0];
+    M_maxNumEdges = globalMaxima[1];
+    M_maxNumFaces = globalMaxima[2];
+    M_maxNumElements = globalMaxima[3];
+
     // HDF5 cleanup
     H5Dclose(intDataset);
     H5Sclose(filespace);
@@ -500,7 +540,7 @@ void LifeV::PartitionIO<MeshType>::writePoints()
     M_realBuffer.resize(currentCount[0] * currentCount[1], 0);
     UInt stride = currentCount[1];
     if (! M_transposeInFile) {
-        for (UInt i = 0; i < M_numParts; ++i) {
+        for (UInt i = 0; i < M_numLocalParts; ++i) {
             mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
             for (UInt j = 0; j < currentPart.numPoints(); ++j) {
                 M_uintBuffer[j] = currentPart.pointList[j].markerID();
@@ -512,7 +552,7 @@ void LifeV::PartitionIO<MeshType>::writePoints()
                 M_realBuffer[2 * stride + j] = currentPart.pointList[j].z();
             }
 
-            hsize_t currentOffset[2] = {i * currentCount[0], 0};
+            hsize_t currentOffset[2] = {(M_partOffset + i) * currentCount[0], 0};
             writeData(filespace, memspace, plistId, intDataset,
                       H5T_NATIVE_UINT, currentOffset, currentCount,
                       &M_uintBuffer[0]);
@@ -521,7 +561,7 @@ void LifeV::PartitionIO<MeshType>::writePoints()
                       &M_realBuffer[0]);
         }
     } else {
-        for (UInt i = 0; i < M_numParts; ++i) {
+        for (UInt i = 0; i < M_numLocalParts; ++i) {
             mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
             for (UInt j = 0; j < currentPart.numPoints(); ++j) {
                 M_uintBuffer[stride * j] = currentPart.pointList[j].markerID();
@@ -533,7 +573,7 @@ void LifeV::PartitionIO<MeshType>::writePoints()
                 M_realBuffer[stride * j + 2] = currentPart.pointList[j].z();
             }
 
-            hsize_t currentOffset[2] = {0, i * currentCount[1]};
+            hsize_t currentOffset[2] = {0, (M_partOffset + i) * currentCount[1]};
             writeData(filespace, memspace, plistId, intDataset,
                       H5T_NATIVE_UINT, currentOffset, currentCount,
                       &M_uintBuffer[0]);
@@ -591,7 +631,7 @@ void LifeV::PartitionIO<MeshType>::writeEdges()
     M_uintBuffer.resize(currentCount[0] * currentCount[1], 0);
     UInt stride = currentCount[1];
     if (! M_transposeInFile) {
-        for (UInt i = 0; i < M_numParts; ++i) {
+        for (UInt i = 0; i < M_numLocalParts; ++i) {
             mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
             for (UInt j = 0; j < currentPart.numEdges(); ++j) {
                 M_uintBuffer[j] = currentPart.edgeList[j].point(0).localId();
@@ -603,12 +643,12 @@ void LifeV::PartitionIO<MeshType>::writeEdges()
                         static_cast<int>(currentPart.edgeList[j].flag());
             }
 
-            hsize_t currentOffset[2] = {i * currentCount[0], 0};
+            hsize_t currentOffset[2] = {(M_partOffset + i) * currentCount[0], 0};
             writeData(filespace, memspace, plistId, dataset, H5T_NATIVE_UINT,
                       currentOffset, currentCount, &M_uintBuffer[0]);
         }
     } else {
-        for (UInt i = 0; i < M_numParts; ++i) {
+        for (UInt i = 0; i < M_numLocalParts; ++i) {
             mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
             for (UInt j = 0; j < currentPart.numEdges(); ++j) {
                 M_uintBuffer[stride * j] =
@@ -621,7 +661,7 @@ void LifeV::PartitionIO<MeshType>::writeEdges()
                         static_cast<int>(currentPart.edgeList[j].flag());
             }
 
-            hsize_t currentOffset[2] = {0, i * currentCount[1]};
+            hsize_t currentOffset[2] = {0, (M_partOffset + i) * currentCount[1]};
             writeData(filespace, memspace, plistId, dataset, H5T_NATIVE_UINT,
                       currentOffset, currentCount, &M_uintBuffer[0]);
         }
@@ -673,7 +713,7 @@ void LifeV::PartitionIO<MeshType>::writeFaces()
     M_uintBuffer.resize(currentCount[0] * currentCount[1], 0);
     UInt stride = currentCount[1];
     if (! M_transposeInFile) {
-        for (UInt i = 0; i < M_numParts; ++i) {
+        for (UInt i = 0; i < M_numLocalParts; ++i) {
             mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
             for (UInt j = 0; j < currentPart.numFaces(); ++j) {
                 for (UInt k = 0; k < M_faceNodes; ++k) {
@@ -696,12 +736,12 @@ void LifeV::PartitionIO<MeshType>::writeFaces()
                         static_cast<int>(currentPart.faceList[j].flag());
             }
 
-            hsize_t currentOffset[2] = {i * currentCount[0], 0};
+            hsize_t currentOffset[2] = {(M_partOffset + i) * currentCount[0], 0};
             writeData(filespace, memspace, plistId, dataset, H5T_NATIVE_UINT,
                       currentOffset, currentCount, &M_uintBuffer[0]);
         }
     } else {
-        for (UInt i = 0; i < M_numParts; ++i) {
+        for (UInt i = 0; i < M_numLocalParts; ++i) {
             mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
             for (UInt j = 0; j < currentPart.numFaces(); ++j) {
                 for (UInt k = 0; k < M_faceNodes; ++k) {
@@ -724,7 +764,7 @@ void LifeV::PartitionIO<MeshType>::writeFaces()
                         static_cast<int>(currentPart.faceList[j].flag());
             }
 
-            hsize_t currentOffset[2] = {0, i * currentCount[1]};
+            hsize_t currentOffset[2] = {0, (M_partOffset + i) * currentCount[1]};
             writeData(filespace, memspace, plistId, dataset, H5T_NATIVE_UINT,
                       currentOffset, currentCount, &M_uintBuffer[0]);
         }
@@ -776,7 +816,7 @@ void LifeV::PartitionIO<MeshType>::writeElements()
     M_uintBuffer.resize(currentCount[0] * currentCount[1], 0);
     UInt stride = currentCount[1];
     if (! M_transposeInFile) {
-        for (UInt i = 0; i < M_numParts; ++i) {
+        for (UInt i = 0; i < M_numLocalParts; ++i) {
             mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
             for (UInt j = 0; j < currentPart.numVolumes(); ++j) {
                 for (UInt k = 0; k < M_elementNodes; ++k) {
@@ -791,12 +831,12 @@ void LifeV::PartitionIO<MeshType>::writeElements()
                         static_cast<int>(currentPart.volumeList[j].flag());
                 }
 
-            hsize_t currentOffset[2] = {i * currentCount[0], 0};
+            hsize_t currentOffset[2] = {(M_partOffset + i) * currentCount[0], 0};
             writeData(filespace, memspace, plistId, dataset, H5T_NATIVE_UINT,
                       currentOffset, currentCount, &M_uintBuffer[0]);
         }
     } else {
-        for (UInt i = 0; i < M_numParts; ++i) {
+        for (UInt i = 0; i < M_numLocalParts; ++i) {
             mesh_Type& currentPart = (*(*M_meshPartsOut)[i]);
             for (UInt j = 0; j < currentPart.numVolumes(); ++j) {
                 for (UInt k = 0; k < M_elementNodes; ++k) {
@@ -811,7 +851,7 @@ void LifeV::PartitionIO<MeshType>::writeElements()
                         static_cast<int>(currentPart.volumeList[j].flag());
                 }
 
-            hsize_t currentOffset[2] = {0, i * currentCount[1]};
+            hsize_t currentOffset[2] = {0, (M_partOffset + i) * currentCount[1]};
             writeData(filespace, memspace, plistId, dataset, H5T_NATIVE_UINT,
                       currentOffset, currentCount, &M_uintBuffer[0]);
         }
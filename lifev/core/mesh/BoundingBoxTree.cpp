@@ -0,0 +1,243 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the implementation of the BoundingBoxTree class
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/mesh/BoundingBoxTree.hpp>
+
+#include <algorithm>
+
+namespace LifeV
+{
+
+namespace
+{
+
+//! Order the boxes by the coordinate of their center along a direction
+class CenterLess
+{
+public:
+    CenterLess( const std::vector<BoundingBoxTree::point_Type>& centers, const UInt& direction ) :
+            M_centers( centers ),
+            M_direction( direction )
+    {}
+
+    bool operator()( const UInt& i, const UInt& j ) const
+    {
+        return M_centers[i][M_direction] < M_centers[j][M_direction];
+    }
+
+private:
+    const std::vector<BoundingBoxTree::point_Type>& M_centers;
+    UInt M_direction;
+};
+
+} // anonymous namespace
+
+// ===================================================
+// Constructor
+// ===================================================
+
+BoundingBoxTree::BoundingBoxTree()
+        :
+        M_boxesMin(),
+        M_boxesMax(),
+        M_order(),
+        M_nodes()
+{
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+void BoundingBoxTree::build( const std::vector<point_Type>& boxesMin, const std::vector<point_Type>& boxesMax,
+                             const UInt& leafSize )
+{
+    ASSERT( boxesMin.size() == boxesMax.size(), "The lists of corners must have the same size!" );
+    ASSERT( leafSize > 0, "The leaves must contain at least one box!" );
+
+    clear();
+
+    M_boxesMin = boxesMin;
+    M_boxesMax = boxesMax;
+
+    const UInt numBoxes( M_boxesMin.size() );
+    if ( numBoxes == 0 )
+    {
+        return;
+    }
+
+    std::vector<point_Type> centers( numBoxes );
+    M_order.resize( numBoxes );
+    for ( UInt iBox( 0 ); iBox < numBoxes; ++iBox )
+    {
+        centers[iBox] = 0.5 * ( M_boxesMin[iBox] + M_boxesMax[iBox] );
+        M_order[iBox] = iBox;
+    }
+
+    // A binary tree with leaves of at least leafSize / 2 boxes
+    M_nodes.reserve( 4 * numBoxes / leafSize + 1 );
+    buildNode( 0, numBoxes, centers, leafSize );
+}
+
+void BoundingBoxTree::candidates( const point_Type& point, std::vector<UInt>& boxes ) const
+{
+    boxes.clear();
+
+    if ( M_nodes.empty() )
+    {
+        return;
+    }
+
+    // Depth first visit of the nodes whose box contains the point
+    UInt stack[ 64 ];
+    UInt stackSize( 0 );
+    stack[ stackSize++ ] = 0;
+
+    while ( stackSize > 0 )
+    {
+        const Node& node( M_nodes[ stack[ --stackSize ] ] );
+
+        if ( !boxContains( node.boxMin, node.boxMax, point ) )
+        {
+            continue;
+        }
+
+        if ( isLeaf( node ) )
+        {
+            for ( UInt i( node.begin ); i < node.end; ++i )
+            {
+                if ( contains( M_order[i], point ) )
+                {
+                    boxes.push_back( M_order[i] );
+                }
+            }
+        }
+        else
+        {
+            stack[ stackSize++ ] = node.right;
+            stack[ stackSize++ ] = node.left;
+        }
+    }
+}
+
+bool BoundingBoxTree::contains( const UInt& box, const point_Type& point ) const
+{
+    ASSERT_BD( box < M_boxesMin.size() )
+
+    return boxContains( M_boxesMin[box], M_boxesMax[box], point );
+}
+
+void BoundingBoxTree::clear()
+{
+    M_boxesMin.clear();
+    M_boxesMax.clear();
+    M_order.clear();
+    M_nodes.clear();
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+UInt BoundingBoxTree::buildNode( const UInt& begin, const UInt& end, const std::vector<point_Type>& centers, const UInt& leafSize )
+{
+    const UInt nodeID( M_nodes.size() );
+    M_nodes.push_back( Node() );
+
+    // Box of the node
+    point_Type boxMin( M_boxesMin[ M_order[begin] ] );
+    point_Type boxMax( M_boxesMax[ M_order[begin] ] );
+    point_Type centerMin( centers[ M_order[begin] ] );
+    point_Type centerMax( centers[ M_order[begin] ] );
+    for ( UInt i( begin + 1 ); i < end; ++i )
+    {
+        const UInt box( M_order[i] );
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            boxMin[iCoor] = std::min( boxMin[iCoor], M_boxesMin[box][iCoor] );
+            boxMax[iCoor] = std::max( boxMax[iCoor], M_boxesMax[box][iCoor] );
+            centerMin[iCoor] = std::min( centerMin[iCoor], centers[box][iCoor] );
+            centerMax[iCoor] = std::max( centerMax[iCoor], centers[box][iCoor] );
+        }
+    }
+
+    M_nodes[nodeID].boxMin = boxMin;
+    M_nodes[nodeID].boxMax = boxMax;
+    M_nodes[nodeID].begin = begin;
+    M_nodes[nodeID].end = end;
+    M_nodes[nodeID].left = 0;
+    M_nodes[nodeID].right = 0;
+
+    // Direction of largest spread of the centers
+    UInt direction( 0 );
+    for ( UInt iCoor( 1 ); iCoor < 3; ++iCoor )
+    {
+        if ( centerMax[iCoor] - centerMin[iCoor] > centerMax[direction] - centerMin[direction] )
+        {
+            direction = iCoor;
+        }
+    }
+
+    // Leaf: few boxes, or boxes that cannot be separated
+    if ( end - begin <= leafSize || centerMax[direction] <= centerMin[direction] )
+    {
+        return nodeID;
+    }
+
+    // Median split, which keeps the tree balanced (depth of order log2( N / leafSize ))
+    const UInt middle( begin + ( end - begin ) / 2 );
+    std::nth_element( M_order.begin() + begin, M_order.begin() + middle, M_order.begin() + end,
+                      CenterLess( centers, direction ) );
+
+    const UInt left( buildNode( begin, middle, centers, leafSize ) );
+    const UInt right( buildNode( middle, end, centers, leafSize ) );
+
+    M_nodes[nodeID].left = left;
+    M_nodes[nodeID].right = right;
+
+    return nodeID;
+}
+
+bool BoundingBoxTree::boxContains( const point_Type& boxMin, const point_Type& boxMax, const point_Type& point )
+{
+    for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+    {
+        if ( point[iCoor] < boxMin[iCoor] || point[iCoor] > boxMax[iCoor] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // Namespace LifeV
@@ -0,0 +1,173 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief File containing the BoundingBoxTree class
+
+    @date 19-10-2012
+ */
+
+#ifndef BOUNDINGBOXTREE_H
+#define BOUNDINGBOXTREE_H 1
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/VectorSmall.hpp>
+
+#include <vector>
+
+namespace LifeV
+{
+
+//! BoundingBoxTree - Hierarchy of axis aligned boxes to find the boxes containing a point
+/*!
+  The tree is built on a list of boxes (typically the bounding boxes of the elements of a mesh,
+  or of the partitions of a mesh) by recursive median splits of the box centers along the longest
+  direction. The leaves contain at most leafSize boxes, so that finding the boxes that contain
+  a point costs O( log N ) box tests instead of the O( N ) of a scan of the list.
+
+  Usage:
+  \code
+  BoundingBoxTree tree;
+  tree.build( boxesMin, boxesMax );
+  std::vector<UInt> boxes;
+  tree.candidates( point, boxes );
+  \endcode
+
+  The boxes are identified by their position in the lists given to build().
+ */
+class BoundingBoxTree
+{
+
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef VectorSmall<3> point_Type;
+
+    //@}
+
+
+    //! @name Constructor & Destructor
+    //@{
+
+    //! Empty constructor
+    BoundingBoxTree();
+
+    //! Destructor
+    ~BoundingBoxTree() {}
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Build the tree on a list of boxes
+    /*!
+      @param boxesMin lower corners of the boxes
+      @param boxesMax upper corners of the boxes
+      @param leafSize maximum number of boxes in a leaf of the tree
+     */
+    void build( const std::vector<point_Type>& boxesMin, const std::vector<point_Type>& boxesMax,
+                const UInt& leafSize = 8 );
+
+    //! Find the boxes containing a point
+    /*!
+      @param point the point to locate
+      @param boxes the positions of the boxes containing the point, in the order they are found
+     */
+    void candidates( const point_Type& point, std::vector<UInt>& boxes ) const;
+
+    //! Tell if a box contains a point
+    bool contains( const UInt& box, const point_Type& point ) const;
+
+    //! Remove the boxes and the tree
+    void clear();
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    //! Number of boxes in the tree
+    UInt numBoxes() const
+    {
+        return M_boxesMin.size();
+    }
+
+    //! Number of nodes of the tree
+    UInt numNodes() const
+    {
+        return M_nodes.size();
+    }
+
+    //@}
+
+private:
+
+    //! A node of the tree: its box, the range of boxes below it and its children
+    struct Node
+    {
+        point_Type boxMin;
+        point_Type boxMax;
+        UInt begin;
+        UInt end;
+        UInt left;
+        UInt right;
+    };
+
+    //! @name Private Methods
+    //@{
+
+    //! Build the node for the boxes M_order[begin] ... M_order[end-1] and its subtree
+    UInt buildNode( const UInt& begin, const UInt& end, const std::vector<point_Type>& centers, const UInt& leafSize );
+
+    //! Tell if a node is a leaf (the root is never a child, so a zero child means no child)
+    bool isLeaf( const Node& node ) const
+    {
+        return node.left == 0;
+    }
+
+    //! Tell if a box contains a point
+    static bool boxContains( const point_Type& boxMin, const point_Type& boxMax, const point_Type& point );
+
+    //@}
+
+    std::vector<point_Type> M_boxesMin;
+
+    std::vector<point_Type> M_boxesMax;
+
+    std::vector<UInt> M_order;
+
+    std::vector<Node> M_nodes;
+};
+
+} // Namespace LifeV
+
+#endif /* BOUNDINGBOXTREE_H */
@@ -53,6 +53,7 @@ MeshData::MeshData( ):
         M_meshFile ( "mesh.mesh" ),
         M_meshType ( "structured" ),
         M_order ( "P1" ),
+        M_reordering ( "none" ),
         M_verbose   ( false )
 {}
 
@@ -61,6 +62,7 @@ MeshData::MeshData( const GetPot& dataFile, const std::string& section ):
         M_meshFile (),
         M_meshType (),
         M_order    (),
+        M_reordering (),
         M_verbose   ()
 {
     setup( dataFile, section );
@@ -71,6 +73,7 @@ MeshData::MeshData( const MeshData& meshData ):
         M_meshFile   ( meshData.M_meshFile ),
         M_meshType   ( meshData.M_meshType ),
         M_order      ( meshData.M_order ),
+        M_reordering ( meshData.M_reordering ),
         M_verbose     ( meshData.M_verbose )
 {}
 
@@ -84,6 +87,7 @@ MeshData::setup( const GetPot& dataFile, const std::string& section )
     M_meshFile = dataFile( ( section + "/mesh_file" ).data(), "mesh.mesh" );
     M_meshType = dataFile( ( section + "/mesh_type" ).data(), "structured" );
     M_order    = dataFile( ( section + "/mesh_order"   ).data(), "P1" );
+    M_reordering = dataFile( ( section + "/reordering" ).data(), "none" );
     M_verbose   = dataFile( ( section + "/verbose"   ).data(), false );
 }
 
@@ -95,6 +99,7 @@ void MeshData::showMe( std::ostream& output ) const
     output << "mesh_file  = " << M_meshFile << std::endl;
     output << "mesh_type  = " << M_meshType << std::endl;
     output << "mesh_order  = " << M_order << std::endl;
+    output << "reordering = " << M_reordering << std::endl;
 }
 
 }
@@ -55,6 +55,7 @@
 #include <lifev/core/mesh/RegionMesh3DStructured.hpp>
 #include <lifev/core/filter/ParserINRIAMesh.hpp>
 #include <lifev/core/mesh/ConvertBareMesh.hpp>
+#include <lifev/core/mesh/MeshReordering.hpp>
 
 namespace LifeV
 {
@@ -118,6 +119,7 @@ public:
     void setMeshFile ( const std::string& file )  { M_meshFile = file; }
     void setMeshType ( const std::string& type )  { M_meshType = type; }
     void setMOrder   ( const std::string& order ) { M_order    = order; }
+    void setReordering ( const std::string& reordering ) { M_reordering = reordering; }
     void setVerbose  ( const bool& isVerbose )    { M_verbose  = isVerbose; }
 
     //@}
@@ -130,6 +132,7 @@ public:
     const std::string&   meshFile()  const { return M_meshFile; }
     const std::string&   meshType()  const { return M_meshType; }
     const std::string&   mOrder()    const { return M_order; }
+    const std::string&   reordering() const { return M_reordering; }
     const bool&          verbose()   const { return M_verbose; }
 
     //@}
@@ -140,6 +143,7 @@ private:
     std::string     M_meshFile;    //!< mesh file
     std::string     M_meshType;    //!< mesh type
     std::string     M_order;       //!< mesh type
+    std::string     M_reordering;  //!< renumbering of the points and elements after reading (none, rcm, hilbert), the edges and faces keep their numbering
 
     bool            M_verbose;		//!< verbose output?
 };
@@ -159,6 +163,8 @@ void readMesh( RegionMesh<LinearTriangle, MC>& mesh, const MeshData& data )
     //Update Edges
     mesh.updateElementFacets(true);
 
+    MeshUtility::reorderMesh( mesh, data.reordering() );
+
     if ( data.verbose() )
         std::cout << "mesh read.\n" << std::endl;
 }
@@ -194,6 +200,8 @@ void readMesh( RegionMesh<GEOSHAPE, MC>& mesh, const MeshData& data )
         mesh.updateElementFacets( true, data.verbose() );
     }
 
+    MeshUtility::reorderMesh( mesh, data.reordering() );
+
     if ( data.verbose() )
         std::cout << "mesh read.\n" << std::endl;
 }
@@ -535,11 +535,9 @@ template <typename EntityContainer >
 void reorderAccordingToIdPermutation( EntityContainer & container, std::vector<ID> const & newToOld )
 {
     ASSERT_BD( newToOld.size() >= container.size() );
-    typedef typename EntityContainer::iterator it;
     typedef typename EntityContainer::value_type meshEntity_Type;
-    std::vector<ID>::const_iterator start = newToOld.begin();
-    // Change the id's
-    for( it i = container.begin(); i < container.end(); ++i) i->setLocalId( *(start++) );
+    // The entity in position newToOld[ id ] gets the id
+    for( UInt i = 0; i < container.size(); ++i ) container[ newToOld[ i ] ].setLocalId( i );
     // Fix the ordering
     std::sort( container.begin(),
                container.end(),
@@ -0,0 +1,283 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Locality improving renumbering of the points and of the elements of a mesh
+
+    @date 19-10-2012
+ */
+
+#include <lifev/core/mesh/MeshReordering.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace LifeV
+{
+
+namespace MeshUtility
+{
+
+uint64_type hilbertKey( const VectorSmall<3>& point, const VectorSmall<3>& boxMin, const VectorSmall<3>& boxMax )
+{
+    const UInt numBits( 21 );
+    const uint32_type numCells( 1u << numBits );
+
+    // Integer coordinates of the cell containing the point
+    uint32_type X[3];
+    for ( UInt i( 0 ); i < 3; ++i )
+    {
+        const Real length( boxMax[i] - boxMin[i] );
+        Real coordinate( length > 0. ? ( point[i] - boxMin[i] ) / length * numCells : 0. );
+        coordinate = std::max( 0., std::min( coordinate, static_cast<Real>( numCells - 1 ) ) );
+        X[i] = static_cast<uint32_type>( coordinate );
+    }
+
+    // Transposed Hilbert index (J. Skilling, "Programming the Hilbert curve", 2004)
+    const uint32_type M( 1u << ( numBits - 1 ) );
+    for ( uint32_type Q( M ); Q > 1; Q >>= 1 )
+    {
+        const uint32_type P( Q - 1 );
+        for ( UInt i( 0 ); i < 3; ++i )
+        {
+            if ( X[i] & Q )
+            {
+                X[0] ^= P;
+            }
+            else
+            {
+                const uint32_type t( ( X[0] ^ X[i] ) & P );
+                X[0] ^= t;
+                X[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode
+    for ( UInt i( 1 ); i < 3; ++i )
+    {
+        X[i] ^= X[i - 1];
+    }
+    uint32_type t( 0 );
+    for ( uint32_type Q( M ); Q > 1; Q >>= 1 )
+    {
+        if ( X[2] & Q )
+        {
+            t ^= Q - 1;
+        }
+    }
+    for ( UInt i( 0 ); i < 3; ++i )
+    {
+        X[i] ^= t;
+    }
+
+    // Interleave the bits of the transposed index
+    uint64_type key( 0 );
+    for ( Int bit( numBits - 1 ); bit >= 0; --bit )
+    {
+        for ( UInt i( 0 ); i < 3; ++i )
+        {
+            key = ( key << 1 ) | ( ( X[i] >> bit ) & 1 );
+        }
+    }
+
+    return key;
+}
+
+std::vector<ID> hilbertPermutation( const std::vector< VectorSmall<3> >& points )
+{
+    std::vector<ID> newToOld( points.size() );
+    if ( points.empty() )
+    {
+        return newToOld;
+    }
+
+    VectorSmall<3> boxMin( points[0] );
+    VectorSmall<3> boxMax( points[0] );
+    for ( UInt iPoint( 1 ); iPoint < points.size(); ++iPoint )
+    {
+        for ( UInt i( 0 ); i < 3; ++i )
+        {
+            boxMin[i] = std::min( boxMin[i], points[iPoint][i] );
+            boxMax[i] = std::max( boxMax[i], points[iPoint][i] );
+        }
+    }
+
+    // Sorting the pairs (key, position) keeps the original order for equal keys
+    std::vector< std::pair<uint64_type, ID> > keys( points.size() );
+    for ( UInt iPoint( 0 ); iPoint < points.size(); ++iPoint )
+    {
+        keys[iPoint] = std::make_pair( hilbertKey( points[iPoint], boxMin, boxMax ), iPoint );
+    }
+    std::sort( keys.begin(), keys.end() );
+
+    for ( UInt iPoint( 0 ); iPoint < points.size(); ++iPoint )
+    {
+        newToOld[iPoint] = keys[iPoint].second;
+    }
+
+    return newToOld;
+}
+
+namespace
+{
+
+//! Breadth first visit of the component of a node, returning the last level
+std::vector<ID> lastLevel( const std::vector< std::set<ID> >& graph, const ID& root, std::vector<UInt>& level, UInt& depth )
+{
+    std::vector<ID> front( 1, root );
+    std::vector<ID> next;
+    std::vector<ID> visited( 1, root );
+
+    level[root] = 0;
+    depth = 0;
+    for ( ;; )
+    {
+        next.clear();
+        for ( UInt i( 0 ); i < front.size(); ++i )
+        {
+            for ( std::set<ID>::const_iterator it( graph[ front[i] ].begin() ); it != graph[ front[i] ].end(); ++it )
+            {
+                if ( level[*it] == NotAnId )
+                {
+                    level[*it] = depth + 1;
+                    next.push_back( *it );
+                    visited.push_back( *it );
+                }
+            }
+        }
+        if ( next.empty() )
+        {
+            break;
+        }
+        front.swap( next );
+        ++depth;
+    }
+
+    // Reset the levels for the next visit
+    for ( UInt i( 0 ); i < visited.size(); ++i )
+    {
+        level[ visited[i] ] = NotAnId;
+    }
+
+    return front;
+}
+
+//! Node of minimum degree in a list
+ID minimumDegreeNode( const std::vector< std::set<ID> >& graph, const std::vector<ID>& nodes )
+{
+    ID node( nodes[0] );
+    for ( UInt i( 1 ); i < nodes.size(); ++i )
+    {
+        if ( graph[ nodes[i] ].size() < graph[node].size() )
+        {
+            node = nodes[i];
+        }
+    }
+    return node;
+}
+
+} // anonymous namespace
+
+std::vector<ID> reverseCuthillMcKeePermutation( const std::vector< std::set<ID> >& graph )
+{
+    const UInt numNodes( graph.size() );
+
+    std::vector<ID> newToOld;
+    newToOld.reserve( numNodes );
+
+    std::vector<bool> numbered( numNodes, false );
+    std::vector<UInt> level( numNodes, NotAnId );
+
+    // Nodes sorted by degree, to start each component from a node of low degree
+    std::vector< std::pair<UInt, ID> > degrees( numNodes );
+    for ( UInt iNode( 0 ); iNode < numNodes; ++iNode )
+    {
+        degrees[iNode] = std::make_pair( static_cast<UInt>( graph[iNode].size() ), iNode );
+    }
+    std::sort( degrees.begin(), degrees.end() );
+
+    std::vector< std::pair<UInt, ID> > neighbours;
+    for ( UInt iStart( 0 ); iStart < numNodes; ++iStart )
+    {
+        if ( numbered[ degrees[iStart].second ] )
+        {
+            continue;
+        }
+
+        // Pseudo-peripheral node: move to the farthest level while the eccentricity grows
+        ID root( degrees[iStart].second );
+        UInt depth( 0 );
+        std::vector<ID> farthest( lastLevel( graph, root, level, depth ) );
+        for ( ;; )
+        {
+            const ID candidate( minimumDegreeNode( graph, farthest ) );
+            UInt candidateDepth( 0 );
+            std::vector<ID> candidateFarthest( lastLevel( graph, candidate, level, candidateDepth ) );
+            if ( candidateDepth <= depth )
+            {
+                break;
+            }
+            root = candidate;
+            depth = candidateDepth;
+            farthest.swap( candidateFarthest );
+        }
+
+        // Cuthill-McKee visit of the component
+        UInt head( newToOld.size() );
+        newToOld.push_back( root );
+        numbered[root] = true;
+        for ( ; head < newToOld.size(); ++head )
+        {
+            const ID node( newToOld[head] );
+
+            neighbours.clear();
+            for ( std::set<ID>::const_iterator it( graph[node].begin() ); it != graph[node].end(); ++it )
+            {
+                if ( !numbered[*it] )
+                {
+                    neighbours.push_back( std::make_pair( static_cast<UInt>( graph[*it].size() ), *it ) );
+                    numbered[*it] = true;
+                }
+            }
+            std::sort( neighbours.begin(), neighbours.end() );
+
+            for ( UInt i( 0 ); i < neighbours.size(); ++i )
+            {
+                newToOld.push_back( neighbours[i].second );
+            }
+        }
+    }
+
+    std::reverse( newToOld.begin(), newToOld.end() );
+
+    return newToOld;
+}
+
+} // namespace MeshUtility
+
+} // namespace LifeV
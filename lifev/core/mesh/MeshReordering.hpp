@@ -0,0 +1,340 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Locality improving renumbering of the points and of the elements of a mesh
+
+    @date 19-10-2012
+
+    The degrees of freedom are numbered by DOF::update following the global ID of the
+    mesh entities, and the Epetra maps store them sorted by global ID. The numbering
+    of the mesh therefore fixes the bandwidth of the matrices and the memory access
+    pattern of the assembly and of the matrix-vector products.
+
+    The utilities of this file renumber a mesh to improve this locality:
+    <ul>
+    <li> the points can be numbered with a reverse Cuthill-McKee ordering of their
+         connectivity graph, or following a Hilbert space-filling curve;
+    <li> the elements can be numbered following a Hilbert space-filling curve
+         through their barycenters.
+    </ul>
+
+    On a mesh that is not partitioned, the global IDs are renumbered as well, so that
+    the reordering is inherited by the DOF numbering and by the maps of the finite element
+    spaces built on the partitioned mesh. On a partitioned mesh only the local storage
+    order changes.
+
+    The edges and the faces are not renumbered: the degrees of freedom carried by the
+    edges and the faces (e.g. for P2 or P1Bubble elements) keep the numbering of the
+    mesh generator, so the reordering is fully effective only for the elements with
+    degrees of freedom on the vertices and in the elements (P0, P1, Q1).
+
+    Usage:
+    @code
+    MeshUtility::reorderMesh( *fullMeshPtr, "rcm" );
+    MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, comm );
+    @endcode
+ */
+
+#ifndef MESHREORDERING_H
+#define MESHREORDERING_H 1
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/array/VectorSmall.hpp>
+#include <lifev/core/mesh/ElementShapes.hpp>
+#include <lifev/core/mesh/MeshEntityContainer.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace LifeV
+{
+
+namespace MeshUtility
+{
+
+/*
+ *******************************************************************************
+                              PERMUTATIONS
+ *******************************************************************************
+ */
+
+//! Position of a point along the 3D Hilbert curve covering a box
+/*!
+  @param point the coordinates of the point
+  @param boxMin the lower corner of the box
+  @param boxMax the upper corner of the box
+  @return the index of the cell containing the point, on a grid of 2^21 cells per direction
+ */
+uint64_type hilbertKey( const VectorSmall<3>& point, const VectorSmall<3>& boxMin, const VectorSmall<3>& boxMax );
+
+//! Permutation sorting a set of points along the Hilbert curve covering their bounding box
+/*!
+  @param points the coordinates of the points
+  @return the permutation newToOld: the point in position newToOld[i] goes in position i
+ */
+std::vector<ID> hilbertPermutation( const std::vector< VectorSmall<3> >& points );
+
+//! Reverse Cuthill-McKee permutation of a graph
+/*!
+  Each connected component is numbered starting from a pseudo-peripheral node,
+  visiting the neighbours by increasing degree.
+
+  @param graph the adjacency list of each node (the node itself may be included)
+  @return the permutation newToOld: the node in position newToOld[i] goes in position i
+ */
+std::vector<ID> reverseCuthillMcKeePermutation( const std::vector< std::set<ID> >& graph );
+
+/*
+ *******************************************************************************
+                              MESH RENUMBERING
+ *******************************************************************************
+ */
+
+//! Fix the pointers to the points after a renumbering of the points, not meant for general use
+template <typename MeshType>
+void fixPointPointersAfterPermutation( MeshType& mesh, const std::vector<ID>& newToOld, GeoDim<3> )
+{
+    Utilities::fixAfterPermutation( mesh.volumeList, mesh.pointList, newToOld );
+    Utilities::fixAfterPermutation( mesh.faceList, mesh.pointList, newToOld );
+    Utilities::fixAfterPermutation( mesh.edgeList, mesh.pointList, newToOld );
+}
+
+//! Fix the pointers to the points after a renumbering of the points, not meant for general use
+template <typename MeshType>
+void fixPointPointersAfterPermutation( MeshType& mesh, const std::vector<ID>& newToOld, GeoDim<2> )
+{
+    Utilities::fixAfterPermutation( mesh.faceList, mesh.pointList, newToOld );
+    Utilities::fixAfterPermutation( mesh.edgeList, mesh.pointList, newToOld );
+}
+
+//! Fix the pointers to the points after a renumbering of the points, not meant for general use
+template <typename MeshType>
+void fixPointPointersAfterPermutation( MeshType& mesh, const std::vector<ID>& newToOld, GeoDim<1> )
+{
+    Utilities::fixAfterPermutation( mesh.edgeList, mesh.pointList, newToOld );
+}
+
+//! Fix the adjacency of the facets after a renumbering of the elements, not meant for general use
+template <typename MeshType, typename GeoDimType>
+void fixFacetAdjacencyAfterPermutation( MeshType& mesh, const std::vector<ID>& oldToNew, GeoDimType )
+{
+    typedef typename MeshType::facets_Type::iterator facetIterator_Type;
+    for ( facetIterator_Type facet = mesh.facetList().begin(); facet != mesh.facetList().end(); ++facet )
+    {
+        if ( facet->firstAdjacentElementIdentity() != NotAnId )
+        {
+            facet->firstAdjacentElementIdentity() = oldToNew[ facet->firstAdjacentElementIdentity() ];
+        }
+        if ( facet->secondAdjacentElementIdentity() != NotAnId )
+        {
+            facet->secondAdjacentElementIdentity() = oldToNew[ facet->secondAdjacentElementIdentity() ];
+        }
+    }
+}
+
+//! The facets of a 1D mesh are points, which store no adjacency
+template <typename MeshType>
+void fixFacetAdjacencyAfterPermutation( MeshType&, const std::vector<ID>&, GeoDim<1> )
+{
+    ERROR_MSG( "The elements of a 1D mesh can not be reordered!" );
+}
+
+//! Renumber the points of a mesh
+/*!
+  The points are moved in the point list, and the pointers to the points stored in the
+  elements, in the facets, in the ridges and in the boundary point list are fixed.
+  If the mesh is not partitioned, the global IDs of the points are set equal to the new local IDs.
+
+  @param mesh the mesh
+  @param newToOld the permutation: the point in position newToOld[i] goes in position i
+  @pre The point list must be consistent (localId equal to the position)
+  @note The points saved by the MeshTransformer are not reordered: call it before moving the mesh.
+ */
+template <typename MeshType>
+void reorderPoints( MeshType& mesh, const std::vector<ID>& newToOld )
+{
+    ASSERT( newToOld.size() == mesh.pointList.size(), "The permutation must have the size of the point list!" );
+
+    Utilities::reorderAccordingToIdPermutation( mesh.pointList, newToOld );
+
+    fixPointPointersAfterPermutation( mesh, newToOld, typename MeshType::geoDim_Type() );
+
+    // The boundary point list stores the addresses of the points
+    std::vector<ID> oldToNew( newToOld.size() );
+    for ( UInt i( 0 ); i < newToOld.size(); ++i )
+    {
+        oldToNew[ newToOld[i] ] = i;
+    }
+    for ( UInt i( 0 ); i < mesh._bPoints.size(); ++i )
+    {
+        mesh._bPoints[i] = &mesh.pointList[ oldToNew[ mesh._bPoints[i]->localId() ] ];
+    }
+
+    if ( !mesh.isPartitioned() )
+    {
+        for ( UInt i( 0 ); i < mesh.pointList.size(); ++i )
+        {
+            mesh.pointList[i].setId( i );
+        }
+    }
+}
+
+//! Renumber the elements of a mesh
+/*!
+  The elements are moved in the element list and the adjacency information of the facets is
+  updated. The element to facet and element to ridge tables, if present, are rebuilt.
+  If the mesh is not partitioned, the global IDs of the elements are set equal to the new local IDs.
+
+  @param mesh the mesh, with at least two dimensions
+  @param newToOld the permutation: the element in position newToOld[i] goes in position i
+  @pre The element list must be consistent (localId equal to the position)
+ */
+template <typename MeshType>
+void reorderElements( MeshType& mesh, const std::vector<ID>& newToOld )
+{
+    ASSERT( newToOld.size() == mesh.elementList().size(), "The permutation must have the size of the element list!" );
+
+    Utilities::reorderAccordingToIdPermutation( mesh.elementList(), newToOld );
+
+    std::vector<ID> oldToNew( newToOld.size() );
+    for ( UInt i( 0 ); i < newToOld.size(); ++i )
+    {
+        oldToNew[ newToOld[i] ] = i;
+    }
+
+    fixFacetAdjacencyAfterPermutation( mesh, oldToNew, typename MeshType::geoDim_Type() );
+
+    if ( !mesh.isPartitioned() )
+    {
+        for ( UInt i( 0 ); i < mesh.elementList().size(); ++i )
+        {
+            mesh.elementList()[i].setId( i );
+        }
+    }
+
+    if ( mesh.hasLocalFacets() )
+    {
+        mesh.cleanElementFacets();
+        mesh.updateElementFacets();
+    }
+    if ( mesh.hasLocalRidges() )
+    {
+        mesh.cleanElementRidges();
+        mesh.updateElementRidges();
+    }
+}
+
+//! Hilbert curve permutation of the points of a mesh
+template <typename MeshType>
+std::vector<ID> pointsHilbertPermutation( const MeshType& mesh )
+{
+    std::vector< VectorSmall<3> > points( mesh.pointList.size() );
+    for ( UInt i( 0 ); i < mesh.pointList.size(); ++i )
+    {
+        for ( UInt iCoor( 0 ); iCoor < MeshType::S_geoDimensions; ++iCoor )
+        {
+            points[i][iCoor] = mesh.pointList[i].coordinate( iCoor );
+        }
+    }
+    return hilbertPermutation( points );
+}
+
+//! Reverse Cuthill-McKee permutation of the points of a mesh
+/*!
+  Two points are connected when they belong to the same element, as the degrees of
+  freedom they carry are coupled in the finite element matrices.
+ */
+template <typename MeshType>
+std::vector<ID> pointsReverseCuthillMcKeePermutation( const MeshType& mesh )
+{
+    const UInt numElementPoints( MeshType::element_Type::S_numPoints );
+
+    std::vector< std::set<ID> > graph( mesh.pointList.size() );
+    for ( UInt iElement( 0 ); iElement < mesh.numElements(); ++iElement )
+    {
+        for ( UInt i( 0 ); i < numElementPoints; ++i )
+        {
+            for ( UInt j( 0 ); j < numElementPoints; ++j )
+            {
+                graph[ mesh.element( iElement ).point( i ).localId() ].insert( mesh.element( iElement ).point( j ).localId() );
+            }
+        }
+    }
+    return reverseCuthillMcKeePermutation( graph );
+}
+
+//! Hilbert curve permutation of the elements of a mesh, through their barycenters
+template <typename MeshType>
+std::vector<ID> elementsHilbertPermutation( const MeshType& mesh )
+{
+    const UInt numElementVertices( MeshType::element_Type::S_numVertices );
+
+    std::vector< VectorSmall<3> > barycenters( mesh.numElements() );
+    for ( UInt iElement( 0 ); iElement < mesh.numElements(); ++iElement )
+    {
+        for ( UInt i( 0 ); i < numElementVertices; ++i )
+        {
+            for ( UInt iCoor( 0 ); iCoor < MeshType::S_geoDimensions; ++iCoor )
+            {
+                barycenters[iElement][iCoor] += mesh.element( iElement ).point( i ).coordinate( iCoor ) / numElementVertices;
+            }
+        }
+    }
+    return hilbertPermutation( barycenters );
+}
+
+//! Renumber the points and the elements of a mesh to improve the locality
+/*!
+  @param mesh the mesh
+  @param method "none", "rcm" (reverse Cuthill-McKee for the points) or "hilbert" (Hilbert curve for the points).
+         Except for "none", the elements are then sorted along the Hilbert curve.
+ */
+template <typename MeshType>
+void reorderMesh( MeshType& mesh, const std::string& method )
+{
+    if ( method == "none" )
+        return;
+
+    if ( method == "rcm" )
+        reorderPoints( mesh, pointsReverseCuthillMcKeePermutation( mesh ) );
+    else if ( method == "hilbert" )
+        reorderPoints( mesh, pointsHilbertPermutation( mesh ) );
+    else
+        ERROR_MSG( "Unknown mesh reordering method: use none, rcm or hilbert" );
+
+    // The facets of a 1D mesh store no adjacency, and the edges follow the points anyway
+    if ( MeshType::S_geoDimensions > 1 )
+        reorderElements( mesh, elementsHilbertPermutation( mesh ) );
+}
+
+} // namespace MeshUtility
+
+} // namespace LifeV
+
+#endif /* MESHREORDERING_H */
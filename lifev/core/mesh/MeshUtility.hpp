@@ -2377,6 +2377,16 @@ public:
       *  @return The list mesh Point before the last movement.
       */
      typename REGIONMESH::points_Type const & pointListInitial() const;
+
+    //! Version of the geometry of the mesh
+    /**
+     * It is increased by each method moving the mesh points, so that data depending
+     * on the geometry (e.g. CurrentFEGeometryCache) can check if they are still valid.
+     */
+    UInt geometryVersion() const
+    {
+        return M_geometryVersion;
+    }
      private:
     /** Appropriately sets internal switches
      *
@@ -2386,6 +2396,7 @@ public:
      */
     REGIONMESH & M_mesh;
     typename REGIONMESH::points_Type M_pointList;
+    UInt M_geometryVersion;
 };
 /** Mesh statistics.
  *  Namespace that groups functions which operate on a mesh to extract statistics.
@@ -2415,7 +2426,7 @@ namespace MeshStatistics
 // *****   IMPLEMENTATIONS ****
 // The Template RMTYPE is used to compile with IBM compilers
 template <typename REGIONMESH, typename RMTYPE >
-MeshTransformer<REGIONMESH, RMTYPE >::MeshTransformer(REGIONMESH &m):M_mesh(m),M_pointList(){}
+MeshTransformer<REGIONMESH, RMTYPE >::MeshTransformer(REGIONMESH &m):M_mesh(m),M_pointList(),M_geometryVersion(0){}
 /**
  * @todo this method should be changed to make sure not to generate invalid elements
  */
@@ -2447,6 +2458,7 @@ void MeshTransformer<REGIONMESH, RMTYPE >::moveMesh( const VECTOR & disp, UInt d
             pointList[ i ].coordinate( j ) = M_pointList[ i ].coordinate( j ) + disp[ j * dim + globalId ];
         }
     }
+    ++M_geometryVersion;
 }
 
 template<typename REGIONMESH, typename RMTYPE >
@@ -2560,6 +2572,7 @@ void MeshTransformer<REGIONMESH, RMTYPE >::transformMesh( const VECTOR& scale, c
         pointList[ i ].coordinate( 1 ) = P( 1 );
         pointList[ i ].coordinate( 2 ) = P( 2 );
     }
+    ++M_geometryVersion;
 }
 //  The Template RMTYPE is used to compile with IBM compilers
 template <typename REGIONMESH, typename RMTYPE >
@@ -2574,6 +2587,7 @@ void MeshTransformer<REGIONMESH, RMTYPE >::transformMesh( const function& meshMa
         typename REGIONMESH::point_Type& p = pointList[ i ];
         meshMapping(p.coordinate(0),p.coordinate(1),p.coordinate(2));
     }
+    ++M_geometryVersion;
 }
 
 template <typename REGIONMESH>
@@ -260,6 +260,9 @@ public:
     //! Return the handle to perform transormations on the mesh
     inline MeshUtility::MeshTransformer<RegionMesh<geoShape_Type, markerCommon_Type>, markerCommon_Type > & meshTransformer();
 
+    //! Return the handle to perform transormations on the mesh (const version)
+    inline const MeshUtility::MeshTransformer<RegionMesh<geoShape_Type, markerCommon_Type>, markerCommon_Type > & meshTransformer() const;
+
     //! Return the communicator
     commPtr_Type comm() const;
 
@@ -3652,6 +3655,13 @@ RegionMesh<GeoShapeType, MCType>::meshTransformer()
     return this->M_meshTransformer;
 }
 
+template <typename GeoShapeType, typename MCType>
+inline const MeshUtility::MeshTransformer<RegionMesh<GeoShapeType, MCType>, MCType > &
+RegionMesh<GeoShapeType, MCType>::meshTransformer() const
+{
+    return this->M_meshTransformer;
+}
+
 template <typename GeoShapeType, typename MCType>
 inline typename RegionMesh<GeoShapeType, MCType>::commPtr_Type
 RegionMesh<GeoShapeType, MCType>::comm() const
@@ -54,6 +54,8 @@
 #include <lifev/core/fem/Assembly.hpp>
 #include <lifev/core/fem/FESpace.hpp>
 #include <lifev/core/fem/AssemblyElemental.hpp>
+#include <lifev/core/fem/AssemblyElementalBatched.hpp>
+#include <lifev/core/fem/TensorProductHexa.hpp>
 
 namespace LifeV
 {
@@ -318,6 +320,7 @@ public:
     {
         ASSERT(M_massCFE != 0,"No mass currentFE for setting the quadrature rule!");
         M_massCFE->setQuadRule(qr);
+        M_massCFE->setGeometryCache(M_fespace->geometryCache(qr));
     }
 
     //! Setter for the quadrature used for the diffusion matrix
@@ -329,6 +332,7 @@ public:
     {
         ASSERT(M_diffCFE != 0,"No diffusion currentFE for setting the quadrature rule!");
         M_diffCFE->setQuadRule(qr);
+        M_diffCFE->setGeometryCache(M_fespace->geometryCache(qr));
     }
 
     //! Setter for the quadrature used for the advection matrix
@@ -341,6 +345,7 @@ public:
         ASSERT(M_advCFE != 0,"No advection (u) currentFE for setting the quadrature rule!");
         ASSERT(M_advBetaCFE != 0,"No advection (beta) currentFE for setting the quadrature rule!");
         M_advCFE->setQuadRule(qr);
+        M_advCFE->setGeometryCache(M_fespace->geometryCache(qr));
         M_advBetaCFE->setQuadRule(qr);
     }
 
@@ -353,6 +358,42 @@ public:
     {
         ASSERT(M_massRhsCFE != 0,"No Rhs currentFE for setting the quadrature rule!");
         M_massRhsCFE->setQuadRule(qr);
+        M_massRhsCFE->setGeometryCache(M_fespace->geometryCache(qr));
+    }
+
+    //! Setter for the batched assembly of the mass, advection and diffusion matrices
+    /*!
+      When enabled, the local matrices are computed for CurrentFEBatch::S_batchSize elements
+      at the same time with the procedures of AssemblyElementalBatched.hpp, then assembled
+      element by element. The quadrature rules are the same of the non batched assembly.
+     */
+    inline void setBatchedAssembly(const bool& batchedAssembly = true)
+    {
+        M_batchedAssembly = batchedAssembly;
+    }
+
+    //! Setter for the sum factorized assembly of the mass and diffusion matrices
+    /*!
+      When enabled and the finite element is Q1 or Q2 on hexahedra with a tensor product
+      quadrature rule, the local matrices are computed with TensorProductHexa. In the other
+      cases, the usual (or batched) assembly is used.
+     */
+    inline void setTensorProductAssembly(const bool& tensorProductAssembly = true)
+    {
+        M_tensorProductAssembly = tensorProductAssembly;
+    }
+
+    //! Setter for the overlap of the communications with the assembly
+    /*!
+      When enabled and the vector given to addAdvection or addMassRhs is unique, its repeated
+      copy is built with a split-phase import (see VectorEpetra::beginImport): the elements whose
+      degrees of freedom are all owned by this process are assembled while the values of the
+      other processes are being communicated, the other elements after the end of the import.
+      It is not used with the batched assembly.
+     */
+    inline void setOverlappedImport(const bool& overlappedImport = true)
+    {
+        M_overlappedImport = overlappedImport;
     }
 
     //@}
@@ -396,6 +437,35 @@ private:
     // Copy constructor is a no-sense.
     ADRAssembler(const ADRAssembler&);
 
+    //! Batched version of addMass
+    void addMassBatched(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft, const UInt& offsetUp);
+
+    //! Batched version of addAdvection, beta is repeated
+    void addAdvectionBatched(matrix_ptrType matrix, const vector_type& beta, const UInt& offsetLeft, const UInt& offsetUp);
+
+    //! Batched version of addDiffusion
+    void addDiffusionBatched(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft, const UInt& offsetUp);
+
+    //! Sum factorized version of addMass
+    void addMassTensorProduct(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft, const UInt& offsetUp);
+
+    //! Sum factorized version of addDiffusion
+    void addDiffusionTensorProduct(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft, const UInt& offsetUp);
+
+    //! Version of addAdvection overlapping the import of beta (unique) with the assembly
+    void addAdvectionOverlapped(matrix_ptrType matrix, const vector_type& beta, const UInt& offsetLeft, const UInt& offsetUp);
+
+    //! Assemble the advection on one element, beta is repeated
+    void addAdvectionElement(matrix_ptrType matrix, const vector_type& beta, const UInt& iterElement,
+                             std::vector< std::vector< Real > >& localBetaValue,
+                             const UInt& offsetLeft, const UInt& offsetUp);
+
+    //! Version of addMassRhs overlapping the import of f (unique) with the assembly
+    void addMassRhsOverlapped(vector_type& rhs, const vector_type& f);
+
+    //! Assemble the mass right hand side on one element, f is repeated
+    void addMassRhsElement(vector_type& rhs, const vector_type& f, const UInt& iterElement, std::vector<Real>& fValues);
+
     //@}
 
     // Finite element space for the unknown
@@ -432,6 +502,15 @@ private:
     // Local vector for the right hand side
     localVector_ptrType M_localMassRhs;
 
+    // Use the batched assembly
+    bool M_batchedAssembly;
+
+    // Use the sum factorized assembly on hexahedra
+    bool M_tensorProductAssembly;
+
+    // Overlap the import of the repeated vectors with the assembly
+    bool M_overlappedImport;
+
     // Chronos
     chrono_type M_diffusionAssemblyChrono;
     chrono_type M_advectionAssemblyChrono;
@@ -461,6 +540,10 @@ ADRAssembler():
         M_localDiff(),
         M_localMassRhs(),
 
+        M_batchedAssembly(false),
+        M_tensorProductAssembly(false),
+        M_overlappedImport(false),
+
         M_diffusionAssemblyChrono(),
         M_advectionAssemblyChrono(),
         M_massAssemblyChrono(),
@@ -500,6 +583,18 @@ addMass(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft,
     // Check that the fespace is set
     ASSERT(M_fespace != 0, "No FE space for assembling the mass!");
 
+    if (M_tensorProductAssembly && TensorProductHexa::isTensorProduct(M_massCFE->refFE(), M_massCFE->quadRule()))
+    {
+        addMassTensorProduct(matrix, coefficient, offsetLeft, offsetUp);
+        return;
+    }
+
+    if (M_batchedAssembly)
+    {
+        addMassBatched(matrix, coefficient, offsetLeft, offsetUp);
+        return;
+    }
+
     M_massAssemblyChrono.start();
 
     // Some constants
@@ -545,6 +640,11 @@ addAdvection(matrix_ptrType matrix, const vector_type& beta, const UInt& offsetL
     // Beta has to be repeated!
     if (beta.mapType() == Unique)
     {
+        if (M_overlappedImport && !M_batchedAssembly)
+        {
+            addAdvectionOverlapped(matrix, beta, offsetLeft, offsetUp);
+            return;
+        }
         addAdvection(matrix,vector_type(beta,Repeated), offsetLeft, offsetUp);
         return;
     }
@@ -553,14 +653,18 @@ addAdvection(matrix_ptrType matrix, const vector_type& beta, const UInt& offsetL
     ASSERT(M_fespace != 0, "No FE space for assembling the advection!");
     ASSERT(M_betaFESpace !=0, "No FE space (beta) for assembling the advection!");
 
+    if (M_batchedAssembly)
+    {
+        addAdvectionBatched(matrix, beta, offsetLeft, offsetUp);
+        return;
+    }
+
     M_advectionAssemblyChrono.start();
 
 
     // Some constants
     const UInt nbElements(M_fespace->mesh()->numElements());
-    const UInt fieldDim(M_fespace->fieldDim());
     const UInt betaFieldDim(M_betaFESpace->fieldDim());
-    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
     const UInt nbQuadPt(M_advCFE->nbQuadPt());
 
     // Temporaries
@@ -570,32 +674,7 @@ addAdvection(matrix_ptrType matrix, const vector_type& beta, const UInt& offsetL
     // Loop over the elements
     for (UInt iterElement(0); iterElement < nbElements; ++iterElement)
     {
-        // Update the advection current FEs
-        M_advCFE->update( M_fespace->mesh()->element(iterElement), UPDATE_PHI | UPDATE_DPHI | UPDATE_WDET );
-        M_advBetaCFE->update(M_fespace->mesh()->element(iterElement), UPDATE_PHI );
-
-        // Clean the local matrix
-        M_localAdv->zero();
-
-        // Interpolate beta in the quadrature points
-        AssemblyElemental::interpolate(localBetaValue,*M_advBetaCFE,betaFieldDim,M_betaFESpace->dof(),iterElement,beta);
-
-        // Assemble the advection
-        AssemblyElemental::advection(*M_localAdv,*M_advCFE,1.0,localBetaValue,fieldDim);
-
-
-        // Assembly
-        for (UInt iFieldDim(0); iFieldDim<fieldDim; ++iFieldDim)
-        {
-            assembleMatrix( *matrix,
-                            *M_localAdv,
-                            *M_advCFE,
-                            *M_advCFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*nbTotalDof + offsetLeft, iFieldDim*nbTotalDof + offsetUp );
-        }
+        addAdvectionElement(matrix, beta, iterElement, localBetaValue, offsetLeft, offsetUp);
     }
 
     M_advectionAssemblyChrono.stop();
@@ -609,6 +688,18 @@ addDiffusion(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetL
     // Check that the fespace is set
     ASSERT(M_fespace != 0, "No FE space for assembling the diffusion!");
 
+    if (M_tensorProductAssembly && TensorProductHexa::isTensorProduct(M_diffCFE->refFE(), M_diffCFE->quadRule()))
+    {
+        addDiffusionTensorProduct(matrix, coefficient, offsetLeft, offsetUp);
+        return;
+    }
+
+    if (M_batchedAssembly)
+    {
+        addDiffusionBatched(matrix, coefficient, offsetLeft, offsetUp);
+        return;
+    }
+
     M_diffusionAssemblyChrono.start();
 
     // Some constants
@@ -653,6 +744,11 @@ addMassRhs(vector_type& rhs, const vector_type& f)
     // f has to be repeated!
     if (f.mapType() == Unique)
     {
+        if (M_overlappedImport)
+        {
+            addMassRhsOverlapped(rhs, f);
+            return;
+        }
         addMassRhs(rhs,vector_type(f,Repeated));
         return;
     }
@@ -664,70 +760,15 @@ addMassRhs(vector_type& rhs, const vector_type& f)
 
     // Some constants
     const UInt nbElements(M_fespace->mesh()->numElements());
-    const UInt fieldDim(M_fespace->fieldDim());
-    const UInt nbFEDof(M_massRhsCFE->nbFEDof());
     const UInt nbQuadPt(M_massRhsCFE->nbQuadPt());
-    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
 
     // Temporaries
-    Real localValue(0.0);
     std::vector<Real> fValues(nbQuadPt,0.0);
 
     // Loop over the elements
     for (UInt iterElement(0); iterElement < nbElements; ++iterElement)
     {
-        // Update the diffusion current FE
-        M_massRhsCFE->update( M_fespace->mesh()->element(iterElement), UPDATE_PHI |UPDATE_WDET );
-
-        // Clean the local matrix
-        M_localMassRhs->zero();
-
-        // Assemble the local diffusion
-        for (UInt iterFDim(0); iterFDim<fieldDim; ++iterFDim)
-        {
-            localVector_type::vector_view localView = M_localMassRhs->block(iterFDim);
-
-            // Compute the value of f in the quadrature nodes
-            for (UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt)
-            {
-                fValues[iQuadPt]=0.0;
-                for (UInt iDof(0); iDof < nbFEDof ; ++iDof)
-                {
-                    fValues[iQuadPt]+=
-                        f[ M_fespace->dof().localToGlobalMap(iterElement,iDof) + iterFDim*nbTotalDof]
-                        * M_massRhsCFE->phi(iDof,iQuadPt);
-                }
-            }
-
-            // Loop over the basis functions
-            for (UInt iDof(0); iDof < nbFEDof ; ++iDof)
-            {
-                localValue = 0.0;
-
-                //Loop on the quadrature nodes
-                for (UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt)
-                {
-                    localValue += fValues[iQuadPt]
-                                  * M_massRhsCFE->phi(iDof,iQuadPt)
-                                  * M_massRhsCFE->wDetJacobian(iQuadPt);
-                }
-
-                // Add on the local matrix
-                localView(iDof)=localValue;
-            }
-        }
-
-        // Here add in the global rhs
-        for (UInt iterFDim(0); iterFDim<fieldDim; ++iterFDim)
-        {
-            assembleVector( rhs,
-                            iterElement,
-                            *M_localMassRhs,
-                            nbFEDof,
-                            M_fespace->dof(),
-                            iterFDim,
-                            iterFDim*M_fespace->dof().numTotalDof());
-        }
+        addMassRhsElement(rhs, f, iterElement, fValues);
     }
 
     M_massRhsAssemblyChrono.stop();
@@ -842,6 +883,12 @@ setFespace(const fespace_ptrType& fespace)
 
     M_massRhsCFE.reset(new currentFE_type(M_fespace->refFE(),M_fespace->fe().geoMap(),M_fespace->qr()));
     M_localMassRhs.reset(new localVector_type(M_fespace->fe().nbFEDof(), M_fespace->fieldDim()));
+
+    // Use the geometry cache of the FE space, if enabled
+    M_massCFE->setGeometryCache(M_fespace->geometryCache(M_fespace->qr()));
+    M_advCFE->setGeometryCache(M_fespace->geometryCache(M_fespace->qr()));
+    M_diffCFE->setGeometryCache(M_fespace->geometryCache(M_fespace->qr()));
+    M_massRhsCFE->setGeometryCache(M_fespace->geometryCache(M_fespace->qr()));
 }
 
 template<typename mesh_type, typename matrix_type, typename vector_type>
@@ -856,6 +903,438 @@ setBetaFespace(const fespace_ptrType& betaFESpace)
     M_advBetaCFE.reset(new currentFE_type(M_betaFESpace->refFE(),M_fespace->fe().geoMap(),M_advCFE->quadRule()));
 }
 
+// ===================================================
+// Private Methods
+// ===================================================
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addMassBatched(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft, const UInt& offsetUp)
+{
+    M_massAssemblyChrono.start();
+
+    // Some constants
+    const UInt nbElements(M_fespace->mesh()->numElements());
+    const UInt fieldDim(M_fespace->fieldDim());
+    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
+    const UInt nbFEDof(M_massCFE->nbFEDof());
+
+    // Batch of elements and their local matrices
+    CurrentFEBatch massBatch(M_massCFE->refFE(), M_massCFE->geoMap(), M_massCFE->quadRule());
+    std::vector<localMatrix_type> localMass(CurrentFEBatch::S_batchSize, *M_localMass);
+
+    // Loop over the batches of elements
+    for (UInt firstElement(0); firstElement < nbElements; firstElement += CurrentFEBatch::S_batchSize)
+    {
+        // Update the mass batch
+        massBatch.update( *(M_fespace->mesh()), firstElement, UPDATE_PHI | UPDATE_WDET );
+
+        // Clean the local matrices
+        for (UInt lane(0); lane < massBatch.size(); ++lane)
+        {
+            localMass[lane].zero();
+        }
+
+        // Local Mass
+        AssemblyElemental::mass(localMass,massBatch,coefficient,fieldDim);
+
+        // Assembly
+        for (UInt lane(0); lane < massBatch.size(); ++lane)
+        {
+            for (UInt iFieldDim(0); iFieldDim<fieldDim; ++iFieldDim)
+            {
+                assembleMatrix( *matrix,
+                                massBatch.localId(lane),
+                                localMass[lane],
+                                nbFEDof,
+                                M_fespace->dof(),
+                                iFieldDim, iFieldDim,
+                                iFieldDim*nbTotalDof + offsetLeft, iFieldDim*nbTotalDof + offsetUp);
+            }
+        }
+    }
+
+    M_massAssemblyChrono.stop();
+}
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addAdvectionBatched(matrix_ptrType matrix, const vector_type& beta, const UInt& offsetLeft, const UInt& offsetUp)
+{
+    M_advectionAssemblyChrono.start();
+
+    // Some constants
+    const UInt nbElements(M_fespace->mesh()->numElements());
+    const UInt fieldDim(M_fespace->fieldDim());
+    const UInt betaFieldDim(M_betaFESpace->fieldDim());
+    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
+    const UInt nbFEDof(M_advCFE->nbFEDof());
+
+    // Batches of elements and their local matrices
+    CurrentFEBatch advBatch(M_advCFE->refFE(), M_advCFE->geoMap(), M_advCFE->quadRule());
+    CurrentFEBatch advBetaBatch(M_advBetaCFE->refFE(), M_advBetaCFE->geoMap(), M_advBetaCFE->quadRule());
+    std::vector<localMatrix_type> localAdv(CurrentFEBatch::S_batchSize, *M_localAdv);
+
+    // Values of beta in the quadrature nodes of the batch
+    std::vector<Real> localBetaValue;
+
+    // Loop over the batches of elements
+    for (UInt firstElement(0); firstElement < nbElements; firstElement += CurrentFEBatch::S_batchSize)
+    {
+        // Update the advection batches
+        advBatch.update( *(M_fespace->mesh()), firstElement, UPDATE_PHI | UPDATE_DPHI | UPDATE_WDET );
+        advBetaBatch.update( *(M_fespace->mesh()), firstElement, UPDATE_PHI );
+
+        // Clean the local matrices
+        for (UInt lane(0); lane < advBatch.size(); ++lane)
+        {
+            localAdv[lane].zero();
+        }
+
+        // Interpolate beta in the quadrature points
+        AssemblyElemental::interpolate(localBetaValue,advBetaBatch,betaFieldDim,M_betaFESpace->dof(),beta);
+
+        // Assemble the advection
+        AssemblyElemental::advection(localAdv,advBatch,1.0,localBetaValue,fieldDim);
+
+        // Assembly
+        for (UInt lane(0); lane < advBatch.size(); ++lane)
+        {
+            for (UInt iFieldDim(0); iFieldDim<fieldDim; ++iFieldDim)
+            {
+                assembleMatrix( *matrix,
+                                advBatch.localId(lane),
+                                localAdv[lane],
+                                nbFEDof,
+                                M_fespace->dof(),
+                                iFieldDim, iFieldDim,
+                                iFieldDim*nbTotalDof + offsetLeft, iFieldDim*nbTotalDof + offsetUp );
+            }
+        }
+    }
+
+    M_advectionAssemblyChrono.stop();
+}
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addDiffusionBatched(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft, const UInt& offsetUp)
+{
+    M_diffusionAssemblyChrono.start();
+
+    // Some constants
+    const UInt nbElements(M_fespace->mesh()->numElements());
+    const UInt fieldDim(M_fespace->fieldDim());
+    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
+    const UInt nbFEDof(M_diffCFE->nbFEDof());
+
+    // Batch of elements and their local matrices
+    CurrentFEBatch diffBatch(M_diffCFE->refFE(), M_diffCFE->geoMap(), M_diffCFE->quadRule());
+    std::vector<localMatrix_type> localDiff(CurrentFEBatch::S_batchSize, *M_localDiff);
+
+    // Loop over the batches of elements
+    for (UInt firstElement(0); firstElement < nbElements; firstElement += CurrentFEBatch::S_batchSize)
+    {
+        // Update the diffusion batch
+        diffBatch.update( *(M_fespace->mesh()), firstElement, UPDATE_DPHI | UPDATE_WDET );
+
+        // Clean the local matrices
+        for (UInt lane(0); lane < diffBatch.size(); ++lane)
+        {
+            localDiff[lane].zero();
+        }
+
+        // local stiffness
+        AssemblyElemental::stiffness(localDiff,diffBatch,coefficient,fieldDim);
+
+        // Assembly
+        for (UInt lane(0); lane < diffBatch.size(); ++lane)
+        {
+            for (UInt iFieldDim(0); iFieldDim<fieldDim; ++iFieldDim)
+            {
+                assembleMatrix( *matrix,
+                                diffBatch.localId(lane),
+                                localDiff[lane],
+                                nbFEDof,
+                                M_fespace->dof(),
+                                iFieldDim, iFieldDim,
+                                iFieldDim*nbTotalDof + offsetLeft, iFieldDim*nbTotalDof + offsetUp );
+            }
+        }
+    }
+
+    M_diffusionAssemblyChrono.stop();
+}
+
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addMassTensorProduct(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft, const UInt& offsetUp)
+{
+    M_massAssemblyChrono.start();
+
+    // Some constants
+    const UInt nbElements(M_fespace->mesh()->numElements());
+    const UInt fieldDim(M_fespace->fieldDim());
+    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
+    const UInt nbFEDof(M_massCFE->nbFEDof());
+
+    TensorProductHexa massTP(M_massCFE->refFE(), M_massCFE->quadRule());
+
+    // Loop over the elements
+    for (UInt iterElement(0); iterElement < nbElements; ++iterElement)
+    {
+        // Update the geometry
+        massTP.update( M_fespace->mesh()->element(iterElement) );
+
+        // Clean the local matrix
+        M_localMass->zero();
+
+        // Local Mass
+        massTP.mass(*M_localMass,coefficient,fieldDim);
+
+        // Assembly
+        for (UInt iFieldDim(0); iFieldDim<fieldDim; ++iFieldDim)
+        {
+            assembleMatrix( *matrix,
+                            M_fespace->mesh()->element(iterElement).localId(),
+                            *M_localMass,
+                            nbFEDof,
+                            M_fespace->dof(),
+                            iFieldDim, iFieldDim,
+                            iFieldDim*nbTotalDof + offsetLeft, iFieldDim*nbTotalDof + offsetUp);
+        }
+    }
+
+    M_massAssemblyChrono.stop();
+}
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addDiffusionTensorProduct(matrix_ptrType matrix, const Real& coefficient, const UInt& offsetLeft, const UInt& offsetUp)
+{
+    M_diffusionAssemblyChrono.start();
+
+    // Some constants
+    const UInt nbElements(M_fespace->mesh()->numElements());
+    const UInt fieldDim(M_fespace->fieldDim());
+    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
+    const UInt nbFEDof(M_diffCFE->nbFEDof());
+
+    TensorProductHexa diffTP(M_diffCFE->refFE(), M_diffCFE->quadRule());
+
+    // Loop over the elements
+    for (UInt iterElement(0); iterElement < nbElements; ++iterElement)
+    {
+        // Update the geometry
+        diffTP.update( M_fespace->mesh()->element(iterElement) );
+
+        // Clean the local matrix
+        M_localDiff->zero();
+
+        // local stiffness
+        diffTP.stiffness(*M_localDiff,coefficient,fieldDim);
+
+        // Assembly
+        for (UInt iFieldDim(0); iFieldDim<fieldDim; ++iFieldDim)
+        {
+            assembleMatrix( *matrix,
+                            M_fespace->mesh()->element(iterElement).localId(),
+                            *M_localDiff,
+                            nbFEDof,
+                            M_fespace->dof(),
+                            iFieldDim, iFieldDim,
+                            iFieldDim*nbTotalDof + offsetLeft, iFieldDim*nbTotalDof + offsetUp );
+        }
+    }
+
+    M_diffusionAssemblyChrono.stop();
+}
+
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addAdvectionOverlapped(matrix_ptrType matrix, const vector_type& beta, const UInt& offsetLeft, const UInt& offsetUp)
+{
+    // Check that the fespace is set
+    ASSERT(M_fespace != 0, "No FE space for assembling the advection!");
+    ASSERT(M_betaFESpace !=0, "No FE space (beta) for assembling the advection!");
+
+    M_advectionAssemblyChrono.start();
+
+    // Start the communication of beta
+    vector_type betaRepeated(beta.map(), Repeated);
+    betaRepeated.beginImport(beta);
+
+    // Temporaries
+    std::vector< std::vector< Real > > localBetaValue(M_advCFE->nbQuadPt(), std::vector<Real>( M_betaFESpace->fieldDim(), 0.0 ) );
+    const std::vector<UInt>& interiorElements( M_betaFESpace->interiorElements() );
+    const std::vector<UInt>& interfaceElements( M_betaFESpace->interfaceElements() );
+
+    // The interior elements need only the local values of beta
+    for (UInt iElement(0); iElement < interiorElements.size(); ++iElement)
+    {
+        addAdvectionElement(matrix, betaRepeated, interiorElements[iElement], localBetaValue, offsetLeft, offsetUp);
+    }
+
+    betaRepeated.endImport();
+
+    for (UInt iElement(0); iElement < interfaceElements.size(); ++iElement)
+    {
+        addAdvectionElement(matrix, betaRepeated, interfaceElements[iElement], localBetaValue, offsetLeft, offsetUp);
+    }
+
+    M_advectionAssemblyChrono.stop();
+}
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addAdvectionElement(matrix_ptrType matrix, const vector_type& beta, const UInt& iterElement,
+                    std::vector< std::vector< Real > >& localBetaValue,
+                    const UInt& offsetLeft, const UInt& offsetUp)
+{
+    // Some constants
+    const UInt fieldDim(M_fespace->fieldDim());
+    const UInt betaFieldDim(M_betaFESpace->fieldDim());
+    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
+
+    // Update the advection current FEs
+    M_advCFE->update( M_fespace->mesh()->element(iterElement), UPDATE_PHI | UPDATE_DPHI | UPDATE_WDET );
+    M_advBetaCFE->update(M_fespace->mesh()->element(iterElement), UPDATE_PHI );
+
+    // Clean the local matrix
+    M_localAdv->zero();
+
+    // Interpolate beta in the quadrature points
+    AssemblyElemental::interpolate(localBetaValue,*M_advBetaCFE,betaFieldDim,M_betaFESpace->dof(),iterElement,beta);
+
+    // Assemble the advection
+    AssemblyElemental::advection(*M_localAdv,*M_advCFE,1.0,localBetaValue,fieldDim);
+
+
+    // Assembly
+    for (UInt iFieldDim(0); iFieldDim<fieldDim; ++iFieldDim)
+    {
+        assembleMatrix( *matrix,
+                        *M_localAdv,
+                        *M_advCFE,
+                        *M_advCFE,
+                        M_fespace->dof(),
+                        M_fespace->dof(),
+                        iFieldDim, iFieldDim,
+                        iFieldDim*nbTotalDof + offsetLeft, iFieldDim*nbTotalDof + offsetUp );
+    }
+}
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addMassRhsOverlapped(vector_type& rhs, const vector_type& f)
+{
+    // Check that the fespace is set
+    ASSERT(M_fespace != 0, "No FE space for assembling the right hand side (mass)!");
+
+    M_massRhsAssemblyChrono.start();
+
+    // Start the communication of f
+    vector_type fRepeated(f.map(), Repeated);
+    fRepeated.beginImport(f);
+
+    // Temporaries
+    std::vector<Real> fValues(M_massRhsCFE->nbQuadPt(),0.0);
+    const std::vector<UInt>& interiorElements( M_fespace->interiorElements() );
+    const std::vector<UInt>& interfaceElements( M_fespace->interfaceElements() );
+
+    // The interior elements need only the local values of f
+    for (UInt iElement(0); iElement < interiorElements.size(); ++iElement)
+    {
+        addMassRhsElement(rhs, fRepeated, interiorElements[iElement], fValues);
+    }
+
+    fRepeated.endImport();
+
+    for (UInt iElement(0); iElement < interfaceElements.size(); ++iElement)
+    {
+        addMassRhsElement(rhs, fRepeated, interfaceElements[iElement], fValues);
+    }
+
+    M_massRhsAssemblyChrono.stop();
+}
+
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssembler< mesh_type, matrix_type, vector_type>::
+addMassRhsElement(vector_type& rhs, const vector_type& f, const UInt& iterElement, std::vector<Real>& fValues)
+{
+    // Some constants
+    const UInt fieldDim(M_fespace->fieldDim());
+    const UInt nbFEDof(M_massRhsCFE->nbFEDof());
+    const UInt nbQuadPt(M_massRhsCFE->nbQuadPt());
+    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
+
+    // Temporaries
+    Real localValue(0.0);
+
+    // Update the diffusion current FE
+    M_massRhsCFE->update( M_fespace->mesh()->element(iterElement), UPDATE_PHI |UPDATE_WDET );
+
+    // Clean the local matrix
+    M_localMassRhs->zero();
+
+    // Assemble the local diffusion
+    for (UInt iterFDim(0); iterFDim<fieldDim; ++iterFDim)
+    {
+        localVector_type::vector_view localView = M_localMassRhs->block(iterFDim);
+
+        // Compute the value of f in the quadrature nodes
+        for (UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt)
+        {
+            fValues[iQuadPt]=0.0;
+            for (UInt iDof(0); iDof < nbFEDof ; ++iDof)
+            {
+                fValues[iQuadPt]+=
+                    f[ M_fespace->dof().localToGlobalMap(iterElement,iDof) + iterFDim*nbTotalDof]
+                    * M_massRhsCFE->phi(iDof,iQuadPt);
+            }
+        }
+
+        // Loop over the basis functions
+        for (UInt iDof(0); iDof < nbFEDof ; ++iDof)
+        {
+            localValue = 0.0;
+
+            //Loop on the quadrature nodes
+            for (UInt iQuadPt(0); iQuadPt < nbQuadPt; ++iQuadPt)
+            {
+                localValue += fValues[iQuadPt]
+                              * M_massRhsCFE->phi(iDof,iQuadPt)
+                              * M_massRhsCFE->wDetJacobian(iQuadPt);
+            }
+
+            // Add on the local matrix
+            localView(iDof)=localValue;
+        }
+    }
+
+    // Here add in the global rhs
+    for (UInt iterFDim(0); iterFDim<fieldDim; ++iterFDim)
+    {
+        assembleVector( rhs,
+                        iterElement,
+                        *M_localMassRhs,
+                        nbFEDof,
+                        M_fespace->dof(),
+                        iterFDim,
+                        iterFDim*M_fespace->dof().numTotalDof());
+    }
+}
 
 } // Namespace LifeV
 
@@ -55,6 +55,7 @@
 #include <lifev/core/fem/Assembly.hpp>
 #include <lifev/core/fem/FESpace.hpp>
 #include <lifev/core/fem/AssemblyElemental.hpp>
+#include <lifev/core/fem/InteriorFacetCache.hpp>
 
 namespace LifeV
 {
@@ -136,6 +137,10 @@ namespace LifeV
 
     @author Samuel Quinodoz
 
+  The geometric quantities of the interior faces (derivatives of the basis functions of both adjacent
+  elements in the quadrature nodes of the face, normals, ...) are computed at the first assembly and
+  stored in an InteriorFacetCache, which is built again only when the mesh moves.
+
     @remark: no choice for the quadrature here, because of currentBDFE.
  */
 
@@ -242,13 +247,8 @@ private:
 
     currentBdFE_ptrType M_IPFaceCFE;
 
-    currentFE_ptrType M_IPQuad1CFE;
-    currentFE_ptrType M_IPQuad2CFE;
-
-    currentFE_ptrType M_IP1CFE;
-    currentFE_ptrType M_IP2CFE;
-
-    currentFE_ptrType M_IPBetaCFE;
+    // Geometry of the interior faces
+    InteriorFacetCache M_facets;
 
     // local matrix for the Galerkin stencil entries
     localMatrix_ptrType M_localIPGalerkin_11;
@@ -257,6 +257,21 @@ private:
     // local matrix for the Extended stencil entries
     localMatrix_ptrType M_localIPExtended_12;
     localMatrix_ptrType M_localIPExtended_21;
+
+    //! @name Private Methods
+    //@{
+
+    //! Build the cache of the interior faces if the mesh has changed
+    void updateFacets();
+
+    //! Compute and assemble the contribution of a cached face, weighted by betaN in the quadrature nodes
+    void assembleFacet(const matrix_ptrType& matrixGalerkin,
+                       const matrix_ptrType& matrixExtended,
+                       const UInt& iFace,
+                       const std::vector<Real>& betaN,
+                       const Real& coef);
+
+    //@}
 };
 
 // ===================================================
@@ -272,13 +287,7 @@ ADRAssemblerIP():
 
         M_IPFaceCFE(),
 
-        M_IPQuad1CFE(),
-        M_IPQuad2CFE(),
-
-        M_IP1CFE(),
-        M_IP2CFE(),
-
-        M_IPBetaCFE(),
+        M_facets(),
 
         M_localIPGalerkin_11(),
         M_localIPGalerkin_22(),
@@ -300,15 +309,8 @@ setup( const fespace_ptrType& fespace, const fespace_ptrType& betaFESpace )
 
     M_IPFaceCFE.reset(new CurrentBoundaryFE(M_fespace->feBd().refFE, M_fespace->feBd().geoMap, M_fespace->feBd().qr));
 
-    // For the two next CurrentFEs, the quadrature plays no role
-    M_IPQuad1CFE.reset(new CurrentFE(M_fespace->refFE(),M_fespace->fe().geoMap(), M_fespace->qr() ));
-    M_IPQuad2CFE.reset(new CurrentFE(M_fespace->refFE(),M_fespace->fe().geoMap(), M_fespace->qr() ));
-
-    // For the three next CurrentFEs, the quadrature will be replaced when computing the
-    // IP stabilization
-    M_IP1CFE.reset(new CurrentFE(M_fespace->refFE(),M_fespace->fe().geoMap(), M_fespace->qr() ));
-    M_IP2CFE.reset(new CurrentFE(M_fespace->refFE(),M_fespace->fe().geoMap(), M_fespace->qr() ));
-    M_IPBetaCFE.reset(new CurrentFE(M_betaFESpace->refFE(),M_fespace->fe().geoMap(), M_fespace->qr() ));
+    // The geometry of the faces is computed at the first assembly
+    M_facets.clear();
 
     // Local matrices
     M_localIPGalerkin_11.reset(new localMatrix_type(M_fespace->fe().nbFEDof()
@@ -342,221 +344,60 @@ addIPStabilizationStencil(const matrix_ptrType& matrixGalerkin,
     ASSERT(M_fespace != 0, "No FE space for building the IP stabilization! ");
     ASSERT(M_betaFESpace != 0, "No FE space (beta) for building the IP stabilization! ");
 
+    updateFacets();
+
     // Some constants
-    const UInt nbBoundaryFaces(M_fespace->mesh()->numBFaces());
-    const UInt nbFaces(M_fespace->mesh()->numFaces());
-    const UInt nbQuadPt(M_fespace->bdQr().nbQuadPt());
+    const UInt nbQuadPt(M_facets.nbQuadPt());
     const UInt nbLocalDof(M_fespace->fe().nbFEDof());
     const UInt nbLocalBetaDof(M_betaFESpace->fe().nbFEDof());
-    const UInt nbComponents(M_fespace->fieldDim());
     const UInt betaTotalDof(M_betaFESpace->dof().numTotalDof());
 
 
     // Temporaries
-    Real localValue_11(0.0);
-    Real localValue_22(0.0);
-    Real localValue_12(0.0);
-    Real localValue_21(0.0);
     std::vector<Real> betaN(nbQuadPt,0.0);
-    Real hFace2(0.0);
 
     // Here instead of looping over the elements, we loop on the faces.
-    for (UInt iFace(nbBoundaryFaces); iFace< nbFaces; ++iFace)
+    for (UInt iFace(0); iFace< M_facets.numFacets(); ++iFace)
     {
-        // Get the adjacent elements ID
-        const UInt adjacentElement1(M_fespace->mesh()->face(iFace).firstAdjacentElementIdentity());
-        const UInt adjacentElement2(M_fespace->mesh()->face(iFace).secondAdjacentElementIdentity());
-
         // Here we check that the face is included in the IP
         // stabilization: it is not a boundary face (we do not
         // stabilize there). We also cannot (not possible) stabilize
         // across the different partitions of the mesh (if they exist).
         // These cases are the excluded.
 
-        if ( Flag::testOneSet( M_fespace->mesh()->face(iFace).flag(), EntityFlags::SUBDOMAIN_INTERFACE | EntityFlags::PHYSICAL_BOUNDARY ) )
+        if ( M_facets.isInterface(iFace) )
         {
             continue;
         };
 
-        // Now the point is that we need to integrate on the face informations coming
-        // from the element (beta is defined on the volume, dphi as well). Therefore,
-        // we need to update the currentFEs with a quadrature that lies on the face.
-        // First step , we compute this quadrature.
-
-        M_IPFaceCFE->updateMeasNormalQuadPt(M_fespace->mesh()->face(iFace));
-        hFace2 = M_IPFaceCFE->measure();
-
-        // Second step, we take the quadrature back to the reference frame for both
-        // adjacent elements
-
-        M_IPQuad1CFE->update( M_fespace->mesh()->element(adjacentElement1),UPDATE_ONLY_CELL_NODES );
-
-        QuadratureRule faceQR1("custom quad 1",TETRA,3,0,0);
-        for (UInt iQuad(0); iQuad< nbQuadPt; ++iQuad) // Here we do not use UInt because of KNM, but we should
-        {
-            Real x(0.0),y(0.0),z(0.0);
-            M_IPQuad1CFE->coorBackMap( M_IPFaceCFE->quadPt(iQuad,0),
-                                       M_IPFaceCFE->quadPt(iQuad,1),
-                                       M_IPFaceCFE->quadPt(iQuad,2),
-                                       x,y,z);
-            QuadraturePoint newPoint(x,y,z,M_fespace->bdQr().weight(iQuad));
-            faceQR1.addPoint(newPoint);
-        }
-
-        M_IPQuad2CFE->update( M_fespace->mesh()->element(adjacentElement2),UPDATE_ONLY_CELL_NODES );
-        QuadratureRule faceQR2("custom quad 2",TETRA,3,0,0);
-        for (UInt iQuad(0); iQuad< nbQuadPt; ++iQuad) // Idem here
-        {
-            Real x(0.0),y(0.0),z(0.0);
-            M_IPQuad2CFE->coorBackMap( M_IPFaceCFE->quadPt(iQuad,0),
-                                       M_IPFaceCFE->quadPt(iQuad,1),
-                                       M_IPFaceCFE->quadPt(iQuad,2),
-                                       x,y,z);
-            QuadraturePoint newPoint(x,y,z,M_fespace->bdQr().weight(iQuad));
-            faceQR2.addPoint(newPoint);
-        }
-
-        // Third step, we change the quadrature in the CurrentFEs
-
-        M_IP1CFE->setQuadRule(faceQR1);
-        M_IP2CFE->setQuadRule(faceQR2);
-        M_IPBetaCFE->setQuadRule(faceQR1);
-
-        // Now the CurrentFEs are updated with a quadrature that is
-        // actually only on the considered face (iterFace).
-
-        M_IP1CFE->update(M_fespace->mesh()->element(adjacentElement1), UPDATE_DPHI | UPDATE_WDET);
-        M_IP2CFE->update(M_fespace->mesh()->element(adjacentElement2), UPDATE_DPHI | UPDATE_WDET);
-        M_IPBetaCFE->update(M_fespace->mesh()->element(adjacentElement1), UPDATE_PHI );
+        // Get the adjacent elements ID
+        const UInt adjacentElement1(M_facets.element(iFace,0));
 
         // Before starting the assembly, we compute the values of |beta n|
-        // in the quadrature nodes
+        // in the quadrature nodes, the quadrature nodes of the face being
+        // taken back to the reference frame of the first element
 
         for (UInt iQuadPt(0); iQuadPt<nbQuadPt; ++iQuadPt)
         {
             betaN[iQuadPt]=0.0;
             for (UInt iDof(0); iDof< nbLocalBetaDof; ++iDof)
             {
+                const Real betaPhi( M_betaFESpace->refFE().phi(iDof,
+                                                               M_facets.refQuadPt(iFace,iQuadPt,0),
+                                                               M_facets.refQuadPt(iFace,iQuadPt,1),
+                                                               M_facets.refQuadPt(iFace,iQuadPt,2)) );
                 for (UInt iDim(0); iDim<3; ++iDim)
                 {
                     betaN[iQuadPt] += beta[M_betaFESpace->dof().localToGlobalMap(adjacentElement1,iDof)
                                            + betaTotalDof*iDim]
-                                      * M_IPBetaCFE->phi(iDof,iQuadPt)
-                                      * M_IPFaceCFE->normal(iDim,iQuadPt);
+                                      * betaPhi
+                                      * M_facets.normal(iFace,iDim,iQuadPt);
                 }
             }
             betaN[iQuadPt] = std::fabs(betaN[iQuadPt]);
         }
 
-        // Now we can start the assembly. There are 4 parts, depending on
-        // which sides we consider ( side1 with side1, side1 with side2,...)
-        // We have also to be carefull about the signs, because we want the jumps
-        // Therefore, there is a "-" when considering two different sides.
-
-        // Zero out the local matrices
-        M_localIPGalerkin_11->zero();
-        M_localIPGalerkin_22->zero();
-        M_localIPExtended_12->zero();
-        M_localIPExtended_21->zero();
-
-        // Loop on the components
-        for (UInt iFieldDim(0); iFieldDim<nbComponents; ++iFieldDim)
-        {
-            // Extract the views
-            localMatrix_type::matrix_view viewIPGalerkin_11 = M_localIPGalerkin_11->block(iFieldDim,iFieldDim);
-            localMatrix_type::matrix_view viewIPGalerkin_22 = M_localIPGalerkin_22->block(iFieldDim,iFieldDim);
-            localMatrix_type::matrix_view viewIPExtended_12 = M_localIPExtended_12->block(iFieldDim,iFieldDim);
-            localMatrix_type::matrix_view viewIPExtended_21 = M_localIPExtended_21->block(iFieldDim,iFieldDim);
-
-            for (UInt iDof(0); iDof< nbLocalDof; ++iDof)
-            {
-                for (UInt jDof(0); jDof<nbLocalDof; ++jDof)
-                {
-                    localValue_11 = 0.0;
-                    localValue_22 = 0.0;
-                    localValue_12 = 0.0;
-                    localValue_21 = 0.0;
-
-                    for (UInt iQuadPt(0); iQuadPt< nbQuadPt; ++iQuadPt)
-                    {
-                        for (UInt iDim(0); iDim<3; ++iDim)
-                        {
-                            localValue_11 += betaN[iQuadPt]
-                                             * M_IP1CFE->dphi(iDof,iDim,iQuadPt)
-                                             * M_IP1CFE->dphi(jDof,iDim,iQuadPt)
-                                             * M_IP1CFE->wDetJacobian(iQuadPt);
-
-                            localValue_22 += betaN[iQuadPt]
-                                             * M_IP2CFE->dphi(iDof,iDim,iQuadPt)
-                                             * M_IP2CFE->dphi(jDof,iDim,iQuadPt)
-                                             * M_IP2CFE->wDetJacobian(iQuadPt);
-
-                            localValue_12 += betaN[iQuadPt]
-                                             * M_IP1CFE->dphi(iDof,iDim,iQuadPt)
-                                             * M_IP2CFE->dphi(jDof,iDim,iQuadPt)
-                                             * M_IP1CFE->wDetJacobian(iQuadPt);
-
-                            localValue_21 += betaN[iQuadPt]
-                                             * M_IP2CFE->dphi(iDof,iDim,iQuadPt)
-                                             * M_IP1CFE->dphi(jDof,iDim,iQuadPt)
-                                             * M_IP1CFE->wDetJacobian(iQuadPt);
-                        }
-                    }
-
-                    // Here we put the values in the local matrices
-                    // We care for sign (to get jumps) and for the
-                    // coefficient here.
-                    viewIPGalerkin_11(iDof,jDof) += coef*hFace2*localValue_11;
-                    viewIPGalerkin_22(iDof,jDof) += coef*hFace2*localValue_22;
-                    viewIPExtended_12(iDof,jDof) += -coef*hFace2*localValue_12;
-                    viewIPExtended_21(iDof,jDof) += -coef*hFace2*localValue_21;
-                }
-            }
-        }
-
-        // Global Assembly
-        // We separate here the assembly of the two
-        // contributions for Galerkin and Extended
-        // stencil.
-
-        for (UInt iFieldDim(0); iFieldDim<nbComponents; ++iFieldDim)
-        {
-            assembleMatrix( *matrixGalerkin,
-                            *M_localIPGalerkin_11,
-                            *M_IP1CFE,
-                            *M_IP1CFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*M_fespace->dof().numTotalDof(), iFieldDim*M_fespace->dof().numTotalDof() );
-
-            assembleMatrix( *matrixGalerkin,
-                            *M_localIPGalerkin_22,
-                            *M_IP2CFE,
-                            *M_IP2CFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*M_fespace->dof().numTotalDof(), iFieldDim*M_fespace->dof().numTotalDof() );
-
-            assembleMatrix( *matrixExtended,
-                            *M_localIPExtended_12,
-                            *M_IP1CFE,
-                            *M_IP2CFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*M_fespace->dof().numTotalDof(), iFieldDim*M_fespace->dof().numTotalDof() );
-
-            assembleMatrix( *matrixExtended,
-                            *M_localIPExtended_21,
-                            *M_IP2CFE,
-                            *M_IP1CFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*M_fespace->dof().numTotalDof(), iFieldDim*M_fespace->dof().numTotalDof() );
-        }
+        assembleFacet(matrixGalerkin, matrixExtended, iFace, betaN, coef);
     }
 
 }
@@ -570,199 +411,185 @@ addIPStabilizationStencil(const matrix_ptrType& matrixGalerkin,
 {
     ASSERT(M_fespace != 0, "No FE space for building the IP stabilization! ");
 
-    // Some constants
-    const UInt nbBoundaryFaces(M_fespace->mesh()->numBFaces());
-    const UInt nbFaces(M_fespace->mesh()->numFaces());
-    const UInt nbQuadPt(M_fespace->bdQr().nbQuadPt());
-    const UInt nbLocalDof(M_fespace->fe().nbFEDof());
-    const UInt nbComponents(M_fespace->fieldDim());
+    updateFacets();
 
-
-    // Temporaries
-    Real localValue_11(0.0);
-    Real localValue_22(0.0);
-    Real localValue_12(0.0);
-    Real localValue_21(0.0);
-    Real hFace2(0.0);
+    const std::vector<Real> betaN(M_facets.nbQuadPt(),1.0);
 
     // Here instead of looping over the elements, we loop on the faces.
-    for (UInt iFace(nbBoundaryFaces); iFace< nbFaces; ++iFace)
+    // The faces that are not shared by two elements of the mesh are not
+    // stored in the cache.
+    for (UInt iFace(0); iFace< M_facets.numFacets(); ++iFace)
     {
-        // Get the adjacent elements ID
-        const UInt adjacentElement1(M_fespace->mesh()->face(iFace).firstAdjacentElementIdentity());
-        const UInt adjacentElement2(M_fespace->mesh()->face(iFace).secondAdjacentElementIdentity());
-
-        // Here we check that the face is included in the IP
-        // stabilization: it is not a boundary face (we do not
-        // stabilize there). We also cannot (not possible) stabilize
-        // across the different partitions of the mesh (if they exist).
-        // These cases are the excluded.
-
-        if ((adjacentElement1 == NotAnId) || (adjacentElement2 == NotAnId) || (adjacentElement1 == adjacentElement2))
-        {
-            continue;
-        };
-
-        // Now the point is that we need to integrate on the face informations coming
-        // from the element (beta is defined on the volume, dphi as well). Therefore,
-        // we need to update the currentFEs with a quadrature that lies on the face.
-        // First step , we compute this quadrature.
-
-        M_IPFaceCFE->updateMeasNormalQuadPt(M_fespace->mesh()->face(iFace));
-        hFace2 = M_IPFaceCFE->measure();
+        assembleFacet(matrixGalerkin, matrixExtended, iFace, betaN, coef);
+    }
 
-        // Second step, we take the quadrature back to the reference frame for both
-        // adjacent elements
+}
 
-        M_IPQuad1CFE->update( M_fespace->mesh()->element(adjacentElement1),UPDATE_ONLY_CELL_NODES );
+// ===================================================
+// Private Methods
+// ===================================================
 
-        QuadratureRule faceQR1("custom quad 1",TETRA,3,0,0);
-        for (int iQuad(0); iQuad< nbQuadPt; ++iQuad) // Here we do not use UInt because of KNM, but we should
-        {
-            Real x(0.0),y(0.0),z(0.0);
-            M_IPQuad1CFE->coorBackMap( M_IPFaceCFE->quadPt(iQuad,0),
-                                       M_IPFaceCFE->quadPt(iQuad,1),
-                                       M_IPFaceCFE->quadPt(iQuad,2),
-                                       x,y,z);
-            QuadraturePoint newPoint(x,y,z,M_fespace->bdQr().weight(iQuad));
-            faceQR1.addPoint(newPoint);
-        }
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssemblerIP< mesh_type, matrix_type, vector_type>::
+updateFacets()
+{
+    // The geometry of the faces (back to the reference frame of both
+    // adjacent elements) is computed only once for the mesh
+    const UInt geometryVersion(M_fespace->mesh()->meshTransformer().geometryVersion());
 
-        M_IPQuad2CFE->update( M_fespace->mesh()->element(adjacentElement2),UPDATE_ONLY_CELL_NODES );
-        QuadratureRule faceQR2("custom quad 2",TETRA,3,0,0);
-        for (int iQuad(0); iQuad< nbQuadPt; ++iQuad) // Idem here
-        {
-            Real x(0.0),y(0.0),z(0.0);
-            M_IPQuad2CFE->coorBackMap( M_IPFaceCFE->quadPt(iQuad,0),
-                                       M_IPFaceCFE->quadPt(iQuad,1),
-                                       M_IPFaceCFE->quadPt(iQuad,2),
-                                       x,y,z);
-            QuadraturePoint newPoint(x,y,z,M_fespace->bdQr().weight(iQuad));
-            faceQR2.addPoint(newPoint);
-        }
+    if ( !M_facets.isUpToDate(geometryVersion) )
+    {
+        M_facets.build(*M_fespace->mesh(), M_fespace->refFE(), M_fespace->qr(), *M_IPFaceCFE, geometryVersion);
+    }
+}
 
-        // Third step, we change the quadrature in the CurrentFEs
+template<typename mesh_type, typename matrix_type, typename vector_type>
+void
+ADRAssemblerIP< mesh_type, matrix_type, vector_type>::
+assembleFacet(const matrix_ptrType& matrixGalerkin,
+              const matrix_ptrType& matrixExtended,
+              const UInt& iFace,
+              const std::vector<Real>& betaN,
+              const Real& coef)
+{
+    const UInt nbQuadPt(M_facets.nbQuadPt());
+    const UInt nbLocalDof(M_fespace->fe().nbFEDof());
+    const UInt nbComponents(M_fespace->fieldDim());
+    const UInt nbTotalDof(M_fespace->dof().numTotalDof());
 
-        M_IP1CFE->setQuadRule(faceQR1);
-        M_IP2CFE->setQuadRule(faceQR2);
+    const UInt adjacentElement1(M_facets.element(iFace,0));
+    const UInt adjacentElement2(M_facets.element(iFace,1));
+    const Real hFace2(M_facets.measure(iFace));
 
-        // Now the CurrentFEs are updated with a quadrature that is
-        // actually only on the considered face (iterFace).
+    // Temporaries
+    Real localValue_11(0.0);
+    Real localValue_22(0.0);
+    Real localValue_12(0.0);
+    Real localValue_21(0.0);
 
-        M_IP1CFE->update(M_fespace->mesh()->element(adjacentElement1), UPDATE_DPHI | UPDATE_WDET);
-        M_IP2CFE->update(M_fespace->mesh()->element(adjacentElement2), UPDATE_DPHI | UPDATE_WDET);
+    // Now we can start the assembly. There are 4 parts, depending on
+    // which sides we consider ( side1 with side1, side1 with side2,...)
+    // We have also to be carefull about the signs, because we want the jumps
+    // Therefore, there is a "-" when considering two different sides.
 
-        // Now we can start the assembly. There are 4 parts, depending on
-        // which sides we consider ( side1 with side1, side1 with side2,...)
-        // We have also to be carefull about the signs, because we want the jumps
-        // Therefore, there is a "-" when considering two different sides.
+    // Zero out the local matrices
+    M_localIPGalerkin_11->zero();
+    M_localIPGalerkin_22->zero();
+    M_localIPExtended_12->zero();
+    M_localIPExtended_21->zero();
 
-        // Zero out the local matrices
-        M_localIPGalerkin_11->zero();
-        M_localIPGalerkin_22->zero();
-        M_localIPExtended_12->zero();
-        M_localIPExtended_21->zero();
+    // Loop on the components
+    for (UInt iFieldDim(0); iFieldDim<nbComponents; ++iFieldDim)
+    {
+        // Extract the views
+        localMatrix_type::matrix_view viewIPGalerkin_11 = M_localIPGalerkin_11->block(iFieldDim,iFieldDim);
+        localMatrix_type::matrix_view viewIPGalerkin_22 = M_localIPGalerkin_22->block(iFieldDim,iFieldDim);
+        localMatrix_type::matrix_view viewIPExtended_12 = M_localIPExtended_12->block(iFieldDim,iFieldDim);
+        localMatrix_type::matrix_view viewIPExtended_21 = M_localIPExtended_21->block(iFieldDim,iFieldDim);
 
-        // Loop on the components
-        for (UInt iFieldDim(0); iFieldDim<nbComponents; ++iFieldDim)
+        for (UInt iDof(0); iDof< nbLocalDof; ++iDof)
         {
-            // Extract the views
-            localMatrix_type::matrix_view viewIPGalerkin_11 = M_localIPGalerkin_11->block(iFieldDim,iFieldDim);
-            localMatrix_type::matrix_view viewIPGalerkin_22 = M_localIPGalerkin_22->block(iFieldDim,iFieldDim);
-            localMatrix_type::matrix_view viewIPExtended_12 = M_localIPExtended_12->block(iFieldDim,iFieldDim);
-            localMatrix_type::matrix_view viewIPExtended_21 = M_localIPExtended_21->block(iFieldDim,iFieldDim);
-
-            for (UInt iDof(0); iDof< nbLocalDof; ++iDof)
+            for (UInt jDof(0); jDof<nbLocalDof; ++jDof)
             {
-                for (UInt jDof(0); jDof<nbLocalDof; ++jDof)
+                localValue_11 = 0.0;
+                localValue_22 = 0.0;
+                localValue_12 = 0.0;
+                localValue_21 = 0.0;
+
+                for (UInt iQuadPt(0); iQuadPt< nbQuadPt; ++iQuadPt)
                 {
-                    localValue_11 = 0.0;
-                    localValue_22 = 0.0;
-                    localValue_12 = 0.0;
-                    localValue_21 = 0.0;
+                    // Weights of the face quadrature times the jacobian of the elements
+                    const Real wDetJacobian1(M_fespace->bdQr().weight(iQuadPt) * M_facets.detJacobian(iFace,0));
+                    const Real wDetJacobian2(M_fespace->bdQr().weight(iQuadPt) * M_facets.detJacobian(iFace,1));
 
-                    for (UInt iQuadPt(0); iQuadPt< nbQuadPt; ++iQuadPt)
+                    for (UInt iDim(0); iDim<3; ++iDim)
                     {
-                        for (UInt iDim(0); iDim<3; ++iDim)
-                        {
-                            localValue_11 += 1.0
-                                             * M_IP1CFE->dphi(iDof,iDim,iQuadPt)
-                                             * M_IP1CFE->dphi(jDof,iDim,iQuadPt)
-                                             * M_IP1CFE->wDetJacobian(iQuadPt);
-
-                            localValue_22 += 1.0
-                                             * M_IP2CFE->dphi(iDof,iDim,iQuadPt)
-                                             * M_IP2CFE->dphi(jDof,iDim,iQuadPt)
-                                             * M_IP2CFE->wDetJacobian(iQuadPt);
-
-                            localValue_12 += 1.0
-                                             * M_IP1CFE->dphi(iDof,iDim,iQuadPt)
-                                             * M_IP2CFE->dphi(jDof,iDim,iQuadPt)
-                                             * M_IP1CFE->wDetJacobian(iQuadPt);
-
-                            localValue_21 += 1.0
-                                             * M_IP2CFE->dphi(iDof,iDim,iQuadPt)
-                                             * M_IP1CFE->dphi(jDof,iDim,iQuadPt)
-                                             * M_IP1CFE->wDetJacobian(iQuadPt);
-                        }
+                        localValue_11 += betaN[iQuadPt]
+                                         * M_facets.dphi(iFace,0,iDof,iDim,iQuadPt)
+                                         * M_facets.dphi(iFace,0,jDof,iDim,iQuadPt)
+                                         * wDetJacobian1;
+
+                        localValue_22 += betaN[iQuadPt]
+                                         * M_facets.dphi(iFace,1,iDof,iDim,iQuadPt)
+                                         * M_facets.dphi(iFace,1,jDof,iDim,iQuadPt)
+                                         * wDetJacobian2;
+
+                        localValue_12 += betaN[iQuadPt]
+                                         * M_facets.dphi(iFace,0,iDof,iDim,iQuadPt)
+                                         * M_facets.dphi(iFace,1,jDof,iDim,iQuadPt)
+                                         * wDetJacobian1;
+
+                        localValue_21 += betaN[iQuadPt]
+                                         * M_facets.dphi(iFace,1,iDof,iDim,iQuadPt)
+                                         * M_facets.dphi(iFace,0,jDof,iDim,iQuadPt)
+                                         * wDetJacobian1;
                     }
-
-                    // Here we put the values in the local matrices
-                    // We care for sign (to get jumps) and for the
-                    // coefficient here.
-                    viewIPGalerkin_11(iDof,jDof) += coef*hFace2*localValue_11;
-                    viewIPGalerkin_22(iDof,jDof) += coef*hFace2*localValue_22;
-                    viewIPExtended_12(iDof,jDof) += -coef*hFace2*localValue_12;
-                    viewIPExtended_21(iDof,jDof) += -coef*hFace2*localValue_21;
                 }
+
+                // Here we put the values in the local matrices
+                // We care for sign (to get jumps) and for the
+                // coefficient here.
+                viewIPGalerkin_11(iDof,jDof) += coef*hFace2*localValue_11;
+                viewIPGalerkin_22(iDof,jDof) += coef*hFace2*localValue_22;
+                viewIPExtended_12(iDof,jDof) += -coef*hFace2*localValue_12;
+                viewIPExtended_21(iDof,jDof) += -coef*hFace2*localValue_21;
             }
         }
+    }
 
-        // Global Assembly
-        // We separate here the assembly of the two
-        // contributions for Galerkin and Extended
-        // stencil.
+    // Global Assembly
+    // We separate here the assembly of the two
+    // contributions for Galerkin and Extended
+    // stencil.
 
-        for (UInt iFieldDim(0); iFieldDim<nbComponents; ++iFieldDim)
-        {
-            assembleMatrix( *matrixGalerkin,
-                            *M_localIPGalerkin_11,
-                            *M_IP1CFE,
-                            *M_IP1CFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*M_fespace->dof().numTotalDof(), iFieldDim*M_fespace->dof().numTotalDof() );
-
-            assembleMatrix( *matrixGalerkin,
-                            *M_localIPGalerkin_22,
-                            *M_IP2CFE,
-                            *M_IP2CFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*M_fespace->dof().numTotalDof(), iFieldDim*M_fespace->dof().numTotalDof() );
-
-            assembleMatrix( *matrixExtended,
-                            *M_localIPExtended_12,
-                            *M_IP1CFE,
-                            *M_IP2CFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*M_fespace->dof().numTotalDof(), iFieldDim*M_fespace->dof().numTotalDof() );
-
-            assembleMatrix( *matrixExtended,
-                            *M_localIPExtended_21,
-                            *M_IP2CFE,
-                            *M_IP1CFE,
-                            M_fespace->dof(),
-                            M_fespace->dof(),
-                            iFieldDim, iFieldDim,
-                            iFieldDim*M_fespace->dof().numTotalDof(), iFieldDim*M_fespace->dof().numTotalDof() );
-        }
+    for (UInt iFieldDim(0); iFieldDim<nbComponents; ++iFieldDim)
+    {
+        localMatrix_type::matrix_view viewIPGalerkin_11 = M_localIPGalerkin_11->block(iFieldDim,iFieldDim);
+        localMatrix_type::matrix_view viewIPGalerkin_22 = M_localIPGalerkin_22->block(iFieldDim,iFieldDim);
+        localMatrix_type::matrix_view viewIPExtended_12 = M_localIPExtended_12->block(iFieldDim,iFieldDim);
+        localMatrix_type::matrix_view viewIPExtended_21 = M_localIPExtended_21->block(iFieldDim,iFieldDim);
+
+        assembleMatrix( *matrixGalerkin,
+                        adjacentElement1,
+                        adjacentElement1,
+                        viewIPGalerkin_11,
+                        nbLocalDof,
+                        nbLocalDof,
+                        M_fespace->dof(),
+                        M_fespace->dof(),
+                        iFieldDim*nbTotalDof, iFieldDim*nbTotalDof );
+
+        assembleMatrix( *matrixGalerkin,
+                        adjacentElement2,
+                        adjacentElement2,
+                        viewIPGalerkin_22,
+                        nbLocalDof,
+                        nbLocalDof,
+                        M_fespace->dof(),
+                        M_fespace->dof(),
+                        iFieldDim*nbTotalDof, iFieldDim*nbTotalDof );
+
+        assembleMatrix( *matrixExtended,
+                        adjacentElement1,
+                        adjacentElement2,
+                        viewIPExtended_12,
+                        nbLocalDof,
+                        nbLocalDof,
+                        M_fespace->dof(),
+                        M_fespace->dof(),
+                        iFieldDim*nbTotalDof, iFieldDim*nbTotalDof );
+
+        assembleMatrix( *matrixExtended,
+                        adjacentElement2,
+                        adjacentElement1,
+                        viewIPExtended_21,
+                        nbLocalDof,
+                        nbLocalDof,
+                        M_fespace->dof(),
+                        M_fespace->dof(),
+                        iFieldDim*nbTotalDof, iFieldDim*nbTotalDof );
     }
-
 }
 
 } // Namespace LifeV
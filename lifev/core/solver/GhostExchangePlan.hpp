@@ -0,0 +1,348 @@
+//@HEADER
+/*
+*******************************************************************************
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+    This file is part of LifeV.
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+    Lesser General Public License for more details.
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV. If not, see <http://www.gnu.org/licenses/>.
+*******************************************************************************
+*/
+//@HEADER
+/*!
+ * @file
+ * @brief Persistent exchange of ghost values across subdomain interfaces.
+ *
+ * @date 19-10-2012
+ *
+ */
+
+#ifndef _GHOSTEXCHANGEPLAN_H_
+#define _GHOSTEXCHANGEPLAN_H_ 1
+
+#include <vector>
+
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+
+// LifeV namespace
+namespace LifeV
+{
+/*!
+  @class GhostExchangePlan
+
+  Plan for the exchange of one value per subdomain interface face with the neighbouring processes.
+  The plan is built once from the ghost map of the MeshPartitioner and stores
+  <ol>
+  <li> the flat list of the local elements whose value is sent, grouped by neighbouring process; </li>
+  <li> the flat list of the local interface faces that receive a ghost value, with the same grouping; </li>
+  <li> the persistent non-blocking requests (MPI_Recv_init and MPI_Send_init) for each neighbour. </li>
+  </ol>
+  Each exchange fills sendBuffer() following sendElements(), calls start(), and after wait() reads
+  recvBuffer() following recvFacets(). The work between start() and wait() overlaps the communication.
+  The send and receive buffers are never reallocated after setup, as required by the persistent requests.
+  @note The ordering of the ghost entities is the same on the two sides of an interface, as built by MeshPartitioner.
+ */
+template <typename Mesh>
+class GhostExchangePlan
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    typedef typename MeshPartitioner<Mesh>::GhostEntityDataMap_Type       ghostEntityDataMap_Type;
+    typedef typename MeshPartitioner<Mesh>::GhostEntityDataContainer_Type ghostEntityDataContainer_Type;
+
+    typedef Epetra_Comm                                                   comm_Type;
+    typedef boost::shared_ptr< comm_Type >                                commPtr_Type;
+
+    //@}
+
+    //! @name Constructors & Destructor
+    //@{
+
+    //! Empty constructor.
+    GhostExchangePlan ();
+
+    //! Destructor.
+    /*!
+      The persistent requests are freed only if MPI is not finalized yet,
+      call clear() before MPI_Finalize to release them.
+    */
+    ~GhostExchangePlan ();
+
+    //@}
+
+    //! @name Methods
+    //@{
+
+    //! Build the plan.
+    /*!
+      @param ghostDataMap Ghost map of the MeshPartitioner, processor -> ghost entities.
+      @param mesh Local mesh, used to find the element on the left of each interface face.
+      @param comm Epetra communicator, it must be an Epetra_MpiComm.
+    */
+    void setup ( const ghostEntityDataMap_Type& ghostDataMap, const Mesh& mesh, const commPtr_Type& comm );
+
+    //! Free the persistent requests and clear the plan, it must be called before MPI_Finalize.
+    void clear ();
+
+    //! Start the exchange, sendBuffer() must be already filled.
+    void start ();
+
+    //! Wait the end of the exchange, after that recvBuffer() is available.
+    void wait ();
+
+    //@}
+
+    //! @name Get Methods
+    //@{
+
+    //! Return true if the plan was built.
+    bool isSetup () const
+    {
+        return M_isSetup;
+    }
+
+    //! Return true if an exchange was started and not yet completed.
+    bool isActive () const
+    {
+        return M_isActive;
+    }
+
+    //! Local elements whose value is sent, one for each entry of sendBuffer().
+    const std::vector<ID>& sendElements () const
+    {
+        return M_sendElements;
+    }
+
+    //! Buffer of the values to send.
+    std::vector<Real>& sendBuffer ()
+    {
+        return M_sendBuffer;
+    }
+
+    //! Local interface faces that receive a value, one for each entry of recvBuffer().
+    const std::vector<ID>& recvFacets () const
+    {
+        return M_recvFacets;
+    }
+
+    //! Buffer of the received values.
+    const std::vector<Real>& recvBuffer () const
+    {
+        return M_recvBuffer;
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Constructors
+    //@{
+
+    //! Inhibited copy constructor, the persistent requests point to the buffers.
+    GhostExchangePlan ( const GhostExchangePlan& );
+
+    //! Inhibited assign operator.
+    GhostExchangePlan& operator= ( const GhostExchangePlan& );
+
+    //@}
+
+    //! Tag of the messages of the exchange.
+    static const Int S_tag = 4321;
+
+    //! Local elements whose value is sent.
+    std::vector<ID>          M_sendElements;
+
+    //! Local interface faces that receive a value.
+    std::vector<ID>          M_recvFacets;
+
+    //! Send buffer.
+    std::vector<Real>        M_sendBuffer;
+
+    //! Receive buffer.
+    std::vector<Real>        M_recvBuffer;
+
+    //! Persistent requests, the receives first and then the sends.
+    std::vector<MPI_Request> M_requests;
+
+    //! The plan was built.
+    bool                     M_isSetup;
+
+    //! An exchange is in progress.
+    bool                     M_isActive;
+
+};
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+template <typename Mesh>
+GhostExchangePlan<Mesh>::
+GhostExchangePlan () :
+        M_sendElements ( ),
+        M_recvFacets   ( ),
+        M_sendBuffer   ( ),
+        M_recvBuffer   ( ),
+        M_requests     ( ),
+        M_isSetup      ( false ),
+        M_isActive     ( false )
+{
+} // Constructor
+
+template <typename Mesh>
+GhostExchangePlan<Mesh>::
+~GhostExchangePlan ()
+{
+    // The requests cannot be freed after MPI_Finalize
+    Int finalized( 0 );
+    MPI_Finalized( &finalized );
+
+    if ( !finalized )
+    {
+        clear();
+    }
+} // Destructor
+
+// ===================================================
+// Methods
+// ===================================================
+
+template <typename Mesh>
+void
+GhostExchangePlan<Mesh>::
+setup ( const ghostEntityDataMap_Type& ghostDataMap, const Mesh& mesh, const commPtr_Type& comm )
+{
+    clear();
+
+    const Int myPID( comm->MyPID() );
+    const MPI_Comm mpiComm( ( boost::dynamic_pointer_cast<Epetra_MpiComm> ( comm ) )->Comm() );
+
+    // Offsets in the buffers and neighbouring processes
+    std::vector<UInt> offsets( 1, 0 );
+    std::vector<Int>  neighbours;
+
+    typename ghostEntityDataMap_Type::const_iterator procIt  = ghostDataMap.begin();
+    typename ghostEntityDataMap_Type::const_iterator procEnd = ghostDataMap.end();
+    for ( ; procIt != procEnd; ++procIt )
+    {
+        if ( static_cast<Int>( procIt->first ) == myPID || procIt->second.empty() )
+        {
+            continue;
+        }
+
+        typename ghostEntityDataContainer_Type::const_iterator dataIt  = procIt->second.begin();
+        typename ghostEntityDataContainer_Type::const_iterator dataEnd = procIt->second.end();
+        for ( ; dataIt != dataEnd; ++dataIt )
+        {
+            M_sendElements.push_back( mesh.faceElement( dataIt->localFacetId, 0 ) );
+            M_recvFacets.push_back( dataIt->localFacetId );
+        }
+
+        neighbours.push_back( procIt->first );
+        offsets.push_back( M_recvFacets.size() );
+    }
+
+    // The buffers are never resized after this point
+    M_sendBuffer.assign( M_sendElements.size(), 0. );
+    M_recvBuffer.assign( M_recvFacets.size(), 0. );
+
+    const UInt numNeighbours( neighbours.size() );
+    M_requests.resize( 2 * numNeighbours );
+
+    for ( UInt iNeighbour(0); iNeighbour < numNeighbours; ++iNeighbour )
+    {
+        const Int count( offsets[ iNeighbour + 1 ] - offsets[ iNeighbour ] );
+
+        MPI_Recv_init( &M_recvBuffer[ offsets[ iNeighbour ] ], count, MPI_DOUBLE, neighbours[ iNeighbour ],
+                       S_tag, mpiComm, &M_requests[ iNeighbour ] );
+
+        MPI_Send_init( &M_sendBuffer[ offsets[ iNeighbour ] ], count, MPI_DOUBLE, neighbours[ iNeighbour ],
+                       S_tag, mpiComm, &M_requests[ numNeighbours + iNeighbour ] );
+    }
+
+    M_isSetup = true;
+
+} // setup
+
+template <typename Mesh>
+void
+GhostExchangePlan<Mesh>::
+clear ()
+{
+    wait();
+
+    for ( UInt iRequest(0); iRequest < M_requests.size(); ++iRequest )
+    {
+        MPI_Request_free( &M_requests[ iRequest ] );
+    }
+
+    M_requests.clear();
+    M_sendElements.clear();
+    M_recvFacets.clear();
+    M_sendBuffer.clear();
+    M_recvBuffer.clear();
+
+    M_isSetup = false;
+
+} // clear
+
+template <typename Mesh>
+void
+GhostExchangePlan<Mesh>::
+start ()
+{
+    ASSERT( M_isSetup, "The ghost exchange plan is not set up." );
+    ASSERT( !M_isActive, "The previous ghost exchange is not completed." );
+
+    if ( !M_requests.empty() )
+    {
+        MPI_Startall( M_requests.size(), &M_requests[0] );
+    }
+
+    M_isActive = true;
+
+} // start
+
+template <typename Mesh>
+void
+GhostExchangePlan<Mesh>::
+wait ()
+{
+    if ( !M_isActive )
+    {
+        return;
+    }
+
+    if ( !M_requests.empty() )
+    {
+        MPI_Waitall( M_requests.size(), &M_requests[0], MPI_STATUSES_IGNORE );
+    }
+
+    M_isActive = false;
+
+} // wait
+
+} // namespace LifeV
+
+#endif /* _GHOSTEXCHANGEPLAN_H_ */
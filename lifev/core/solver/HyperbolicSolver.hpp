@@ -36,6 +36,8 @@
 #ifndef _HYPERBOLICSOLVER_H_
 #define _HYPERBOLICSOLVER_H_ 1
 
+#include <algorithm>
+
 #include <Epetra_LAPACK.h>
 
 #include <lifev/core/algorithm/SolverAztecOO.hpp>
@@ -45,6 +47,7 @@
 #include <lifev/core/fem/HyperbolicFluxNumerical.hpp>
 
 #include <lifev/core/solver/HyperbolicData.hpp>
+#include <lifev/core/solver/GhostExchangePlan.hpp>
 
 namespace
 {
@@ -125,6 +128,10 @@ namespace LifeV
   \f]
   Local approximation for the flux function \f$ \hat{\mathbf{F}} \cdot \mathbf{n} \f$ and the computation of
   \f$ \mathbf{F}^\prime \cdot \mathbf{n}_{e, K} \f$ are in NumericalFlux.hpp file.
+  <br>
+  The numerical flux is computed once for each face, with the normal going from the left to the right element,
+  and then added to the left element and subtracted from the right one. The geometry of the faces (quadrature nodes,
+  normals and weights) is computed once in setup(). The loop on the faces has independent iterations.
   @note The implementation is given just for lowest order discontinuous finite elements.
   @todo Implement the forcing term \f$ f \f$ and implement high order finite elements.
   @todo When we will pass to Trilinos >= 10.6 use Epetra wrapper for LAPACK functions.
@@ -162,6 +169,8 @@ public:
     typedef std::map< UInt, ghostDataContainer_Type > buffer_Type;
     typedef std::map< ID, ghostData_Type >           ghostDataMap_Type;
 
+    typedef GhostExchangePlan< Mesh >                ghostExchangePlan_Type;
+
     //@}
 
     //! @name Constructors & Destructor
@@ -204,11 +213,41 @@ public:
     void solveOneTimeStep();
 
     //! Compute the global CFL condition.
+    /*!
+      The CFL condition needs the solution across the subdomain interfaces: if setupGhostExchange() was
+      called and the ghost values of the current solution are not yet available, they are exchanged here,
+      overlapping the communication with the faces inside the subdomain, and the next solveOneTimeStep()
+      does not exchange them again.
+    */
     Real CFL();
 
+    //! Build the plan for the exchange of the solution values across subdomain interfaces.
+    /*!
+      The plan is built once. After this call solveOneTimeStep() exchanges the ghost values by itself,
+      overlapping the communication with the computation of the fluxes on the faces inside the subdomain.
+      @param ghostDataMap Ghost map of the MeshPartitioner.
+    */
+    void setupGhostExchange( const typename MeshPartitioner<Mesh>::GhostEntityDataMap_Type & ghostDataMap );
+
     //! Get solution values across subdomain interfaces.
+    /*!
+      Blocking exchange of the ghost values, the plan is built at the first call.
+      Not needed if setupGhostExchange() was called.
+      @param ghostDataMap Ghost map of the MeshPartitioner.
+    */
     void updateGhostValues( typename MeshPartitioner<Mesh>::GhostEntityDataMap_Type & ghostDataMap );
 
+    //! Free the plan for the exchange of the ghost values.
+    /*!
+      The plan holds persistent MPI requests: this method has to be called before MPI_Finalize
+      when the solver is destroyed after it.
+    */
+    void clearGhostExchange()
+    {
+        M_ghostExchangePlan.clear();
+        M_ghostValuesUpdated = false;
+    }
+
     //@}
 
     //! @name Set Methos
@@ -258,8 +297,7 @@ public:
     */
     inline void setNumericalFlux ( const flux_Type& flux )
     {
-        typedef GodunovNumericalFlux<Mesh, SolverType> godunov_Type;
-        M_numericalFlux.reset ( new godunov_Type( dynamic_cast<const godunov_Type&>( flux ) ) );
+        M_numericalFlux.reset ( flux.clone() );
     }
 
     //! Set the solution vector.
@@ -271,6 +309,9 @@ public:
         // Set both the final step solution and beginning step solution.
         M_u    = solution;
         M_uOld = solution;
+
+        // The ghost values refer to the previous solution
+        M_ghostValuesUpdated = false;
     }
 
     //@}
@@ -345,12 +386,24 @@ protected:
     //! Reconstruct locally the solution.
     void localReconstruct ( const UInt& Elem );
 
+    //! Compute the numerical flux across a face
+    void localFaceFlux    ( const UInt& iFace );
+
+    //! Compute the local CFL condition, without the time step, of an element across one of its faces
+    Real localFaceCFL     ( const UInt& iElem, const UInt& iFace );
+
     //! Compute the local contribute
     void localEvolve      ( const UInt& iElem );
 
     //! Apply the flux limiters locally.
     void localAverage     ( const UInt& iElem );
 
+    //! Fill the send buffer with the solution and start the exchange of the ghost values.
+    void startGhostExchange ();
+
+    //! Wait the end of the exchange of the ghost values and store them.
+    void endGhostExchange   ();
+
     //@}
 
     //! MPI process identifier.
@@ -404,9 +457,36 @@ protected:
     //! Vector of all local mass matrices, possibly with mass function.
     std::vector<MatrixElemental>  M_elmatMass;
 
+    //! Measure of all the elements.
+    std::vector<Real>         M_elementMeasure;
+
     //! Ghost data container
     ghostDataMap_Type M_ghostDataMap;
 
+    //! Number of quadrature nodes on each face.
+    UInt                      M_faceNbQuadPt;
+
+    //! Quadrature nodes on the faces, three coordinates for each node.
+    std::vector<Real>         M_faceQuadPoints;
+
+    //! Normals on the faces in the quadrature nodes, from the left to the right element.
+    std::vector<Real>         M_faceNormals;
+
+    //! Quadrature weights times the measure on the faces.
+    std::vector<Real>         M_faceWeightMeas;
+
+    //! Numerical flux integrated on each face, from the left to the right element.
+    std::vector<Real>         M_faceFlux;
+
+    //! Faces on the subdomain interface, their flux needs the ghost values.
+    std::vector<ID>           M_interfaceFaces;
+
+    //! Plan for the exchange of the ghost values.
+    ghostExchangePlan_Type    M_ghostExchangePlan;
+
+    //! Flag if the ghost values are already updated for the current time step.
+    bool                      M_ghostValuesUpdated;
+
 private:
 
     //! @name Private Constructors
@@ -459,10 +539,21 @@ HyperbolicSolver ( const data_Type&          dataFile,
         M_globalFlux      ( new vector_Type ( M_FESpace.map(), Repeated ) ),
         // Local matrices and vectors.
         M_localFlux       ( M_FESpace.refFE().nbDof(), 1 ),
-        M_elmatMass       ( )
+        M_elmatMass       ( ),
+        M_elementMeasure  ( ),
+        M_ghostDataMap    ( ),
+        M_faceNbQuadPt    ( 0 ),
+        M_faceQuadPoints  ( ),
+        M_faceNormals     ( ),
+        M_faceWeightMeas  ( ),
+        M_faceFlux        ( ),
+        M_interfaceFaces  ( ),
+        M_ghostExchangePlan ( ),
+        M_ghostValuesUpdated ( false )
 {
 
     M_elmatMass.reserve( M_FESpace.mesh()->numElements() );
+    M_elementMeasure.reserve( M_FESpace.mesh()->numElements() );
 
 } // Constructor
 
@@ -494,10 +585,21 @@ HyperbolicSolver ( const data_Type&          dataFile,
         M_globalFlux      ( new vector_Type ( M_FESpace.map(), Repeated ) ),
         // Local matrices and vectors.
         M_localFlux       ( M_FESpace.refFE().nbDof(), 1 ),
-        M_elmatMass       ( )
+        M_elmatMass       ( ),
+        M_elementMeasure  ( ),
+        M_ghostDataMap    ( ),
+        M_faceNbQuadPt    ( 0 ),
+        M_faceQuadPoints  ( ),
+        M_faceNormals     ( ),
+        M_faceWeightMeas  ( ),
+        M_faceFlux        ( ),
+        M_interfaceFaces  ( ),
+        M_ghostExchangePlan ( ),
+        M_ghostValuesUpdated ( false )
 {
 
     M_elmatMass.reserve( M_FESpace.mesh()->numElements() );
+    M_elementMeasure.reserve( M_FESpace.mesh()->numElements() );
 
 } // Constructor
 
@@ -572,12 +674,49 @@ setup ()
         // Save the local mass matrix in the global vector of mass matrices
         M_elmatMass.push_back( matElem );
 
+        // Save the measure of the element, used in the CFL condition
+        M_elementMeasure.push_back( M_FESpace.fe().measure() );
+
     }
 
     //make sure mesh facets are updated
     if(! M_FESpace.mesh()->hasLocalFacets() )
         M_FESpace.mesh()->updateElementFacets();
 
+    // Store the geometry of all the faces, the mesh does not change during the computation.
+    const UInt meshNumberOfFaces( M_FESpace.mesh()->numFaces() );
+    M_faceNbQuadPt = M_FESpace.feBd().nbQuadPt();
+
+    M_faceQuadPoints.resize( meshNumberOfFaces * M_faceNbQuadPt * 3 );
+    M_faceNormals.resize( meshNumberOfFaces * M_faceNbQuadPt * 3 );
+    M_faceWeightMeas.resize( meshNumberOfFaces * M_faceNbQuadPt );
+    M_faceFlux.assign( meshNumberOfFaces, 0. );
+    M_interfaceFaces.clear();
+
+    for ( UInt iFace(0); iFace < meshNumberOfFaces; ++iFace )
+    {
+        // Update the normal vector of the current face in each quadrature point
+        M_FESpace.feBd().updateMeasNormalQuadPt( M_FESpace.mesh()->boundaryFacet( iFace ) );
+
+        for ( UInt ig(0); ig < M_faceNbQuadPt; ++ig )
+        {
+            const UInt position( iFace * M_faceNbQuadPt + ig );
+
+            for ( UInt icoor(0); icoor < 3; ++icoor )
+            {
+                M_faceQuadPoints[ 3 * position + icoor ] = M_FESpace.feBd().quadPt( ig, icoor );
+                M_faceNormals[ 3 * position + icoor ]    = M_FESpace.feBd().normal( icoor, ig );
+            }
+
+            M_faceWeightMeas[ position ] = M_FESpace.feBd().weightMeas( ig );
+        }
+
+        if ( Flag::testOneSet ( M_FESpace.mesh()->face( iFace ).flag(), EntityFlags::SUBDOMAIN_INTERFACE ) )
+        {
+            M_interfaceFaces.push_back( iFace );
+        }
+    }
+
 } // setup
 
 // Solve one time step of the hyperbolic problem.
@@ -590,23 +729,62 @@ solveOneTimeStep ()
     // Total number of elements in the mesh
     const UInt meshNumberOfElements( M_FESpace.mesh()->numElements() );
 
-    // Loop on all the elements to perform the fluxes
+    // Total number of faces in the mesh
+    const UInt meshNumberOfFaces( M_FESpace.mesh()->numFaces() );
+
+    // Reconstruct step of all the elements
     for ( UInt iElem(0); iElem < meshNumberOfElements; ++iElem )
     {
+        localReconstruct( iElem );
+    }
 
-        // Update the property of the current element
-        M_FESpace.fe().update( M_FESpace.mesh()->element( iElem ),
-                               UPDATE_QUAD_NODES | UPDATE_WDET | UPDATE_PHI );
+    // Check if the boundary conditions were updated.
+    if ( M_setBC && !M_BCh->bcUpdateDone() )
+    {
+        // Update the boundary conditions handler. We use the finite element of the boundary of the dual variable.
+        M_BCh->bcUpdate( *M_FESpace.mesh(), M_FESpace.feBd(), M_FESpace.dof() );
+    }
 
-        // Reconstruct step of the current element
-        localReconstruct( iElem );
+    // Exchange the ghost values, if not already done, while computing the fluxes inside the subdomain
+    const bool exchangeGhostValues( M_ghostExchangePlan.isSetup() && !M_ghostValuesUpdated );
+    if ( exchangeGhostValues )
+    {
+        startGhostExchange();
+    }
+
+    // Compute the numerical flux on each face not on the subdomain interface, the iterations are independent
+    for ( UInt iFace(0); iFace < meshNumberOfFaces; ++iFace )
+    {
+        if ( !Flag::testOneSet ( M_FESpace.mesh()->face( iFace ).flag(), EntityFlags::SUBDOMAIN_INTERFACE ) )
+        {
+            localFaceFlux( iFace );
+        }
+    }
+
+    if ( exchangeGhostValues )
+    {
+        endGhostExchange();
+    }
+
+    // Compute the numerical flux on the faces of the subdomain interface
+    for ( UInt iFace(0); iFace < M_interfaceFaces.size(); ++iFace )
+    {
+        localFaceFlux( M_interfaceFaces[ iFace ] );
+    }
+
+    // The ghost values of the next time step are not yet available
+    M_ghostValuesUpdated = false;
+
+    // Loop on all the elements to collect the fluxes
+    for ( UInt iElem(0); iElem < meshNumberOfElements; ++iElem )
+    {
 
         // Evolve step of the current element
         localEvolve( iElem  );
 
         // Put the total flux of the current element in the global vector of fluxes
         assembleVector( *M_globalFlux,
-                        M_FESpace.fe().currentLocalId(),
+                        iElem,
                         M_localFlux,
                         M_FESpace.refFE().nbDof(),
                         M_FESpace.dof(), 0 );
@@ -639,114 +817,47 @@ CFL()
     // Total number of elements in the mesh
     const UInt meshNumberOfElements( M_FESpace.mesh()->numElements() );
 
+    // Exchange the ghost values, if not already done, while computing the CFL on the faces inside the subdomain
+    const bool exchangeGhostValues( M_ghostExchangePlan.isSetup() && !M_ghostValuesUpdated );
+    if ( exchangeGhostValues )
+    {
+        startGhostExchange();
+    }
+
     // The local value for the CFL condition, without the time step
-    Real localCFL(0.), localCFLOld( - 1. );
+    Real localCFL( - 1. );
 
-    // Loop on all the elements to perform the fluxes
+    // Loop on all the elements and on the faces not on the subdomain interface
     for ( UInt iElem(0); iElem < meshNumberOfElements; ++iElem )
     {
-        // Update the property of the current element
-        M_FESpace.fe().update( M_FESpace.mesh()->element( iElem ),
-                               UPDATE_QUAD_NODES | UPDATE_WDET | UPDATE_PHI );
-
-        // Volumetric measure of the current element
-        const Real K( M_FESpace.fe().measure() );
-
-        // Loop on the faces of the element iElem and compute the local contribution
         for ( UInt iFace(0); iFace < M_FESpace.mesh()->numLocalFaces(); ++iFace )
         {
-
             const UInt iGlobalFace( M_FESpace.mesh()->localFacetId( iElem, iFace ) );
 
-            // Update the normal vector of the current face in each quadrature point
-            M_FESpace.feBd().updateMeasNormalQuadPt( M_FESpace.mesh()->boundaryFacet( iGlobalFace ) );
-
-            // Take the left element to the face, see regionMesh for the meaning of left element
-            const UInt leftElement( M_FESpace.mesh()->faceElement( iGlobalFace, 0 ) );
-
-            // Take the right element to the face, see regionMesh for the meaning of right element
-            const UInt rightElement( M_FESpace.mesh()->faceElement( iGlobalFace, 1 ) );
-
-            // Solution in the left element
-            VectorElemental leftValue  ( M_FESpace.refFE().nbDof(), 1 );
-
-            // Solution in the right element
-            VectorElemental rightValue ( M_FESpace.refFE().nbDof(), 1 );
-
-            // Extract the solution in the current element, now is the leftElement
-            extract_vec( *M_uOld,
-                         leftValue,
-                         M_FESpace.refFE(),
-                         M_FESpace.dof(),
-                         leftElement , 0 );
-
-            if ( !Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(),
-                                     EntityFlags::PHYSICAL_BOUNDARY | EntityFlags::SUBDOMAIN_INTERFACE ) )
-            {
-                // Extract the solution in the current element, now is the leftElement
-                extract_vec( *M_uOld,
-                             rightValue,
-                             M_FESpace.refFE(),
-                             M_FESpace.dof(),
-                             rightElement , 0 );
-            }
-            else if ( Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), EntityFlags::SUBDOMAIN_INTERFACE ) )
+            if ( !Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), EntityFlags::SUBDOMAIN_INTERFACE ) )
             {
-                // TODO: this works only for P0 elements
-                rightValue[ 0 ] = M_ghostDataMap[ iGlobalFace ];
+                localCFL = std::max( localCFL, localFaceCFL( iElem, iGlobalFace ) );
             }
-            else // Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), PHYSICAL_BOUNDARY )
-            {
-                rightValue = leftValue;
-            }
-
-            // Area of the current face
-            const Real e( M_FESpace.feBd().measure() );
-
-            // Loop on all the quadrature points
-            for ( UInt ig(0); ig < M_FESpace.feBd().nbQuadPt(); ++ig )
-            {
-
-                // Cuurent quadrature point
-                KN<Real> quadPoint(3);
-                // normal vector
-                KN<Real> normal(3);
-
-                for (UInt icoor(0); icoor<3; ++icoor)
-                {
-                    quadPoint(icoor) = M_FESpace.feBd().quadPt( ig, icoor );
-                    normal(icoor)    = M_FESpace.feBd().normal( icoor, ig ) ;
         }
+    }
 
-                // Compute the local CFL without the time step
-                localCFL = e / K * M_numericalFlux->normInfinity ( leftValue[0],
-                                                                   rightValue[0],
-                                                                   normal,
-                                                                   iElem,
-                                                                   M_data.dataTime()->time(),
-                                                                   quadPoint(0),
-                                                                   quadPoint(1),
-                                                                   quadPoint(2) );
-
-                // Select the maximum between the old CFL condition and the new CFL condition
-                if ( localCFL > localCFLOld  )
-                {
-                    localCFLOld = localCFL;
-                }
-                else
-                {
-                    localCFL = localCFLOld;
-                }
-
-            }
-
-        }
+    if ( exchangeGhostValues )
+    {
+        endGhostExchange();
 
+        // The next solveOneTimeStep() does not exchange them again
+        M_ghostValuesUpdated = true;
     }
 
+    // The faces on the subdomain interface, the local element is on the left
+    for ( UInt iFace(0); iFace < M_interfaceFaces.size(); ++iFace )
+    {
+        const UInt iGlobalFace( M_interfaceFaces[ iFace ] );
+        localCFL = std::max( localCFL, localFaceCFL( M_FESpace.mesh()->faceElement( iGlobalFace, 0 ), iGlobalFace ) );
+    }
 
     // Compute the time step according to CLF for the current process
-    Real timeStepLocal[]  = { M_data.getCFLRelaxParameter() / localCFLOld };
+    Real timeStepLocal[]  = { M_data.getCFLRelaxParameter() / localCFL };
     Real timeStepGlobal[] = { 0. };
 
     // Compute the minimum of the computed time step for all the processes
@@ -760,75 +871,29 @@ CFL()
 template< typename Mesh, typename SolverType >
 void
 HyperbolicSolver< Mesh, SolverType >::
-updateGhostValues( typename MeshPartitioner<Mesh>::GhostEntityDataMap_Type & ghostDataMap )
+setupGhostExchange( const typename MeshPartitioner<Mesh>::GhostEntityDataMap_Type & ghostDataMap )
 {
 
-    // fill send buffer
-    buffer_Type sendBuffer;
-
-    // TODO: move this to a const reference
-    typename MeshPartitioner<Mesh>::GhostEntityDataMap_Type::const_iterator procIt  = ghostDataMap.begin();
-    typename MeshPartitioner<Mesh>::GhostEntityDataMap_Type::const_iterator procEnd = ghostDataMap.end();
-    typename MeshPartitioner<Mesh>::GhostEntityDataContainer_Type::const_iterator dataIt;
-    typename MeshPartitioner<Mesh>::GhostEntityDataContainer_Type::const_iterator dataEnd;
-    for ( ; procIt != procEnd; ++procIt )
-    {
-        std::vector<Real> valueList ( sendBuffer[ procIt->first ] );
-
-        dataEnd = procIt->second.end();
-        for ( dataIt = procIt->second.begin(); dataIt != dataEnd; ++dataIt )
-        {
-            ID elementId ( M_FESpace.mesh()->faceElement( dataIt->localFacetId, 0 ) );
-
-            VectorElemental ghostValue  ( M_FESpace.refFE().nbDof(), 1 );
-            extract_vec( *M_uOld, ghostValue, M_FESpace.refFE(), M_FESpace.dof(), elementId, 0 );
-            // TODO: this works only for P0
-            sendBuffer[ procIt->first ].push_back ( ghostValue[ 0 ] );
-        }
-    }
-
-    // organize recvBuffer
-    buffer_Type recvBuffer ( sendBuffer );
+    M_ghostExchangePlan.setup( ghostDataMap, *M_FESpace.mesh(), M_displayer.comm() );
 
-    // send data
-    MPI_Status status;
-    for ( Int proc = 0; proc < M_displayer.comm()->NumProc(); proc++ )
-    {
-        if ( proc != M_displayer.comm()->MyPID() )
-        {
-            MPI_Send( &sendBuffer[ proc ][ 0 ], sendBuffer[ proc ].size(), MPI_DOUBLE, proc, M_displayer.comm()->MyPID() + 1000*proc, ( boost::dynamic_pointer_cast <Epetra_MpiComm> (M_displayer.comm() ) )->Comm() );
-            MPI_Recv( &recvBuffer[ proc ][ 0 ], recvBuffer[ proc ].size(), MPI_DOUBLE, proc, proc + 1000*M_displayer.comm()->MyPID(), ( boost::dynamic_pointer_cast <Epetra_MpiComm> (M_displayer.comm() ) )->Comm(), &status );
-        }
+} // setupGhostExchange
 
-    }
+template< typename Mesh, typename SolverType >
+void
+HyperbolicSolver< Mesh, SolverType >::
+updateGhostValues( typename MeshPartitioner<Mesh>::GhostEntityDataMap_Type & ghostDataMap )
+{
 
-    // store data in the M_ghostDataMap member
-    for ( buffer_Type::const_iterator procIt = recvBuffer.begin(); procIt != recvBuffer.end(); ++procIt )
+    // The plan does not change during the computation, build it only once
+    if ( !M_ghostExchangePlan.isSetup() )
     {
-        UInt count ( 0 );
-        for ( ghostDataContainer_Type::const_iterator dataIt = procIt->second.begin(); dataIt != procIt->second.end(); ++dataIt, count++ )
-        {
-            ID ghostFaceId = ghostDataMap[ procIt->first ][ count ].localFacetId;
-            M_ghostDataMap[ ghostFaceId ] = *dataIt;
-        }
+        setupGhostExchange( ghostDataMap );
     }
 
+    startGhostExchange();
+    endGhostExchange();
 
-    // DEBUG
-//    std::ofstream outf ( ( "hype." + boost::lexical_cast<std::string> ( M_displayer.comm()->MyPID() ) + ".out" ).c_str() );
-//    outf << M_uOld->epetraVector() << std::endl << std::endl;
-//
-//    for ( buffer_Type::const_iterator procIt = recvBuffer.begin(); procIt != recvBuffer.end(); ++procIt )
-//    {
-//        outf << "proc " << procIt->first << " size " << recvBuffer[ procIt->first ].size() << std::endl;
-//        UInt count ( 0 );
-//        for ( procData_Type::const_iterator dataIt = procIt->second.begin(); dataIt != procIt->second.end(); ++dataIt, count++ )
-//        {
-//            ID ghostFaceId = ghostDataMap[ procIt->first ][ count ].localFacetId;
-//            ID elementId ( M_FESpace.mesh()->faceElement( ghostFaceId, 0 ) );
-//            outf << "lid " << elementId << " " << "gid " << ghostDataMap[ procIt->first ][ count ].ghostElementLocalId << " " << *dataIt << std::endl;
-//        }
-//    }
+    M_ghostValuesUpdated = true;
 
 } // updateGhostValues
 
@@ -851,6 +916,9 @@ setInitialSolution ( const Function_Type& initialSolution )
     // Update the solution
     *M_u = *M_uOld;
 
+    // The ghost values refer to the previous solution
+    M_ghostValuesUpdated = false;
+
 } // setInitialSolution
 
 // ===================================================
@@ -868,206 +936,259 @@ localReconstruct ( const UInt& /* iElem */ )
 
 } // localReconstruct
 
-// Compute the local contribute
+// Compute the local CFL condition of an element across one of its faces
 template< typename Mesh, typename SolverType >
-void
+Real
 HyperbolicSolver< Mesh, SolverType >::
-localEvolve ( const UInt& iElem )
+localFaceCFL ( const UInt& iElem, const UInt& iFace )
 {
 
-    // LAPACK wrapper of Epetra
-    Epetra_LAPACK lapack;
+    // Take the left element to the face, see regionMesh for the meaning of left element
+    const UInt leftElement( M_FESpace.mesh()->faceElement( iFace, 0 ) );
 
-    // Flags for LAPACK routines.
-    Int INFO[1]  = { 0 };
-    Int NB = M_FESpace.refFE().nbDof();
+    // Take the right element to the face, see regionMesh for the meaning of right element
+    const UInt rightElement( M_FESpace.mesh()->faceElement( iFace, 1 ) );
 
-    // Parameter that indicate the Lower storage of matrices.
-    char param_L = 'L';
-    char param_N = 'N';
+    // Flag of the current face
+    const flag_Type faceFlag( M_FESpace.mesh()->face( iFace ).flag() );
 
-    // Paramater that indicate the Transpose of matrices.
-    char param_T = 'T';
+    // Solution in the left element
+    VectorElemental leftValue  ( M_FESpace.refFE().nbDof(), 1 );
 
-    // Numbers of columns of the right hand side := 1.
-    Int NBRHS = 1;
+    // Solution in the right element
+    VectorElemental rightValue ( M_FESpace.refFE().nbDof(), 1 );
 
-    // Clean the local flux
-    M_localFlux.zero();
+    // Extract the solution in the left element
+    extract_vec( *M_uOld,
+                 leftValue,
+                 M_FESpace.refFE(),
+                 M_FESpace.dof(),
+                 leftElement , 0 );
 
-    // Loop on the faces of the element iElem and compute the local contribution
-    for ( UInt iFace(0); iFace < M_FESpace.mesh()->numLocalFaces(); ++iFace )
+    if ( !Flag::testOneSet ( faceFlag, EntityFlags::PHYSICAL_BOUNDARY | EntityFlags::SUBDOMAIN_INTERFACE ) )
     {
-        // Id mapping
-        const UInt iGlobalFace( M_FESpace.mesh()->localFacetId( iElem, iFace ) );
+        // Extract the solution in the right element
+        extract_vec( *M_uOld,
+                     rightValue,
+                     M_FESpace.refFE(),
+                     M_FESpace.dof(),
+                     rightElement , 0 );
+    }
+    else if ( Flag::testOneSet ( faceFlag, EntityFlags::SUBDOMAIN_INTERFACE ) )
+    {
+        const typename ghostDataMap_Type::const_iterator ghostIt( M_ghostDataMap.find( iFace ) );
+        if ( ghostIt == M_ghostDataMap.end() )
+        {
+            ERROR_MSG( "Ghost value not available, call setupGhostExchange or updateGhostValues." );
+        }
 
-        // Take the left element to the face, see regionMesh for the meaning of left element
-        const UInt leftElement( M_FESpace.mesh()->faceElement( iGlobalFace, 0 ) );
+        // TODO: this works only for P0 elements
+        rightValue[ 0 ] = ghostIt->second;
+    }
+    else // Flag::testOneSet ( faceFlag, PHYSICAL_BOUNDARY )
+    {
+        rightValue = leftValue;
+    }
 
-        // Take the right element to the face, see regionMesh for the meaning of right element
-        const UInt rightElement( M_FESpace.mesh()->faceElement( iGlobalFace, 1 ) );
+    // Geometry of the current face, computed in setup
+    const UInt position( iFace * M_faceNbQuadPt );
 
-        // Update the normal vector of the current face in each quadrature point
-        M_FESpace.feBd().updateMeasNormalQuadPt( M_FESpace.mesh()->boundaryFacet( iGlobalFace ) );
+    // Area of the current face
+    Real e( 0. );
+    for ( UInt ig(0); ig < M_faceNbQuadPt; ++ig )
+    {
+        e += M_faceWeightMeas[ position + ig ];
+    }
 
-        // Local flux of a face times the integration weight
-        VectorElemental localFaceFluxWeight ( M_FESpace.refFE().nbDof(), 1 );
+    // Local CFL without the time step, one call for all the quadrature points
+    return e / M_elementMeasure[ iElem ] * M_numericalFlux->faceNormInfinity ( leftValue[0],
+                                                                               rightValue[0],
+                                                                               &M_faceNormals[ 3 * position ],
+                                                                               &M_faceQuadPoints[ 3 * position ],
+                                                                               M_faceNbQuadPt,
+                                                                               iElem,
+                                                                               M_data.dataTime()->time() );
 
-        // Solution in the left element
-        VectorElemental leftValue  ( M_FESpace.refFE().nbDof(), 1 );
+} // localFaceCFL
 
-        // Solution in the right element
-        VectorElemental rightValue ( M_FESpace.refFE().nbDof(), 1 );
+// Compute the numerical flux across a face
+template< typename Mesh, typename SolverType >
+void
+HyperbolicSolver< Mesh, SolverType >::
+localFaceFlux ( const UInt& iFace )
+{
+
+    // Take the left element to the face, see regionMesh for the meaning of left element
+    const UInt leftElement( M_FESpace.mesh()->faceElement( iFace, 0 ) );
+
+    // Take the right element to the face, see regionMesh for the meaning of right element
+    const UInt rightElement( M_FESpace.mesh()->faceElement( iFace, 1 ) );
+
+    // Flag of the current face
+    const flag_Type faceFlag( M_FESpace.mesh()->face( iFace ).flag() );
 
-        // Extract the solution in the current element, now is the leftElement
+    // Solution in the left element
+    VectorElemental leftValue  ( M_FESpace.refFE().nbDof(), 1 );
+
+    // Solution in the right element
+    VectorElemental rightValue ( M_FESpace.refFE().nbDof(), 1 );
+
+    // Extract the solution in the left element
+    extract_vec( *M_uOld,
+                 leftValue,
+                 M_FESpace.refFE(),
+                 M_FESpace.dof(),
+                 leftElement , 0 );
+
+    // Check if the current face is a boundary face, that is rightElement == NotAnId
+    if ( !Flag::testOneSet ( faceFlag, EntityFlags::PHYSICAL_BOUNDARY | EntityFlags::SUBDOMAIN_INTERFACE ) )
+    {
+        // Extract the solution in the right element
         extract_vec( *M_uOld,
-                     leftValue,
+                     rightValue,
                      M_FESpace.refFE(),
                      M_FESpace.dof(),
-                     leftElement , 0 );
-
-        // Check if the current face is a boundary face, that is rightElement == NotAnId
-        if ( !Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), EntityFlags::PHYSICAL_BOUNDARY | EntityFlags::SUBDOMAIN_INTERFACE ) )
-        {
-            // Extract the solution in the current element, now is the leftElement
-            extract_vec( *M_uOld,
-                         rightValue,
-                         M_FESpace.refFE(),
-                         M_FESpace.dof(),
-                         rightElement , 0 );
-        }
-        else if ( Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), EntityFlags::SUBDOMAIN_INTERFACE ) )
+                     rightElement , 0 );
+    }
+    else if ( Flag::testOneSet ( faceFlag, EntityFlags::SUBDOMAIN_INTERFACE ) )
+    {
+        const typename ghostDataMap_Type::const_iterator ghostIt( M_ghostDataMap.find( iFace ) );
+        if ( ghostIt == M_ghostDataMap.end() )
         {
-            // TODO: this works only for P0 elements
-            rightValue[ 0 ] = M_ghostDataMap[ iGlobalFace ];
+            ERROR_MSG( "Ghost value not available, call setupGhostExchange or updateGhostValues." );
         }
-        else // Flag::testOneSet ( M_FESpace.mesh()->face ( iGlobalFace ).flag(), PHYSICAL_BOUNDARY )
-        {
 
-            // Clean the value of the right element
-            rightValue.zero();
+        // TODO: this works only for P0 elements
+        rightValue[ 0 ] = ghostIt->second;
+    }
+    else // Flag::testOneSet ( faceFlag, PHYSICAL_BOUNDARY )
+    {
+
+        // Sign of the flux on the boundary face
+        Real localFaceFluxWeight( 0. );
 
-            // Check if the boundary conditions were updated.
-            if ( !M_BCh->bcUpdateDone() )
-            {
-                // Update the boundary conditions handler. We use the finite element of the boundary of the dual variable.
-                M_BCh->bcUpdate( *M_FESpace.mesh(), M_FESpace.feBd(), M_FESpace.dof() );
-            }
+        // Take the boundary marker for the current boundary face
+        const ID faceMarker ( M_FESpace.mesh()->boundaryFacet( iFace ).markerID() );
 
-            // Take the boundary marker for the current boundary face
-            const ID faceMarker ( M_FESpace.mesh()->boundaryFacet( iGlobalFace ).markerID() );
+        // Take the corrispective boundary function
+        const BCBase& bcBase ( M_BCh->findBCWithFlag( faceMarker ) );
 
-            // Take the corrispective boundary function
-            const BCBase& bcBase ( M_BCh->findBCWithFlag( faceMarker ) );
+        // Check if the bounday condition is of type Essential, useful for operator splitting strategies
+        if ( bcBase.type() == Essential )
+        {
 
-            // Check if the bounday condition is of type Essential, useful for operator splitting strategies
-            if ( bcBase.type() == Essential )
+            // Loop on all the quadrature points
+            for ( UInt ig(0); ig < M_faceNbQuadPt; ++ig )
             {
 
-                // Loop on all the quadrature points
-                for ( UInt ig(0); ig < M_FESpace.feBd().nbQuadPt(); ++ig)
-                {
+                const UInt position( iFace * M_faceNbQuadPt + ig );
+                const Real* quadPoint( &M_faceQuadPoints[ 3 * position ] );
 
-                    // Current quadrature point
-                    KN<Real> quadPoint(3);
-
-                    // normal vector
-                    KN<Real> normal(3);
-
-                    for (UInt icoor(0); icoor<3; ++icoor)
-                    {
-                        quadPoint(icoor) = M_FESpace.feBd().quadPt( ig, icoor );
-                        normal(icoor)    = M_FESpace.feBd().normal( icoor, ig ) ;
-                    }
-
-                    // Compute the boundary contribution
-                    rightValue[0] = bcBase( M_data.dataTime()->time(), quadPoint(0), quadPoint(1), quadPoint(2), 0 );
-
-                    const Real localFaceFlux = M_numericalFlux->firstDerivativePhysicalFluxDotNormal ( normal,
-                                                                                                       iElem,
-                                                                                                       M_data.dataTime()->time(),
-                                                                                                       quadPoint(0),
-                                                                                                       quadPoint(1),
-                                                                                                       quadPoint(2),
-                                                                                                       rightValue[ 0 ] );
-                    // Update the local flux of the current face with the quadrature weight
-                    localFaceFluxWeight[0] += localFaceFlux * M_FESpace.feBd().weightMeas( ig );
+                // normal vector
+                KN<Real> normal(3);
+                for ( UInt icoor(0); icoor < 3; ++icoor )
+                {
+                    normal( icoor ) = M_faceNormals[ 3 * position + icoor ];
                 }
 
-            }
-            else
-            {
-                /* If the boundary flag is not Essential then is automatically an outflow boundary.
-                   We impose to localFaceFluxWeight a positive value. */
-                localFaceFluxWeight[0] = 1.;
-            }
-
-            // It is an outflow face, we use a ghost cell
-            if ( localFaceFluxWeight[0] > 1e-4 )
-            {
-                rightValue = leftValue;
+                // Compute the boundary contribution
+                rightValue[0] = bcBase( M_data.dataTime()->time(), quadPoint[0], quadPoint[1], quadPoint[2], 0 );
+
+                const Real localFaceFlux = M_numericalFlux->firstDerivativePhysicalFluxDotNormal ( normal,
+                                                                                                   leftElement,
+                                                                                                   M_data.dataTime()->time(),
+                                                                                                   quadPoint[0],
+                                                                                                   quadPoint[1],
+                                                                                                   quadPoint[2],
+                                                                                                   rightValue[ 0 ] );
+                // Update the local flux of the current face with the quadrature weight
+                localFaceFluxWeight += localFaceFlux * M_faceWeightMeas[ position ];
             }
 
-            // Clean the localFaceFluxWeight
-            localFaceFluxWeight.zero();
-
+        }
+        else
+        {
+            /* If the boundary flag is not Essential then is automatically an outflow boundary.
+               We impose to localFaceFluxWeight a positive value. */
+            localFaceFluxWeight = 1.;
         }
 
-        // Clean the localFaceFluxWeight
-        localFaceFluxWeight.zero();
-
-        // Loop on all the quadrature points
-        for ( UInt ig(0); ig < M_FESpace.feBd().nbQuadPt(); ++ig )
+        // It is an outflow face, we use a ghost cell
+        if ( localFaceFluxWeight > 1e-4 )
         {
+            rightValue = leftValue;
+        }
 
-            // Current quadrature point
-            KN<Real> quadPoint(3);
+    }
 
-            // normal vector
-            KN<Real> normal(3);
+    // Numerical flux integrated on the face, with the normal from the left to the right element.
+    // One call for all the quadrature nodes, the policy fluxes evaluate them without virtual calls.
+    const UInt position( iFace * M_faceNbQuadPt );
+    M_faceFlux[ iFace ] = M_numericalFlux->faceFlux( leftValue[ 0 ],
+                                                     rightValue[ 0 ],
+                                                     &M_faceNormals[ 3 * position ],
+                                                     &M_faceQuadPoints[ 3 * position ],
+                                                     &M_faceWeightMeas[ position ],
+                                                     M_faceNbQuadPt,
+                                                     leftElement,
+                                                     M_data.dataTime()->time() );
 
-            for (UInt icoor(0); icoor<3; ++icoor)
-            {
-                quadPoint(icoor) = M_FESpace.feBd().quadPt( ig, icoor );
-                normal(icoor)    = M_FESpace.feBd().normal( icoor, ig ) ;
-            }
+} // localFaceFlux
 
-            // If the normal is orientated inward, we change its sign and swap the left and value of the solution
-            if ( iElem == rightElement )
-            {
-                normal *= -1.;
-                std::swap( leftValue, rightValue );
-            }
+// Compute the local contribute
+template< typename Mesh, typename SolverType >
+void
+HyperbolicSolver< Mesh, SolverType >::
+localEvolve ( const UInt& iElem )
+{
 
-            const Real localFaceFlux = (*M_numericalFlux)( leftValue[ 0 ],
-                                                           rightValue[ 0 ],
-                                                           normal,
-                                                           iElem,
-                                                           M_data.dataTime()->time(),
-                                                           quadPoint(0),
-                                                           quadPoint(1),
-                                                           quadPoint(2) );
+    // LAPACK wrapper of Epetra
+    Epetra_LAPACK lapack;
 
-            // Update the local flux of the current face with the quadrature weight
-            localFaceFluxWeight[0] += localFaceFlux * M_FESpace.feBd().weightMeas( ig );
+    // Flags for LAPACK routines.
+    Int INFO[1]  = { 0 };
+    Int NB = M_FESpace.refFE().nbDof();
 
-        }
+    // Parameter that indicate the Lower storage of matrices.
+    char param_L = 'L';
+    char param_N = 'N';
 
-        /* Put in localFlux the vector L^{-1} * localFlux
-           For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-        lapack.TRTRS( param_L, param_N, param_N, NB, NBRHS, M_elmatMass[ iElem ].mat(), NB, localFaceFluxWeight, NB, INFO);
-        ASSERT_PRE( !INFO[0], "Lapack Computation M_elvecSource = LB^{-1} rhs is not achieved." );
+    // Paramater that indicate the Transpose of matrices.
+    char param_T = 'T';
 
-        /* Put in localFlux the vector L^{-T} * localFlux
-           For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
-        lapack.TRTRS( param_L, param_T, param_N, NB, NBRHS, M_elmatMass[ iElem ].mat(), NB, localFaceFluxWeight, NB, INFO);
-        ASSERT_PRE( !INFO[0], "Lapack Computation M_elvecSource = LB^{-1} rhs is not achieved." );
+    // Numbers of columns of the right hand side := 1.
+    Int NBRHS = 1;
 
-        // Add to the local flux the local flux of the current face
-        M_localFlux += localFaceFluxWeight;
+    // Clean the local flux
+    M_localFlux.zero();
 
+    // Loop on the faces of the element iElem and collect the fluxes computed in localFaceFlux
+    for ( UInt iFace(0); iFace < M_FESpace.mesh()->numLocalFaces(); ++iFace )
+    {
+        // Id mapping
+        const UInt iGlobalFace( M_FESpace.mesh()->localFacetId( iElem, iFace ) );
+
+        // The flux is computed with the normal going from the left to the right element
+        if ( iElem == M_FESpace.mesh()->faceElement( iGlobalFace, 1 ) )
+        {
+            M_localFlux[ 0 ] -= M_faceFlux[ iGlobalFace ];
+        }
+        else
+        {
+            M_localFlux[ 0 ] += M_faceFlux[ iGlobalFace ];
+        }
     }
 
+    /* Put in localFlux the vector L^{-1} * localFlux
+       For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
+    lapack.TRTRS( param_L, param_N, param_N, NB, NBRHS, M_elmatMass[ iElem ].mat(), NB, M_localFlux, NB, INFO);
+    ASSERT_PRE( !INFO[0], "Lapack Computation M_elvecSource = LB^{-1} rhs is not achieved." );
+
+    /* Put in localFlux the vector L^{-T} * localFlux
+       For more details see http://www.netlib.org/lapack/lapack-3.1.1/SRC/dtrtrs.f */
+    lapack.TRTRS( param_L, param_T, param_N, NB, NBRHS, M_elmatMass[ iElem ].mat(), NB, M_localFlux, NB, INFO);
+    ASSERT_PRE( !INFO[0], "Lapack Computation M_elvecSource = LB^{-1} rhs is not achieved." );
+
 } // localEvolve
 
 // Apply the flux limiters locally.
@@ -1081,6 +1202,49 @@ localAverage ( const UInt& /* iElem */ )
 
 } // localAverage
 
+// Fill the send buffer and start the exchange of the ghost values
+template< typename Mesh, typename SolverType >
+void
+HyperbolicSolver< Mesh, SolverType >::
+startGhostExchange ()
+{
+
+    const std::vector<ID>& sendElements( M_ghostExchangePlan.sendElements() );
+    std::vector<Real>& sendBuffer( M_ghostExchangePlan.sendBuffer() );
+
+    VectorElemental ghostValue ( M_FESpace.refFE().nbDof(), 1 );
+
+    for ( UInt iSend(0); iSend < sendElements.size(); ++iSend )
+    {
+        extract_vec( *M_uOld, ghostValue, M_FESpace.refFE(), M_FESpace.dof(), sendElements[ iSend ], 0 );
+
+        // TODO: this works only for P0
+        sendBuffer[ iSend ] = ghostValue[ 0 ];
+    }
+
+    M_ghostExchangePlan.start();
+
+} // startGhostExchange
+
+// Wait the end of the exchange and store the ghost values
+template< typename Mesh, typename SolverType >
+void
+HyperbolicSolver< Mesh, SolverType >::
+endGhostExchange ()
+{
+
+    M_ghostExchangePlan.wait();
+
+    const std::vector<ID>& recvFacets( M_ghostExchangePlan.recvFacets() );
+    const std::vector<Real>& recvBuffer( M_ghostExchangePlan.recvBuffer() );
+
+    for ( UInt iRecv(0); iRecv < recvFacets.size(); ++iRecv )
+    {
+        M_ghostDataMap[ recvFacets[ iRecv ] ] = recvBuffer[ iRecv ];
+    }
+
+} // endGhostExchange
+
 } // namespace LifeV
 
 #endif /*_HYPERBOLICSOLVER_H_ */
@@ -0,0 +1,360 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the interior penalty stabilization of ADRAssemblerIP
+
+    @date 19-10-2012
+
+    The Galerkin and extended stencil matrices assembled by ADRAssemblerIP, with the geometry
+    of the faces stored in an InteriorFacetCache, are compared with the assembly face by face,
+    where the quadrature of each face is taken back to the reference frames of the adjacent
+    elements to update CurrentFEs on them. The stabilization with and without the advection
+    field is tested, then the assembly with the advection field is repeated on the filled
+    matrices set to zero and after the mesh has been moved.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssemblerIP.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef ADRAssemblerIP<mesh_Type, matrix_Type, vector_Type> assembler_Type;
+
+namespace
+{
+
+const Real tolerance( 1e-12 );
+const Real coefficient( 0.7 );
+
+Real advectionField( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    switch ( i )
+    {
+    case 0:
+        return std::sin( y ) + z * z;
+    case 1:
+        return x * z - 0.5;
+    default:
+        return std::cos( x + y );
+    }
+}
+
+// Mapping used to move the mesh, the elements remain valid
+struct MeshMapping
+{
+    void operator() ( Real& x, Real& y, Real& z ) const
+    {
+        const Real xOld( x ), yOld( y );
+        x = xOld + 0.1 * yOld * z;
+        y = yOld + 0.05 * xOld * xOld;
+        z = z + 0.08 * xOld * yOld;
+    }
+};
+
+// Assembly face by face: the quadrature of the face is taken back to the reference frame of
+// each adjacent element. Without the advection field (beta == 0), |beta n| is replaced by one.
+void referenceAssembly( matrix_Type& matrixGalerkin, matrix_Type& matrixExtended,
+                        feSpace_Type& fespace, const feSpace_Type& betaFESpace, const vector_Type* beta )
+{
+    const mesh_Type& mesh( *fespace.mesh() );
+
+    const UInt nbQuadPt( fespace.bdQr().nbQuadPt() );
+    const UInt nbLocalDof( fespace.fe().nbFEDof() );
+    const UInt nbComponents( fespace.fieldDim() );
+    const UInt nbTotalDof( fespace.dof().numTotalDof() );
+
+    CurrentBoundaryFE faceFE( fespace.feBd().refFE, fespace.feBd().geoMap, fespace.feBd().qr );
+    CurrentFE quadFE( fespace.refFE(), getGeometricMap( mesh ), fespace.qr() );
+    CurrentFE sideFE1( fespace.refFE(), getGeometricMap( mesh ), fespace.qr() );
+    CurrentFE sideFE2( fespace.refFE(), getGeometricMap( mesh ), fespace.qr() );
+    CurrentFE betaFE( betaFESpace.refFE(), getGeometricMap( mesh ), fespace.qr() );
+    CurrentFE* sideFE[ 2 ] = { &sideFE1, &sideFE2 };
+
+    MatrixElemental localMatrix( nbLocalDof, nbComponents, nbComponents );
+    std::vector<Real> betaN( nbQuadPt, 1. );
+
+    for ( UInt iFace( mesh.numBFaces() ); iFace < mesh.numFaces(); ++iFace )
+    {
+        const UInt element[ 2 ] = { mesh.face( iFace ).firstAdjacentElementIdentity(),
+                                    mesh.face( iFace ).secondAdjacentElementIdentity() };
+
+        if ( element[ 0 ] == NotAnId || element[ 1 ] == NotAnId || element[ 0 ] == element[ 1 ]
+             || ( beta && Flag::testOneSet( mesh.face( iFace ).flag(),
+                                            EntityFlags::SUBDOMAIN_INTERFACE | EntityFlags::PHYSICAL_BOUNDARY ) ) )
+        {
+            continue;
+        }
+
+        faceFE.updateMeasNormalQuadPt( mesh.face( iFace ) );
+        const Real hFace2( faceFE.measure() );
+
+        // Quadrature of the face in the reference frame of each adjacent element
+        QuadratureRule faceQR1( "custom quad 1", TETRA, 3, 0, 0 );
+        QuadratureRule faceQR2( "custom quad 2", TETRA, 3, 0, 0 );
+        QuadratureRule* faceQR[ 2 ] = { &faceQR1, &faceQR2 };
+
+        for ( UInt side( 0 ); side < 2; ++side )
+        {
+            quadFE.update( mesh.element( element[ side ] ), UPDATE_ONLY_CELL_NODES );
+            for ( UInt iQuadPt( 0 ); iQuadPt < nbQuadPt; ++iQuadPt )
+            {
+                Real x( 0. ), y( 0. ), z( 0. );
+                quadFE.coorBackMap( faceFE.quadPt( iQuadPt, 0 ), faceFE.quadPt( iQuadPt, 1 ), faceFE.quadPt( iQuadPt, 2 ),
+                                    x, y, z );
+                faceQR[ side ]->addPoint( QuadraturePoint( x, y, z, fespace.bdQr().weight( iQuadPt ) ) );
+            }
+            sideFE[ side ]->setQuadRule( *faceQR[ side ] );
+            sideFE[ side ]->update( mesh.element( element[ side ] ), UPDATE_DPHI | UPDATE_WDET );
+        }
+
+        // |beta n| in the quadrature nodes
+        if ( beta )
+        {
+            betaFE.setQuadRule( faceQR1 );
+            betaFE.update( mesh.element( element[ 0 ] ), UPDATE_PHI );
+
+            for ( UInt iQuadPt( 0 ); iQuadPt < nbQuadPt; ++iQuadPt )
+            {
+                betaN[ iQuadPt ] = 0.;
+                for ( UInt iDof( 0 ); iDof < betaFE.nbFEDof(); ++iDof )
+                {
+                    for ( UInt iDim( 0 ); iDim < 3; ++iDim )
+                    {
+                        betaN[ iQuadPt ] += ( *beta )[ betaFESpace.dof().localToGlobalMap( element[ 0 ], iDof )
+                                                       + betaFESpace.dof().numTotalDof() * iDim ]
+                                            * betaFE.phi( iDof, iQuadPt ) * faceFE.normal( iDim, iQuadPt );
+                    }
+                }
+                betaN[ iQuadPt ] = std::fabs( betaN[ iQuadPt ] );
+            }
+        }
+
+        // The two sides with themselves go in the Galerkin stencil, with a minus sign in the extended stencil
+        // otherwise. The jacobian of the first element is used, except for the second side with itself.
+        for ( UInt side1( 0 ); side1 < 2; ++side1 )
+            for ( UInt side2( 0 ); side2 < 2; ++side2 )
+            {
+                const CurrentFE& weightFE( *sideFE[ side1 == side2 ? side1 : 0 ] );
+                const Real sign( side1 == side2 ? 1. : -1. );
+
+                localMatrix.zero();
+                for ( UInt iFieldDim( 0 ); iFieldDim < nbComponents; ++iFieldDim )
+                {
+                    MatrixElemental::matrix_view view( localMatrix.block( iFieldDim, iFieldDim ) );
+                    for ( UInt iDof( 0 ); iDof < nbLocalDof; ++iDof )
+                        for ( UInt jDof( 0 ); jDof < nbLocalDof; ++jDof )
+                        {
+                            Real value( 0. );
+                            for ( UInt iQuadPt( 0 ); iQuadPt < nbQuadPt; ++iQuadPt )
+                                for ( UInt iDim( 0 ); iDim < 3; ++iDim )
+                                {
+                                    value += betaN[ iQuadPt ]
+                                             * sideFE[ side1 ]->dphi( iDof, iDim, iQuadPt )
+                                             * sideFE[ side2 ]->dphi( jDof, iDim, iQuadPt )
+                                             * weightFE.wDetJacobian( iQuadPt );
+                                }
+                            view( iDof, jDof ) += sign * coefficient * hFace2 * value;
+                        }
+                }
+
+                for ( UInt iFieldDim( 0 ); iFieldDim < nbComponents; ++iFieldDim )
+                {
+                    assembleMatrix( side1 == side2 ? matrixGalerkin : matrixExtended, localMatrix,
+                                    *sideFE[ side1 ], *sideFE[ side2 ], fespace.dof(), fespace.dof(),
+                                    iFieldDim, iFieldDim, iFieldDim * nbTotalDof, iFieldDim * nbTotalDof );
+                }
+            }
+    }
+}
+
+// Relative difference of two assembled matrices
+Real relativeDifference( const MapEpetra& map, const matrix_Type& reference, const matrix_Type& other )
+{
+    matrix_Type difference( map );
+    difference += reference;
+    difference.add( -1., other );
+    difference.globalAssemble();
+    return difference.normInf() / reference.normInf();
+}
+
+// Compare the Galerkin and the extended stencil matrices
+bool compareAssemblies( const std::string& name, feSpacePtr_Type& fespace, const feSpacePtr_Type& betaFESpace,
+                        const matrixPtr_Type& matrixGalerkin, const matrixPtr_Type& matrixExtended,
+                        const vector_Type* beta, const bool& verbose )
+{
+    matrixGalerkin->globalAssemble();
+    matrixExtended->globalAssemble();
+
+    matrix_Type referenceGalerkin( fespace->map() );
+    matrix_Type referenceExtended( fespace->map() );
+    referenceAssembly( referenceGalerkin, referenceExtended, *fespace, *betaFESpace, beta );
+    referenceGalerkin.globalAssemble();
+    referenceExtended.globalAssemble();
+
+    const Real galerkinDifference( relativeDifference( fespace->map(), referenceGalerkin, *matrixGalerkin ) );
+    const Real extendedDifference( relativeDifference( fespace->map(), referenceExtended, *matrixExtended ) );
+
+    if ( verbose ) std::cout << " ---> " << fespace->refFE().name() << ", " << name
+                             << ", difference of the Galerkin stencil : " << galerkinDifference
+                             << ", of the extended stencil : " << extendedDifference << std::endl;
+
+    return galerkinDifference < tolerance && extendedDifference < tolerance;
+}
+
+// Test the assemblies for a finite element space
+bool testSpace( feSpacePtr_Type& fespace, const feSpacePtr_Type& betaFESpace, const bool& verbose )
+{
+    assembler_Type ipAssembler;
+    ipAssembler.setup( fespace, betaFESpace );
+
+    vector_Type beta( betaFESpace->map(), Unique );
+    betaFESpace->interpolate( static_cast<feSpace_Type::function_Type>( advectionField ), beta, 0.0 );
+    const vector_Type betaRepeated( beta, Repeated );
+
+    bool success( true );
+
+    // Without the advection field
+    {
+        matrixPtr_Type matrixGalerkin( new matrix_Type( fespace->map() ) );
+        matrixPtr_Type matrixExtended( new matrix_Type( fespace->map() ) );
+        ipAssembler.addIPStabilizationStencil( matrixGalerkin, matrixExtended, coefficient );
+        success &= compareAssemblies( "without advection", fespace, betaFESpace, matrixGalerkin, matrixExtended, 0, verbose );
+    }
+
+    // With the advection field, on new matrices, on the same matrices filled and after moving the mesh
+    matrixPtr_Type matrixGalerkin( new matrix_Type( fespace->map() ) );
+    matrixPtr_Type matrixExtended( new matrix_Type( fespace->map() ) );
+
+    for ( UInt iCase( 0 ); iCase < 3; ++iCase )
+    {
+        if ( iCase > 0 )
+        {
+            matrixGalerkin->zero();
+            matrixExtended->zero();
+        }
+        if ( iCase == 2 )
+        {
+            fespace->mesh()->meshTransformer().transformMesh( MeshMapping() );
+        }
+
+        ipAssembler.addIPStabilizationStencil( matrixGalerkin, matrixExtended, beta, coefficient );
+        success &= compareAssemblies( iCase == 0 ? "with advection" : iCase == 1 ? "filled matrices" : "moved mesh",
+                                      fespace, betaFESpace, matrixGalerkin, matrixExtended, &betaRepeated, verbose );
+    }
+
+    return success;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    bool success( true );
+
+    // P2 scalar unknown and P1 vector unknown, the advection field is P1
+    const std::string orders[ 2 ] = { "P2", "P1" };
+    const UInt fieldDims[ 2 ] = { 1, 3 };
+
+    for ( UInt iSpace( 0 ); iSpace < 2; ++iSpace )
+    {
+        // Each space moves its own mesh
+        boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+        regularMesh3D( *fullMeshPtr, 1, 4, 4, 4, false,
+                       2.0,   2.0,   2.0,
+                       -1.0,  -1.0,  -1.0 );
+
+        boost::shared_ptr< mesh_Type > meshPtr;
+        {
+            MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+            meshPtr = meshPart.meshPartition();
+        }
+        fullMeshPtr.reset();
+
+        feSpacePtr_Type fespace( new feSpace_Type( meshPtr, orders[ iSpace ], fieldDims[ iSpace ], Comm ) );
+        feSpacePtr_Type betaFESpace( new feSpace_Type( meshPtr, "P1", 3, Comm ) );
+
+        success &= testSpace( fespace, betaFESpace, verbose );
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
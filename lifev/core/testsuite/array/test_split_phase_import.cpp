@@ -0,0 +1,225 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+
+/*!
+    @file
+    @brief Test of the split-phase import and export of the VectorEpetra
+
+    @date 19-10-2012
+
+    The import (beginImport and endImport) and the export (beginExport and endExport) are
+    compared with the conversions of the vectors done by the constructors of VectorEpetra,
+    twice to use the buffers kept by the map. The advection matrix and the mass right hand
+    side assembled by ADRAssembler with the overlapped import are then compared with the
+    ones assembled without it.
+
+    The test runs on one process as well, where the maps are not distributed.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef ADRAssembler<mesh_Type, matrix_Type, vector_Type> assembler_Type;
+
+namespace
+{
+
+Real testFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    return std::sin( x + 2 * y ) + z * z + i;
+}
+
+// Relative difference of two vectors
+Real relativeDifference( const vector_Type& reference, const vector_Type& other )
+{
+    vector_Type difference( reference );
+    difference -= other;
+    return difference.normInf() / reference.normInf();
+}
+
+// Assemble the advection matrix and the mass right hand side and apply the matrix to the vector x
+vector_Type assembleAndApply( const feSpacePtr_Type& uFESpace, const feSpacePtr_Type& betaFESpace,
+                              const vector_Type& beta, const vector_Type& f, const vector_Type& x,
+                              const bool& overlappedImport, vector_Type& rightHandSide )
+{
+    assembler_Type adrAssembler;
+    adrAssembler.setup( uFESpace, betaFESpace );
+    adrAssembler.setOverlappedImport( overlappedImport );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addAdvection( systemMatrix, beta );
+    systemMatrix->globalAssemble();
+
+    vector_Type rightHandSideRepeated( uFESpace->map(), Repeated );
+    adrAssembler.addMassRhs( rightHandSideRepeated, f );
+    rightHandSideRepeated.globalAssemble();
+    rightHandSide = vector_Type( rightHandSideRepeated, Unique );
+
+    return *systemMatrix * x;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    const UInt Nelements( 6 );
+    const Real tolerance( 1e-12 );
+
+    bool success( true );
+
+// Build and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   2.0,   2.0,   2.0,
+                   -1.0,  -1.0,  -1.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, "P2", 1, Comm ) );
+    feSpacePtr_Type betaFESpace( new feSpace_Type( meshPtr, "P1", 3, Comm ) );
+
+    if ( verbose ) std::cout << " ---> Interior elements : " << betaFESpace->interiorElements().size()
+                             << ", interface elements : " << betaFESpace->interfaceElements().size() << std::endl;
+
+// Compare the import and the export with the conversions
+
+    vector_Type beta( betaFESpace->map(), Unique );
+    betaFESpace->interpolate( static_cast<feSpace_Type::function_Type>( testFunction ), beta, 0.0 );
+
+    for ( UInt iExchange(0); iExchange < 2; ++iExchange )
+    {
+        vector_Type uniqueVector( beta );
+        uniqueVector *= 1. + iExchange;
+
+        const vector_Type repeatedReference( uniqueVector, Repeated );
+
+        vector_Type repeatedVector( betaFESpace->map(), Repeated );
+        repeatedVector.beginImport( uniqueVector );
+        repeatedVector.endImport();
+
+        const Real importDifference( relativeDifference( repeatedReference, repeatedVector ) );
+        if ( verbose ) std::cout << " ---> Import " << iExchange << ", difference : " << importDifference << std::endl;
+        success &= importDifference < tolerance;
+
+        // The repeated values are summed by the export
+        const vector_Type uniqueReference( repeatedReference, Unique );
+
+        vector_Type exportedVector( betaFESpace->map(), Unique );
+        exportedVector.beginExport( repeatedReference );
+        exportedVector.endExport();
+
+        const Real exportDifference( relativeDifference( uniqueReference, exportedVector ) );
+        if ( verbose ) std::cout << " ---> Export " << iExchange << ", difference : " << exportDifference << std::endl;
+        success &= exportDifference < tolerance;
+    }
+
+// Compare the assembly with and without the overlapped import
+
+    vector_Type f( uFESpace->map(), Unique );
+    uFESpace->interpolate( static_cast<feSpace_Type::function_Type>( testFunction ), f, 0.0 );
+
+    vector_Type x( uFESpace->map(), Unique );
+    x.epetraVector().Random();
+
+    vector_Type rightHandSide( uFESpace->map(), Unique );
+    vector_Type overlappedRightHandSide( uFESpace->map(), Unique );
+
+    const vector_Type reference( assembleAndApply( uFESpace, betaFESpace, beta, f, x, false, rightHandSide ) );
+    const vector_Type overlapped( assembleAndApply( uFESpace, betaFESpace, beta, f, x, true, overlappedRightHandSide ) );
+
+    const Real matrixDifference( relativeDifference( reference, overlapped ) );
+    const Real rightHandSideDifference( relativeDifference( rightHandSide, overlappedRightHandSide ) );
+    if ( verbose ) std::cout << " ---> Overlapped import, advection difference : " << matrixDifference
+                             << ", mass right hand side difference : " << rightHandSideDifference << std::endl;
+    success &= matrixDifference < tolerance;
+    success &= rightHandSideDifference < tolerance;
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,202 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the batched assembly of ADRAssembler
+
+    @date 19-10-2012
+
+    The mass, diffusion and advection matrices are assembled with ADRAssembler with and without
+    the batched assembly (see CurrentFEBatch and AssemblyElementalBatched.hpp) for P1 and P2
+    elements, and compared. The number of elements is chosen not to be a multiple of
+    CurrentFEBatch::S_batchSize, so that the last batch is partially filled.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/CurrentFEBatch.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef ADRAssembler<mesh_Type, matrix_Type, vector_Type> assembler_Type;
+
+namespace
+{
+
+Real testFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& /* i */ )
+{
+    return std::sin( x + 2 * y ) + z * z;
+}
+
+Real betaFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    switch ( i )
+    {
+    case 0:
+        return 1. + y;
+    case 1:
+        return z - x;
+    default:
+        return 0.5;
+    }
+}
+
+// Assemble the mass, diffusion and advection matrices and apply them to the vector x
+vector_Type assembleAndApply( const feSpacePtr_Type& uFESpace, const feSpacePtr_Type& betaFESpace,
+                              const vector_Type& x, const bool& batchedAssembly )
+{
+    assembler_Type adrAssembler;
+    adrAssembler.setup( uFESpace, betaFESpace );
+    adrAssembler.setBatchedAssembly( batchedAssembly );
+
+    vector_Type beta( betaFESpace->map(), Repeated );
+    betaFESpace->interpolate( static_cast<feSpace_Type::function_Type>( betaFunction ), beta, 0.0 );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addMass( systemMatrix, 2.0 );
+    adrAssembler.addDiffusion( systemMatrix, 0.5 );
+    adrAssembler.addAdvection( systemMatrix, beta );
+    systemMatrix->globalAssemble();
+
+    return *systemMatrix * x;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    const Real tolerance( 1e-12 );
+
+    bool success( true );
+
+// Build the mesh, with a number of elements that is not a multiple of the batch size
+
+    UInt Nelements( 5 );
+    while ( ( 6 * Nelements * Nelements * Nelements ) % CurrentFEBatch::S_batchSize == 0 )
+    {
+        ++Nelements;
+    }
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   2.0,   2.0,   2.0,
+                   -1.0,  -1.0,  -1.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    if ( verbose ) std::cout << " ---> Elements : " << meshPtr->numElements()
+                             << ", batch size : " << CurrentFEBatch::S_batchSize << std::endl;
+
+    if ( Comm->NumProc() == 1 && meshPtr->numElements() % CurrentFEBatch::S_batchSize == 0 )
+    {
+        if ( verbose ) std::cout << " <!> The last batch is full, the test is not meaningful <!> " << std::endl;
+        success = false;
+    }
+
+// Compare the batched and the non batched assembly
+
+    feSpacePtr_Type betaFESpace( new feSpace_Type( meshPtr, "P1", 3, Comm ) );
+
+    const std::string spaces[] = { "P1", "P2" };
+    for ( UInt iSpace(0); iSpace < 2; ++iSpace )
+    {
+        feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, spaces[ iSpace ], 1, Comm ) );
+
+        vector_Type x( uFESpace->map(), Unique );
+        uFESpace->interpolate( static_cast<feSpace_Type::function_Type>( testFunction ), x, 0.0 );
+
+        const vector_Type reference( assembleAndApply( uFESpace, betaFESpace, x, false ) );
+        vector_Type difference( assembleAndApply( uFESpace, betaFESpace, x, true ) );
+        difference -= reference;
+
+        const Real relativeDifference( difference.normInf() / reference.normInf() );
+        if ( verbose ) std::cout << " ---> " << spaces[ iSpace ] << ", difference : " << relativeDifference << std::endl;
+        success &= relativeDifference < tolerance;
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
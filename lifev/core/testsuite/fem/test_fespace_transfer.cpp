@@ -0,0 +1,242 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the transfer of finite element functions between two meshes
+
+    @date 19-10-2012
+
+    A linear vector field is interpolated in a P2 space on a structured tetrahedral mesh and
+    transferred by FESpaceTransfer to the spaces of a finer mesh, inside the first one and
+    partitioned differently. The interpolation in P1 and P2 gives the exact nodal values.
+    The lumped L2 projection in P1 transfers the constants exactly, and for the linear field
+    the lumped mass times the result is the consistent mass matrix times the exact nodal values.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/FESpaceTransfer.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef boost::shared_ptr<mesh_Type> meshPtr_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef FESpaceTransfer<mesh_Type, mesh_Type> transfer_Type;
+typedef ADRAssembler<mesh_Type, matrix_Type, vector_Type> assembler_Type;
+
+namespace
+{
+
+const Real tolerance( 1e-10 );
+
+Real linearFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    return 1. + ( i + 1 ) * x - 2. * y + 0.5 * i * z;
+}
+
+Real constantFunction( const Real& /* t */, const Real& /* x */, const Real& /* y */, const Real& /* z */, const ID& i )
+{
+    return 2. - i;
+}
+
+// Structured mesh of the cube [origin, origin + length]^3, partitioned on the processes
+meshPtr_Type buildMesh( const UInt& numElements, const Real& length, const Real& origin,
+                        const boost::shared_ptr<Epetra_Comm>& comm )
+{
+    meshPtr_Type fullMeshPtr( new mesh_Type( comm ) );
+    regularMesh3D( *fullMeshPtr, 1, numElements, numElements, numElements, false,
+                   length, length, length, origin, origin, origin );
+
+    MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, comm );
+    return meshPart.meshPartition();
+}
+
+// Relative difference of two vectors
+Real relativeDifference( const vector_Type& reference, const vector_Type& other )
+{
+    vector_Type difference( reference );
+    difference -= other;
+    return difference.normInf() / reference.normInf();
+}
+
+// The points of the target space found in the source mesh, on all the processes
+bool allPointsFound( const transfer_Type& transfer, const Epetra_Comm& comm )
+{
+    Int localMissing( transfer.numMissingPoints() );
+    Int globalMissing( 0 );
+    comm.SumAll( &localMissing, &globalMissing, 1 );
+    return globalMissing == 0;
+}
+
+// Transfer of the source function by interpolation, compared with the exact nodal values
+bool checkInterpolation( const feSpacePtr_Type& sourceFESpace, const feSpacePtr_Type& targetFESpace,
+                         const vector_Type& source, const bool& verbose )
+{
+    transfer_Type transfer( sourceFESpace, targetFESpace );
+    transfer.setup( transfer_Type::Interpolation );
+
+    vector_Type target( targetFESpace->map(), Unique );
+    transfer.transfer( source, target );
+
+    vector_Type exact( targetFESpace->map(), Unique );
+    targetFESpace->interpolate( static_cast<feSpace_Type::function_Type>( linearFunction ), exact, 0.0 );
+
+    const bool found( allPointsFound( transfer, targetFESpace->map().comm() ) );
+    const Real difference( relativeDifference( exact, target ) );
+
+    if ( verbose ) std::cout << " ---> Interpolation in " << targetFESpace->refFE().name()
+                             << ", all the nodes found : " << found << ", difference : " << difference << std::endl;
+
+    return found && difference < tolerance;
+}
+
+// Transfer by lumped L2 projection of a constant and of a linear source function
+bool checkL2Projection( const feSpacePtr_Type& sourceFESpace, const feSpacePtr_Type& targetFESpace, const bool& verbose )
+{
+    transfer_Type transfer( sourceFESpace, targetFESpace );
+    transfer.setup( transfer_Type::L2Projection );
+
+    const bool found( allPointsFound( transfer, targetFESpace->map().comm() ) );
+
+    // The constants are transferred exactly
+    vector_Type source( sourceFESpace->map(), Unique );
+    sourceFESpace->interpolate( static_cast<feSpace_Type::function_Type>( constantFunction ), source, 0.0 );
+
+    vector_Type target( targetFESpace->map(), Unique );
+    transfer.transfer( source, target );
+
+    vector_Type exact( targetFESpace->map(), Unique );
+    targetFESpace->interpolate( static_cast<feSpace_Type::function_Type>( constantFunction ), exact, 0.0 );
+
+    const Real constantDifference( relativeDifference( exact, target ) );
+
+    // For the linear function, the lumped mass times the projection is the consistent mass matrix
+    // times the exact nodal values, since the mixed mass matrix is exact
+    sourceFESpace->interpolate( static_cast<feSpace_Type::function_Type>( linearFunction ), source, 0.0 );
+    transfer.transfer( source, target );
+
+    targetFESpace->interpolate( static_cast<feSpace_Type::function_Type>( linearFunction ), exact, 0.0 );
+
+    assembler_Type adrAssembler;
+    adrAssembler.setup( targetFESpace, targetFESpace );
+
+    matrixPtr_Type massMatrix( new matrix_Type( targetFESpace->map() ) );
+    adrAssembler.addMass( massMatrix );
+    massMatrix->globalAssemble();
+
+    vector_Type ones( targetFESpace->map(), Unique );
+    ones = 1.;
+
+    const vector_Type lumpedMass( *massMatrix * ones );
+    const Real linearDifference( relativeDifference( *massMatrix * exact, lumpedMass * target ) );
+
+    if ( verbose ) std::cout << " ---> L2 projection in " << targetFESpace->refFE().name()
+                             << ", all the nodes found : " << found << ", difference for the constant : " << constantDifference
+                             << ", for the linear function : " << linearDifference << std::endl;
+
+    return found && constantDifference < tolerance && linearDifference < tolerance;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    bool success( true );
+
+// Source mesh of [-1,1]^3 and finer target mesh of [-0.9,0.9]^3
+
+    const meshPtr_Type sourceMeshPtr( buildMesh( 3, 2.0, -1.0, Comm ) );
+    const meshPtr_Type targetMeshPtr( buildMesh( 5, 1.8, -0.9, Comm ) );
+
+    feSpacePtr_Type sourceFESpace( new feSpace_Type( sourceMeshPtr, "P2", 3, Comm ) );
+
+    vector_Type source( sourceFESpace->map(), Unique );
+    sourceFESpace->interpolate( static_cast<feSpace_Type::function_Type>( linearFunction ), source, 0.0 );
+
+    feSpacePtr_Type p1FESpace( new feSpace_Type( targetMeshPtr, "P1", 3, Comm ) );
+    feSpacePtr_Type p2FESpace( new feSpace_Type( targetMeshPtr, "P2", 3, Comm ) );
+
+    success &= checkInterpolation( sourceFESpace, p1FESpace, source, verbose );
+    success &= checkInterpolation( sourceFESpace, p2FESpace, source, verbose );
+    success &= checkL2Projection( sourceFESpace, p1FESpace, verbose );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,228 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the geometry cache of the FESpace
+
+    @date 19-10-2012
+
+    The mass, diffusion and advection matrices are assembled with ADRAssembler on a FESpace with
+    the geometry cache (see FESpace::setGeometryCache) and on a FESpace without it. The matrices
+    are compared at the first assembly (values stored in the cache), at the second assembly
+    (values read from the cache) and after moving the mesh with its MeshTransformer, which has to
+    invalidate the cache.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef ADRAssembler<mesh_Type, matrix_Type, vector_Type> assembler_Type;
+
+namespace
+{
+
+Real testFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& /* i */ )
+{
+    return std::sin( x + 2 * y ) + z * z;
+}
+
+Real betaFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    switch ( i )
+    {
+    case 0:
+        return 1. + y;
+    case 1:
+        return z - x;
+    default:
+        return 0.5;
+    }
+}
+
+// Mapping used to move the mesh, the elements remain valid
+struct MeshMapping
+{
+    void operator() ( Real& x, Real& y, Real& z ) const
+    {
+        const Real xOld( x ), yOld( y );
+        x = xOld + 0.1 * xOld * yOld;
+        y = yOld + 0.05 * z;
+        z = 1.2 * z;
+    }
+};
+
+// Assemble the mass, diffusion and advection matrices and apply them to the vector x
+vector_Type assembleAndApply( const feSpacePtr_Type& uFESpace, const feSpacePtr_Type& betaFESpace, const vector_Type& x )
+{
+    assembler_Type adrAssembler;
+    adrAssembler.setup( uFESpace, betaFESpace );
+
+    vector_Type beta( betaFESpace->map(), Repeated );
+    betaFESpace->interpolate( static_cast<feSpace_Type::function_Type>( betaFunction ), beta, 0.0 );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addMass( systemMatrix, 2.0 );
+    adrAssembler.addDiffusion( systemMatrix, 0.5 );
+    adrAssembler.addAdvection( systemMatrix, beta );
+    systemMatrix->globalAssemble();
+
+    return *systemMatrix * x;
+}
+
+// Relative difference of two vectors
+Real relativeDifference( const vector_Type& reference, const vector_Type& other )
+{
+    vector_Type difference( reference );
+    difference -= other;
+    return difference.normInf() / reference.normInf();
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    const UInt Nelements( 6 );
+    const Real tolerance( 1e-12 );
+
+    bool success( true );
+
+// Build and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   2.0,   2.0,   2.0,
+                   -1.0,  -1.0,  -1.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+// Build the FESpaces, with and without the geometry cache
+
+    feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, "P2", 1, Comm ) );
+    feSpacePtr_Type uFESpaceCache( new feSpace_Type( meshPtr, "P2", 1, Comm ) );
+    feSpacePtr_Type betaFESpace( new feSpace_Type( meshPtr, "P1", 3, Comm ) );
+    uFESpaceCache->setGeometryCache( true );
+
+    vector_Type x( uFESpace->map(), Unique );
+    uFESpace->interpolate( static_cast<feSpace_Type::function_Type>( testFunction ), x, 0.0 );
+
+// Compare the assembly with and without the cache
+
+    const vector_Type reference( assembleAndApply( uFESpace, betaFESpace, x ) );
+
+    // The first assembly stores the values in the cache, the second one reads them
+    for ( UInt iAssembly(0); iAssembly < 2; ++iAssembly )
+    {
+        const Real difference( relativeDifference( reference, assembleAndApply( uFESpaceCache, betaFESpace, x ) ) );
+        if ( verbose ) std::cout << " ---> Assembly " << iAssembly << " with the cache, difference : " << difference << std::endl;
+        success &= difference < tolerance;
+    }
+
+// Move the mesh, the cache has to be invalidated
+
+    const UInt geometryVersion( meshPtr->meshTransformer().geometryVersion() );
+    meshPtr->meshTransformer().transformMesh( MeshMapping() );
+    if ( meshPtr->meshTransformer().geometryVersion() == geometryVersion )
+    {
+        if ( verbose ) std::cout << " <!> The geometry version has not changed <!> " << std::endl;
+        success = false;
+    }
+
+    const vector_Type movedReference( assembleAndApply( uFESpace, betaFESpace, x ) );
+
+    // Check that the test is meaningful: the matrices on the moved mesh are different
+    const Real movedDifference( relativeDifference( reference, movedReference ) );
+    if ( verbose ) std::cout << " ---> Difference due to the mesh motion : " << movedDifference << std::endl;
+    success &= movedDifference > 1e-3;
+
+    const Real difference( relativeDifference( movedReference, assembleAndApply( uFESpaceCache, betaFESpace, x ) ) );
+    if ( verbose ) std::cout << " ---> Assembly with the cache after the motion, difference : " << difference << std::endl;
+    success &= difference < tolerance;
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,345 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the PointLocator on a partitioned hexahedral mesh
+
+    @date 19-10-2012
+
+    A linear vector field is interpolated in the Q1 space of a distorted structured hexahedral
+    mesh, so that the elements are not affine and their inversion requires the Newton iterations.
+    Each process gives its own list of points: points inside the elements of the whole mesh (most
+    of them owned by the other processes), points on the faces of the elements and points on both
+    sides of the faces between the partitions. The values computed by PointLocator::interpolate
+    and by the coefficients of PointLocator::interpolationCoefficients are compared with the
+    exact values of the linear field. The local elements are also located from their centers.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/PointLocator.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/MeshData.hpp>
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearHexa> mesh_Type;
+typedef boost::shared_ptr<mesh_Type> meshPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef PointLocator<mesh_Type> locator_Type;
+typedef locator_Type::point_Type point_Type;
+typedef locator_Type::pointList_Type pointList_Type;
+
+namespace
+{
+
+const Real tolerance( 1e-10 );
+
+// Linear field, reproduced exactly by the isoparametric Q1 elements
+Real linearFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    return 1. + ( i + 1. ) * x - 2. * y + 0.5 * i * z;
+}
+
+Real exactValue( const point_Type& point, const ID& i )
+{
+    return linearFunction( 0., point[0], point[1], point[2], i );
+}
+
+// Mapping used to distort the mesh, the elements remain valid
+struct MeshMapping
+{
+    void operator() ( Real& x, Real& y, Real& z ) const
+    {
+        const Real xOld( x ), yOld( y );
+        x = xOld + 0.1 * yOld * z;
+        y = yOld + 0.05 * xOld * xOld;
+        z = z + 0.08 * xOld * yOld;
+    }
+};
+
+// Image of a point of the reference element by the geometric map of an element
+point_Type physicalPoint( const mesh_Type& mesh, const UInt& iElement, const point_Type& referencePoint )
+{
+    const GeometricMap& geoMap( getGeometricMap( mesh ) );
+
+    point_Type point( 0., 0., 0. );
+    for ( UInt iPoint( 0 ); iPoint < geoMap.nbDof(); ++iPoint )
+    {
+        const Real phi( geoMap.phi( iPoint, referencePoint[0], referencePoint[1], referencePoint[2] ) );
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            point[iCoor] += phi * mesh.element( iElement ).point( iPoint ).coordinate( iCoor );
+        }
+    }
+    return point;
+}
+
+// Points of the whole mesh, each process takes a different subset of the elements
+void addMeshPoints( const mesh_Type& fullMesh, const Epetra_Comm& comm, pointList_Type& points )
+{
+    pointList_Type referencePoints;
+    referencePoints.push_back( point_Type( 0.3, 0.6, 0.2 ) );
+    referencePoints.push_back( point_Type( 0.5, 0.5, 0. ) );
+    referencePoints.push_back( point_Type( 1., 0.25, 0.75 ) );
+    referencePoints.push_back( point_Type( 0., 0., 0. ) );
+
+    for ( UInt iElement( comm.MyPID() ); iElement < fullMesh.numElements(); iElement += comm.NumProc() )
+    {
+        for ( UInt i( 0 ); i < referencePoints.size(); ++i )
+        {
+            points.push_back( physicalPoint( fullMesh, iElement, referencePoints[i] ) );
+        }
+    }
+}
+
+// Points on both sides of the faces between the local partition and the others
+void addInterfacePoints( const mesh_Type& mesh, pointList_Type& points )
+{
+    const point_Type elementCenter( 0.5, 0.5, 0.5 );
+
+    for ( UInt iFace( 0 ); iFace < mesh.numFaces(); ++iFace )
+    {
+        if ( !Flag::testOneSet( mesh.face( iFace ).flag(), EntityFlags::SUBDOMAIN_INTERFACE ) )
+        {
+            continue;
+        }
+
+        point_Type faceCenter( 0., 0., 0. );
+        for ( UInt iPoint( 0 ); iPoint < mesh_Type::facetShape_Type::S_numPoints; ++iPoint )
+        {
+            for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+            {
+                faceCenter[iCoor] += mesh.face( iFace ).point( iPoint ).coordinate( iCoor )
+                                     / mesh_Type::facetShape_Type::S_numPoints;
+            }
+        }
+
+        // The direction from the center of the local element to the face points outside the partition
+        const point_Type direction( faceCenter - physicalPoint( mesh, mesh.faceElement( iFace, 0 ), elementCenter ) );
+
+        points.push_back( faceCenter );
+        points.push_back( faceCenter + 1e-3 * direction );
+        points.push_back( faceCenter - 1e-3 * direction );
+    }
+}
+
+// Check the values interpolated by the locator
+bool checkInterpolate( const locator_Type& locator, const feSpacePtr_Type& feSpace, const vector_Type& u,
+                       const pointList_Type& points, const UInt& numOutsidePoints )
+{
+    std::vector<Real> values;
+    std::vector<bool> found;
+    locator.interpolate( *feSpace, u, points, values, found );
+
+    const UInt fieldDim( feSpace->fieldDim() );
+    const UInt numInsidePoints( points.size() - numOutsidePoints );
+
+    bool success( values.size() == fieldDim * points.size() && found.size() == points.size() );
+    for ( UInt iPoint( 0 ); success && iPoint < points.size(); ++iPoint )
+    {
+        const bool inside( iPoint < numInsidePoints );
+        success &= found[iPoint] == inside;
+        for ( UInt iComponent( 0 ); iComponent < fieldDim; ++iComponent )
+        {
+            const Real exact( inside ? exactValue( points[iPoint], iComponent ) : 0. );
+            success &= std::fabs( values[fieldDim * iPoint + iComponent] - exact ) < tolerance;
+        }
+    }
+
+    return success;
+}
+
+// Check the interpolation coefficients: the nodes of the Q1 space are the vertices of the mesh
+bool checkInterpolationCoefficients( const locator_Type& locator, const feSpacePtr_Type& feSpace,
+                                     const mesh_Type& fullMesh, const pointList_Type& points,
+                                     const UInt& numOutsidePoints )
+{
+    std::vector<ID> dofs;
+    std::vector<Real> weights;
+    std::vector<bool> found;
+    locator.interpolationCoefficients( *feSpace, points, dofs, weights, found );
+
+    const UInt numLocalDof( feSpace->dof().numLocalDof() );
+    const UInt numInsidePoints( points.size() - numOutsidePoints );
+
+    bool success( dofs.size() == numLocalDof * points.size() && weights.size() == dofs.size() );
+    for ( UInt iPoint( 0 ); success && iPoint < points.size(); ++iPoint )
+    {
+        const bool inside( iPoint < numInsidePoints );
+        success &= found[iPoint] == inside;
+
+        Real sum( 0. ), value( 0. );
+        for ( UInt iDof( 0 ); iDof < numLocalDof; ++iDof )
+        {
+            const UInt i( numLocalDof * iPoint + iDof );
+            sum += weights[i];
+            if ( inside )
+            {
+                success &= dofs[i] < fullMesh.numPoints();
+                const point_Type node( fullMesh.point( dofs[i] ).coordinate( 0 ),
+                                       fullMesh.point( dofs[i] ).coordinate( 1 ),
+                                       fullMesh.point( dofs[i] ).coordinate( 2 ) );
+                value += weights[i] * exactValue( node, 0 );
+            }
+        }
+
+        success &= std::fabs( sum - ( inside ? 1. : 0. ) ) < tolerance;
+        success &= std::fabs( value - ( inside ? exactValue( points[iPoint], 0 ) : 0. ) ) < tolerance;
+    }
+
+    return success;
+}
+
+// Locate the centers of the local elements
+bool checkLocate( const locator_Type& locator, const mesh_Type& mesh )
+{
+    const point_Type elementCenter( 0.5, 0.5, 0.5 );
+
+    bool success( true );
+    for ( UInt iElement( 0 ); iElement < mesh.numElements(); ++iElement )
+    {
+        point_Type referencePoint;
+        const ID element( locator.locate( physicalPoint( mesh, iElement, elementCenter ), referencePoint ) );
+
+        success &= element == iElement;
+        for ( UInt iCoor( 0 ); iCoor < 3; ++iCoor )
+        {
+            success &= std::fabs( referencePoint[iCoor] - 0.5 ) < tolerance;
+        }
+    }
+
+    return success;
+}
+
+// Collective result of a check
+bool allSucceeded( const Epetra_Comm& comm, const bool& localSuccess, const std::string& name, const bool& verbose )
+{
+    Int local( localSuccess ), global( 0 );
+    comm.MinAll( &local, &global, 1 );
+
+    if ( verbose ) std::cout << " ---> " << name << ( global ? " passed" : " failed" ) << std::endl;
+
+    return global == 1;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    bool success( true );
+
+// Read, distort and partition the structured hexahedral mesh, the full mesh is kept for the checks
+
+    GetPot dataFile( "./data" );
+    MeshData meshData( dataFile, "interpolate/space_discretization" );
+
+    meshPtr_Type fullMeshPtr( new mesh_Type( Comm ) );
+    readMesh( *fullMeshPtr, meshData );
+    fullMeshPtr->meshTransformer().transformMesh( MeshMapping() );
+
+    meshPtr_Type meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+
+// Linear vector field in the Q1 space
+
+    feSpacePtr_Type feSpace( new feSpace_Type( meshPtr, feHexaQ1, quadRuleHexa8pt, quadRuleQuad4pt, 3, Comm ) );
+
+    vector_Type u( feSpace->map(), Unique );
+    feSpace->interpolate( static_cast<feSpace_Type::function_Type>( linearFunction ), u, 0.0 );
+
+// Points of the current process, the points outside the mesh are at the end
+
+    pointList_Type points;
+    addMeshPoints( *fullMeshPtr, *Comm, points );
+    addInterfacePoints( *meshPtr, points );
+    points.push_back( point_Type( 2., 0.5, 0.5 ) );
+    points.push_back( point_Type( -0.5, -0.5, -0.5 ) );
+    const UInt numOutsidePoints( 2 );
+
+    locator_Type locator( meshPtr, Comm );
+    locator.setup();
+
+    success &= allSucceeded( *Comm, checkLocate( locator, *meshPtr ), "Location of the element centers", verbose );
+    success &= allSucceeded( *Comm, checkInterpolate( locator, feSpace, u, points, numOutsidePoints ),
+                             "Interpolation of the linear field", verbose );
+    success &= allSucceeded( *Comm, checkInterpolationCoefficients( locator, feSpace, *fullMeshPtr, points, numOutsidePoints ),
+                             "Interpolation coefficients", verbose );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
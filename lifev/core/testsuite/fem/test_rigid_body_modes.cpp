@@ -0,0 +1,252 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the rigid body modes of a finite element space
+
+    @date 19-10-2012
+
+    The linear elasticity matrix (stiff_strain and stiff_div, as in the structure solvers) and the
+    vector Laplacian are assembled without boundary conditions, for P1 and P2 vector fields on a
+    distorted structured tetrahedral mesh partitioned on the processes. The modes computed by
+    FESpace::rigidBodyModes must be in the kernel of the elasticity matrix, the translations
+    (rigidBodyModes without the rotations) in the kernel of the vector Laplacian, while the
+    rotations are not.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixElemental.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/Assembly.hpp>
+#include <lifev/core/fem/AssemblyElemental.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+
+namespace
+{
+
+const Real tolerance( 1e-12 );
+
+// Mapping used to distort the mesh, the elements remain valid
+struct MeshMapping
+{
+    void operator() ( Real& x, Real& y, Real& z ) const
+    {
+        const Real xOld( x ), yOld( y );
+        x = xOld + 0.1 * yOld * z;
+        y = yOld + 0.05 * xOld * xOld;
+        z = z + 0.08 * xOld * yOld;
+    }
+};
+
+// Assemble the linear elasticity matrix (elasticity) or the vector Laplacian, without boundary conditions
+matrixPtr_Type assembleMatrix( feSpace_Type& uFESpace, const bool& elasticity )
+{
+    const UInt totalDof( uFESpace.dof().numTotalDof() );
+    const UInt fieldDim( uFESpace.fieldDim() );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace.map() ) );
+    MatrixElemental elmat( uFESpace.fe().nbFEDof(), fieldDim, fieldDim );
+
+    for ( UInt iElement( 0 ); iElement < uFESpace.mesh()->numElements(); ++iElement )
+    {
+        uFESpace.fe().updateFirstDerivQuadPt( uFESpace.mesh()->element( iElement ) );
+        elmat.zero();
+
+        if ( elasticity )
+        {
+            stiff_strain( 2. * 0.8, elmat, uFESpace.fe() );
+            stiff_div( 1.3, elmat, uFESpace.fe() );
+        }
+        else
+        {
+            stiff( 0.8, elmat, uFESpace.fe(), 0, 0, fieldDim );
+        }
+
+        for ( UInt iComponent( 0 ); iComponent < fieldDim; ++iComponent )
+        {
+            for ( UInt jComponent( 0 ); jComponent < fieldDim; ++jComponent )
+            {
+                assembleMatrix( *systemMatrix, elmat, uFESpace.fe(), uFESpace.fe(), uFESpace.dof(), uFESpace.dof(),
+                                iComponent, jComponent, iComponent * totalDof, jComponent * totalDof );
+            }
+        }
+    }
+
+    systemMatrix->globalAssemble();
+
+    return systemMatrix;
+}
+
+// Relative norm of the product of the matrix with each mode, in the order of the modes
+std::vector<Real> modeResiduals( const matrix_Type& matrix, const feSpace_Type& uFESpace,
+                                 const std::vector<Real>& modes, const UInt& numModes )
+{
+    const UInt numRows( uFESpace.map().map( Unique )->NumMyElements() );
+
+    std::vector<Real> residuals( numModes );
+    for ( UInt iMode( 0 ); iMode < numModes; ++iMode )
+    {
+        vector_Type mode( uFESpace.map(), Unique );
+        for ( UInt iRow( 0 ); iRow < numRows; ++iRow )
+        {
+            mode.epetraVector()[0][iRow] = modes[ iMode * numRows + iRow ];
+        }
+
+        residuals[iMode] = ( matrix * mode ).normInf() / ( matrix.normInf() * mode.normInf() );
+    }
+
+    return residuals;
+}
+
+// Check the modes of a vector field with the elasticity matrix and the vector Laplacian
+bool checkModes( feSpace_Type& uFESpace, const bool& verbose )
+{
+    bool success( true );
+
+    const matrixPtr_Type elasticityMatrix( assembleMatrix( uFESpace, true ) );
+    const matrixPtr_Type laplacianMatrix( assembleMatrix( uFESpace, false ) );
+
+    // Translations and rotations
+    std::vector<Real> modes;
+    const UInt numModes( uFESpace.rigidBodyModes( modes ) );
+    success &= numModes == 6;
+
+    const std::vector<Real> elasticityResiduals( modeResiduals( *elasticityMatrix, uFESpace, modes, numModes ) );
+    const std::vector<Real> laplacianResiduals( modeResiduals( *laplacianMatrix, uFESpace, modes, numModes ) );
+
+    for ( UInt iMode( 0 ); iMode < numModes; ++iMode )
+    {
+        if ( verbose ) std::cout << " ---> " << uFESpace.refFE().name() << ", mode " << iMode
+                                 << ", elasticity : " << elasticityResiduals[iMode]
+                                 << ", vector Laplacian : " << laplacianResiduals[iMode] << std::endl;
+
+        success &= elasticityResiduals[iMode] < tolerance;
+
+        // The rotations are not in the kernel of the vector Laplacian
+        success &= ( iMode < 3 ) == ( laplacianResiduals[iMode] < tolerance );
+    }
+
+    // Translations only
+    std::vector<Real> translations;
+    const UInt numTranslations( uFESpace.rigidBodyModes( translations, uFESpace.map(), 0, false ) );
+    success &= numTranslations == 3;
+
+    const std::vector<Real> translationResiduals( modeResiduals( *laplacianMatrix, uFESpace, translations, numTranslations ) );
+    for ( UInt iMode( 0 ); iMode < numTranslations; ++iMode )
+    {
+        success &= translationResiduals[iMode] < tolerance;
+    }
+
+    return success;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    bool success( true );
+
+// Build, distort and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, 4, 4, 4, false,
+                   2.0,   2.0,   2.0,
+                   -1.0,  -1.0,  -1.0 );
+    fullMeshPtr->meshTransformer().transformMesh( MeshMapping() );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+// P1 and P2 vector fields
+
+    feSpace_Type p1FESpace( meshPtr, "P1", 3, Comm );
+    success &= checkModes( p1FESpace, verbose );
+
+    feSpace_Type p2FESpace( meshPtr, "P2", 3, Comm );
+    success &= checkModes( p2FESpace, verbose );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
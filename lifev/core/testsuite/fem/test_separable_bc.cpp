@@ -0,0 +1,274 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the boundary conditions given by a BCFunctionSeparable
+
+    @date 19-10-2012
+
+    The same Essential and Natural boundary data are given once as a BCFunctionBase and once
+    as a BCFunctionSeparable, whose spatial profiles are computed by BCHandler::bcUpdate.
+    The matrices and right hand sides obtained with bcManage are compared at several times,
+    then after moving the mesh with its MeshTransformer: the profiles on the quadrature nodes
+    of the Natural conditions have to be discarded.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/BCFunction.hpp>
+#include <lifev/core/fem/BCHandler.hpp>
+#include <lifev/core/fem/BCManage.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+
+namespace
+{
+
+Real timeCoefficientA( const Real& t )
+{
+    return std::cos( 3. * t );
+}
+
+Real timeCoefficientB( const Real& t )
+{
+    return 1. + t * t;
+}
+
+Real spatialProfileA( const Real& x, const Real& y, const Real& z, const ID& /* i */ )
+{
+    return std::sin( x + 2 * y ) + z;
+}
+
+Real spatialProfileB( const Real& x, const Real& y, const Real& z, const ID& /* i */ )
+{
+    return x * y - z * z;
+}
+
+// The same data as a generic function of time and space
+Real boundaryData( const Real& t, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    return timeCoefficientA( t ) * spatialProfileA( x, y, z, i ) + timeCoefficientB( t ) * spatialProfileB( x, y, z, i );
+}
+
+Real testFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& /* i */ )
+{
+    return 1. + x - y * z;
+}
+
+// Mapping used to move the mesh, the elements remain valid
+struct MeshMapping
+{
+    void operator() ( Real& x, Real& y, Real& z ) const
+    {
+        const Real xOld( x ), yOld( y );
+        x = xOld + 0.1 * xOld * yOld;
+        y = yOld + 0.05 * z;
+        z = 1.2 * z;
+    }
+};
+
+// Essential conditions on the bottom face, Natural conditions on the top and right faces
+void addBoundaryConditions( BCHandler& bcHandler, const BCFunctionBase& function )
+{
+    bcHandler.addBC( "Bottom", 5, Essential, Full, function, 1 );
+    bcHandler.addBC( "Top",    6, Natural,   Full, function, 1 );
+    bcHandler.addBC( "Right",  2, Natural,   Full, function, 1 );
+}
+
+// Prescribe the boundary conditions on the mass matrix and on a zero right hand side
+void applyBoundaryConditions( const feSpacePtr_Type& uFESpace, const BCHandler& bcHandler, const Real& time,
+                              const vector_Type& x, vector_Type& product, vector_Type& rightHandSide )
+{
+    ADRAssembler<mesh_Type, matrix_Type, vector_Type> adrAssembler;
+    adrAssembler.setup( uFESpace, uFESpace );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addMass( systemMatrix, 1.0 );
+    systemMatrix->globalAssemble();
+
+    rightHandSide = vector_Type( uFESpace->map(), Unique );
+    rightHandSide *= 0.;
+    bcManage( *systemMatrix, rightHandSide, *uFESpace->mesh(), uFESpace->dof(), bcHandler, uFESpace->feBd(), 1.0, time );
+
+    product = *systemMatrix * x;
+}
+
+// Relative difference of two vectors
+Real relativeDifference( const vector_Type& reference, const vector_Type& other )
+{
+    vector_Type difference( reference );
+    difference -= other;
+    return difference.normInf() / reference.normInf();
+}
+
+// Compare the generic and the separable boundary conditions at the given time
+bool compareBoundaryConditions( const feSpacePtr_Type& uFESpace, const BCHandler& genericHandler,
+                                const BCHandler& separableHandler, const Real& time, const vector_Type& x,
+                                const Real& tolerance, const bool& verbose, vector_Type& rightHandSide )
+{
+    vector_Type product( uFESpace->map(), Unique );
+    vector_Type separableProduct( uFESpace->map(), Unique );
+    vector_Type separableRightHandSide( uFESpace->map(), Unique );
+
+    applyBoundaryConditions( uFESpace, genericHandler, time, x, product, rightHandSide );
+    applyBoundaryConditions( uFESpace, separableHandler, time, x, separableProduct, separableRightHandSide );
+
+    const Real matrixDifference( relativeDifference( product, separableProduct ) );
+    const Real rhsDifference( relativeDifference( rightHandSide, separableRightHandSide ) );
+    if ( verbose ) std::cout << " ---> Time " << time << ", difference of the matrices : " << matrixDifference
+                             << ", of the right hand sides : " << rhsDifference << std::endl;
+
+    return matrixDifference < tolerance && rhsDifference < tolerance;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    const UInt Nelements( 6 );
+    const Real tolerance( 1e-12 );
+
+    bool success( true );
+
+// Build and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   2.0,   2.0,   2.0,
+                   -1.0,  -1.0,  -1.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, "P2", 1, Comm ) );
+
+    vector_Type x( uFESpace->map(), Unique );
+    uFESpace->interpolate( static_cast<feSpace_Type::function_Type>( testFunction ), x, 0.0 );
+
+// Build the boundary conditions with the generic and the separable functions
+
+    BCFunctionBase genericFunction( boundaryData );
+    BCFunctionSeparable separableFunction( timeCoefficientA, spatialProfileA );
+    separableFunction.addTerm( timeCoefficientB, spatialProfileB );
+
+    BCHandler genericHandler;
+    BCHandler separableHandler;
+    addBoundaryConditions( genericHandler, genericFunction );
+    addBoundaryConditions( separableHandler, separableFunction );
+
+    genericHandler.bcUpdate( *uFESpace->mesh(), uFESpace->feBd(), uFESpace->dof() );
+    separableHandler.bcUpdate( *uFESpace->mesh(), uFESpace->feBd(), uFESpace->dof() );
+
+// Compare the two paths at several times
+
+    vector_Type rightHandSide( uFESpace->map(), Unique );
+    const Real times[] = { 0., 0.3, 1.7 };
+    for ( UInt iTime( 0 ); iTime < 3; ++iTime )
+        success &= compareBoundaryConditions( uFESpace, genericHandler, separableHandler, times[ iTime ],
+                                              x, tolerance, verbose, rightHandSide );
+
+// Move the mesh, the profiles of the Natural conditions have to be discarded
+
+    const UInt geometryVersion( meshPtr->meshTransformer().geometryVersion() );
+    meshPtr->meshTransformer().transformMesh( MeshMapping() );
+    if ( meshPtr->meshTransformer().geometryVersion() == geometryVersion )
+    {
+        if ( verbose ) std::cout << " <!> The geometry version has not changed <!> " << std::endl;
+        success = false;
+    }
+
+    vector_Type movedRightHandSide( uFESpace->map(), Unique );
+    success &= compareBoundaryConditions( uFESpace, genericHandler, separableHandler, times[ 2 ],
+                                          x, tolerance, verbose, movedRightHandSide );
+
+    // Check that the test is meaningful: the Natural conditions on the moved mesh are different
+    const Real movedDifference( relativeDifference( rightHandSide, movedRightHandSide ) );
+    if ( verbose ) std::cout << " ---> Difference due to the mesh motion : " << movedDifference << std::endl;
+    success &= movedDifference > 1e-3;
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,236 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the global tensor product operators on a hexahedral mesh
+
+    @date 19-10-2012
+
+    The mass and stiffness matrices are assembled by ADRAssembler with CurrentFE and with
+    the tensor product assembly (see ADRAssembler::setTensorProductAssembly). Their products
+    with a vector are compared with each other and with the matrix free application of
+    TensorProductHexa::applyMass and TensorProductHexa::applyStiffness, for Q1 (vector field)
+    and Q2 (scalar field) on a distorted structured hexahedral mesh partitioned on the processes.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+#include <lifev/core/fem/TensorProductHexa.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/MeshData.hpp>
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearHexa> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef ADRAssembler<mesh_Type, matrix_Type, vector_Type> assembler_Type;
+
+namespace
+{
+
+const Real tolerance( 1e-12 );
+
+Real testFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    return std::sin( x + 2 * y ) + z * z + i * x * y;
+}
+
+// Mapping used to distort the mesh, the elements remain valid
+struct MeshMapping
+{
+    void operator() ( Real& x, Real& y, Real& z ) const
+    {
+        const Real xOld( x ), yOld( y );
+        x = xOld + 0.1 * yOld * z;
+        y = yOld + 0.05 * xOld * xOld;
+        z = z + 0.08 * xOld * yOld;
+    }
+};
+
+// Assemble the mass (operator 0) or the stiffness (operator 1) matrix and apply it to x
+vector_Type assembleAndApply( const feSpacePtr_Type& uFESpace, const UInt& iOperator,
+                              const bool& tensorProduct, const vector_Type& x )
+{
+    assembler_Type adrAssembler;
+    adrAssembler.setup( uFESpace, uFESpace );
+    adrAssembler.setTensorProductAssembly( tensorProduct );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace->map() ) );
+    if ( iOperator == 0 )
+    {
+        adrAssembler.addMass( systemMatrix, 1.5 );
+    }
+    else
+    {
+        adrAssembler.addDiffusion( systemMatrix, 0.7 );
+    }
+    systemMatrix->globalAssemble();
+
+    return *systemMatrix * x;
+}
+
+// Matrix free application of the mass (operator 0) or the stiffness (operator 1) matrix to x
+vector_Type applyMatrixFree( const feSpacePtr_Type& uFESpace, const UInt& iOperator, const vector_Type& x )
+{
+    TensorProductHexa tensorProduct( uFESpace->refFE(), uFESpace->qr() );
+
+    const vector_Type xRepeated( x, Repeated );
+    vector_Type product( uFESpace->map(), Repeated );
+    product *= 0.;
+
+    if ( iOperator == 0 )
+    {
+        tensorProduct.applyMass( *uFESpace->mesh(), uFESpace->dof(), xRepeated, product, 1.5, uFESpace->fieldDim() );
+    }
+    else
+    {
+        tensorProduct.applyStiffness( *uFESpace->mesh(), uFESpace->dof(), xRepeated, product, 0.7, uFESpace->fieldDim() );
+    }
+    product.globalAssemble();
+
+    return vector_Type( product, Unique );
+}
+
+// Relative difference of two vectors
+Real relativeDifference( const vector_Type& reference, const vector_Type& other )
+{
+    vector_Type difference( reference );
+    difference -= other;
+    return difference.normInf() / reference.normInf();
+}
+
+// Compare the three applications of the mass and stiffness matrices
+bool compareOperators( const feSpacePtr_Type& uFESpace, const bool& verbose )
+{
+    vector_Type x( uFESpace->map(), Unique );
+    uFESpace->interpolate( static_cast<feSpace_Type::function_Type>( testFunction ), x, 0.0 );
+
+    bool success( true );
+
+    for ( UInt iOperator(0); iOperator < 2; ++iOperator )
+    {
+        const vector_Type reference( assembleAndApply( uFESpace, iOperator, false, x ) );
+
+        const Real assemblyDifference( relativeDifference( reference, assembleAndApply( uFESpace, iOperator, true, x ) ) );
+        const Real matrixFreeDifference( relativeDifference( reference, applyMatrixFree( uFESpace, iOperator, x ) ) );
+
+        if ( verbose ) std::cout << " ---> " << uFESpace->refFE().name() << ", " << uFESpace->qr().name()
+                                 << ( iOperator == 0 ? ", mass" : ", stiffness" )
+                                 << ", difference of the tensor product assembly : " << assemblyDifference
+                                 << ", of the matrix free application : " << matrixFreeDifference << std::endl;
+
+        success &= assemblyDifference < tolerance && matrixFreeDifference < tolerance;
+    }
+
+    return success;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    bool success( true );
+
+// Read, distort and partition the structured hexahedral mesh
+
+    GetPot dataFile( "./data" );
+    MeshData meshData( dataFile, "interpolate/space_discretization" );
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    readMesh( *fullMeshPtr, meshData );
+    fullMeshPtr->meshTransformer().transformMesh( MeshMapping() );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+// Q1 vector field and Q2 scalar field
+
+    feSpacePtr_Type q1FESpace( new feSpace_Type( meshPtr, feHexaQ1, quadRuleHexa8pt, quadRuleQuad4pt, 3, Comm ) );
+    success &= compareOperators( q1FESpace, verbose );
+
+    feSpacePtr_Type q2FESpace( new feSpace_Type( meshPtr, feHexaQ2, quadRuleHexa27pt, quadRuleQuad9pt, 1, Comm ) );
+    success &= compareOperators( q2FESpace, verbose );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
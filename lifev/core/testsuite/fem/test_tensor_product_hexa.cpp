@@ -0,0 +1,333 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the Q2 element, of the tensor Gauss rules and of TensorProductHexa on hexahedra
+
+    @date 19-10-2012
+
+    The program checks:
+    <ol>
+    <li> the exactness of the tensor Gauss rules on hexahedra (8, 27 and 64 points) on the monomials
+         whose degree in each direction is at most the degree of exactness; </li>
+    <li> the Lagrange property of feHexaQ2 and the reproduction of the Q2 polynomials and of their gradients; </li>
+    <li> the local mass and stiffness matrices of TensorProductHexa against the ones of AssemblyElemental
+         on a distorted mesh; </li>
+    <li> the polynomial exactness of the mass and stiffness operators of TensorProductHexa on the unit cube. </li>
+    </ol>
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef HAVE_MPI
+#include <mpi.h>
+#endif
+#include <Epetra_SerialComm.h>
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MatrixElemental.hpp>
+
+#include <lifev/core/fem/ReferenceFE.hpp>
+#include <lifev/core/fem/QuadratureRule.hpp>
+#include <lifev/core/fem/CurrentFE.hpp>
+#include <lifev/core/fem/AssemblyElemental.hpp>
+#include <lifev/core/fem/TensorProductHexa.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/RegionMesh.hpp>
+#include <lifev/core/mesh/MeshData.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearHexa> mesh_Type;
+
+namespace
+{
+
+const Real tolerance( 1e-10 );
+
+// Q2 polynomial and its gradient
+Real q2Polynomial( const Real& x, const Real& y, const Real& z )
+{
+    return x * x * y * y * z * z - 2. * x * y * z * z + 3. * y * y - x + 0.5;
+}
+
+Real q2Derivative( const UInt& icoor, const Real& x, const Real& y, const Real& z )
+{
+    switch ( icoor )
+    {
+    case 0:
+        return 2. * x * y * y * z * z - 2. * y * z * z - 1.;
+    case 1:
+        return 2. * x * x * y * z * z - 2. * x * z * z + 6. * y;
+    default:
+        return 2. * x * x * y * y * z - 4. * x * y * z;
+    }
+}
+
+// Mapping used to distort the mesh, the elements remain valid
+struct MeshMapping
+{
+    void operator() ( Real& x, Real& y, Real& z ) const
+    {
+        const Real xOld( x ), yOld( y );
+        x = xOld + 0.1 * yOld * z;
+        y = yOld + 0.05 * xOld * xOld;
+        z = z + 0.08 * xOld * yOld;
+    }
+};
+
+// Check the exactness of a tensor rule on the reference cube [0,1]^3
+bool checkQuadratureRule( const QuadratureRule& qr )
+{
+    const UInt degree( qr.degreeOfExactness() );
+    Real maxError( 0. );
+
+    for ( UInt a(0); a <= degree; ++a )
+        for ( UInt b(0); b <= degree; ++b )
+            for ( UInt c(0); c <= degree; ++c )
+            {
+                Real integral( 0. );
+                for ( UInt ig(0); ig < qr.nbQuadPt(); ++ig )
+                {
+                    integral += qr.weight( ig ) * std::pow( qr.quadPointCoor( ig, 0 ), static_cast<Real>( a ) )
+                                                * std::pow( qr.quadPointCoor( ig, 1 ), static_cast<Real>( b ) )
+                                                * std::pow( qr.quadPointCoor( ig, 2 ), static_cast<Real>( c ) );
+                }
+                const Real exact( 1. / ( ( a + 1. ) * ( b + 1. ) * ( c + 1. ) ) );
+                maxError = std::max( maxError, std::fabs( integral - exact ) );
+            }
+
+    std::cout << " ---> " << qr.name() << ", max error : " << maxError << std::endl;
+
+    return maxError < tolerance;
+}
+
+// Check the Lagrange property of the Q2 element and the reproduction of the Q2 polynomials
+bool checkQ2Element()
+{
+    const ReferenceFE& refFE( feHexaQ2 );
+    const QuadratureRule& qr( quadRuleHexa64pt );
+    Real maxError( 0. );
+
+    if ( refFE.nbDof() != 27 )
+    {
+        std::cout << " <!> feHexaQ2 has " << refFE.nbDof() << " dofs <!> " << std::endl;
+        return false;
+    }
+
+    for ( UInt i(0); i < refFE.nbDof(); ++i )
+        for ( UInt j(0); j < refFE.nbDof(); ++j )
+        {
+            const Real value( refFE.phi( i, refFE.xi( j ), refFE.eta( j ), refFE.zeta( j ) ) );
+            maxError = std::max( maxError, std::fabs( value - ( i == j ? 1. : 0. ) ) );
+        }
+
+    for ( UInt ig(0); ig < qr.nbQuadPt(); ++ig )
+    {
+        const Real x( qr.quadPointCoor( ig, 0 ) ), y( qr.quadPointCoor( ig, 1 ) ), z( qr.quadPointCoor( ig, 2 ) );
+
+        Real value( 0. );
+        Real gradient[3] = { 0., 0., 0. };
+        for ( UInt i(0); i < refFE.nbDof(); ++i )
+        {
+            const Real nodalValue( q2Polynomial( refFE.xi( i ), refFE.eta( i ), refFE.zeta( i ) ) );
+            value += nodalValue * refFE.phi( i, x, y, z );
+            for ( UInt icoor(0); icoor < 3; ++icoor )
+            {
+                gradient[ icoor ] += nodalValue * refFE.dPhi( i, icoor, x, y, z );
+            }
+        }
+
+        maxError = std::max( maxError, std::fabs( value - q2Polynomial( x, y, z ) ) );
+        for ( UInt icoor(0); icoor < 3; ++icoor )
+        {
+            maxError = std::max( maxError, std::fabs( gradient[ icoor ] - q2Derivative( icoor, x, y, z ) ) );
+        }
+    }
+
+    std::cout << " ---> " << refFE.name() << ", max error : " << maxError << std::endl;
+
+    return maxError < tolerance;
+}
+
+// Compare the local matrices of TensorProductHexa with the ones of AssemblyElemental
+bool compareLocalMatrices( const mesh_Type& mesh, const ReferenceFE& refFE, const QuadratureRule& qr )
+{
+    TensorProductHexa tensorProduct( refFE, qr );
+    CurrentFE currentFE( refFE, geoBilinearHexa, qr );
+
+    const UInt nbFEDof( refFE.nbDof() );
+    MatrixElemental tensorMatrix( nbFEDof, 1, 1 );
+    MatrixElemental referenceMatrix( nbFEDof, 1, 1 );
+
+    Real maxError( 0. ), maxValue( 0. );
+
+    for ( UInt iElement(0); iElement < mesh.numElements(); ++iElement )
+    {
+        tensorProduct.update( mesh.element( iElement ) );
+        currentFE.update( mesh.element( iElement ), UPDATE_DPHI | UPDATE_WDET );
+
+        for ( UInt iOperator(0); iOperator < 2; ++iOperator )
+        {
+            tensorMatrix.zero();
+            referenceMatrix.zero();
+
+            if ( iOperator == 0 )
+            {
+                tensorProduct.mass( tensorMatrix, 1.5, 1 );
+                AssemblyElemental::mass( referenceMatrix, currentFE, 1.5, 1 );
+            }
+            else
+            {
+                tensorProduct.stiffness( tensorMatrix, 0.7, 1 );
+                AssemblyElemental::stiffness( referenceMatrix, currentFE, 0.7, 1 );
+            }
+
+            for ( UInt i(0); i < nbFEDof; ++i )
+                for ( UInt j(0); j < nbFEDof; ++j )
+                {
+                    maxError = std::max( maxError, std::fabs( tensorMatrix.mat()( i, j ) - referenceMatrix.mat()( i, j ) ) );
+                    maxValue = std::max( maxValue, std::fabs( referenceMatrix.mat()( i, j ) ) );
+                }
+        }
+    }
+
+    std::cout << " ---> " << refFE.name() << ", " << qr.name() << ", relative difference : " << maxError / maxValue << std::endl;
+
+    return maxError / maxValue < tolerance;
+}
+
+// Check the exactness of the operators on the unit cube for u(x,y,z) = x^degree:
+// u^T M u = 1 / ( 2 degree + 1 ) and u^T A u = degree^2 / ( 2 degree - 1 )
+bool checkExactness( const mesh_Type& mesh, const ReferenceFE& refFE, const QuadratureRule& qr, const UInt& degree )
+{
+    TensorProductHexa tensorProduct( refFE, qr );
+
+    const UInt nbFEDof( refFE.nbDof() );
+    std::vector<Real> u( nbFEDof ), massU( nbFEDof ), stiffnessU( nbFEDof );
+
+    Real massIntegral( 0. ), stiffnessIntegral( 0. );
+
+    for ( UInt iElement(0); iElement < mesh.numElements(); ++iElement )
+    {
+        tensorProduct.update( mesh.element( iElement ) );
+
+        // The elements of the unit cube mesh are boxes: the dof coordinates are the trilinear map of the reference ones
+        for ( UInt iDof(0); iDof < nbFEDof; ++iDof )
+        {
+            Real x( 0. );
+            for ( UInt iVertex(0); iVertex < 8; ++iVertex )
+            {
+                x += mesh.element( iElement ).point( iVertex ).x()
+                     * feHexaQ1.phi( iVertex, refFE.xi( iDof ), refFE.eta( iDof ), refFE.zeta( iDof ) );
+            }
+            u[ iDof ] = std::pow( x, static_cast<Real>( degree ) );
+            massU[ iDof ] = 0.;
+            stiffnessU[ iDof ] = 0.;
+        }
+
+        tensorProduct.applyMass( &u[0], &massU[0], 1. );
+        tensorProduct.applyStiffness( &u[0], &stiffnessU[0], 1. );
+
+        for ( UInt iDof(0); iDof < nbFEDof; ++iDof )
+        {
+            massIntegral += u[ iDof ] * massU[ iDof ];
+            stiffnessIntegral += u[ iDof ] * stiffnessU[ iDof ];
+        }
+    }
+
+    const Real massError( std::fabs( massIntegral - 1. / ( 2. * degree + 1. ) ) );
+    const Real stiffnessError( std::fabs( stiffnessIntegral - degree * degree / ( 2. * degree - 1. ) ) );
+
+    std::cout << " ---> " << refFE.name() << ", " << qr.name() << ", u = x^" << degree
+              << ", mass error : " << massError << ", stiffness error : " << stiffnessError << std::endl;
+
+    return massError < tolerance && stiffnessError < tolerance;
+}
+
+}
+
+int main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+#endif
+
+    bool success( true );
+
+    // Tensor Gauss rules
+    success &= checkQuadratureRule( quadRuleHexa8pt );
+    success &= checkQuadratureRule( quadRuleHexa27pt );
+    success &= checkQuadratureRule( quadRuleHexa64pt );
+
+    // Q2 element
+    success &= checkQ2Element();
+
+    // The unit cube mesh
+    boost::shared_ptr<Epetra_Comm> comm( new Epetra_SerialComm );
+    GetPot dataFile( "./data" );
+    MeshData meshData( dataFile, "interpolate/space_discretization" );
+    mesh_Type mesh( comm );
+    readMesh( mesh, meshData );
+
+    // Polynomial exactness of the sum factorized operators
+    success &= checkExactness( mesh, feHexaQ1, quadRuleHexa8pt, 1 );
+    success &= checkExactness( mesh, feHexaQ2, quadRuleHexa27pt, 2 );
+    success &= checkExactness( mesh, feHexaQ2, quadRuleHexa64pt, 2 );
+
+    // Comparison with the assembly with CurrentFE on a distorted mesh
+    mesh.meshTransformer().transformMesh( MeshMapping() );
+
+    success &= compareLocalMatrices( mesh, feHexaQ1, quadRuleHexa8pt );
+    success &= compareLocalMatrices( mesh, feHexaQ2, quadRuleHexa27pt );
+    success &= compareLocalMatrices( mesh, feHexaQ2, quadRuleHexa64pt );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
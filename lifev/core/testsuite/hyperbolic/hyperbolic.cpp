@@ -608,6 +608,9 @@ hyperbolic::run()
     // Flag for the last time step that does not coincide with the last advance
     bool isLastTimeStep( false );
 
+    // Build the exchange of the ghost values with the neighboring processes, done in CFL or solveOneTimeStep
+    hyperbolicSolver.setupGhostExchange( ghostDataMap );
+
     // A loop for the simulation, it starts from \Delta t and end in N \Delta t = T
     while ( dataHyperbolic.dataTime()->canAdvance() && !isLastTimeStep )
     {
@@ -615,9 +618,6 @@ hyperbolic::run()
         // Start chronoTimeStep for measure the time for the current time step
         chronoTimeStep.start();
 
-        // update ghost values from neighboring processes
-        hyperbolicSolver.updateGhostValues( ghostDataMap );
-
         // Check if the time step is consistent, i.e. if innerTimeStep + currentTime < endTime.
         if ( dataHyperbolic.dataTime()->isLastTimeStep() )
         {
@@ -629,7 +629,7 @@ hyperbolic::run()
         }
         else
         {
-            // Compute the new time step according to the CFL condition.
+            // Compute the new time step according to the CFL condition, with the current ghost values.
             timeStep = hyperbolicSolver.CFL();
         }
 
@@ -668,6 +668,9 @@ hyperbolic::run()
 
     }
 
+    // Free the persistent requests of the ghost exchange
+    hyperbolicSolver.clearGhostExchange();
+
     // Stop chronoProcess
     chronoProcess.stop();
 
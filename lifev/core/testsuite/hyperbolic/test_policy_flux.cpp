@@ -0,0 +1,299 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the policy numerical fluxes against the Godunov flux computed with the Brent algorithm
+
+    @date 19-10-2012
+
+    The closed form fluxes (GodunovPolicyNumericalFlux with LinearFluxPolicy and BurgersFluxPolicy,
+    RusanovPolicyNumericalFlux) are compared in a set of states and normals with GodunovNumericalFlux.
+    Then the HyperbolicSolver is run with both GodunovNumericalFlux and GodunovPolicyNumericalFlux on a
+    linear advection problem and the two solutions are compared.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/solver/HyperbolicSolver.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra>                     mesh_Type;
+typedef HyperbolicSolver< mesh_Type >               hyperbolicSolver_Type;
+typedef hyperbolicSolver_Type::vector_Type          vector_Type;
+typedef FESpace< mesh_Type, MapEpetra >             feSpace_Type;
+typedef boost::shared_ptr< feSpace_Type >           feSpacePtr_Type;
+typedef AbstractNumericalFlux< mesh_Type >          flux_Type;
+typedef flux_Type::normal_Type                      normal_Type;
+typedef MeshPartitioner< mesh_Type >::GhostEntityDataMap_Type ghostDataMap_Type;
+
+namespace
+{
+
+// Constant advection field
+const Real advectionField[] = { 1., -0.5, 0.25 };
+
+Vector linearFlux( const Real& /* t */, const Real& /* x */, const Real& /* y */, const Real& /* z */,
+                   const std::vector<Real>& u )
+{
+    Vector flux( static_cast<UInt>(3) );
+    for ( UInt i(0); i < 3; ++i )
+        flux( i ) = advectionField[ i ] * u[0];
+    return flux;
+}
+
+Vector linearFluxDerivative( const Real& /* t */, const Real& /* x */, const Real& /* y */, const Real& /* z */,
+                             const std::vector<Real>& /* u */ )
+{
+    Vector flux( static_cast<UInt>(3) );
+    for ( UInt i(0); i < 3; ++i )
+        flux( i ) = advectionField[ i ];
+    return flux;
+}
+
+Vector burgersFlux( const Real& /* t */, const Real& /* x */, const Real& /* y */, const Real& /* z */,
+                    const std::vector<Real>& u )
+{
+    Vector flux( static_cast<UInt>(3) );
+    for ( UInt i(0); i < 3; ++i )
+        flux( i ) = advectionField[ i ] * 0.5 * u[0] * u[0];
+    return flux;
+}
+
+Vector burgersFluxDerivative( const Real& /* t */, const Real& /* x */, const Real& /* y */, const Real& /* z */,
+                              const std::vector<Real>& u )
+{
+    Vector flux( static_cast<UInt>(3) );
+    for ( UInt i(0); i < 3; ++i )
+        flux( i ) = advectionField[ i ] * u[0];
+    return flux;
+}
+
+Real initialCondition( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& /* ic */ )
+{
+    return std::exp( - 20. * ( ( x - 0.3 ) * ( x - 0.3 ) + ( y - 0.7 ) * ( y - 0.7 ) + ( z - 0.3 ) * ( z - 0.3 ) ) );
+}
+
+Real inflow( const Real& /* t */, const Real& /* x */, const Real& /* y */, const Real& /* z */, const ID& /* ic */ )
+{
+    return 0.;
+}
+
+// Compare two fluxes and their norm infinity in a set of states and normals
+bool compareFluxes( const flux_Type& reference, const flux_Type& flux, const Real& tolerance, const std::string& name )
+{
+    const Real states[] = { -1.5, -0.3, 0., 0.4, 2. };
+    const Real normals[][3] = { { 1., 0., 0. }, { 0., -1., 0. }, { 0.6, 0., -0.8 }, { -0.48, 0.6, 0.64 } };
+
+    normal_Type normal( 3 );
+    Real maxError( 0. );
+
+    for ( UInt iNormal(0); iNormal < 4; ++iNormal )
+    {
+        for ( UInt icoor(0); icoor < 3; ++icoor )
+            normal( icoor ) = normals[ iNormal ][ icoor ];
+
+        for ( UInt iLeft(0); iLeft < 5; ++iLeft )
+            for ( UInt iRight(0); iRight < 5; ++iRight )
+            {
+                const Real& left( states[ iLeft ] );
+                const Real& right( states[ iRight ] );
+
+                maxError = std::max( maxError, std::fabs( reference( left, right, normal, 0 ) - flux( left, right, normal, 0 ) ) );
+                maxError = std::max( maxError, std::fabs( reference.normInfinity( left, right, normal, 0 )
+                                                          - flux.normInfinity( left, right, normal, 0 ) ) );
+
+                // The face integrated flux on a face with one quadrature node of unit weight
+                const Real weight( 1. ), point[] = { 0., 0., 0. };
+                maxError = std::max( maxError, std::fabs( reference( left, right, normal, 0 )
+                                                          - flux.faceFlux( left, right, normals[ iNormal ], point, &weight, 1, 0, 0. ) ) );
+            }
+    }
+
+    std::cout << " ---> " << name << " max difference : " << maxError << std::endl;
+
+    return maxError < tolerance;
+}
+
+// Run the hyperbolic solver with the given flux for a number of time steps
+void runSolver( const flux_Type& flux, const GetPot& dataFile, feSpace_Type& feSpace,
+                ghostDataMap_Type& ghostDataMap, boost::shared_ptr<Epetra_Comm>& comm,
+                const UInt& timeSteps, vector_Type& solution, std::vector<Real>& timeStepList )
+{
+    HyperbolicData< mesh_Type > dataHyperbolic;
+    dataHyperbolic.setup( dataFile );
+
+    BCFunctionBase inflowFunction( inflow );
+    BCHandler bcHandler;
+    for ( UInt i(1); i <= 6; ++i )
+        bcHandler.addBC( "Wall", i, Essential, Scalar, inflowFunction );
+
+    hyperbolicSolver_Type hyperbolicSolver( dataHyperbolic, feSpace, bcHandler, comm );
+    hyperbolicSolver.setup();
+    hyperbolicSolver.setInitialSolution( initialCondition );
+    hyperbolicSolver.setNumericalFlux( flux );
+    hyperbolicSolver.setupGhostExchange( ghostDataMap );
+
+    timeStepList.clear();
+    for ( UInt iStep(0); iStep < timeSteps; ++iStep )
+    {
+        const Real timeStep( hyperbolicSolver.CFL() );
+        timeStepList.push_back( timeStep );
+
+        dataHyperbolic.dataTime()->setTimeStep( timeStep );
+        dataHyperbolic.dataTime()->updateTime();
+
+        hyperbolicSolver.solveOneTimeStep();
+    }
+
+    solution = *hyperbolicSolver.solution();
+
+    // Free the persistent requests of the ghost exchange
+    hyperbolicSolver.clearGhostExchange();
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init(&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( comm->MyPID() == 0 );
+
+    GetPot command_line( argc, argv );
+    GetPot dataFile( command_line.follow( "data_policy_flux", 2, "-f", "--file" ) );
+
+    const UInt nElements( dataFile( "mesh/nelements", 6 ) );
+    const UInt timeSteps( dataFile( "hyperbolic/time_discretization/timesteps", 10 ) );
+    const Real fluxTolerance( dataFile( "test/flux_tolerance", 1e-6 ) );
+    const Real solutionTolerance( dataFile( "test/solution_tolerance", 1e-6 ) );
+    const std::string section( "hyperbolic/numerical_flux/" );
+
+    bool success( true );
+
+    // Build and partition the mesh
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( comm ) );
+    regularMesh3D( *fullMeshPtr, 1, nElements, nElements, nElements );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    ghostDataMap_Type ghostDataMap;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, comm );
+        meshPtr = meshPart.meshPartition();
+        ghostDataMap = meshPart.ghostDataMap();
+    }
+    fullMeshPtr.reset();
+
+    feSpace_Type feSpace( meshPtr, feTetraP0, quadRuleTetra4pt, quadRuleTria4pt, 1, comm );
+
+    const Vector direction( linearFluxDerivative( 0., 0., 0., 0., std::vector<Real>( 1, 0. ) ) );
+
+    // Fluxes evaluated with the Brent algorithm
+    GodunovNumericalFlux< mesh_Type > linearGodunov( linearFlux, linearFluxDerivative, feSpace, dataFile, section );
+    GodunovNumericalFlux< mesh_Type > burgersGodunov( burgersFlux, burgersFluxDerivative, feSpace, dataFile, section );
+
+    // Fluxes in closed form
+    GodunovPolicyNumericalFlux< mesh_Type, LinearFluxPolicy > linearPolicy( LinearFluxPolicy( direction ), feSpace, dataFile, section );
+    GodunovPolicyNumericalFlux< mesh_Type, BurgersFluxPolicy > burgersPolicy( BurgersFluxPolicy( direction ), feSpace, dataFile, section );
+    RusanovPolicyNumericalFlux< mesh_Type, LinearFluxPolicy > linearRusanov( LinearFluxPolicy( direction ), feSpace, dataFile, section );
+
+    if ( verbose ) std::cout << " -- Comparing the fluxes ... " << std::endl;
+
+    success &= compareFluxes( linearGodunov, linearPolicy, fluxTolerance, "Godunov, linear flux " );
+    success &= compareFluxes( burgersGodunov, burgersPolicy, fluxTolerance, "Godunov, Burgers flux" );
+
+    // For the linear flux the Rusanov flux is the upwind flux, as the Godunov flux
+    success &= compareFluxes( linearGodunov, linearRusanov, fluxTolerance, "Rusanov, linear flux " );
+
+    if ( verbose ) std::cout << " -- Comparing the solutions of the hyperbolic solver ... " << std::endl;
+
+    vector_Type referenceSolution( feSpace.map(), Repeated );
+    vector_Type policySolution( feSpace.map(), Repeated );
+    std::vector<Real> referenceTimeSteps, policyTimeSteps;
+
+    runSolver( linearGodunov, dataFile, feSpace, ghostDataMap, comm, timeSteps, referenceSolution, referenceTimeSteps );
+    runSolver( linearPolicy, dataFile, feSpace, ghostDataMap, comm, timeSteps, policySolution, policyTimeSteps );
+
+    Real timeStepError( 0. );
+    for ( UInt iStep(0); iStep < timeSteps; ++iStep )
+        timeStepError = std::max( timeStepError, std::fabs( referenceTimeSteps[ iStep ] - policyTimeSteps[ iStep ] ) / referenceTimeSteps[ iStep ] );
+
+    vector_Type difference( referenceSolution, Unique );
+    difference -= vector_Type( policySolution, Unique );
+    const Real solutionError( difference.normInf() / vector_Type( referenceSolution, Unique ).normInf() );
+
+    if ( verbose )
+    {
+        std::cout << " ---> Relative difference of the time steps : " << timeStepError << std::endl;
+        std::cout << " ---> Relative difference of the solutions  : " << solutionError << std::endl;
+    }
+
+    success &= ( timeStepError < solutionTolerance ) && ( solutionError < solutionTolerance );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
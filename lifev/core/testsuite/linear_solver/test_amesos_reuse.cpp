@@ -0,0 +1,258 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+
+/*!
+    @file
+    @brief Test of the reuse of the Amesos factorizations
+
+    @date 19-10-2012
+
+    Diffusion-reaction matrices are given to SolverAmesos with the reuse of the factorizations
+    enabled (amesos/reuse_factorization in the data file). The numbers of symbolic and numeric
+    factorizations are checked
+    <ul>
+    <li> for the same matrix, and for another matrix with the same values: nothing is factorized;
+    <li> for a matrix with the same pattern and other coefficients: only the numeric factorization;
+    <li> for a matrix with an additional entry on the first process only: both factorizations.
+    </ul>
+    The solutions are checked with the residual, also for several right hand sides solved at once.
+    A singular matrix must fail to be factorized each time it is set, and the solver must then
+    accept a regular matrix again.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/algorithm/SolverAmesos.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef boost::shared_ptr<vector_Type> vectorPtr_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+
+namespace
+{
+
+// Assemble a diffusion-reaction matrix, with an additional entry on the first process if required
+matrixPtr_Type assembleMatrix( const feSpacePtr_Type& uFESpace, const Real& massCoefficient,
+                               const Real& diffusionCoefficient, const bool& additionalEntry )
+{
+    ADRAssembler<mesh_Type, matrix_Type, vector_Type> adrAssembler;
+    adrAssembler.setup( uFESpace, uFESpace );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addMass( systemMatrix, massCoefficient );
+    adrAssembler.addDiffusion( systemMatrix, diffusionCoefficient );
+
+    // Couple the first row of the first process with the last degree of freedom
+    if ( additionalEntry && uFESpace->map().map( Unique )->Comm().MyPID() == 0 )
+    {
+        systemMatrix->addToCoefficient( uFESpace->map().map( Unique )->GID( 0 ), uFESpace->dof().numTotalDof() - 1, 1e-8 );
+    }
+
+    systemMatrix->globalAssemble();
+
+    return systemMatrix;
+}
+
+// Relative residual of a solution
+Real relativeResidual( const matrix_Type& matrix, const vector_Type& rightHandSide, const vector_Type& solution )
+{
+    vector_Type residual( rightHandSide );
+    residual -= matrix * solution;
+
+    return residual.normInf() / rightHandSide.normInf();
+}
+
+// Set the matrix and check the numbers of factorizations and the solution of a system
+bool setAndSolve( SolverAmesos& solver, const matrix_Type& matrix, const vector_Type& rightHandSide,
+                  const UInt& numSymbolic, const UInt& numNumeric, const Real& tolerance,
+                  const std::string& description, const bool& verbose )
+{
+    const Int error( solver.setMatrix( matrix ) );
+
+    vector_Type solution( rightHandSide.map(), Unique );
+    vector_Type rightHandSideCopy( rightHandSide );
+    solver.solveSystem( rightHandSideCopy, solution, matrixPtr_Type() );
+
+    const Real residual( relativeResidual( matrix, rightHandSide, solution ) );
+
+    if ( verbose ) std::cout << " ---> " << description << ", symbolic factorizations : " << solver.numSymbolicFactorizations()
+                             << ", numeric factorizations : " << solver.numNumericFactorizations()
+                             << ", residual : " << residual << std::endl;
+
+    return error == 0 && solver.numSymbolicFactorizations() == numSymbolic
+           && solver.numNumericFactorizations() == numNumeric && residual < tolerance;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    GetPot command_line( argc, argv );
+    const std::string dataFileName = command_line.follow( "data_amesos_reuse", 2, "-f", "--file" );
+    GetPot dataFile( dataFileName );
+
+    const UInt Nelements( dataFile( "mesh/num_elements", 6 ) );
+    const Real tolerance( dataFile( "solver/tol", 1e-10 ) );
+
+    bool success( true );
+
+// Build and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   1.0,   1.0,   1.0,
+                   0.0,   0.0,   0.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, "P1", 1, Comm ) );
+
+    vector_Type rightHandSide( uFESpace->map(), Unique );
+    rightHandSide.epetraVector().Random();
+
+// Build the solver
+
+    SolverAmesos solver( Comm );
+    solver.setDataFromGetPot( dataFile, "solver" );
+    solver.setParameters();
+
+// Counters of the factorizations
+
+    matrixPtr_Type matrix( assembleMatrix( uFESpace, 1.0, 1.0, false ) );
+    success &= setAndSolve( solver, *matrix, rightHandSide, 1, 1, tolerance, "First matrix", verbose );
+    success &= setAndSolve( solver, *matrix, rightHandSide, 1, 1, tolerance, "Same matrix", verbose );
+
+    matrix = assembleMatrix( uFESpace, 1.0, 1.0, false );
+    success &= setAndSolve( solver, *matrix, rightHandSide, 1, 1, tolerance, "Same values", verbose );
+
+    const matrixPtr_Type samePatternMatrix( assembleMatrix( uFESpace, 10.0, 0.5, false ) );
+    success &= setAndSolve( solver, *samePatternMatrix, rightHandSide, 1, 2, tolerance, "Same pattern", verbose );
+
+// Several right hand sides solved at once
+
+    std::vector<vectorPtr_Type> rightHandSides( 3 );
+    std::vector<vectorPtr_Type> solutions( 3 );
+    for ( UInt i( 0 ); i < rightHandSides.size(); ++i )
+    {
+        rightHandSides[i].reset( new vector_Type( uFESpace->map(), Unique ) );
+        rightHandSides[i]->epetraVector().Random();
+        solutions[i].reset( new vector_Type( uFESpace->map(), Unique ) );
+    }
+
+    success &= solver.solveSystem( rightHandSides, solutions ) == 0;
+    for ( UInt i( 0 ); i < rightHandSides.size(); ++i )
+    {
+        const Real residual( relativeResidual( *samePatternMatrix, *rightHandSides[i], *solutions[i] ) );
+        if ( verbose ) std::cout << " ---> Right hand side " << i << " of " << rightHandSides.size()
+                                 << ", residual : " << residual << std::endl;
+        success &= residual < tolerance;
+    }
+    success &= solver.numNumericFactorizations() == 2;
+
+// Pattern changed on the first process only: both factorizations on all the processes
+
+    matrix = assembleMatrix( uFESpace, 10.0, 0.5, true );
+    success &= setAndSolve( solver, *matrix, rightHandSide, 2, 3, tolerance, "Changed pattern", verbose );
+
+// A singular matrix fails every time, even when it is set twice
+
+    const matrixPtr_Type singularMatrix( assembleMatrix( uFESpace, 0.0, 0.0, false ) );
+    const Int firstError( solver.setMatrix( *singularMatrix ) );
+    const Int secondError( solver.setMatrix( *singularMatrix ) );
+    if ( verbose ) std::cout << " ---> Singular matrix, errors : " << firstError << ", " << secondError << std::endl;
+    success &= firstError != 0 && secondError != 0;
+
+    const UInt numSymbolic( solver.numSymbolicFactorizations() );
+    const UInt numNumeric( solver.numNumericFactorizations() );
+    success &= setAndSolve( solver, *samePatternMatrix, rightHandSide, numSymbolic + 1, numNumeric + 1, tolerance,
+                            "After the failure", verbose );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
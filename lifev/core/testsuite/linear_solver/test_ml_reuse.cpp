@@ -0,0 +1,225 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+
+/*!
+    @file
+    @brief Test of the reuse of the ML hierarchy
+
+    @date 19-10-2012
+
+    An ML preconditioner with the reuse enabled (ML/reuse in the data file) is built for a
+    diffusion-reaction matrix, then recomputed (see PreconditionerML::recomputePreconditioner)
+    <ul>
+    <li> for a matrix with the same pattern and other coefficients: the hierarchy has to be reused;
+    <li> for a matrix with an additional entry on the first process only: the hierarchy has to be
+         built again, on all the processes.
+    </ul>
+    In both cases the preconditioned GMRES must solve the system with the new matrix.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <AztecOO.h>
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/algorithm/PreconditionerML.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+
+namespace
+{
+
+// Assemble a diffusion-reaction matrix, with an additional entry on the first process if required
+matrixPtr_Type assembleMatrix( const feSpacePtr_Type& uFESpace, const Real& massCoefficient,
+                               const Real& diffusionCoefficient, const bool& additionalEntry )
+{
+    ADRAssembler<mesh_Type, matrix_Type, vector_Type> adrAssembler;
+    adrAssembler.setup( uFESpace, uFESpace );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addMass( systemMatrix, massCoefficient );
+    adrAssembler.addDiffusion( systemMatrix, diffusionCoefficient );
+
+    // Couple the first row of the first process with the last degree of freedom
+    if ( additionalEntry && uFESpace->map().map( Unique )->Comm().MyPID() == 0 )
+    {
+        systemMatrix->addToCoefficient( uFESpace->map().map( Unique )->GID( 0 ), uFESpace->dof().numTotalDof() - 1, 1e-8 );
+    }
+
+    systemMatrix->globalAssemble();
+
+    return systemMatrix;
+}
+
+// Solve the system with GMRES and the preconditioner, return the relative residual
+Real solve( const matrix_Type& matrix, PreconditionerML& preconditioner, const vector_Type& rightHandSide,
+            const Int& maxIterations, const Real& tolerance, Int& numIterations )
+{
+    vector_Type solution( rightHandSide.map(), Unique );
+    vector_Type rightHandSideCopy( rightHandSide );
+
+    AztecOO solver( matrix.matrixPtr().get(), &solution.epetraVector(), &rightHandSideCopy.epetraVector() );
+    solver.SetPrecOperator( preconditioner.preconditioner() );
+    solver.SetAztecOption( AZ_solver, AZ_gmres );
+    solver.SetAztecOption( AZ_output, AZ_none );
+    solver.Iterate( maxIterations, tolerance );
+    numIterations = solver.NumIters();
+
+    vector_Type residual( rightHandSide );
+    residual -= matrix * solution;
+
+    return residual.normInf() / rightHandSide.normInf();
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    GetPot command_line( argc, argv );
+    const std::string dataFileName = command_line.follow( "data_ml_reuse", 2, "-f", "--file" );
+    GetPot dataFile( dataFileName );
+
+    const UInt Nelements( dataFile( "mesh/num_elements", 8 ) );
+    const Int maxIterations( dataFile( "solver/max_iter", 200 ) );
+    const Real tolerance( dataFile( "solver/tol", 1e-10 ) );
+
+    bool success( true );
+
+// Build and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   1.0,   1.0,   1.0,
+                   0.0,   0.0,   0.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, "P1", 1, Comm ) );
+
+    vector_Type rightHandSide( uFESpace->map(), Unique );
+    rightHandSide.epetraVector().Random();
+
+// Build the preconditioner
+
+    PreconditionerML preconditioner( Comm );
+    preconditioner.setDataFromGetPot( dataFile, "prec" );
+
+    matrixPtr_Type matrix( assembleMatrix( uFESpace, 1.0, 1.0, false ) );
+    preconditioner.buildPreconditioner( matrix );
+
+    Int numIterations( 0 );
+    Real residual( solve( *matrix, preconditioner, rightHandSide, maxIterations, tolerance, numIterations ) );
+    if ( verbose ) std::cout << " ---> First build, iterations : " << numIterations << ", residual : " << residual << std::endl;
+    success &= numIterations < maxIterations;
+
+// Same pattern: the hierarchy is reused
+
+    matrix = assembleMatrix( uFESpace, 10.0, 0.5, false );
+    preconditioner.recomputePreconditioner( matrix );
+
+    residual = solve( *matrix, preconditioner, rightHandSide, maxIterations, tolerance, numIterations );
+    if ( verbose ) std::cout << " ---> Same pattern, reused : " << preconditioner.hierarchyReused()
+                             << ", iterations : " << numIterations << ", residual : " << residual << std::endl;
+    success &= preconditioner.hierarchyReused();
+    success &= numIterations < maxIterations;
+
+// Pattern changed on the first process only: the hierarchy is built again everywhere
+
+    matrix = assembleMatrix( uFESpace, 10.0, 0.5, true );
+    preconditioner.recomputePreconditioner( matrix );
+
+    residual = solve( *matrix, preconditioner, rightHandSide, maxIterations, tolerance, numIterations );
+    if ( verbose ) std::cout << " ---> Changed pattern, reused : " << preconditioner.hierarchyReused()
+                             << ", iterations : " << numIterations << ", residual : " << residual << std::endl;
+    success &= !preconditioner.hierarchyReused();
+    success &= numIterations < maxIterations;
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,312 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test of the ReducedBasisSolver on a diffusion-reaction problem with a parametric diffusivity
+
+    @date 19-10-2012
+
+    The problem \f$ (\mu K + M_L) u = f \f$ is solved with homogeneous Neumann conditions, where
+    \f$ K \f$ is the stiffness matrix and \f$ M_L \f$ the lumped mass matrix. Since \f$ K \f$ is
+    positive semi-definite, the smallest entry of \f$ M_L \f$ is a lower bound of the coercivity
+    constant and the error estimate of the ReducedBasisSolver is a bound of the relative error.
+    <ul>
+      <li> the basis is built from the full solutions at a few training diffusivities;</li>
+      <li> at a new diffusivity the error of the reduced solution has to be below the estimate;</li>
+      <li> with a tolerance below the estimate, solve() has to fall back to the full solver and
+           add its solution to the basis, so that the next reduced solution is accepted.</li>
+    </ul>
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+#include <Teuchos_RCP.hpp>
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/algorithm/LinearSolver.hpp>
+#include <lifev/core/algorithm/PreconditionerIfpack.hpp>
+#include <lifev/core/algorithm/ReducedBasisSolver.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef boost::shared_ptr<vector_Type> vectorPtr_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef boost::shared_ptr<LinearSolver> solverPtr_Type;
+
+namespace
+{
+
+Real sourceFunction( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& /* i */ )
+{
+    return 1. + std::sin( 3. * x ) * y + z * z;
+}
+
+// Coefficients of the stiffness and lumped mass matrices
+std::vector<Real> matrixCoefficients( const Real& diffusivity )
+{
+    std::vector<Real> coefficients( 2, 1. );
+    coefficients[0] = diffusivity;
+    return coefficients;
+}
+
+// Solve the full problem with the given diffusivity
+void solveFull( const solverPtr_Type& solver, const matrix_Type& stiffness, const matrix_Type& lumpedMass,
+                const vectorPtr_Type& rightHandSide, const Real& diffusivity, vector_Type& solution )
+{
+    matrixPtr_Type systemMatrix( new matrix_Type( stiffness.map() ) );
+    systemMatrix->add( diffusivity, stiffness );
+    systemMatrix->add( 1., lumpedMass );
+    systemMatrix->globalAssemble();
+
+    vectorPtr_Type fullSolution( new vector_Type( rightHandSide->map(), Unique ) );
+    solver->setOperator( systemMatrix );
+    solver->setRightHandSide( rightHandSide );
+    solver->solve( fullSolution );
+
+    solution = *fullSolution;
+}
+
+// Relative difference of two vectors, in the euclidean norm used by the error estimate
+Real relativeDifference( const vector_Type& reference, const vector_Type& other )
+{
+    vector_Type difference( reference );
+    difference -= other;
+    return difference.norm2() / other.norm2();
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    GetPot command_line( argc, argv );
+    const std::string dataFileName = command_line.follow( "data_reduced_basis", 2, "-f", "--file" );
+    GetPot dataFile( dataFileName );
+
+    const UInt Nelements( dataFile( "mesh/num_elements", 8 ) );
+
+    // Tolerance on the error of the full solutions, which are used as reference
+    const Real fullTolerance( 1e-8 );
+
+    bool success( true );
+
+// Build and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   1.0,   1.0,   1.0,
+                   0.0,   0.0,   0.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+    feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, "P1", 1, Comm ) );
+
+// Assemble the affine terms
+
+    ADRAssembler<mesh_Type, matrix_Type, vector_Type> adrAssembler;
+    adrAssembler.setup( uFESpace, uFESpace );
+
+    matrixPtr_Type stiffness( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addDiffusion( stiffness, 1.0 );
+    stiffness->globalAssemble();
+
+    matrixPtr_Type mass( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addMass( mass, 1.0 );
+    mass->globalAssemble();
+
+    vector_Type ones( uFESpace->map(), Unique );
+    ones = 1.;
+    const vector_Type lumpedDiagonal( *mass * ones );
+
+    matrixPtr_Type lumpedMass( new matrix_Type( uFESpace->map() ) );
+    const Epetra_Map& uniqueMap( *uFESpace->map().map( Unique ) );
+    for ( Int i( 0 ); i < uniqueMap.NumMyElements(); ++i )
+    {
+        const Int gid( uniqueMap.GID( i ) );
+        lumpedMass->addToCoefficient( gid, gid, lumpedDiagonal[ gid ] );
+    }
+    lumpedMass->globalAssemble();
+
+    vector_Type repeatedRightHandSide( uFESpace->map(), Repeated );
+    adrAssembler.addMassRhs( repeatedRightHandSide, sourceFunction, 0.0 );
+    repeatedRightHandSide.globalAssemble();
+    vectorPtr_Type rightHandSide( new vector_Type( repeatedRightHandSide, Unique ) );
+
+    // The stiffness matrix is positive semi-definite with Neumann conditions
+    const Real stabilityLowerBound( lumpedDiagonal.minValue() );
+
+// Build the full solver
+
+    Teuchos::RCP< Teuchos::ParameterList > solverList = Teuchos::getParametersFromXmlFile( "SolverParamList_reduced_basis.xml" );
+
+    solverPtr_Type fullSolver( new LinearSolver );
+    fullSolver->setCommunicator( Comm );
+    fullSolver->setParameters( *solverList );
+    fullSolver->setPreconditionerFromGetPot( dataFile, "prec" );
+
+// Offline stage
+
+    ReducedBasisSolver reducedBasis( Comm );
+    reducedBasis.setDataFromGetPot( dataFile, "reducedBasis" );
+    reducedBasis.setStabilityLowerBound( stabilityLowerBound );
+    reducedBasis.setFullSolver( fullSolver );
+
+    const UInt numTrainingDiffusivities( 3 );
+    const Real trainingDiffusivities[] = { 0.01, 0.1, 1. };
+    for ( UInt iTraining( 0 ); iTraining < numTrainingDiffusivities; ++iTraining )
+    {
+        vector_Type snapshot( uFESpace->map(), Unique );
+        solveFull( fullSolver, *stiffness, *lumpedMass, rightHandSide, trainingDiffusivities[ iTraining ], snapshot );
+        reducedBasis.addSnapshot( snapshot );
+    }
+    reducedBasis.buildBasis();
+
+    reducedBasis.addAffineMatrix( stiffness );
+    reducedBasis.addAffineMatrix( lumpedMass );
+    reducedBasis.addAffineRightHandSide( rightHandSide );
+    reducedBasis.buildReducedOperators();
+
+    const std::vector<Real> rightHandSideCoefficients( 1, 1. );
+
+// Online stage: the error has to be below the estimate
+
+    const Real diffusivity( 0.3 );
+
+    const Real errorEstimate( reducedBasis.solveReduced( matrixCoefficients( diffusivity ), rightHandSideCoefficients ) );
+    vector_Type reducedSolution( uFESpace->map(), Unique );
+    reducedBasis.reconstruct( reducedSolution );
+
+    vector_Type fullSolution( uFESpace->map(), Unique );
+    solveFull( fullSolver, *stiffness, *lumpedMass, rightHandSide, diffusivity, fullSolution );
+
+    const Real error( relativeDifference( fullSolution, reducedSolution ) );
+    if ( verbose ) std::cout << " ---> Basis size " << reducedBasis.basisSize() << ", error : " << error
+                             << ", error estimate : " << errorEstimate << std::endl;
+    success &= error <= errorEstimate + fullTolerance;
+
+    // Check that the test is meaningful: the basis does not contain the solution
+    success &= error > 10 * fullTolerance;
+
+// Online stage: the full solver is used above the tolerance and its solution enriches the basis
+
+    reducedBasis.setErrorTolerance( 0.5 * errorEstimate );
+    reducedBasis.setEnrichOnFallback( true );
+
+    const UInt basisSize( reducedBasis.basisSize() );
+    vector_Type solution( uFESpace->map(), Unique );
+    if ( reducedBasis.solve( matrixCoefficients( diffusivity ), rightHandSideCoefficients, solution ) )
+    {
+        if ( verbose ) std::cout << " <!> The reduced solution has been accepted above the tolerance <!> " << std::endl;
+        success = false;
+    }
+
+    const Real fallbackDifference( relativeDifference( fullSolution, solution ) );
+    if ( verbose ) std::cout << " ---> Fallback to the full solver, basis size " << reducedBasis.basisSize()
+                             << ", difference with the full solution : " << fallbackDifference << std::endl;
+    success &= reducedBasis.numFullSolves() == 1;
+    success &= reducedBasis.basisSize() == basisSize + 1;
+    success &= fallbackDifference < fullTolerance;
+
+    // The enriched basis contains the solution
+    if ( !reducedBasis.solve( matrixCoefficients( diffusivity ), rightHandSideCoefficients, solution ) )
+    {
+        if ( verbose ) std::cout << " <!> The reduced solution has been rejected after the enrichment <!> " << std::endl;
+        success = false;
+    }
+
+    const Real enrichedError( relativeDifference( fullSolution, solution ) );
+    if ( verbose ) std::cout << " ---> Enriched basis, error : " << enrichedError
+                             << ", error estimate : " << reducedBasis.errorEstimate() << std::endl;
+    success &= reducedBasis.numReducedSolves() == 1;
+    success &= enrichedError <= reducedBasis.errorEstimate() + fullTolerance;
+
+    reducedBasis.showMe();
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,243 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+
+/*!
+    @file
+    @brief Test of the renumbering of the mesh
+
+    @date 19-10-2012
+
+    The same Laplace problem is solved on a structured mesh with its original numbering and
+    after renumbering the points and the elements with MeshUtility::reorderMesh. The
+    numbering of the degrees of freedom changes, but the errors and the norms of the
+    solutions, which do not depend on it, must be the same.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/algorithm/PreconditionerIfpack.hpp>
+#include <lifev/core/algorithm/SolverAztecOO.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/BCManage.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/function/Laplacian.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/MeshReordering.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/solver/ADRAssembler.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef boost::shared_ptr<mesh_Type> meshPtr_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef boost::shared_ptr<matrix_Type> matrixPtr_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef boost::shared_ptr<Epetra_Comm> commPtr_Type;
+
+namespace
+{
+
+// Build the structured mesh of the unit cube
+meshPtr_Type buildMesh( const UInt& numElements, const commPtr_Type& comm )
+{
+    meshPtr_Type meshPtr( new mesh_Type( comm ) );
+    regularMesh3D( *meshPtr, 1, numElements, numElements, numElements, false,
+                   1.0, 1.0, 1.0,
+                   0.0, 0.0, 0.0 );
+    return meshPtr;
+}
+
+// Number of points whose position in the point list has changed
+UInt numMovedPoints( const mesh_Type& mesh, const mesh_Type& reorderedMesh )
+{
+    UInt numMoved( 0 );
+    for ( UInt iPoint(0); iPoint < mesh.pointList.size(); ++iPoint )
+    {
+        for ( UInt iCoor(0); iCoor < mesh_Type::S_geoDimensions; ++iCoor )
+        {
+            if ( mesh.pointList[iPoint].coordinate( iCoor ) != reorderedMesh.pointList[iPoint].coordinate( iCoor ) )
+            {
+                ++numMoved;
+                break;
+            }
+        }
+    }
+    return numMoved;
+}
+
+// Solve the Laplace problem on the mesh and compute the L2 error and the L2 norm of the solution
+void solveLaplacian( const meshPtr_Type& fullMeshPtr, const std::string& order, const GetPot& dataFile,
+                     const commPtr_Type& comm, Real& l2Error, Real& l2Norm )
+{
+    meshPtr_Type meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, comm );
+        meshPtr = meshPart.meshPartition();
+    }
+
+    feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, order, 1, comm ) );
+
+    BCFunctionBase uExact( Laplacian::uexact );
+    BCHandler bcHandler;
+    for ( UInt iDirichlet( 1 ); iDirichlet <= 26; ++iDirichlet )
+    {
+        bcHandler.addBC( "Wall", iDirichlet, Essential, Full, uExact, 1 );
+    }
+    bcHandler.bcUpdate( *uFESpace->mesh(), uFESpace->feBd(), uFESpace->dof() );
+
+    ADRAssembler<mesh_Type, matrix_Type, vector_Type> adrAssembler;
+    adrAssembler.setup( uFESpace, uFESpace );
+
+    matrixPtr_Type systemMatrix( new matrix_Type( uFESpace->map() ) );
+    adrAssembler.addDiffusion( systemMatrix, 1.0 );
+
+    vector_Type rhs( uFESpace->map(), Repeated );
+    adrAssembler.addMassRhs( rhs, Laplacian::f, 0.0 );
+    rhs.globalAssemble();
+
+    systemMatrix->globalAssemble();
+    vector_Type rhsBC( rhs, Unique );
+    bcManage( *systemMatrix, rhsBC, *uFESpace->mesh(), uFESpace->dof(), bcHandler, uFESpace->feBd(), 1.0, 0.0 );
+
+    boost::shared_ptr<Preconditioner> precPtr( new PreconditionerIfpack );
+    precPtr->setDataFromGetPot( dataFile, "prec" );
+
+    SolverAztecOO linearSolver;
+    linearSolver.setCommunicator( comm );
+    linearSolver.setDataFromGetPot( dataFile, "solver" );
+    linearSolver.setPreconditioner( precPtr );
+
+    vector_Type solution( uFESpace->map(), Unique );
+    linearSolver.setMatrix( *systemMatrix );
+    linearSolver.solveSystem( rhsBC, solution, systemMatrix );
+
+    const vector_Type solutionRepeated( solution, Repeated );
+    l2Error = uFESpace->l2Error( Laplacian::uexact, solutionRepeated, 0.0 );
+    l2Norm = uFESpace->l2Norm( solutionRepeated );
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    commPtr_Type Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    commPtr_Type Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    GetPot command_line( argc, argv );
+    const std::string dataFileName = command_line.follow( "data_reordering", 2, "-f", "--file" );
+    GetPot dataFile( dataFileName );
+
+    const UInt numElements( dataFile( "mesh/num_elements", 6 ) );
+    const Real tolerance( dataFile( "mesh/tolerance", 1e-8 ) );
+
+    Laplacian::setModes( 1, 1, 1 );
+
+    bool success( true );
+
+    const std::string methods[] = { "rcm", "hilbert" };
+    const std::string orders[] = { "P1", "P2" };
+
+    for ( UInt iOrder(0); iOrder < 2; ++iOrder )
+    {
+        Real referenceError, referenceNorm;
+        solveLaplacian( buildMesh( numElements, Comm ), orders[iOrder], dataFile, Comm, referenceError, referenceNorm );
+        if ( verbose ) std::cout << " ---> " << orders[iOrder] << ", original numbering : L2 error " << referenceError
+                                 << ", L2 norm " << referenceNorm << std::endl;
+
+        for ( UInt iMethod(0); iMethod < 2; ++iMethod )
+        {
+            meshPtr_Type meshPtr( buildMesh( numElements, Comm ) );
+            MeshUtility::reorderMesh( *meshPtr, methods[iMethod] );
+
+            // Check that the test is meaningful: the points have been renumbered
+            const UInt numMoved( numMovedPoints( *buildMesh( numElements, Comm ), *meshPtr ) );
+            if ( verbose ) std::cout << " ---> " << methods[iMethod] << ", renumbered points : " << numMoved << std::endl;
+            success &= numMoved > 0;
+
+            Real error, norm;
+            solveLaplacian( meshPtr, orders[iOrder], dataFile, Comm, error, norm );
+
+            const Real errorDifference( std::abs( error - referenceError ) / referenceError );
+            const Real normDifference( std::abs( norm - referenceNorm ) / referenceNorm );
+            if ( verbose ) std::cout << " ---> " << orders[iOrder] << ", " << methods[iMethod]
+                                     << " : L2 error " << error << " (difference " << errorDifference << ")"
+                                     << ", L2 norm " << norm << " (difference " << normDifference << ")" << std::endl;
+            success &= errorDifference < tolerance;
+            success &= normDifference < tolerance;
+        }
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,220 @@
+//@HEADER
+/*
+*******************************************************************************
+
+Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+Copyright (C) 2010, 2011, 2012 EPFL, Politecnico di Milano, Emory University
+
+This file is part of LifeV.
+
+LifeV is free software; you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+LifeV is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Test for PartitionIO class - parallel write and read
+
+    @date 19-10-2012
+
+    Every process builds the mesh and partitions it with ParMETIS, as the
+    UtilityMeshPartitioner. Each process writes its own part in the HDF5
+    container with the collective writes of PartitionIO, then reads back the
+    part of its rank. The part read is compared with the part written: number
+    of entities, global ids, coordinates and connectivity of the elements.
+    Both the standard and the transposed layouts are tested.
+ */
+
+#include <lifev/core/LifeV.hpp>
+
+#include <iostream>
+#include <string>
+
+#include "Epetra_config.h"
+
+#ifdef HAVE_HDF5
+#ifdef HAVE_MPI
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <mpi.h>
+
+#include <Epetra_MpiComm.h>
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/filter/GetPot.hpp>
+#include <lifev/core/filter/PartitionIO.hpp>
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef boost::shared_ptr<mesh_Type> meshPtr_Type;
+
+namespace
+{
+
+// Compare the part written with the part read, on the current process
+bool comparePartitions(const mesh_Type& written, const mesh_Type& read)
+{
+    if (written.numPoints() != read.numPoints()
+        || written.numElements() != read.numElements()
+        || written.numFaces() != read.numFaces()
+        || written.numEdges() != read.numEdges())
+    {
+        return false;
+    }
+
+    for (UInt i = 0; i < written.numPoints(); ++i)
+    {
+        if (written.point(i).id() != read.point(i).id())
+        {
+            return false;
+        }
+        for (UInt j = 0; j < 3; ++j)
+        {
+            if (written.point(i).coordinate(j) != read.point(i).coordinate(j))
+            {
+                return false;
+            }
+        }
+    }
+
+    for (UInt i = 0; i < written.numElements(); ++i)
+    {
+        if (written.element(i).id() != read.element(i).id())
+        {
+            return false;
+        }
+        for (UInt k = 0; k < mesh_Type::elementShape_Type::S_numPoints; ++k)
+        {
+            if (written.element(i).point(k).id() != read.element(i).point(k).id())
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+}
+
+#endif /* HAVE_MPI */
+#endif /* HAVE_HDF5 */
+
+int main(int argc, char** argv)
+{
+#ifdef HAVE_HDF5
+#ifdef HAVE_MPI
+
+    MPI_Init(&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> comm(new Epetra_MpiComm(MPI_COMM_WORLD));
+    const bool verbose(comm->MyPID() == 0);
+
+    if (comm->NumProc() < 2)
+    {
+        std::cout << "This test needs to be run "
+                  << "with at least two processes. Aborting."
+                  << std::endl;
+        MPI_Finalize();
+        return(EXIT_FAILURE);
+    }
+
+    GetPot commandLine(argc, argv);
+    const std::string dataFileName = commandLine.follow("data", 2, "-f", "--file");
+    GetPot dataFile(dataFileName);
+
+    const UInt numElements(dataFile("mesh/nelements", 10));
+
+    bool success(true);
+
+    // Every process reads the mesh and ParMETIS builds one part per process
+    meshPtr_Type fullMeshPtr(new mesh_Type(comm));
+    regularMesh3D(*fullMeshPtr, 1, numElements, numElements, numElements,
+                  false, 2.0, 2.0, 2.0, -1.0, -1.0, -1.0);
+    const UInt numGlobalElements(fullMeshPtr->numElements());
+
+    MeshPartitioner<mesh_Type> meshPart(fullMeshPtr, comm);
+    meshPart.releaseUnpartitionedMesh();
+    fullMeshPtr.reset();
+
+    const meshPtr_Type writtenPart(meshPart.meshPartition());
+
+    // The parts cover the mesh
+    Int numLocalElements(writtenPart->numElements());
+    Int numPartElements(0);
+    comm->SumAll(&numLocalElements, &numPartElements, 1);
+    success &= static_cast<UInt>(numPartElements) == numGlobalElements;
+
+    for (UInt transpose = 0; transpose < 2; ++transpose)
+    {
+        const bool transposeInFile(transpose == 1);
+        const std::string partsFileName(transposeInFile ? "parallel_parts_transposed.h5" : "parallel_parts.h5");
+
+        // Each process writes its own part
+        {
+            PartitionIO<mesh_Type> partitionIO(partsFileName, comm, transposeInFile);
+            partitionIO.write(meshPart.meshPartitions());
+        }
+
+        // Each process reads the part of its rank
+        meshPtr_Type readPart;
+        {
+            PartitionIO<mesh_Type> partitionIO(partsFileName, comm, transposeInFile);
+            partitionIO.read(readPart);
+        }
+
+        Int localSuccess(comparePartitions(*writtenPart, *readPart));
+        Int globalSuccess(0);
+        comm->MinAll(&localSuccess, &globalSuccess, 1);
+
+        if (verbose)
+        {
+            std::cout << " ---> Parts " << (transposeInFile ? "transposed" : "standard")
+                      << " read back " << (globalSuccess ? "correctly" : "with differences") << std::endl;
+        }
+        success &= globalSuccess == 1;
+    }
+
+    MPI_Finalize();
+
+    if (!success)
+    {
+        if (verbose) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return(EXIT_FAILURE);
+    }
+
+    if (verbose) std::cout << "End Result: TEST PASSED" << std::endl;
+
+#else
+    std::cout << "This test needs MPI to run. Aborting." << std::endl;
+    return(EXIT_FAILURE);
+#endif /* HAVE_MPI */
+#else
+    std::cout << "This test needs HDF5 to run. Aborting." << std::endl;
+    return(EXIT_FAILURE);
+#endif /* HAVE_HDF5 */
+
+    return(EXIT_SUCCESS);
+}
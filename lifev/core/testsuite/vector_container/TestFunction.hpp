@@ -179,10 +179,33 @@ TestFunction( boost::shared_ptr<VectorType> A1, boost::shared_ptr<VectorType> B1
     VV3->showMe();
 
 
-
-
-
-
+    // Fused reductions: one collective for the whole container
+    ContainerOfBaseVectors_ptr VV4, VV5;
+    VV4.reset( new ContainerOfBaseVectors( *VV1 + 1.0 ) );
+
+    Real blocksDot( 0. ), blocksNormInf( 0. );
+    for ( UInt i(0); i < VV1->vectorsNumber(); ++i )
+    {
+        blocksDot += (*VV1)( i )->dot( *(*VV4)( i ) );
+        blocksNormInf = std::max( blocksNormInf, (*VV1)( i )->normInf() );
+    }
+    std::cout << "VV1.dot(VV1 + 1) = " << VV1->dot( *VV4 ) << " (blocks: " << blocksDot << ")" << std::endl;
+    std::cout << "Norm2(VV1) = " << VV1->norm2() << std::endl;
+    std::cout << "NormInf(VV1) = " << VV1->normInf() << " (blocks: " << blocksNormInf << ")" << std::endl << std::endl;
+
+    if ( std::fabs( VV1->dot( *VV4 ) - blocksDot ) > 1e-10 * std::fabs( blocksDot )
+         || VV1->normInf() != blocksNormInf
+         || std::fabs( VV1->norm2() * VV1->norm2() - VV1->dot( *VV1 ) ) > 1e-10 * VV1->dot( *VV1 ) )
+        return EXIT_FAILURE;
+
+    // Fused update: VV5 = 2 * VV1 - VV4
+    VV5.reset( new ContainerOfBaseVectors( *VV1 ) );
+    VV5->update( -1., *VV4, 2. );
+    std::cout << "VV5 = 2 * VV1 - VV4" << std::endl;
+    VV5->showMe();
+
+    if ( ( *VV5 - ( 2. * *VV1 - *VV4 ) ).normInf() > 1e-10 )
+        return EXIT_FAILURE;
 
     // Replace a vector
     UInt pos = 2;
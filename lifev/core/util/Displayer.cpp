@@ -37,6 +37,8 @@
 
 #include<lifev/core/util/Displayer.hpp>
 
+#include <iomanip>
+
 namespace LifeV
 {
 
@@ -45,7 +47,10 @@ namespace LifeV
 // ===================================================
 Displayer::Displayer():
     M_comm (commPtr_Type()),
-    M_verbose (true)
+    M_verbose (true),
+    M_timings (new timings_Type()),
+    M_timingsIndex (new timingsIndex_Type()),
+    M_lastLabel ()
 {
     if (M_comm)
         M_verbose = M_comm->MyPID() == 0;
@@ -53,7 +58,10 @@ Displayer::Displayer():
 
 Displayer::Displayer( const commPtr_Type& comm ):
         M_comm          ( comm ),
-        M_verbose       ( true )
+        M_verbose       ( true ),
+        M_timings       ( new timings_Type() ),
+        M_timingsIndex  ( new timingsIndex_Type() ),
+        M_lastLabel     ()
 {
     if ( M_comm )
         M_verbose = M_comm->MyPID() == 0;
@@ -61,13 +69,50 @@ Displayer::Displayer( const commPtr_Type& comm ):
 
 Displayer::Displayer( const Displayer& displayer ):
         M_comm          ( displayer.M_comm ),
-        M_verbose       ( displayer.M_verbose )
+        M_verbose       ( displayer.M_verbose ),
+        M_timings       ( displayer.M_timings ),
+        M_timingsIndex  ( displayer.M_timingsIndex ),
+        M_lastLabel     ( displayer.M_lastLabel )
 {
 }
 
 // =================
 // Methods
 // =================
+void
+Displayer::leaderPrintTimings( const std::string& title ) const
+{
+#ifdef ENABLE_PRODUCTION_LOGGING
+    const UInt numValues( M_timings->size() );
+    if ( numValues == 0 )
+        return;
+
+    std::vector<Real> localValues( numValues ), globalValues( numValues );
+    for ( UInt i( 0 ); i < numValues; ++i )
+        localValues[i] = (*M_timings)[i].second;
+
+    // A single reduction for all the values recorded since the last call
+    if ( M_comm.get() )
+        M_comm->MaxAll( &localValues[0], &globalValues[0], numValues );
+    else
+        globalValues = localValues;
+
+    if ( M_verbose )
+    {
+        std::cout << title << " (max among the processors)" << std::endl;
+        for ( UInt i( 0 ); i < numValues; ++i )
+            std::cout << "  " << std::setw( 60 ) << std::left << (*M_timings)[i].first
+                      << globalValues[i] << std::endl;
+        std::cout << std::right << std::flush;
+    }
+
+    M_timings->clear();
+    M_timingsIndex->clear();
+#else
+    ( void ) title;
+#endif
+}
+
 const bool&
 Displayer::isLeader() const
 {
@@ -53,6 +53,12 @@
 
 #include <lifev/core/LifeV.hpp>
 
+#include <map>
+
+#ifdef ENABLE_PRODUCTION_LOGGING
+#include <sstream>
+#endif
+
 namespace LifeV
 {
 
@@ -62,6 +68,16 @@ namespace LifeV
  *
  * If a communicator is passed to the constructor only one processor (the leader) will print out the message.
  * If no communicator is passed to the constructor every processor prints the messages.
+ *
+ * When LifeV is configured with ENABLE_PRODUCTION_LOGGING, leaderPrintMax() does not communicate:
+ * the leader prints its local value, and the value is accumulated under a label made of the first
+ * argument of the last leaderPrint() and of message1. The first arguments are the fixed part of the
+ * messages (the values, e.g. the iteration number, being passed as the following arguments), so that the
+ * number of labels does not grow with the number of calls. The maxima over the processors of the accumulated
+ * values are then computed with a single reduction and printed by leaderPrintTimings(), to be called
+ * by all the processors of the communicator, e.g. at the end of each time step.
+ * The keys must be recorded in the same order on all the processors, as the MaxAll of the default mode
+ * already requires. The copies of a Displayer share the same record.
  */
 class Displayer
 {
@@ -73,6 +89,11 @@ public:
     typedef Epetra_Comm                              comm_Type;
     typedef boost::shared_ptr< comm_Type >           commPtr_Type;
 
+    typedef std::vector< std::pair< std::string, Real > > timings_Type;
+    typedef boost::shared_ptr< timings_Type >        timingsPtr_Type;
+    typedef std::map< std::string, UInt >            timingsIndex_Type;
+    typedef boost::shared_ptr< timingsIndex_Type >   timingsIndexPtr_Type;
+
     //@}
 
 
@@ -146,6 +167,14 @@ public:
     template <typename T1, typename T2>
     void leaderPrintMax( const T1& message1, const Real& localMax, const T2& message2 ) const;
 
+    //! Print the maximum among the processors of the values recorded by leaderPrintMax() and clear them
+    /*!
+     * Only with ENABLE_PRODUCTION_LOGGING, where a single MaxAll is done for all the recorded values;
+     * otherwise the values are already printed by leaderPrintMax() and this method does nothing.
+     * @param title title of the table
+     */
+    void leaderPrintTimings( const std::string& title = "Timings" ) const;
+
     //! Determine if it is the leader
     /*!
      * @return true if it is process 0 of the communicator
@@ -177,9 +206,21 @@ public:
 
 protected:
 
+    //! Record a value under the label made of the last label and of message1
+    template <typename T1>
+    void recordValue( const T1& message1, const Real& value ) const;
+
+    //! Set the label of the next recorded values
+    template <typename T1>
+    void setLabel( const T1& message1 ) const;
+
     commPtr_Type					    M_comm;
     bool	           					M_verbose;
 
+    timingsPtr_Type                     M_timings;
+    timingsIndexPtr_Type                M_timingsIndex;
+    mutable std::string                 M_lastLabel;
+
 };
 
 
@@ -190,6 +231,9 @@ template <typename T1>
 void
 Displayer::leaderPrint( const T1& message1 ) const
 {
+#ifdef ENABLE_PRODUCTION_LOGGING
+    setLabel( message1 );
+#endif
     if ( M_verbose )
         std::cout << message1 << std::flush;
 }
@@ -198,6 +242,9 @@ template <typename T1, typename T2>
 void
 Displayer::leaderPrint( const T1& message1, const T2& message2 ) const
 {
+#ifdef ENABLE_PRODUCTION_LOGGING
+    setLabel( message1 );
+#endif
     if ( M_verbose )
         std::cout << message1 << message2 << std::flush;
 }
@@ -206,6 +253,9 @@ template <typename T1, typename T2, typename T3>
 void
 Displayer::leaderPrint( const T1& message1, const T2& message2, const T3& message3 ) const
 {
+#ifdef ENABLE_PRODUCTION_LOGGING
+    setLabel( message1 );
+#endif
     if ( M_verbose )
         std::cout << message1 << message2 << message3 << std::flush;
 }
@@ -214,6 +264,11 @@ template <typename T1>
 void
 Displayer::leaderPrintMax( const T1& message1, const Real& localMax ) const
 {
+#ifdef ENABLE_PRODUCTION_LOGGING
+    recordValue( message1, localMax );
+    if ( M_verbose )
+        std::cout << message1 << localMax << std::endl;
+#else
     if ( M_comm.get() )
     {
         Real num( localMax );
@@ -225,12 +280,18 @@ Displayer::leaderPrintMax( const T1& message1, const Real& localMax ) const
     }
     else
         std::cout << message1 << localMax << std::endl;
+#endif
 }
 
 template <typename T1, typename T2>
 void
 Displayer::leaderPrintMax( const T1& message1, const Real& localMax, const T2& message2 ) const
 {
+#ifdef ENABLE_PRODUCTION_LOGGING
+    recordValue( message1, localMax );
+    if ( M_verbose )
+        std::cout << message1 << localMax << message2 << std::endl;
+#else
     if ( M_comm.get() )
     {
         Real num( localMax );
@@ -242,6 +303,31 @@ Displayer::leaderPrintMax( const T1& message1, const Real& localMax, const T2& m
     }
     else
         std::cout << message1 << localMax << message2 << std::endl;
+#endif
+}
+
+template <typename T1>
+void
+Displayer::recordValue( const T1& message1, const Real& value ) const
+{
+    std::ostringstream label;
+    label << M_lastLabel << message1;
+
+    // The same label is usually recorded once per time step: accumulate it
+    std::pair<timingsIndex_Type::iterator, bool> inserted( M_timingsIndex->insert( std::make_pair( label.str(), M_timings->size() ) ) );
+    if ( inserted.second )
+        M_timings->push_back( std::make_pair( label.str(), value ) );
+    else
+        ( *M_timings )[ inserted.first->second ].second += value;
+}
+
+template <typename T1>
+void
+Displayer::setLabel( const T1& message1 ) const
+{
+    std::ostringstream label;
+    label << message1;
+    M_lastLabel = label.str();
 }
 
 } // Namespace LifeV
@@ -572,6 +572,24 @@ public:
         return M_residual;
     }
 
+    /*!
+      Returns the pointer of the hybrid matrix, with the boundary conditions.
+      @return Constant matrixPtr_Type reference of the hybrid matrix.
+    */
+    const matrixPtr_Type& matrixPtr () const
+    {
+        return M_matrHybrid;
+    }
+
+    /*!
+      Returns the pointer of the hybrid right hand side, with the boundary conditions.
+      @return Constant vectorPtr_Type reference of the right hand side.
+    */
+    const vectorPtr_Type& rightHandSidePtr () const
+    {
+        return M_rhs;
+    }
+
     //! Returns boundary conditions handler.
     /*!
       @return Constant reference of boundary conditions handler.
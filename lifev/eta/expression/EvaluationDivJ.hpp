@@ -185,7 +185,7 @@ public:
 private:
 
     //! Pointer to the data
-    std::vector< std::vector < return_Type > > const * M_valuesPtr;
+    boost::multi_array< return_Type, 2 > const * M_valuesPtr;
 
 };
 
@@ -170,7 +170,7 @@ public:
 private:
 
     //! Storage of the pointer to the data
-    std::vector< std::vector < return_Type > > const * M_valuesPtr;
+    boost::multi_array< return_Type, 2 > const * M_valuesPtr;
 
 };
 
@@ -302,7 +302,7 @@ public:
 private:
 
     //! Storage of the pointer to the data
-	std::vector< std::vector < VectorSmall<spaceDim> > > const * M_valuesPtr;
+	boost::multi_array< VectorSmall<spaceDim>, 2 > const * M_valuesPtr;
 
 };
 
@@ -165,7 +165,7 @@ public:
 private:
 
     //! Pointer to the data
-    std::vector< std::vector < return_Type > > const * M_valuesPtr;
+    boost::multi_array< return_Type, 2 > const * M_valuesPtr;
 
 };
 
@@ -291,7 +291,7 @@ public:
 private:
 
     //! Pointer to the data
-	std::vector< std::vector < VectorSmall<spaceDim> > > const * M_valuesPtr;
+	boost::multi_array< VectorSmall<spaceDim>, 2 > const * M_valuesPtr;
 
 };
 
@@ -173,7 +173,7 @@ public:
 private:
 
     //! Storage of the pointer to the data
-    std::vector< std::vector < return_Type > > const * M_valuesPtr;
+    boost::multi_array< return_Type, 2 > const * M_valuesPtr;
 
 };
 
@@ -310,7 +310,7 @@ public:
 private:
 
     //! Storage of the pointer to the data
-	std::vector< std::vector < Real > > const * M_valuesPtr;
+	boost::multi_array< Real, 2 > const * M_valuesPtr;
 
 };
 
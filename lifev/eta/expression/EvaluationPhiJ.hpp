@@ -166,7 +166,7 @@ public:
 private:
 
     //! Storage for the pointer to the data
-    std::vector< std::vector < return_Type > > const * M_valuesPtr;
+    boost::multi_array< return_Type, 2 > const * M_valuesPtr;
 
 };
 
@@ -295,7 +295,7 @@ public:
 private:
 
     //! Storage for the pointer to the data
-	std::vector< std::vector < Real > > const * M_valuesPtr;
+	boost::multi_array< Real, 2 > const * M_valuesPtr;
 
 };
 
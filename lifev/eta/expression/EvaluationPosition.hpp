@@ -169,7 +169,7 @@ public:
 private:
 
     //! Storage for the pointer to the data
-    std::vector< VectorSmall<spaceDim> > const * M_valuePtr;
+    boost::multi_array< VectorSmall<spaceDim>, 1 > const * M_valuePtr;
 
 };
 
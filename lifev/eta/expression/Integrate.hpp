@@ -43,6 +43,7 @@
 #include <lifev/core/fem/QuadratureRule.hpp>
 
 #include <lifev/eta/expression/IntegrateMatrixElement.hpp>
+#include <lifev/eta/expression/IntegrateMatrixFreeElement.hpp>
 #include <lifev/eta/expression/IntegrateVectorElement.hpp>
 #include <lifev/eta/expression/IntegrateValueElement.hpp>
 
@@ -78,6 +79,28 @@ integrate( const RequestLoopElement<MeshType>& request,
 		(request.mesh(),quadrature,testSpace,solutionSpace,expression);
 }
 
+//! Integrate function for matricial expressions, without assembly
+/*!
+  This function is an helper function to instantiate the class
+  for applying a bilinear form to a vector without assembling
+  the matrix. The resulting object is an Epetra_Operator that can
+  be passed to the iterative solvers, e.g.
+
+  integrateMatrixFree( elements(mesh), quad, uSpace, uSpace, dot( grad(phi_i), grad(phi_j) ) )
+ */
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+boost::shared_ptr< IntegrateMatrixFreeElement<MeshType,TestSpaceType,SolutionSpaceType,ExpressionType> >
+integrateMatrixFree( const RequestLoopElement<MeshType>& request,
+                     const QuadratureRule& quadrature,
+                     const boost::shared_ptr<TestSpaceType>& testSpace,
+                     const boost::shared_ptr<SolutionSpaceType>& solutionSpace,
+                     const ExpressionType& expression)
+{
+    return boost::shared_ptr< IntegrateMatrixFreeElement<MeshType,TestSpaceType,SolutionSpaceType,ExpressionType> >
+        ( new IntegrateMatrixFreeElement<MeshType,TestSpaceType,SolutionSpaceType,ExpressionType>
+          (request.mesh(),quadrature,testSpace,solutionSpace,expression) );
+}
+
 //! Integrate function for vectorial expressions
 /*!
   @author Samuel Quinodoz <samuel.quinodoz@epfl.ch>
@@ -296,39 +296,54 @@ addTo(MatrixType& mat)
         // Update the evaluation
         M_evaluation.update(iElement);
 
-        // Loop on the blocks
-
+        // Set the row global indices in the local matrix
         for (UInt iblock(0); iblock < TestSpaceType::S_fieldDim; ++iblock)
         {
-            for (UInt jblock(0); jblock < SolutionSpaceType::S_fieldDim; ++jblock)
+            for (UInt i(0); i<nbTestDof; ++i)
             {
+                M_elementalMatrix.setRowIndex
+                    (i+iblock*nbTestDof,
+                     M_testSpace->dof().localToGlobalMap(iElement,i)+ iblock*M_testSpace->dof().numTotalDof());
+            }
+        }
 
-                // Set the row global indices in the local matrix
-                for (UInt i(0); i<nbTestDof; ++i)
-                {
-                    M_elementalMatrix.setRowIndex
-						(i+iblock*nbTestDof,
-                         M_testSpace->dof().localToGlobalMap(iElement,i)+ iblock*M_testSpace->dof().numTotalDof());
-                }
+        // Set the column global indices in the local matrix
+        for (UInt jblock(0); jblock < SolutionSpaceType::S_fieldDim; ++jblock)
+        {
+            for (UInt j(0); j<nbSolutionDof; ++j)
+            {
+                M_elementalMatrix.setColumnIndex
+                    (j+jblock*nbSolutionDof,
+                     M_solutionSpace->dof().localToGlobalMap(iElement,j)+ jblock*M_solutionSpace->dof().numTotalDof());
+            }
+        }
 
-                // Set the column global indices in the local matrix
-                for (UInt j(0); j<nbSolutionDof; ++j)
-                {
-                    M_elementalMatrix.setColumnIndex
-						(j+jblock*nbSolutionDof,
-                         M_solutionSpace->dof().localToGlobalMap(iElement,j)+ jblock*M_solutionSpace->dof().numTotalDof());
-                }
+        // Make the assembly: the weight is hoisted out of the loops on the
+        // blocks and each row of the elemental matrix is accessed contiguously.
+        // The values that do not depend on the basis functions (coefficients,
+        // interpolated fields, ...) are computed once per quadrature node in
+        // M_evaluation.update, value_qij only combines the stored tables, so a
+        // further table of size nbQuadPt x nbTestDof x nbSolutionDof would be
+        // filled with the same operations.
+        for (UInt iQuadPt(0); iQuadPt< nbQuadPt; ++iQuadPt)
+        {
+            const Real wDet(M_globalCFE->wDet(iQuadPt));
+
+            for (UInt iblock(0); iblock < TestSpaceType::S_fieldDim; ++iblock)
+            {
+                const UInt rowOffset(iblock*nbTestDof);
 
-                for (UInt iQuadPt(0); iQuadPt< nbQuadPt; ++iQuadPt)
+                for (UInt jblock(0); jblock < SolutionSpaceType::S_fieldDim; ++jblock)
                 {
+                    const UInt columnOffset(jblock*nbSolutionDof);
+
                     for (UInt i(0); i<nbTestDof; ++i)
                     {
+                        Real* row(&M_elementalMatrix.element(i+rowOffset,columnOffset));
+
                         for (UInt j(0); j<nbSolutionDof; ++j)
                         {
-                            M_elementalMatrix.element(i+iblock*nbTestDof,j+jblock*nbSolutionDof) +=
-								M_evaluation.value_qij(iQuadPt,i+iblock*nbTestDof,j+jblock*nbSolutionDof)
-								* M_globalCFE->wDet(iQuadPt);
-
+                            row[j] += M_evaluation.value_qij(iQuadPt,i+rowOffset,j+columnOffset) * wDet;
                         }
                     }
                 }
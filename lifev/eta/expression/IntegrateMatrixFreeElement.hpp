@@ -0,0 +1,428 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief This file contains the definition of the IntegrateMatrixFreeElement class.
+
+    @date 10/2012
+ */
+
+#ifndef INTEGRATE_MATRIX_FREE_ELEMENT_HPP
+#define INTEGRATE_MATRIX_FREE_ELEMENT_HPP
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/fem/QuadratureRule.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+#include <lifev/core/operator/LinearOperator.hpp>
+
+#include <lifev/eta/fem/ETCurrentFE.hpp>
+#include <lifev/eta/fem/MeshGeometricMap.hpp>
+
+#include <lifev/eta/expression/ExpressionToEvaluation.hpp>
+
+#include <boost/shared_ptr.hpp>
+
+#include <vector>
+
+
+namespace LifeV
+{
+
+namespace ExpressionAssembly
+{
+
+
+//! The class to apply a bilinear form to a vector without assembling the matrix
+/*!
+  This class stores the same data as the IntegrateMatrixElement class, but instead
+  of assembling the matrix, it implements the Epetra_Operator interface: each call
+  to Apply performs the loop over the elements, gathers the local values of the
+  input vector, evaluates the expression in the quadrature nodes and scatter-adds
+  the local results in the output vector. The matrix is therefore never stored,
+  so that the operator can be used with the iterative solvers (AztecOO, Belos)
+  also for problems where the matrix would not fit in memory.
+
+  The local indices of the degrees of freedom of each element in the repeated
+  maps are computed once in the constructor, together with the vectors used for
+  the communications, so that Apply does not perform any search in the maps.
+
+  The domain map is the unique map of the solution space, the range map the
+  unique map of the test space.
+ */
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+class IntegrateMatrixFreeElement : public Operators::LinearOperator
+{
+public:
+
+    //! @name Public Types
+    //@{
+
+    //! Type of the Evaluation
+    typedef typename ExpressionToEvaluation< ExpressionType,
+                                             TestSpaceType::S_fieldDim,
+                                             SolutionSpaceType::S_fieldDim,
+                                             3>::evaluation_Type  evaluation_Type;
+
+    typedef Operators::LinearOperator::vector_Type vector_Type;
+    typedef Operators::LinearOperator::map_Type map_Type;
+    typedef Operators::LinearOperator::comm_Type comm_Type;
+
+    //@}
+
+
+    //! @name Constructors, destructor
+    //@{
+
+    //! Full data constructor
+    IntegrateMatrixFreeElement(const boost::shared_ptr<MeshType>& mesh,
+                               const QuadratureRule& quadrature,
+                               const boost::shared_ptr<TestSpaceType>& testSpace,
+                               const boost::shared_ptr<SolutionSpaceType>& solutionSpace,
+                               const ExpressionType& expression);
+
+    //! Destructor
+    virtual ~IntegrateMatrixFreeElement();
+
+    //@}
+
+
+    //! @name Methods
+    //@{
+
+    //! Ouput method
+    void check(std::ostream& out = std::cout);
+
+    //! Transpose is not supported: returns -1 if useTranspose is true
+    int SetUseTranspose(bool useTranspose)
+    {
+        return ( useTranspose ? -1 : 0 );
+    }
+
+    //! Apply the operator: Y = A X
+    /*!
+      The loop over the elements is located right in this method. For each
+      element, the values are updated and the local product is computed
+      with the values of the expression in the quadrature nodes.
+     */
+    int Apply(const vector_Type& X, vector_Type& Y) const;
+
+    //! The inverse is not available: returns -1
+    int ApplyInverse(const vector_Type& /*X*/, vector_Type& /*Y*/) const
+    {
+        return -1;
+    }
+
+    //! The norm is not available
+    double NormInf() const
+    {
+        return -1.0;
+    }
+
+    //@}
+
+
+    //! @name Get Methods
+    //@{
+
+    const char* Label() const
+    {
+        return "ETA matrix free operator";
+    }
+
+    bool UseTranspose() const
+    {
+        return false;
+    }
+
+    bool HasNormInf() const
+    {
+        return false;
+    }
+
+    const comm_Type& Comm() const
+    {
+        return OperatorRangeMap().Comm();
+    }
+
+    const map_Type& OperatorDomainMap() const
+    {
+        return *M_solutionSpace->map().map(Unique);
+    }
+
+    const map_Type& OperatorRangeMap() const
+    {
+        return *M_testSpace->map().map(Unique);
+    }
+
+    //@}
+
+private:
+
+    //! @name Private Methods
+    //@{
+
+    //! No empty constructor
+    IntegrateMatrixFreeElement();
+
+    //! No copy constructor
+    IntegrateMatrixFreeElement(const IntegrateMatrixFreeElement&);
+
+    //! Compute the local indices of the degrees of freedom of each element in the repeated maps
+    void setupLocalIndices();
+
+    //@}
+
+    // Pointer on the mesh
+    boost::shared_ptr<MeshType> M_mesh;
+
+    // Quadrature to be used
+    QuadratureRule M_quadrature;
+
+    // Shared pointer on the Spaces
+    boost::shared_ptr<TestSpaceType> M_testSpace;
+    boost::shared_ptr<SolutionSpaceType> M_solutionSpace;
+
+    // Tree to compute the values (updated in Apply)
+    mutable evaluation_Type M_evaluation;
+
+    ETCurrentFE<3,1>* M_globalCFE;
+    ETCurrentFE<3,TestSpaceType::S_fieldDim>* M_testCFE;
+    ETCurrentFE<3,SolutionSpaceType::S_fieldDim>* M_solutionCFE;
+
+    // Number of local dofs (all the blocks) of an element
+    UInt M_nbLocalTestDof;
+    UInt M_nbLocalSolutionDof;
+
+    // Local indices in the repeated maps: [element * nbLocalDof + local dof]
+    std::vector<Int> M_testLocalIndices;
+    std::vector<Int> M_solutionLocalIndices;
+
+    // Vectors used for the communications
+    mutable VectorEpetra M_domainUnique;
+    mutable VectorEpetra M_domainRepeated;
+    mutable VectorEpetra M_rangeUnique;
+    mutable VectorEpetra M_rangeRepeated;
+
+    // Local values of an element
+    mutable std::vector<Real> M_localSolution;
+};
+
+
+// ===================================================
+// IMPLEMENTATION
+// ===================================================
+
+// ===================================================
+// Constructors & Destructor
+// ===================================================
+
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+IntegrateMatrixFreeElement<MeshType,TestSpaceType,SolutionSpaceType,ExpressionType>::
+IntegrateMatrixFreeElement(const boost::shared_ptr<MeshType>& mesh,
+                           const QuadratureRule& quadrature,
+                           const boost::shared_ptr<TestSpaceType>& testSpace,
+                           const boost::shared_ptr<SolutionSpaceType>& solutionSpace,
+                           const ExpressionType& expression)
+    :   M_mesh(mesh),
+        M_quadrature(quadrature),
+        M_testSpace(testSpace),
+        M_solutionSpace(solutionSpace),
+        M_evaluation(expression),
+
+        M_globalCFE(new ETCurrentFE<3,1>(feTetraP0,geometricMapFromMesh<MeshType>(),quadrature)),
+        M_testCFE(new ETCurrentFE<3,TestSpaceType::S_fieldDim>(testSpace->refFE(),testSpace->geoMap(),quadrature)),
+        M_solutionCFE(new ETCurrentFE<3,SolutionSpaceType::S_fieldDim>(solutionSpace->refFE(),solutionSpace->geoMap(),quadrature)),
+
+        M_nbLocalTestDof(TestSpaceType::S_fieldDim*testSpace->refFE().nbDof()),
+        M_nbLocalSolutionDof(SolutionSpaceType::S_fieldDim*solutionSpace->refFE().nbDof()),
+        M_testLocalIndices(),
+        M_solutionLocalIndices(),
+
+        M_domainUnique(solutionSpace->map(),Unique),
+        M_domainRepeated(solutionSpace->map(),Repeated),
+        M_rangeUnique(testSpace->map(),Unique),
+        M_rangeRepeated(testSpace->map(),Repeated),
+
+        M_localSolution(M_nbLocalSolutionDof,0.0)
+{
+    M_evaluation.setQuadrature(quadrature);
+    M_evaluation.setGlobalCFE(M_globalCFE);
+    M_evaluation.setTestCFE(M_testCFE);
+    M_evaluation.setSolutionCFE(M_solutionCFE);
+
+    setupLocalIndices();
+}
+
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+IntegrateMatrixFreeElement<MeshType,TestSpaceType,SolutionSpaceType,ExpressionType>::
+~IntegrateMatrixFreeElement()
+{
+    delete M_globalCFE;
+    delete M_testCFE;
+    delete M_solutionCFE;
+}
+
+// ===================================================
+// Methods
+// ===================================================
+
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+void
+IntegrateMatrixFreeElement<MeshType,TestSpaceType,SolutionSpaceType,ExpressionType>::
+check(std::ostream& out)
+{
+    out << " Checking the matrix free operator : " << std::endl;
+    M_evaluation.display(out);
+    out << std::endl;
+    out << " Local dofs : " << M_nbLocalTestDof << " x " << M_nbLocalSolutionDof << std::endl;
+}
+
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+int
+IntegrateMatrixFreeElement<MeshType,TestSpaceType,SolutionSpaceType,ExpressionType>::
+Apply(const vector_Type& X, vector_Type& Y) const
+{
+    ASSERT( X.NumVectors() == Y.NumVectors(), "Different number of vectors in X and Y");
+
+    const UInt nbElements(M_mesh->numElements());
+    const UInt nbQuadPt(M_quadrature.nbQuadPt());
+
+    // The values of X are copied before Y is modified, as X and Y can be the same object
+    for (Int iVector(0); iVector < X.NumVectors(); ++iVector)
+    {
+        // Gather the values of X, including the ghost dofs
+        M_domainUnique.epetraVector().Update(1.0, *X(iVector), 0.0);
+        M_domainRepeated = M_domainUnique;
+
+        const Real* domainValues(M_domainRepeated.epetraVector()[0]);
+        Real* rangeValues(M_rangeRepeated.epetraVector()[0]);
+
+        M_rangeRepeated *= 0.0;
+
+        for (UInt iElement(0); iElement< nbElements; ++iElement)
+        {
+            // Update the currentFEs
+            M_globalCFE->update(M_mesh->element(iElement),evaluation_Type::S_globalUpdateFlag | ET_UPDATE_WDET);
+            M_testCFE->update(M_mesh->element(iElement),evaluation_Type::S_testUpdateFlag);
+            M_solutionCFE->update(M_mesh->element(iElement),evaluation_Type::S_solutionUpdateFlag);
+
+            // Update the evaluation
+            M_evaluation.update(iElement);
+
+            // Local values of the solution
+            const Int* solutionIndices(&M_solutionLocalIndices[iElement*M_nbLocalSolutionDof]);
+            for (UInt j(0); j<M_nbLocalSolutionDof; ++j)
+            {
+                M_localSolution[j] = domainValues[solutionIndices[j]];
+            }
+
+            // Local product, scattered in the repeated vector
+            const Int* testIndices(&M_testLocalIndices[iElement*M_nbLocalTestDof]);
+            for (UInt iQuadPt(0); iQuadPt< nbQuadPt; ++iQuadPt)
+            {
+                const Real wDet(M_globalCFE->wDet(iQuadPt));
+
+                for (UInt i(0); i<M_nbLocalTestDof; ++i)
+                {
+                    Real partialSum(0.0);
+
+                    for (UInt j(0); j<M_nbLocalSolutionDof; ++j)
+                    {
+                        partialSum += M_evaluation.value_qij(iQuadPt,i,j) * M_localSolution[j];
+                    }
+
+                    rangeValues[testIndices[i]] += partialSum * wDet;
+                }
+            }
+        }
+
+        // Sum the contributions of the ghost dofs
+        M_rangeUnique = M_rangeRepeated;
+
+        Y(iVector)->Update(1.0, M_rangeUnique.epetraVector(), 0.0);
+    }
+
+    return 0;
+}
+
+// ===================================================
+// Private Methods
+// ===================================================
+
+template < typename MeshType, typename TestSpaceType, typename SolutionSpaceType, typename ExpressionType>
+void
+IntegrateMatrixFreeElement<MeshType,TestSpaceType,SolutionSpaceType,ExpressionType>::
+setupLocalIndices()
+{
+    const UInt nbElements(M_mesh->numElements());
+    const UInt nbTestDof(M_testSpace->refFE().nbDof());
+    const UInt nbSolutionDof(M_solutionSpace->refFE().nbDof());
+
+    const map_Type& testMap(*M_testSpace->map().map(Repeated));
+    const map_Type& solutionMap(*M_solutionSpace->map().map(Repeated));
+
+    M_testLocalIndices.resize(nbElements*M_nbLocalTestDof);
+    M_solutionLocalIndices.resize(nbElements*M_nbLocalSolutionDof);
+
+    for (UInt iElement(0); iElement< nbElements; ++iElement)
+    {
+        for (UInt iblock(0); iblock < TestSpaceType::S_fieldDim; ++iblock)
+        {
+            for (UInt i(0); i<nbTestDof; ++i)
+            {
+                const Int globalIndex(M_testSpace->dof().localToGlobalMap(iElement,i)
+                                      + iblock*M_testSpace->dof().numTotalDof());
+
+                M_testLocalIndices[iElement*M_nbLocalTestDof + iblock*nbTestDof + i] = testMap.LID(globalIndex);
+
+                ASSERT(M_testLocalIndices[iElement*M_nbLocalTestDof + iblock*nbTestDof + i] >= 0,
+                       "Test dof not in the repeated map");
+            }
+        }
+
+        for (UInt jblock(0); jblock < SolutionSpaceType::S_fieldDim; ++jblock)
+        {
+            for (UInt j(0); j<nbSolutionDof; ++j)
+            {
+                const Int globalIndex(M_solutionSpace->dof().localToGlobalMap(iElement,j)
+                                      + jblock*M_solutionSpace->dof().numTotalDof());
+
+                M_solutionLocalIndices[iElement*M_nbLocalSolutionDof + jblock*nbSolutionDof + j] = solutionMap.LID(globalIndex);
+
+                ASSERT(M_solutionLocalIndices[iElement*M_nbLocalSolutionDof + jblock*nbSolutionDof + j] >= 0,
+                       "Solution dof not in the repeated map");
+            }
+        }
+    }
+}
+
+} // Namespace ExpressionAssembly
+
+} // Namespace LifeV
+
+#endif
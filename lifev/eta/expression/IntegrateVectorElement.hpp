@@ -266,34 +266,25 @@ addTo(VectorType& vec)
         // Update the evaluation
         M_evaluation.update(iElement);
 
-        // Loop on the blocks
-
+        // Set the row global indices in the local vector
         for (UInt iblock(0); iblock < TestSpaceType::S_fieldDim; ++iblock)
         {
-            // Set the row global indices in the local vector
             for (UInt i(0); i<nbTestDof; ++i)
             {
-                /*M_elementalVector.block(0).setRowIndex
-					(i + iblock*nbTestDof,
-                    M_testSpace->dof().localToGlobalMap(iElement,i)+ iblock*M_testSpace->dof().numTotalDof());*/
                 M_elementalVector.setRowIndex
-					(i + iblock*nbTestDof,
+                    (i + iblock*nbTestDof,
                      M_testSpace->dof().localToGlobalMap(iElement,i)+ iblock*M_testSpace->dof().numTotalDof());
             }
+        }
+
+        // Make the assembly
+        for (UInt iQuadPt(0); iQuadPt< nbQuadPt; ++iQuadPt)
+        {
+            const Real wDet(M_globalCFE->wDet(iQuadPt));
 
-            // Make the assembly
-            for (UInt iQuadPt(0); iQuadPt< nbQuadPt; ++iQuadPt)
+            for (UInt i(0); i<nbTestDof*TestSpaceType::S_fieldDim; ++i)
             {
-                for (UInt i(0); i<nbTestDof; ++i)
-                {
-                    /*M_elementalVector.block(0).element(i+iblock*nbTestDof) +=
-						M_evaluation.value_qi(iQuadPt,i+iblock*nbTestDof)
-						* M_globalCFE->wDet(iQuadPt);*/
-                    M_elementalVector.element(i+iblock*nbTestDof) +=
-						M_evaluation.value_qi(iQuadPt,i+iblock*nbTestDof)
-						* M_globalCFE->wDet(iQuadPt);
-
-                }
+                M_elementalVector.element(i) += M_evaluation.value_qi(iQuadPt,i) * wDet;
             }
         }
 
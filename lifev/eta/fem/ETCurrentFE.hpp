@@ -54,6 +54,8 @@
 
 #include <vector>
 
+#include <boost/multi_array.hpp>
+
 namespace LifeV
 {
 
@@ -359,20 +361,23 @@ public:
 
 private:
 
+    // The arrays are stored contiguously (row major), so that the loops
+    // over the quadrature nodes and the basis functions run on flat memory
+
     //Private typedefs for the 1D array
-    typedef std::vector< Real > array1D_Type;
+    typedef boost::multi_array< Real, 1 > array1D_Type;
 
-    //Private typedefs for the 2D array (array of 1D array)
-    typedef std::vector< array1D_Type > array2D_Type;
+    //Private typedefs for the 2D array
+    typedef boost::multi_array< Real, 2 > array2D_Type;
 
-    //Private typedefs for the 3D array (array of 2D array)
-    typedef std::vector< array2D_Type > array3D_Type;
+    //Private typedefs for the 3D array
+    typedef boost::multi_array< Real, 3 > array3D_Type;
 
     //Private typedefs for the 1D array of vector
-    typedef std::vector< VectorSmall<spaceDim> > array1D_vector_Type;
+    typedef boost::multi_array< VectorSmall<spaceDim>, 1 > array1D_vector_Type;
 
     //Private typedefs for the 2D array of vector
-    typedef std::vector< std::vector< VectorSmall<spaceDim> > > array2D_vector_Type;
+    typedef boost::multi_array< VectorSmall<spaceDim>, 2 > array2D_vector_Type;
 
     //! @name Private Methods
     //@{
@@ -828,10 +833,9 @@ setupInternalConstants()
     // it does not depend on the current element
 
     // PHI
-    M_phi.resize(M_nbQuadPt);
+    M_phi.resize( boost::extents[M_nbQuadPt][M_nbFEDof] );
     for (UInt q(0); q< M_nbQuadPt; ++q)
     {
-        M_phi[q].resize(M_nbFEDof);
         for (UInt j(0); j< M_nbFEDof; ++j)
         {
             M_phi[q][j]=M_referenceFE->phi(j,M_quadratureRule->quadPointCoor(q));
@@ -839,10 +843,9 @@ setupInternalConstants()
     }
 
     // PHI MAP
-    M_phiMap.resize(M_nbQuadPt);
+    M_phiMap.resize( boost::extents[M_nbQuadPt][M_nbMapDof] );
     for (UInt q(0); q<M_nbQuadPt; ++q)
     {
-        M_phiMap[q].resize(M_nbMapDof);
         for (UInt i(0); i<M_nbMapDof; ++i)
         {
             M_phiMap[q][i]=M_geometricMap->phi(i,M_quadratureRule->quadPointCoor(q));
@@ -850,13 +853,11 @@ setupInternalConstants()
     }
 
     // DPHIREFERENCEFE
-    M_dphiReferenceFE.resize(M_nbQuadPt);
+    M_dphiReferenceFE.resize( boost::extents[M_nbQuadPt][M_nbFEDof][spaceDim] );
     for (UInt q(0); q< M_nbQuadPt; ++q)
     {
-        M_dphiReferenceFE[q].resize(M_nbFEDof);
         for (UInt i(0); i< M_nbFEDof; ++i)
         {
-            M_dphiReferenceFE[q][i].resize(spaceDim);
             for (UInt j(0); j<spaceDim; ++j)
             {
                 M_dphiReferenceFE[q][i][j] = M_referenceFE->dPhi(i,j,M_quadratureRule->quadPointCoor(q));
@@ -865,13 +866,11 @@ setupInternalConstants()
     }
 
     // DPHIGEOMETRICMAP
-    M_dphiGeometricMap.resize(M_nbQuadPt);
+    M_dphiGeometricMap.resize( boost::extents[M_nbQuadPt][M_nbMapDof][spaceDim] );
     for (UInt q(0); q< M_nbQuadPt; ++q)
     {
-        M_dphiGeometricMap[q].resize(M_nbMapDof);
         for (UInt i(0); i< M_nbMapDof; ++i)
         {
-            M_dphiGeometricMap[q][i].resize(spaceDim);
             for (UInt j(0); j<spaceDim; ++j)
             {
                 M_dphiGeometricMap[q][i][j] = M_geometricMap->dPhi(i,j,M_quadratureRule->quadPointCoor(q));
@@ -884,53 +883,25 @@ setupInternalConstants()
     // So, we just make space for it.
 
     // Cell nodes
-    M_cellNode.resize(M_nbMapDof);
-    for (UInt i(0); i<M_nbMapDof; ++i)
-    {
-        M_cellNode[i].resize(spaceDim);
-    }
+    M_cellNode.resize( boost::extents[M_nbMapDof][spaceDim] );
 
     // Quad nodes
-    M_quadNode.resize(M_nbQuadPt);
-    /*for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        M_quadNode[i].resize(spaceDim);
-        }*/
+    M_quadNode.resize( boost::extents[M_nbQuadPt] );
 
     // Jacobian
-    M_jacobian.resize(M_nbQuadPt);
-    for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        M_jacobian[i].resize(spaceDim);
-        for (UInt j(0); j<spaceDim; ++j)
-        {
-            M_jacobian[i][j].resize(spaceDim);
-        }
-    }
+    M_jacobian.resize( boost::extents[M_nbQuadPt][spaceDim][spaceDim] );
 
     // Det jacobian
-    M_detJacobian.resize(M_nbQuadPt);
+    M_detJacobian.resize( boost::extents[M_nbQuadPt] );
 
     // wDet
-    M_wDet.resize(M_nbQuadPt);
+    M_wDet.resize( boost::extents[M_nbQuadPt] );
 
     // tInverseJacobian
-    M_tInverseJacobian.resize(M_nbQuadPt);
-    for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        M_tInverseJacobian[i].resize(spaceDim);
-        for (UInt j(0); j<spaceDim; ++j)
-        {
-            M_tInverseJacobian[i][j].resize(spaceDim);
-        }
-    }
+    M_tInverseJacobian.resize( boost::extents[M_nbQuadPt][spaceDim][spaceDim] );
 
     // dphi
-    M_dphi.resize(M_nbQuadPt);
-    for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        M_dphi[i].resize(M_nbFEDof);
-    }
+    M_dphi.resize( boost::extents[M_nbQuadPt][M_nbFEDof] );
 
 }
 
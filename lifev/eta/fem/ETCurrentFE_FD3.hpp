@@ -54,10 +54,10 @@ private:
     typedef MatrixSmall< spaceDim, 3 > matrix_Return_Type;
 
     //Private typedefs for the 2D array of vector
-    typedef std::vector< std::vector< array1D_Return_Type > > array2D_vector_Type;
+    typedef boost::multi_array< array1D_Return_Type, 2 > array2D_vector_Type;
 
-    //Private typedefs for the 3D array of vector
-    typedef std::vector< std::vector< matrix_Return_Type > > array2D_matrix_Type;
+    //Private typedefs for the 2D array of matrices
+    typedef boost::multi_array< matrix_Return_Type, 2 > array2D_matrix_Type;
 
 public:
 
@@ -222,7 +222,7 @@ public:
       @param q The index of the quadrature node
       @return The divergence of the ith basis function in the qth quadrature node
      */
-    const array1D_Return_Type& divergence(const UInt& i, const UInt& q) const
+    const Real& divergence(const UInt& i, const UInt& q) const
     {
         ASSERT( M_isDivergenceUpdated, "Divergence of the basis functions have not been updated");
         ASSERT( i < 3*M_nbFEDof, "No basis function with this index" );
@@ -246,14 +246,16 @@ public:
 
 private:
 
+    // The arrays are stored contiguously (row major), see ETCurrentFE<spaceDim,1>
+
     //Private typedefs for the 1D array
-    typedef std::vector< Real > array1D_Type;
+    typedef boost::multi_array< Real, 1 > array1D_Type;
 
-    //Private typedefs for the 2D array (array of 1D array)
-    typedef std::vector< array1D_Type > array2D_Type;
+    //Private typedefs for the 2D array
+    typedef boost::multi_array< Real, 2 > array2D_Type;
 
-    //Private typedefs for the 3D array (array of 2D array)
-    typedef std::vector< array2D_Type > array3D_Type;
+    //Private typedefs for the 3D array
+    typedef boost::multi_array< Real, 3 > array3D_Type;
 
     //! @name Private Methods
     //@{
@@ -668,12 +670,10 @@ setupInternalConstants()
     // it does not depend on the current element
 
     // PHI
-    M_phi.resize( M_nbQuadPt );
+    // we have M_nbFEDof * 3 basis functions
+    M_phi.resize( boost::extents[M_nbQuadPt][M_nbFEDof * 3] );
     for ( UInt q( 0 ); q < M_nbQuadPt; ++q )
     {
-        // we have M_nbFEDof * 3 basis functions
-        M_phi[q].resize( M_nbFEDof * 3 );
-
         // set only appropriate values, other are initialized to 0 by default constructor (of VectorSmall)
         for ( UInt j( 0 ); j < M_nbFEDof; ++j )
         {
@@ -685,10 +685,9 @@ setupInternalConstants()
     }
 
     // PHI MAP
-    M_phiMap.resize(M_nbQuadPt);
+    M_phiMap.resize( boost::extents[M_nbQuadPt][M_nbMapDof] );
     for (UInt q(0); q<M_nbQuadPt; ++q)
     {
-        M_phiMap[q].resize(M_nbMapDof);
         for (UInt i(0); i<M_nbMapDof; ++i)
         {
             M_phiMap[q][i]=M_geometricMap->phi(i,M_quadratureRule->quadPointCoor(q));
@@ -696,13 +695,11 @@ setupInternalConstants()
     }
 
     // DPHIREFERENCEFE
-    M_dphiReferenceFE.resize(M_nbQuadPt);
+    M_dphiReferenceFE.resize( boost::extents[M_nbQuadPt][M_nbFEDof][spaceDim] );
     for (UInt q(0); q< M_nbQuadPt; ++q)
     {
-        M_dphiReferenceFE[q].resize(M_nbFEDof);
         for (UInt i(0); i< M_nbFEDof; ++i)
         {
-            M_dphiReferenceFE[q][i].resize(spaceDim);
             for (UInt j(0); j<spaceDim; ++j)
             {
                 M_dphiReferenceFE[q][i][j] = M_referenceFE->dPhi(i,j,M_quadratureRule->quadPointCoor(q));
@@ -711,13 +708,11 @@ setupInternalConstants()
     }
 
     // DPHIGEOMETRICMAP
-    M_dphiGeometricMap.resize(M_nbQuadPt);
+    M_dphiGeometricMap.resize( boost::extents[M_nbQuadPt][M_nbMapDof][spaceDim] );
     for (UInt q(0); q< M_nbQuadPt; ++q)
     {
-        M_dphiGeometricMap[q].resize(M_nbMapDof);
         for (UInt i(0); i< M_nbMapDof; ++i)
         {
-            M_dphiGeometricMap[q][i].resize(spaceDim);
             for (UInt j(0); j<spaceDim; ++j)
             {
                 M_dphiGeometricMap[q][i][j] = M_geometricMap->dPhi(i,j,M_quadratureRule->quadPointCoor(q));
@@ -729,62 +724,29 @@ setupInternalConstants()
     // now because it depends on the current element.
     // So, we just make space for it.
     // Cell nodes
-    M_cellNode.resize(M_nbMapDof);
-    for (UInt i(0); i<M_nbMapDof; ++i)
-    {
-        M_cellNode[i].resize(spaceDim);
-    }
+    M_cellNode.resize( boost::extents[M_nbMapDof][spaceDim] );
 
     // Quad nodes
-    M_quadNode.resize(M_nbQuadPt);
-    for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        M_quadNode[i].resize(spaceDim);
-    }
+    M_quadNode.resize( boost::extents[M_nbQuadPt][spaceDim] );
 
     // Jacobian
-    M_jacobian.resize(M_nbQuadPt);
-    for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        M_jacobian[i].resize(spaceDim);
-        for (UInt j(0); j<spaceDim; ++j)
-        {
-            M_jacobian[i][j].resize(spaceDim);
-        }
-    }
+    M_jacobian.resize( boost::extents[M_nbQuadPt][spaceDim][spaceDim] );
 
     // Det jacobian
-    M_detJacobian.resize(M_nbQuadPt);
+    M_detJacobian.resize( boost::extents[M_nbQuadPt] );
 
     // wDet
-    M_wDet.resize(M_nbQuadPt);
+    M_wDet.resize( boost::extents[M_nbQuadPt] );
 
     // tInverseJacobian
-    M_tInverseJacobian.resize(M_nbQuadPt);
-    for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        M_tInverseJacobian[i].resize(spaceDim);
-        for (UInt j(0); j<spaceDim; ++j)
-        {
-            M_tInverseJacobian[i][j].resize(spaceDim);
-        }
-    }
+    M_tInverseJacobian.resize( boost::extents[M_nbQuadPt][spaceDim][spaceDim] );
 
     // dphi
-    M_dphi.resize(M_nbQuadPt);
-    for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        // we have 3 * DoF basis functions
-        M_dphi[i].resize( 3 * M_nbFEDof );
-    }
+    // we have 3 * DoF basis functions
+    M_dphi.resize( boost::extents[M_nbQuadPt][3 * M_nbFEDof] );
 
     // divergence
-    M_divergence.resize(M_nbQuadPt);
-    for (UInt i(0); i<M_nbQuadPt; ++i)
-    {
-        // we have 3 * DoF basis functions
-        M_divergence[i].resize( 3 * M_nbFEDof );
-    }
+    M_divergence.resize( boost::extents[M_nbQuadPt][3 * M_nbFEDof] );
 }
 
 template <UInt spaceDim>
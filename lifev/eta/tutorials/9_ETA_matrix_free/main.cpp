@@ -0,0 +1,259 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+/*!
+    @file
+    @brief Tutorial for the matrix free application of an expression.
+
+    @date 10-2012
+
+    In this tutorial, we show how an expression can be applied to a
+    vector without assembling the matrix. The result is compared with
+    the product of the assembled matrix and the same vector.
+
+    Tutorials that should be read before: 1,4
+ */
+
+// ---------------------------------------------------------------
+// We include the same files as in the tutorial 4.
+// ---------------------------------------------------------------
+
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/eta/fem/ETFESpace.hpp>
+#include <lifev/eta/expression/Integrate.hpp>
+
+#include <boost/shared_ptr.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+
+// ---------------------------------------------------------------
+// We work in the LifeV namespace and define the mesh, matrix and
+// vector types that we will need several times.
+// ---------------------------------------------------------------
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef VectorEpetra vector_Type;
+
+
+// ---------------------------------------------------------------
+// As usual, we start with the definition of the MPI communicator
+// and the boolean for the outputs.
+// ---------------------------------------------------------------
+
+int main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init(&argc, &argv);
+    boost::shared_ptr<Epetra_Comm> Comm(new Epetra_MpiComm(MPI_COMM_WORLD));
+#else
+    boost::shared_ptr<Epetra_Comm> Comm(new Epetra_SerialComm);
+#endif
+
+    const bool verbose(Comm->MyPID()==0);
+
+
+// ---------------------------------------------------------------
+// We define the mesh and parition it, as in the tutorial 4.
+// ---------------------------------------------------------------
+
+    if (verbose) std::cout << " -- Building and partitioning the mesh ... " << std::flush;
+
+    const UInt Nelements(6);
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr(new mesh_Type);
+
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   2.0,   2.0,   2.0,
+                   -1.0,  -1.0,  -1.0);
+
+    MeshPartitioner< mesh_Type >   meshPart(fullMeshPtr, Comm);
+
+    fullMeshPtr.reset();
+
+    if (verbose) std::cout << " done ! " << std::endl;
+
+
+// ---------------------------------------------------------------
+// The matrix free application is most interesting for high order
+// vectorial problems, where the matrices are the largest. We use
+// then P2 finite elements for a vectorial unknown.
+// ---------------------------------------------------------------
+
+    if (verbose) std::cout << " -- Building the FESpaces ... " << std::flush;
+
+    std::string uOrder("P2");
+
+    boost::shared_ptr<FESpace< mesh_Type, MapEpetra > > uSpace
+        ( new FESpace< mesh_Type, MapEpetra >(meshPart,uOrder, 3, Comm));
+
+    boost::shared_ptr<ETFESpace< mesh_Type, MapEpetra, 3, 3 > > ETuSpace
+        ( new ETFESpace< mesh_Type, MapEpetra, 3, 3 >(meshPart,&(uSpace->refFE()),&(uSpace->fe().geoMap()), Comm));
+
+    if (verbose) std::cout << " done ! " << std::endl;
+    if (verbose) std::cout << " ---> Dofs: " << ETuSpace->dof().numTotalDof() << std::endl;
+
+
+// ---------------------------------------------------------------
+// We assemble the matrix of the vectorial laplacian, as usual.
+// ---------------------------------------------------------------
+
+    if (verbose) std::cout << " -- ET assembly ... " << std::flush;
+
+    boost::shared_ptr<matrix_Type> ETsystemMatrix(new matrix_Type( ETuSpace->map() ));
+    *ETsystemMatrix *=0.0;
+
+    {
+        using namespace ExpressionAssembly;
+
+        integrate( elements(ETuSpace->mesh()),
+                   uSpace->qr(),
+                   ETuSpace,
+                   ETuSpace,
+
+                   dot( grad(phi_i) , grad(phi_j) )
+
+                   )
+            >> ETsystemMatrix;
+    }
+
+    ETsystemMatrix->globalAssemble();
+
+    if (verbose) std::cout << " done! " << std::endl;
+
+
+// ---------------------------------------------------------------
+// To get the matrix free operator, we use the integrateMatrixFree
+// function instead of the integrate function. The arguments are
+// exactly the same, but nothing is computed at this stage: the
+// expression is evaluated each time the operator is applied.
+//
+// The returned object derives from Epetra_Operator, so that it can
+// be given to the AztecOO or Belos solvers in place of the matrix.
+// ---------------------------------------------------------------
+
+    if (verbose) std::cout << " -- Building the matrix free operator ... " << std::flush;
+
+    boost::shared_ptr<Operators::LinearOperator> ETsystemOperator;
+
+    {
+        using namespace ExpressionAssembly;
+
+        ETsystemOperator = integrateMatrixFree( elements(ETuSpace->mesh()),
+                                                uSpace->qr(),
+                                                ETuSpace,
+                                                ETuSpace,
+
+                                                dot( grad(phi_i) , grad(phi_j) )
+
+                                                );
+    }
+
+    if (verbose) std::cout << " done! " << std::endl;
+
+
+// ---------------------------------------------------------------
+// We apply both the matrix and the operator to a random vector.
+// ---------------------------------------------------------------
+
+    if (verbose) std::cout << " -- Applying the operators ... " << std::flush;
+
+    vector_Type x(ETuSpace->map(),Unique);
+    x.epetraVector().Random();
+
+    vector_Type matrixResult(ETuSpace->map(),Unique);
+    ETsystemMatrix->multiply(false,x,matrixResult);
+
+    vector_Type operatorResult(ETuSpace->map(),Unique);
+    ETsystemOperator->apply(x,operatorResult);
+
+    if (verbose) std::cout << " done! " << std::endl;
+
+
+// ---------------------------------------------------------------
+// We compute the norm of the difference of the two results.
+// ---------------------------------------------------------------
+
+    if (verbose) std::cout << " -- Computing the error ... " << std::flush;
+
+    vector_Type checkVector(matrixResult);
+    checkVector -= operatorResult;
+
+    Real errorNorm( checkVector.normInf() );
+
+    if (verbose) std::cout << " done ! " << std::endl;
+
+
+// ---------------------------------------------------------------
+// We finalize the MPI if needed.
+// ---------------------------------------------------------------
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+
+// ---------------------------------------------------------------
+// We finally display the error norm and compare with the
+// tolerance of the test.
+// ---------------------------------------------------------------
+
+    if (verbose) std::cout << " Error : " << errorNorm << std::endl;
+
+    Real testTolerance(1e-10);
+
+    if (errorNorm < testTolerance)
+    {
+        return( EXIT_SUCCESS );
+    }
+    return ( EXIT_FAILURE );
+}
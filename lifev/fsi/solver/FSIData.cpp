@@ -53,11 +53,20 @@ FSIData::FSIData( ) :
         M_relativeTolerance             (),
         M_errorTolerance                (),
         M_NonLinearLineSearch           (),
+        M_jacobianMaxAge                (),
+        M_jacobianMaxContraction        (),
+        M_jacobianReuseTimeSteps        (),
         M_method                        (),
         M_algorithm                     (),
         M_defaultOmega                  (),
         M_rangeOmega                    (),
         M_updateEvery                   (),
+        M_accelerator                   (),
+        M_acceleratorInitialOmega       (),
+        M_acceleratorMixingParameter    (),
+        M_acceleratorMaxColumns         (),
+        M_acceleratorReuseTimeSteps     (),
+        M_acceleratorFilterTolerance    (),
         M_fluidInterfaceFlag            (),
         M_structureInterfaceFlag        (),
         M_fluidInterfaceVertexFlag      (),
@@ -74,11 +83,20 @@ FSIData::FSIData( const FSIData& FSIData ) :
         M_relativeTolerance             ( FSIData.M_relativeTolerance ),
         M_errorTolerance                ( FSIData.M_errorTolerance ),
         M_NonLinearLineSearch           ( FSIData.M_NonLinearLineSearch ),
+        M_jacobianMaxAge                ( FSIData.M_jacobianMaxAge ),
+        M_jacobianMaxContraction        ( FSIData.M_jacobianMaxContraction ),
+        M_jacobianReuseTimeSteps        ( FSIData.M_jacobianReuseTimeSteps ),
         M_method                        ( FSIData.M_method ),
         M_algorithm                     ( FSIData.M_algorithm ),
         M_defaultOmega                  ( FSIData.M_defaultOmega ),
         M_rangeOmega                    ( FSIData.M_rangeOmega ),
         M_updateEvery                   ( FSIData.M_updateEvery ),
+        M_accelerator                   ( FSIData.M_accelerator ),
+        M_acceleratorInitialOmega       ( FSIData.M_acceleratorInitialOmega ),
+        M_acceleratorMixingParameter    ( FSIData.M_acceleratorMixingParameter ),
+        M_acceleratorMaxColumns         ( FSIData.M_acceleratorMaxColumns ),
+        M_acceleratorReuseTimeSteps     ( FSIData.M_acceleratorReuseTimeSteps ),
+        M_acceleratorFilterTolerance    ( FSIData.M_acceleratorFilterTolerance ),
         M_fluidInterfaceFlag            ( FSIData.M_fluidInterfaceFlag ),
         M_structureInterfaceFlag        ( FSIData.M_structureInterfaceFlag ),
         M_fluidInterfaceVertexFlag      ( new Int const ( *FSIData.M_fluidInterfaceVertexFlag ) ),
@@ -104,11 +122,20 @@ FSIData::operator=( const FSIData& FSIData )
         M_relativeTolerance             = FSIData.M_relativeTolerance;
         M_errorTolerance                = FSIData.M_errorTolerance;
         M_NonLinearLineSearch           = FSIData.M_NonLinearLineSearch;
+        M_jacobianMaxAge                = FSIData.M_jacobianMaxAge;
+        M_jacobianMaxContraction        = FSIData.M_jacobianMaxContraction;
+        M_jacobianReuseTimeSteps        = FSIData.M_jacobianReuseTimeSteps;
         M_method                        = FSIData.M_method;
         M_algorithm                     = FSIData.M_algorithm;
         M_defaultOmega                  = FSIData.M_defaultOmega;
         M_rangeOmega                    = FSIData.M_rangeOmega;
         M_updateEvery                   = FSIData.M_updateEvery;
+        M_accelerator                   = FSIData.M_accelerator;
+        M_acceleratorInitialOmega       = FSIData.M_acceleratorInitialOmega;
+        M_acceleratorMixingParameter    = FSIData.M_acceleratorMixingParameter;
+        M_acceleratorMaxColumns         = FSIData.M_acceleratorMaxColumns;
+        M_acceleratorReuseTimeSteps     = FSIData.M_acceleratorReuseTimeSteps;
+        M_acceleratorFilterTolerance    = FSIData.M_acceleratorFilterTolerance;
         M_fluidInterfaceFlag            = FSIData.M_fluidInterfaceFlag;
         M_structureInterfaceFlag        = FSIData.M_structureInterfaceFlag;
 
@@ -134,6 +161,11 @@ FSIData::setup( const GetPot& dataFile, const std::string& section )
     M_errorTolerance = dataFile( ( section + "/etamax" ).data(), 1.e-03 );
     M_NonLinearLineSearch = static_cast<Int> ( dataFile( ( section + "/NonLinearLineSearch" ).data(), 0 ) );
 
+    // Problem - Reuse of the Jacobian (modified Newton)
+    M_jacobianMaxAge = dataFile( ( section + "/jacobianMaxAge" ).data(), 1 );
+    M_jacobianMaxContraction = dataFile( ( section + "/jacobianMaxContraction" ).data(), 0.5 );
+    M_jacobianReuseTimeSteps = dataFile( ( section + "/jacobianReuse" ).data(), false );
+
     // Problem - Methods
     M_method = dataFile( ( section + "/method" ).data(), "steklovPoincare" );
     M_algorithm = dataFile( ( section + "/algorithm" ).data(), "DirichletNeumann" );
@@ -144,6 +176,14 @@ FSIData::setup( const GetPot& dataFile, const std::string& section )
     M_rangeOmega[1] = dataFile( ( section + "/defOmega" ).data(), std::fabs( M_defaultOmega )/1024., 1);
     M_updateEvery = dataFile( ( section + "/updateEvery" ).data(), 1);
 
+    // Problem - FixPoint acceleration
+    M_accelerator = dataFile( ( section + "/accelerator" ).data(), "Aitken" );
+    M_acceleratorInitialOmega = dataFile( ( section + "/IQNOmega" ).data(), std::fabs( M_defaultOmega ) );
+    M_acceleratorMixingParameter = dataFile( ( section + "/IQNMixing" ).data(), 1. );
+    M_acceleratorMaxColumns = dataFile( ( section + "/IQNMaxColumns" ).data(), 20 );
+    M_acceleratorReuseTimeSteps = dataFile( ( section + "/IQNReuse" ).data(), 0 );
+    M_acceleratorFilterTolerance = dataFile( ( section + "/IQNFilter" ).data(), 1.e-8 );
+
     // Interface
     M_fluidInterfaceFlag     = dataFile( "interface/fluid_flag",     1 );
     M_structureInterfaceFlag = dataFile( "interface/structure_flag", M_fluidInterfaceFlag );
@@ -185,6 +225,9 @@ FSIData::showMe( std::ostream& output )
     output << "Relative tolerance               = " << M_relativeTolerance << std::endl;
     output << "Max error tolerance              = " << M_errorTolerance << std::endl;
     output << "NonLinearLineSearch                       = " << M_NonLinearLineSearch << std::endl;
+    output << "Jacobian max age                 = " << M_jacobianMaxAge << std::endl;
+    output << "Jacobian max contraction         = " << M_jacobianMaxContraction << std::endl;
+    output << "Jacobian reused across steps     = " << M_jacobianReuseTimeSteps << std::endl;
 
     output << "Method                           = " << M_method << std::endl;
     output << "Algorithm                        = " << M_algorithm << std::endl;
@@ -192,6 +235,12 @@ FSIData::showMe( std::ostream& output )
     output << "Default Omega                    = " << M_defaultOmega << std::endl;
     output << "Omega range                      = " << "(" << M_rangeOmega[0] << " " << M_rangeOmega[1] << ")" << std::endl;
     output << "Update every                     = " << M_updateEvery << std::endl;
+    output << "Accelerator                      = " << M_accelerator << std::endl;
+    output << "IQN-ILS initial omega            = " << M_acceleratorInitialOmega << std::endl;
+    output << "IQN-ILS mixing parameter         = " << M_acceleratorMixingParameter << std::endl;
+    output << "IQN-ILS max columns              = " << M_acceleratorMaxColumns << std::endl;
+    output << "IQN-ILS reused time steps        = " << M_acceleratorReuseTimeSteps << std::endl;
+    output << "IQN-ILS filter tolerance         = " << M_acceleratorFilterTolerance << std::endl;
 
     output << "\n*** Values for interface\n\n";
     output << "Interface fluid                  = " << M_fluidInterfaceFlag << std::endl;
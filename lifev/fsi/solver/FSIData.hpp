@@ -179,6 +179,24 @@ public:
      */
     const Int& NonLinearLineSearch() const { return M_NonLinearLineSearch; }
 
+    //! Get the maximum number of Newton iterations with the same Jacobian
+    /*!
+     * @return maximum age of the Jacobian (1: Newton method)
+     */
+    const UInt& jacobianMaxAge() const { return M_jacobianMaxAge; }
+
+    //! Get the maximum contraction of the residual for keeping the Jacobian
+    /*!
+     * @return maximum contraction of the residual
+     */
+    const Real& jacobianMaxContraction() const { return M_jacobianMaxContraction; }
+
+    //! Check if the Jacobian is kept from a time step to the next one
+    /*!
+     * @return true if the Jacobian is reused across the time steps
+     */
+    const bool& jacobianReuseTimeSteps() const { return M_jacobianReuseTimeSteps; }
+
     //! Get method type
     /*!
      * @return method type
@@ -213,6 +231,42 @@ public:
      */
     const Int& updateEvery() const { return M_updateEvery; }
 
+    //! Get the accelerator of the fixed point iterations
+    /*!
+     * @return accelerator type ("Aitken" or "IQN-ILS")
+     */
+    const std::string& accelerator() const { return M_accelerator; }
+
+    //! Get the relaxation of the first step of the IQN-ILS accelerator
+    /*!
+     * @return relaxation parameter used when no secant information is available
+     */
+    const Real& acceleratorInitialOmega() const { return M_acceleratorInitialOmega; }
+
+    //! Get the mixing parameter of the IQN-ILS accelerator
+    /*!
+     * @return mixing parameter (1 for IQN-ILS)
+     */
+    const Real& acceleratorMixingParameter() const { return M_acceleratorMixingParameter; }
+
+    //! Get the maximum number of columns of the IQN-ILS accelerator
+    /*!
+     * @return maximum number of columns
+     */
+    const UInt& acceleratorMaxColumns() const { return M_acceleratorMaxColumns; }
+
+    //! Get the number of time steps reused by the IQN-ILS accelerator
+    /*!
+     * @return number of reused time steps
+     */
+    const UInt& acceleratorReuseTimeSteps() const { return M_acceleratorReuseTimeSteps; }
+
+    //! Get the filter tolerance of the IQN-ILS accelerator
+    /*!
+     * @return filter tolerance
+     */
+    const Real& acceleratorFilterTolerance() const { return M_acceleratorFilterTolerance; }
+
     //! Get the fluid Interface Flag
     /*!
      * @return Flag of the interface  on the fluid boundary side
@@ -264,6 +318,11 @@ private:
     Real                          M_errorTolerance;
     Int                           M_NonLinearLineSearch;
 
+    // Problem - Reuse of the Jacobian
+    UInt                          M_jacobianMaxAge;
+    Real                          M_jacobianMaxContraction;
+    bool                          M_jacobianReuseTimeSteps;
+
     // Problem - Methods
     std::string                   M_method;
     std::string                   M_algorithm;
@@ -273,6 +332,14 @@ private:
     boost::array< Real, 2 >       M_rangeOmega;
     Int                           M_updateEvery;
 
+    // Problem - FixedPoint acceleration
+    std::string                   M_accelerator;
+    Real                          M_acceleratorInitialOmega;
+    Real                          M_acceleratorMixingParameter;
+    UInt                          M_acceleratorMaxColumns;
+    UInt                          M_acceleratorReuseTimeSteps;
+    Real                          M_acceleratorFilterTolerance;
+
     // Interface
     Int                           M_fluidInterfaceFlag;
     Int                           M_structureInterfaceFlag;
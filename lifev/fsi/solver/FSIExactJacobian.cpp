@@ -72,7 +72,8 @@ void  FSIExactJacobian::solveJac(vector_Type         &_muk,
 
     this->displayer().leaderPrint( "Solving Jacobian system... " );
 
-    M_recomputeShapeDer=true;
+    // The shape derivatives are part of the Jacobian: they are kept when the Jacobian is reused
+    M_recomputeShapeDer = !M_reuseJacobian || !M_matrShapeDer.get();
     M_linearSolver.solve(_muk, res);
 
     this->displayer().leaderPrint( "Solving the Jacobian system done.\n" );
@@ -288,7 +289,9 @@ void FSIExactJacobian::eval(const vector_Type& _disp,
 
     vector_Type sigmaFluidUnique (this->sigmaFluid(), Unique);
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_epetraWorldComm->Barrier();
+#endif
     chronoFluid.start();
 
     if (this->isFluid())
@@ -338,7 +341,9 @@ void FSIExactJacobian::eval(const vector_Type& _disp,
 
     }
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_epetraWorldComm->Barrier();
+#endif
     chronoFluid.stop();
     this->displayer().leaderPrintMax("      Fluid solution total time:               ", chronoFluid.diff() );
 
@@ -368,7 +373,9 @@ void FSIExactJacobian::eval(const vector_Type& _disp,
     vector_Type sigmaSolidUnique    (this->sigmaSolid(),     Unique);
 
     chronoInterface.stop();
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_epetraWorldComm->Barrier();
+#endif
     chronoSolid.start();
 
     if (this->isSolid())
@@ -379,7 +386,9 @@ void FSIExactJacobian::eval(const vector_Type& _disp,
 //         this->transferSolidOnInterface(this->M_solid->residual(), sigmaSolidUnique);
     }
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_epetraWorldComm->Barrier();
+#endif
     chronoSolid.stop();
     this->displayer().leaderPrintMax("      Solid solution total time:               ", chronoSolid.diff() );
 
@@ -498,7 +507,9 @@ int FSIExactJacobian::Epetra_ExactJacobian::Apply(const Epetra_MultiVector &X, E
         vector_Type sigmaFluidUnique (M_ej->sigmaFluid(), Unique);
         chronoInterface.stop();
 
+#ifndef ENABLE_PRODUCTION_LOGGING
         M_comm->Barrier();
+#endif
         chronoFluid.start();
 
         if (M_ej->isFluid())
@@ -520,7 +531,9 @@ int FSIExactJacobian::Epetra_ExactJacobian::Apply(const Epetra_MultiVector &X, E
             //M_ej->fluidPostProcess();
         }
 
+#ifndef ENABLE_PRODUCTION_LOGGING
         M_comm->Barrier();
+#endif
         chronoFluid.stop();
         M_ej->displayer().leaderPrintMax( "Fluid linear solution: total time : ", chronoFluid.diff() );
 
@@ -533,7 +546,9 @@ int FSIExactJacobian::Epetra_ExactJacobian::Apply(const Epetra_MultiVector &X, E
         vector_Type lambdaSolidUnique (M_ej->lambdaSolid(), Unique);
         chronoInterface.stop();
 
+#ifndef ENABLE_PRODUCTION_LOGGING
         M_comm->Barrier();
+#endif
         chronoFluid.start();
 
         if (M_ej->isSolid())
@@ -542,7 +557,9 @@ int FSIExactJacobian::Epetra_ExactJacobian::Apply(const Epetra_MultiVector &X, E
             M_ej->transferSolidOnInterface(M_ej->solid().getDisplacement(), lambdaSolidUnique);
         }
 
+#ifndef ENABLE_PRODUCTION_LOGGING
         M_comm->Barrier();
+#endif
         chronoSolid.stop();
         M_ej->displayer().leaderPrintMax( "Solid linear solution: total time : " , chronoSolid.diff() );
 
@@ -36,6 +36,8 @@ namespace LifeV
 FSIFixedPoint::FSIFixedPoint():
         super(),
         M_nonLinearAitken(),
+        M_nonLinearAnderson(),
+        M_useAnderson( false ),
         M_rhsNew(),
         M_beta()
 {
@@ -54,7 +56,13 @@ void  FSIFixedPoint::solveJac(vector_Type        &muk,
                            const vector_Type  &res,
                            const Real   /*_linearRelTol*/)
 {
-    M_nonLinearAitken.restart();
+    if ( M_useAnderson )
+    {
+        // The accelerator works on f = G(x) - x = -res for both algorithms
+        muk = M_nonLinearAnderson.computeDeltaLambda(this->lambdaSolidOld(), -1.*res);
+
+        return;
+    }
 
     if (M_data->algorithm()=="RobinNeumann")
     {
@@ -76,6 +84,13 @@ void FSIFixedPoint::evalResidual(vector_Type &res, const vector_Type& disp, UInt
         std::cout << std::endl;
     }
 
+    // The Aitken coefficients and the quasi-Newton differences are collected per time step
+    if ( iter == 0 )
+    {
+        M_nonLinearAitken.restart();
+        M_nonLinearAnderson.restart();
+    }
+
     this->setLambdaSolidOld(disp);
 
     eval(disp, iter);
@@ -127,6 +142,17 @@ FSIFixedPoint::setDataFile( GetPot const& dataFile )
     if ( M_data->algorithm() == "RobinNeumann" )
         M_nonLinearAitken.setDefaultOmega(-1, 1);
 
+    M_useAnderson = ( M_data->accelerator() == "IQN-ILS" );
+
+    // The relaxation is used only for the first step, without secant information
+    if ( M_data->algorithm() == "RobinNeumann" )
+        M_nonLinearAnderson.setDefaultOmega( 1. );
+    else
+        M_nonLinearAnderson.setDefaultOmega( M_data->acceleratorInitialOmega() );
+    M_nonLinearAnderson.setMixingParameter( M_data->acceleratorMixingParameter() );
+    M_nonLinearAnderson.setMaxColumns( M_data->acceleratorMaxColumns() );
+    M_nonLinearAnderson.setReuseTimeSteps( M_data->acceleratorReuseTimeSteps() );
+    M_nonLinearAnderson.setFilterTolerance( M_data->acceleratorFilterTolerance() );
 }
 
 // ===================================================
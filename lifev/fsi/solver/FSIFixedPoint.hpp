@@ -41,6 +41,7 @@
 #define FSIFIXEDPOINT_HPP
 
 #include <lifev/core/algorithm/NonLinearAitken.hpp>
+#include <lifev/core/algorithm/NonLinearAnderson.hpp>
 #include <lifev/fsi/solver/FSIOperator.hpp>
 
 namespace LifeV
@@ -59,6 +60,10 @@ namespace LifeV
 
     This class implements an FSI that will solve the FSI problem by a
     relaxed fixed point method.
+
+    The interface iterations are accelerated either by the Aitken relaxation
+    (problem/accelerator = Aitken, default) or by the interface quasi-Newton
+    IQN-ILS method (problem/accelerator = IQN-ILS), see NonLinearAnderson.
 */
 
 class FSIFixedPoint : public FSIOperator
@@ -165,7 +170,9 @@ private:
 
     //@}
 
-    NonLinearAitken<vector_Type> M_nonLinearAitken;
+    NonLinearAitken<vector_Type>   M_nonLinearAitken;
+    NonLinearAnderson<vector_Type> M_nonLinearAnderson;
+    bool                           M_useAnderson;
 
     vectorPtr_Type       M_rhsNew;
     vectorPtr_Type       M_beta;
@@ -34,6 +34,7 @@
 
 #include <lifev/core/LifeV.hpp>
 #include <lifev/fsi/solver/FSIMonolithic.hpp>
+#include <lifev/fsi/solver/MonolithicBlockComposed.hpp>
 
 namespace LifeV
 {
@@ -327,11 +328,15 @@ FSIMonolithic::solveJac( vector_Type& step, const vector_Type& res, const Real /
 {
     setupBlockPrec( );
 
-    checkIfChangedFluxBC( M_precPtr );
+    // When the Jacobian is reused, the preconditioner of its last evaluation is kept
+    if ( !M_reuseJacobian )
+    {
+        checkIfChangedFluxBC( M_precPtr );
 
-    M_precPtr->blockAssembling();
-    M_precPtr->applyBoundaryConditions( dataFluid()->dataTime()->time() );
-    M_precPtr->GlobalAssemble();
+        M_precPtr->blockAssembling();
+        M_precPtr->applyBoundaryConditions( dataFluid()->dataTime()->time() );
+        M_precPtr->GlobalAssemble();
+    }
 
 #ifdef HAVE_LIFEV_DEBUG
     M_solid->getDisplayer().leaderPrint("  M-  Residual NormInf:                        ", res.normInf(), "\n");
@@ -435,12 +440,25 @@ FSIMonolithic::iterateMonolithic(const vector_Type& rhs, vector_Type& step)
 
     //M_monolithicMatrix->GlobalAssemble();
     //necessary if we did not imposed Dirichlet b.c.
-    M_linearSolver->setOperator(*M_monolithicMatrix->matrix()->matrixPtr());
+    M_linearSolver->setOperator( jacobianOperator() );
 
-    M_linearSolver->setReusePreconditioner( (M_reusePrec) && (!M_resetPrec) );
+    M_linearSolver->setReusePreconditioner( ( (M_reusePrec) && (!M_resetPrec) ) || M_reuseJacobian );
+
+    // The factors of the composed preconditioners are not recomputed either
+    MonolithicBlockComposed* composedPrec( dynamic_cast<MonolithicBlockComposed*>( M_precPtr.get() ) );
+    std::vector<bool> recompute;
+    if ( M_reuseJacobian && composedPrec )
+    {
+        recompute = composedPrec->recompute();
+        for ( UInt k(0); k < recompute.size(); ++k )
+            composedPrec->setRecompute( k, false );
+    }
 
     int numIter = M_precPtr->solveSystem( rhs, step, M_linearSolver );
 
+    for ( UInt k(0); k < recompute.size(); ++k )
+        composedPrec->setRecompute( k, recompute[k] );
+
     if (numIter < 0)
     {
         chrono.start();
@@ -544,8 +562,13 @@ void FSIMonolithic::setupBlockPrec( )
          M_precPtr->setSpaces(M_FESpaces);
          M_precPtr->setOffsets(2, M_offset, 0);
          M_precPtr->coupler(M_monolithicMap, M_dofStructureToHarmonicExtension->localDofMap(), M_numerationInterface, M_data->dataFluid()->dataTime()->timeStep());
+
+         // Rigid body modes of the structure, for the multilevel preconditioners of the solid block
+         boost::shared_ptr<std::vector<Real> > solidNullSpace( new std::vector<Real> );
+         const UInt numModes( M_dFESpace->rigidBodyModes( *solidNullSpace, *M_monolithicMap, M_offset ) );
+         M_precPtr->setNullSpace( 0, solidNullSpace, numModes );
      }
-    else
+    else if ( !M_reuseJacobian )
     {
         M_precPtr->replace_matrix(M_fluidBlock, 1);
         M_precPtr->replace_matrix(M_solidBlockPrec, 0);
@@ -528,6 +528,13 @@ protected:
     //!
     virtual void setupBlockPrec();
 
+    //! returns the operator of the tangent system, passed to the linear solver
+    /**
+       By default it is the assembled monolithic matrix. It is overridden when a part of the Jacobian
+       is applied without being assembled, in which case only the preconditioner uses the assembled blocks.
+    */
+    virtual Epetra_Operator& jacobianOperator() { return *M_monolithicMatrix->matrix()->matrixPtr(); }
+
 #ifdef OBSOLETE
     void setOperator(Epetra_Operator& epetraOperator) {M_linearSolver->setOperator(epetraOperator);}
 #endif
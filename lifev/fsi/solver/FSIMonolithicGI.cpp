@@ -48,7 +48,14 @@ FSIMonolithicGI::FSIMonolithicGI():
         M_interface             (0),
         M_meshBlock             (),
         M_shapeDerivativesBlock (),
-        M_solidDerBlock         ()
+        M_solidDerBlock         (),
+        M_matrixFreeShapeDerivatives   (false),
+        M_checkMatrixFreeShapeDerivatives (false),
+        M_updateShapeDerivativesBlock  (true),
+        M_shapeDerivativesBeta         (),
+        M_shapeDerivativesSolution     (),
+        M_shapeDerivativesMeshVelocity (),
+        M_matrixFreeJacobian    (this)
 {}
 
 // ===================================================
@@ -61,6 +68,8 @@ FSIMonolithicGI::setUp( const GetPot& dataFile )
 
     M_domainVelImplicit = dataFile( "fluid/domainVelImplicit", true );
     M_convectiveTermDer = dataFile( "fluid/convectiveTermDer", false );
+    M_matrixFreeShapeDerivatives = dataFile( "fluid/matrixFreeShapeDerivatives", false );
+    M_checkMatrixFreeShapeDerivatives = dataFile( "fluid/checkMatrixFreeShapeDerivatives", false );
 }
 
 void
@@ -132,6 +141,9 @@ FSIMonolithicGI::updateSystem()
     super_Type::updateSystem();
     M_meshMotion->setDisplacement(*meshDispDiff);//M_disp is set to the total mesh disp.`
     M_un.reset(new vector_Type(*M_uk));
+
+    // The shape derivatives block of the preconditioner is computed again at the next time step
+    M_updateShapeDerivativesBlock = true;
 }
 
 void
@@ -297,12 +309,27 @@ void FSIMonolithicGI::setupBlockPrec()
 
     if (M_data->dataFluid()->useShapeDerivatives())
     {
-        *M_shapeDerivativesBlock *= 0.;
-        M_shapeDerivativesBlock->openCrsMatrix( );
-        shapeDerivatives( M_shapeDerivativesBlock );
+        // When the Jacobian is reused, the shape derivatives of its last evaluation are added
+        if ( !M_reuseJacobian )
+        {
+            shapeDerivativesData();
+
+            // When applied matrix-free, the assembled block is used only in the preconditioner, and kept for the whole time step
+            if ( !M_matrixFreeShapeDerivatives || M_updateShapeDerivativesBlock )
+            {
+                *M_shapeDerivativesBlock *= 0.;
+                M_shapeDerivativesBlock->openCrsMatrix( );
+                shapeDerivatives( M_shapeDerivativesBlock );
 
-        M_shapeDerivativesBlock->globalAssemble( );
-        M_monolithicMatrix->addToGlobalMatrix( M_shapeDerivativesBlock );
+                M_shapeDerivativesBlock->globalAssemble( );
+                M_updateShapeDerivativesBlock = false;
+
+                if ( M_matrixFreeShapeDerivatives && M_checkMatrixFreeShapeDerivatives )
+                    checkMatrixFreeShapeDerivatives();
+            }
+        }
+        if ( !M_matrixFreeShapeDerivatives )
+            M_monolithicMatrix->addToGlobalMatrix( M_shapeDerivativesBlock );
     }
 
     //M_solidDerBlock = M_solidBlockPrec; // an inexact Newton approximation of the Jacobian
@@ -311,7 +338,8 @@ void FSIMonolithicGI::setupBlockPrec()
     //elasticity is used
     if ( M_data->dataSolid()->getUseExactJacobian() )
     {
-        M_solid->updateJacobian( *M_uk, M_solidDerBlock ); // computing the derivatives if nonlinear (comment this for inexact Newton);
+        if ( !M_reuseJacobian )
+            M_solid->updateJacobian( *M_uk, M_solidDerBlock ); // computing the derivatives if nonlinear (comment this for inexact Newton);
         *M_monolithicMatrix->matrix() *= 0;
         // doing nothing if linear
         M_solidBlockPrec.reset(new matrix_Type(*M_monolithicMap, 1));
@@ -337,7 +365,7 @@ void FSIMonolithicGI::setupBlockPrec()
             M_precPtr->push_back_coupling( M_shapeDerivativesBlock );
         }
     }
-    else
+    else if ( !M_reuseJacobian )
     {
         //M_precPtr->replace_matrix( M_solidBlockPrec, 0 );
         //M_precPtr->replace_matrix( M_fluidBlock, 1 );
@@ -350,12 +378,11 @@ void FSIMonolithicGI::setupBlockPrec()
     }
 }
 
-void FSIMonolithicGI::shapeDerivatives( matrixPtr_Type sdMatrix )
+void FSIMonolithicGI::shapeDerivativesData()
 {
     Real alpha = 1./M_data->dataFluid()->dataTime()->timeStep();
-    vectorPtr_Type rhsNew(new vector_Type(*M_monolithicMap));
-    vector_Type un(M_uFESpace->map());
-    vector_Type uk(M_uFESpace->map()+M_pFESpace->map());
+    vector_Type beta(M_uFESpace->map());
+    vector_Type solution(M_uFESpace->map()+M_pFESpace->map());
 
     vectorPtr_Type meshVel(new vector_Type(M_mmFESpace->map()));
 
@@ -374,24 +401,32 @@ void FSIMonolithicGI::shapeDerivatives( matrixPtr_Type sdMatrix )
     }
 
     if ( M_convectiveTermDer )
-        un.subset(*M_uk, 0);
+        beta.subset(*M_uk, 0);
     else
-        un.subset(*M_un, 0);
+        beta.subset(*M_un, 0);
 
     *meshVel *= alpha;
     vectorPtr_Type meshVelRep(new vector_Type(M_mmFESpace->map(), Repeated));
     *meshVelRep = *meshVel;
 
-    uk.subset(*M_uk, 0);
-    vector_Type dvfm(M_uFESpace->map(), Repeated);
-    vector_Type vfm(M_uFESpace->map(), Repeated);
-    this->transferMeshMotionOnFluid(*meshVelRep, vfm);
+    solution.subset(*M_uk, 0);
+
+    // The vectors are stored on their repeated maps, so that they are not imported again at each product
+    M_shapeDerivativesBeta.reset(new vector_Type(beta, Repeated));
+    M_shapeDerivativesSolution.reset(new vector_Type(solution, Repeated));
+    M_shapeDerivativesMeshVelocity.reset(new vector_Type(M_uFESpace->map(), Repeated));
+    this->transferMeshMotionOnFluid(*meshVelRep, *M_shapeDerivativesMeshVelocity);
+}
+
+void FSIMonolithicGI::shapeDerivatives( matrixPtr_Type sdMatrix )
+{
+    Real alpha = 1./M_data->dataFluid()->dataTime()->timeStep();
 
     M_fluid->updateShapeDerivatives(*sdMatrix,
                                     alpha,
-                                    un,//un if !domainVelImplicit, otherwise uk
-                                    uk,//uk
-                                    vfm, //(xk-xn)/dt (FI), or (xn-xn-1)/dt (CE)//Repeated
+                                    *M_shapeDerivativesBeta,//un if !domainVelImplicit, otherwise uk
+                                    *M_shapeDerivativesSolution,//uk
+                                    *M_shapeDerivativesMeshVelocity, //(xk-xn)/dt (FI), or (xn-xn-1)/dt (CE)//Repeated
                                     M_solidAndFluidDim+M_interface*nDimensions,
                                     *M_uFESpace,
                                     M_domainVelImplicit,
@@ -399,6 +434,49 @@ void FSIMonolithicGI::shapeDerivatives( matrixPtr_Type sdMatrix )
                                    );
 }
 
+void FSIMonolithicGI::applyShapeDerivatives( const vector_Type& direction, vector_Type& product ) const
+{
+    Real alpha = 1./M_data->dataFluid()->dataTime()->timeStep();
+
+    M_fluid->applyShapeDerivatives(direction,
+                                   product,
+                                   alpha,
+                                   *M_shapeDerivativesBeta,
+                                   *M_shapeDerivativesSolution,
+                                   *M_shapeDerivativesMeshVelocity,
+                                   M_solidAndFluidDim+M_interface*nDimensions,
+                                   *M_uFESpace,
+                                   M_domainVelImplicit,
+                                   M_convectiveTermDer
+                                  );
+}
+
+void FSIMonolithicGI::checkMatrixFreeShapeDerivatives() const
+{
+    vector_Type direction(*M_monolithicMap, Unique);
+    direction.epetraVector().Random();
+
+    vector_Type product(*M_monolithicMap, Unique);
+    applyShapeDerivatives(direction, product);
+
+    vector_Type assembledProduct(*M_shapeDerivativesBlock * direction);
+    const Real assembledNorm(assembledProduct.normInf());
+    product -= assembledProduct;
+    const Real difference(assembledNorm > 0. ? product.normInf() / assembledNorm : product.normInf());
+
+    M_solid->getDisplayer().leaderPrint("  M-  Matrix-free shape derivatives, relative difference = ", difference, "\n");
+    if ( difference > 1e-10 )
+        ERROR_MSG( "The matrix-free product of the shape derivatives differs from the assembled one" );
+}
+
+Epetra_Operator& FSIMonolithicGI::jacobianOperator()
+{
+    if ( M_matrixFreeShapeDerivatives && M_data->dataFluid()->useShapeDerivatives() )
+        return M_matrixFreeJacobian;
+
+    return super_Type::jacobianOperator();
+}
+
 void
 FSIMonolithicGI::assembleMeshBlock(UInt /*iter*/)
 {
@@ -431,6 +509,28 @@ FSIMonolithicGI::assembleMeshBlock(UInt /*iter*/)
         }
 }
 
+// ===================================================
+//  Epetra_MatrixFreeJacobian
+// ===================================================
+int FSIMonolithicGI::Epetra_MatrixFreeJacobian::Apply( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const
+{
+    // Assembled blocks: fluid, solid, harmonic extension and coupling
+    int error = M_gi->M_monolithicMatrix->matrix()->matrixPtr()->Apply( X, Y );
+    if ( error )
+        return error;
+
+    // Shape derivatives, computed element by element
+    vector_Type const direction( X, M_gi->M_monolithicMap, Unique );
+    vector_Type product( *M_gi->M_monolithicMap, Unique );
+    M_gi->applyShapeDerivatives( direction, product );
+
+    // As the assembled blocks, the shape derivatives are scaled by the time step with the exact solid Jacobian (see setupBlockPrec)
+    if ( M_gi->M_data->dataSolid()->getUseExactJacobian() )
+        product *= M_gi->M_data->dataFluid()->dataTime()->timeStep();
+
+    return Y.Update( 1., product.epetraVector(), 1. );
+}
+
 // ===================================================
 //  Products registration
 // ===================================================
@@ -65,6 +65,11 @@ class Epetra_FullMonolithic;
 
  Important parameters to set properly in the data file:
  - useShapeDerivatives: if true the shape derivatives block is added to the Jacobian matrix;
+ - matrixFreeShapeDerivatives: if true the shape derivatives are not added to the Jacobian matrix, but applied element
+ by element in the operator passed to the linear solver. Their assembled block is then used only by the preconditioner,
+ and it is computed once per time step;
+ - checkMatrixFreeShapeDerivatives: if true, each time the shape derivatives block is assembled, its product with a random vector
+ is compared with the matrix-free product (for testing);
  - domainVelImplicit: if true the domain velocity w in the convective term is considered an unknown (at the time n+1);
  - convectiveTermDer: false if the convective term is linearized (\f$u^{n+1}\nabla(u^n-w^n)\f$),
  otherwise it can be either true (if we use the Newton method to solve the convective term nonlinearity) or false
@@ -193,6 +198,9 @@ protected:
     //! set the block preconditioner
     void setupBlockPrec();
 
+    //! returns the operator of the tangent system, with the shape derivatives applied matrix-free if required
+    Epetra_Operator& jacobianOperator();
+
     //@}
 
 private:
@@ -207,6 +215,9 @@ private:
         M_monolithicMatrix.reset(MonolithicBlockMatrix::Factory_Type::instance().createObject( operType ));
     }
 
+    //! computes the velocities around which the shape derivatives are evaluated, at the current Newton iteration
+    void shapeDerivativesData();
+
     /**
        calculates the terms due to the shape derivatives given the mesh increment deltaDisp. The shape derivative block is assembled in a matrix
        (not in a right hand side representing the matrix-vector multiplication)
@@ -214,6 +225,16 @@ private:
     */
     void shapeDerivatives( matrixPtr_Type sdMatrix );
 
+    /**
+       applies the shape derivatives to a direction without assembling their matrix (see shapeDerivatives).
+       \param direction: increment of the monolithic solution
+       \param product: output. Product of the shape derivatives block with the direction.
+    */
+    void applyShapeDerivatives( const vector_Type& direction, vector_Type& product ) const;
+
+    //! checks that applyShapeDerivatives gives the product with the assembled shape derivatives block (on a random vector)
+    void checkMatrixFreeShapeDerivatives() const;
+
     //! assembles the mesh motion matrix.
     /*!In Particular it diagonalize the part of the matrix corresponding to the
       Dirichlet condition expressing the coupling
@@ -224,6 +245,48 @@ private:
     //@}
 
 
+    //! Epetra_MatrixFreeJacobian  This class implements the Epetra_Operator passed to AztecOO when the shape
+    //! derivatives are not assembled: it applies the monolithic matrix and adds the shape derivatives element by element
+    class Epetra_MatrixFreeJacobian:
+        public Epetra_Operator
+    {
+
+    public:
+
+        //! @name Constructor & Destructor
+        //@{
+        //! Constructor
+        Epetra_MatrixFreeJacobian( const FSIMonolithicGI* gi ) : M_gi( gi ) {}
+
+        //! Destructor
+        virtual ~Epetra_MatrixFreeJacobian() {}
+        //@}
+
+        //! @name Methods
+        //@{
+
+        //! apply the jacobian to X and returns the result in Y
+        int Apply( const Epetra_MultiVector& X, Epetra_MultiVector& Y ) const;
+
+        //! These are the methods necessary to implement Epetra_Operator but that are not used.
+        int SetUseTranspose( bool /*UseTranspose*/ ) { return -1; }
+        int ApplyInverse( const Epetra_MultiVector& /*X*/, Epetra_MultiVector& /*Y*/ ) const { return -1; }
+        double NormInf() const { return 0.; }
+        const char* Label() const { return "matrixFreeJacobian"; }
+        bool UseTranspose() const { return false; }
+        bool HasNormInf() const { return false; }
+
+        const Epetra_Comm& Comm() const { return M_gi->M_monolithicMap->map( Unique )->Comm(); }
+        const Epetra_Map& OperatorDomainMap() const { return *M_gi->M_monolithicMap->map( Unique ); }
+        const Epetra_Map& OperatorRangeMap() const { return *M_gi->M_monolithicMap->map( Unique ); }
+        //@}
+
+    private:
+
+        const FSIMonolithicGI* M_gi;
+
+    }; // end of class Epetra_MatrixFreeJacobian
+
     //!@name Private Members
     //@{
 
@@ -235,6 +298,13 @@ private:
     matrixPtr_Type                       M_meshBlock;
     matrixPtr_Type                       M_shapeDerivativesBlock;
     matrixPtr_Type                       M_solidDerBlock;
+    bool                                 M_matrixFreeShapeDerivatives;
+    bool                                 M_checkMatrixFreeShapeDerivatives;
+    bool                                 M_updateShapeDerivativesBlock;
+    vectorPtr_Type                       M_shapeDerivativesBeta;
+    vectorPtr_Type                       M_shapeDerivativesSolution;
+    vectorPtr_Type                       M_shapeDerivativesMeshVelocity;
+    Epetra_MatrixFreeJacobian            M_matrixFreeJacobian;
     //std::vector<fluidBchandlerPtr_Type>    M_BChsLin;
     static bool                          S_register;
     //@}
@@ -116,6 +116,7 @@ FSIOperator::FSIOperator():
     M_betamedio                          ( ),
     M_epetraComm                         ( ),
     M_epetraWorldComm                    ( ),
+    M_reuseJacobian                      ( false ),
     //begin of private members
     M_lambdaSolid                        ( ),
     M_lambdaSolidRepeated                ( ),
@@ -632,6 +632,13 @@ public:
     //!Setter for the "linear solid" flag
     void setLinearSolid( const bool& linSolid ) { M_linearSolid = linSolid; }
 
+    //!Setter for the "reuse Jacobian" flag
+    /**
+       Set by NonLinearRichardson before solveJac: if true, the Jacobian (and its preconditioner)
+       of the previous iteration can be kept instead of being evaluated again (modified Newton)
+     */
+    void setReuseJacobian( const bool& reuseJacobian ) { M_reuseJacobian = reuseJacobian; }
+
     void setFluidLeader( const int& fluidLeader ) { M_fluidLeader = fluidLeader; }
     void setSolidLeader( const int& solidLeader ) { M_solidLeader = solidLeader; }
 
@@ -885,6 +892,8 @@ protected:
     commPtr_Type                                      M_epetraComm;
     commPtr_Type                                      M_epetraWorldComm;
 
+    bool                                              M_reuseJacobian;
+
     //@}
 private:
 
@@ -52,7 +52,9 @@ FSISolver::FSISolver():
         M_epetraComm        ( ),
         M_epetraWorldComm   ( ),
         M_localComm         ( new MPI_Comm ),
-        M_interComm         ( new MPI_Comm )
+        M_interComm         ( new MPI_Comm ),
+        M_jacobianLagging   ( ),
+        M_subIterations     ( 0 )
 {
 #ifdef DEBUG
     debugStream( 6220 ) << "FSISolver::FSISolver constructor starts\n";
@@ -69,6 +71,10 @@ FSISolver::setData( const dataPtr_Type& data )
 {
     M_data = data;
 
+    M_jacobianLagging.setMaxAge( data->jacobianMaxAge() );
+    M_jacobianLagging.setMaxContraction( data->jacobianMaxContraction() );
+    M_jacobianLagging.setReuseTimeSteps( data->jacobianReuseTimeSteps() );
+
     int rank, numtasks;
     MPI_Comm_rank(MPI_COMM_WORLD, &rank);
     MPI_Comm_size(MPI_COMM_WORLD, &numtasks);
@@ -310,7 +316,11 @@ FSISolver::iterate()
                                        M_data->errorTolerance(),
                                        M_data->NonLinearLineSearch(),
                                        M_out_res,
-                                       M_data->dataFluid()->dataTime()->time() );
+                                       M_data->dataFluid()->dataTime()->time(),
+                                       UInt(0),
+                                       M_jacobianLagging.isActive() ? &M_jacobianLagging : 0 );
+
+    M_subIterations = maxiter;
 
     // We update the solution
     M_oper->updateSolution( *lambda );
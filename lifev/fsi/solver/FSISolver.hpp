@@ -62,6 +62,7 @@
 #pragma GCC diagnostic warning "-Wunused-parameter"
 
 #include <lifev/core/LifeV.hpp>
+#include <lifev/core/algorithm/NonLinearJacobianLagging.hpp>
 
 //#include <life/lifealg/newton.hpp>
 
@@ -174,6 +175,12 @@ public:
     bool isFluid() { return M_oper->isFluid(); }
     bool isSolid() { return M_oper->isSolid(); }
 
+    //! get the policy for the reuse of the Jacobian, with the number of evaluated and reused Jacobians
+    const NonLinearJacobianLagging& jacobianLagging() const { return M_jacobianLagging; }
+
+    //! get the number of subiterations of the last time step
+    const UInt& subIterations() const { return M_subIterations; }
+
     //@}
 
 
@@ -260,6 +267,9 @@ private:
     std::ofstream								M_out_iter;
     std::ofstream								M_out_res;
 
+    NonLinearJacobianLagging                    M_jacobianLagging;
+    UInt                                        M_subIterations;
+
 //     data_fluid           M_dataFluid;
 //     data_solid           M_dataSolid;
 
@@ -288,6 +288,12 @@ void HarmonicExtensionSolver<Mesh, SolverType>::setUp( const GetPot& dataFile )
     M_linearSolver.setDataFromGetPot( dataFile, "mesh_motion/solver" );
     M_linearSolver.setupPreconditioner(dataFile, "mesh_motion/prec");
 
+    // Translations of the mesh displacement for the multilevel preconditioners: the operator is
+    // a vector Laplacian, the rotations are not in its near null space
+    boost::shared_ptr<std::vector<Real> > nullSpace( new std::vector<Real> );
+    const UInt numModes( M_FESpace.rigidBodyModes( *nullSpace, M_localMap, M_offset, false ) );
+    M_linearSolver.preconditioner()->setNullSpace( nullSpace, numModes );
+
     M_diffusion = dataFile("mesh_motion/diffusion",1.0);
 
     computeMatrix( );
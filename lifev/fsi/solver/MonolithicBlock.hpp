@@ -266,6 +266,17 @@ public:
      */
     virtual void push_back_precs (const epetraOperatorPtr_Type& /*Mat*/)
     {ERROR_MSG("this method should not be implemented");}
+
+    //!sets the near null space of a block
+    /*!
+      (only used if the operator is a preconditioner using multilevel preconditioners for the blocks,
+      otherwise does nothing)
+      \param block: number of the block (in the order of push_back_matrix)
+      \param nullSpace: vectors of the null space, with the size of the monolithic map (see FESpace::rigidBodyModes)
+      \param numVectors: number of vectors
+     */
+    virtual void setNullSpace( const UInt /*block*/, const boost::shared_ptr<std::vector<Real> >& /*nullSpace*/,
+                               const UInt /*numVectors*/ ) {}
     //@}
 
     //!replaces a BCHandler
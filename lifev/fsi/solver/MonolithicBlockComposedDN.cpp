@@ -44,6 +44,16 @@ void MonolithicBlockComposedDN::setDataFromGetPot( const GetPot& dataFile,
 }
 
 
+void MonolithicBlockComposedDN::setNullSpace( const UInt block, const boost::shared_ptr<std::vector<Real> >& nullSpace,
+                                              const UInt numVectors )
+{
+    // The preconditioners are in the order of application of the blocks
+    for (UInt k=0; k < M_blockReordering->size(); ++k)
+        if ( (*M_blockReordering)[k] == static_cast<Int>(block) && k < M_blockPrecs->number() )
+            M_blockPrecs->setNullSpace( k, nullSpace, numVectors );
+}
+
+
 int MonolithicBlockComposedDN::solveSystem( const vector_Type& rhs, vector_Type& step, solverPtr_Type& linearSolver )
 {
     assert(M_blockPrecs.get());
@@ -160,6 +160,14 @@ public:
      */
     virtual void    push_back_precs( matrixPtr_Type& Mat);
 
+    //!sets the near null space of the preconditioner of a block
+    /*!
+      \param block: number of the block
+      \param nullSpace: vectors of the null space
+      \param numVectors: number of vectors
+     */
+    void setNullSpace( const UInt block, const boost::shared_ptr<std::vector<Real> >& nullSpace, const UInt numVectors );
+
     //! returns the true if the preconditioner has at leas one factor computed
     bool set()
     {
@@ -357,6 +357,13 @@ public:
 
             M_fsi->iterate();
 
+            // Jacobians of the time step with the modified Newton method
+            if ( M_fsi->jacobianLagging().isActive() )
+            {
+                M_fsi->FSIOper()->displayer().leaderPrint( "Jacobians evaluated     = ", M_fsi->jacobianLagging().evaluations(), "\n" );
+                M_fsi->FSIOper()->displayer().leaderPrint( "Jacobians reused        = ", M_fsi->jacobianLagging().reuses(), "\n" );
+            }
+
             //*M_WS= *(dynamic_cast<LifeV::FSIMonolithic*>(M_fsi->FSIOper().get())->/*WS());//*/computeStress());
 
 
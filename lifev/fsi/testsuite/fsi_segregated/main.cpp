@@ -204,7 +204,8 @@ public:
 
       -# initialize and setup the FSIsolver
     */
-    Problem( const std::string& dataFileName, std::string method = "" )
+    Problem( const std::string& dataFileName, std::string method = "", const std::string& accelerator = "" ) :
+        M_subIterations ( 0 )
     {
 
         VenantKirchhoffSolver< FSIOperator::mesh_Type, SolverAztecOO >::StructureSolverFactory::instance().registerProduct( "linearVenantKirchhof", &createLinearStructure );
@@ -212,6 +213,8 @@ public:
 
         debugStream( 10000 ) << "Setting up data from GetPot \n";
         GetPot dataFile( dataFileName );
+        if ( !accelerator.empty() )
+            dataFile.set( "problem/accelerator", accelerator.c_str() );
         M_data = dataPtr_Type( new data_Type() );
         M_data->setup( dataFile );
         M_data->dataSolid()->setTimeData( M_data->dataFluid()->dataTime() ); //Same TimeData for fluid & solid
@@ -337,6 +340,9 @@ public:
 
     dataPtr_Type fsiData() { return M_data; }
 
+    //! Total number of subiterations of the run
+    UInt subIterations() const { return M_subIterations; }
+
     /*!
       This routine runs the temporal loop
     */
@@ -366,6 +372,10 @@ public:
             }
 
             M_fsi->iterate();
+            M_subIterations += M_fsi->subIterations();
+
+            // Timings of the time step, on the fluid or solid communicator (with ENABLE_PRODUCTION_LOGGING only)
+            M_fsi->FSIOper()->displayer().leaderPrintTimings( "Timings of the time step" );
 
             if ( M_fsi->isFluid() )
             {
@@ -443,6 +453,7 @@ private:
     fsi_solver_ptr M_fsi;
     dataPtr_Type   M_data;
     Real           M_Tstart;
+    UInt           M_subIterations;
 
     bool           M_absorbingBC;
 
@@ -471,18 +482,25 @@ public:
 
 struct FSIChecker
 {
-    FSIChecker( const std::string& dataFileName ):
+    FSIChecker( const std::string& dataFileName, const std::string& accelerator = "" ):
             M_dataFileName ( dataFileName ),
-            M_method       ()
+            M_method       (),
+            M_accelerator  ( accelerator ),
+            M_subIterations( 0 ),
+            M_converged    ( false )
     {
         GetPot dataFile( dataFileName );
         M_method = dataFile( "problem/method", "exactJacobian" );
     }
 
     FSIChecker( const std::string& dataFileName,
-                const std::string& method   ):
+                const std::string& method,
+                const std::string& accelerator ):
             M_dataFileName ( dataFileName ),
-            M_method       ( method )
+            M_method       ( method ),
+            M_accelerator  ( accelerator ),
+            M_subIterations( 0 ),
+            M_converged    ( false )
     {}
 
     void operator()()
@@ -491,8 +509,10 @@ struct FSIChecker
 
         try
         {
-            FSIproblem = boost::shared_ptr<Problem> ( new Problem( M_dataFileName, M_method ) );
+            FSIproblem = boost::shared_ptr<Problem> ( new Problem( M_dataFileName, M_method, M_accelerator ) );
             FSIproblem->run();
+            M_subIterations = FSIproblem->subIterations();
+            M_converged = true;
         }
         catch ( const std::exception& _ex )
         {
@@ -502,6 +522,9 @@ struct FSIChecker
 
     std::string           M_dataFileName;
     std::string           M_method;
+    std::string           M_accelerator;
+    UInt                  M_subIterations;
+    bool                  M_converged;
 };
 
 int main( int argc, char** argv )
@@ -559,8 +582,31 @@ int main( int argc, char** argv )
         }
     */
 
-    FSIChecker FSIProblem( dataFileName );
-    FSIProblem();
+    // With --accelerators, the fixed point iterations are run with Aitken and with IQN-ILS:
+    // the quasi-Newton acceleration has to need fewer subiterations
+    if ( command_line.search( "--accelerators" ) )
+    {
+        FSIChecker aitkenProblem( dataFileName, "Aitken" );
+        aitkenProblem();
+
+        FSIChecker iqnProblem( dataFileName, "IQN-ILS" );
+        iqnProblem();
+
+        std::cout << "Subiterations with Aitken  : " << aitkenProblem.M_subIterations << "\n"
+                  << "Subiterations with IQN-ILS : " << iqnProblem.M_subIterations << std::endl;
+
+        if ( !aitkenProblem.M_converged || !iqnProblem.M_converged
+             || iqnProblem.M_subIterations >= aitkenProblem.M_subIterations )
+        {
+            std::cout << "The fixed point iterations failed, or IQN-ILS did not reduce the number of subiterations" << std::endl;
+            returnValue = EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        FSIChecker FSIProblem( dataFileName );
+        FSIProblem();
+    }
 
     std::cout << "Total sum up " << chrono.diffCumul() << " s." << std::endl;
 
@@ -388,7 +388,9 @@ void HeartBidomainSolver<Mesh, SolverType>::buildSystem()
     Chrono chronoMassAssemble;
     Chrono chronoZero;
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_comm->Barrier();
+#endif
     chrono.start();
 
     //! Elementary computation and matrix assembling
@@ -534,7 +536,9 @@ void HeartBidomainSolver<Mesh, SolverType>::buildSystem()
     massCoeff = M_data.volumeSurfaceRatio() * M_data.membraneCapacitance() *
         M_BDFIntraExtraPotential.coefficientFirstDerivative(0) / M_data.timeStep();
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_comm->Barrier();
+#endif
     chrono.stop();
 
     if (M_verbose) std::cout << "done in " << chrono.diff() << " s.\n" << std::flush;
@@ -692,7 +696,9 @@ void HeartBidomainSolver<Mesh, SolverType>::PDEiterate( bchandlerRaw_Type& bch )
                   << std::flush;
 
     // boundary conditions update
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_comm->Barrier();
+#endif
     if (M_verbose) std::cout << "  f-  Applying boundary conditions ...         "
                              << std::flush;
 
@@ -701,7 +707,9 @@ void HeartBidomainSolver<Mesh, SolverType>::PDEiterate( bchandlerRaw_Type& bch )
 
     chrono.stop();
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_comm->Barrier();
+#endif
 
     if (M_verbose) std::cout << "done in " << chrono.diff() << " s.\n" << std::flush;
 
@@ -721,7 +721,9 @@ void LuoRudy<Mesh, SolverType>::solveIonicModel( const vector_Type& u, const Rea
 	//! Solving dw/dt=eta2 (u/vp -  eta3 w)
 	LifeChrono chronoionmodelsolve;
 	chronoionmodelsolve.start();
+#ifndef ENABLE_PRODUCTION_LOGGING
 	HeartIonicSolver<Mesh, SolverType>::M_comm->Barrier();
+#endif
 
 	for ( Int i = 0 ; i < u.epetraVector().MyLength() ; i++ )
 	{
@@ -853,7 +855,9 @@ void LuoRudy<Mesh, SolverType>::solveIonicModel( const vector_Type& u, const Rea
 	M_solutionGatingX.globalAssemble();
 	M_solutionGatingCa.globalAssemble();
 
+#ifndef ENABLE_PRODUCTION_LOGGING
 	HeartIonicSolver<Mesh, SolverType>::M_comm->Barrier();
+#endif
 
 	chronoionmodelsolve.stop();
     if (HeartIonicSolver<Mesh, SolverType>::M_comm->MyPID()==0)
@@ -360,7 +360,9 @@ void HeartMonodomainSolver<Mesh, SolverType>::buildSystem()
     LifeChrono chronoMassAssemble;
     LifeChrono chronoZero;
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_comm->Barrier();
+#endif
 
     chrono.start();
 
@@ -505,7 +507,9 @@ void HeartMonodomainSolver<Mesh, SolverType>::buildSystem()
 
     massCoefficient = M_data.volumeSurfaceRatio() * M_data.membraneCapacitance() / M_data.timeStep();
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_comm->Barrier();
+#endif
 
     chrono.stop();
     if (M_verbose) std::cout << "done in " << chrono.diff() << " s.\n" << std::flush;
@@ -672,7 +676,9 @@ void HeartMonodomainSolver<Mesh, SolverType>::PDEiterate( bcHandlerRaw_Type& bch
                   << std::flush;
 
     // boundary conditions update
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_comm->Barrier();
+#endif
     if (M_verbose) std::cout << "  f-  Applying boundary conditions ...         "
               << std::flush;
 
@@ -682,7 +688,9 @@ void HeartMonodomainSolver<Mesh, SolverType>::PDEiterate( bcHandlerRaw_Type& bch
 
     chrono.stop();
 
+#ifndef ENABLE_PRODUCTION_LOGGING
     M_comm->Barrier();
+#endif
 
     if (M_verbose) std::cout << "done in " << chrono.diff() << " s.\n" << std::flush;
 
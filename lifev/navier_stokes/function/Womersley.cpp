@@ -65,6 +65,42 @@ Real Womersley::uexact( const Real& t, const Real& /*x*/, const Real& y, const R
     return 1.;
 }
 
+std::complex<Real> Womersley::uexactAmplitude( const Real& y, const Real& z )
+{
+    Real r=std::sqrt(z*z+y*y);
+    std::complex<Real> z2, b2;
+    z2 = 2.*r/S_D*S_z1;
+    bessel::cbessjy01(z2, b2, S_cj1, S_cy0, S_cy1, S_cj0p, S_cj1p, S_cy0p, S_cy1p);
+    return S_A/S_L/S_rho/S_wi*(1.-b2/S_b1);
+}
+
+BCFunctionSeparable Womersley::uexactSeparable()
+{
+    BCFunctionSeparable separable( &Womersley::cosine, &Womersley::uexactCosine );
+    separable.addTerm( &Womersley::sine, &Womersley::uexactSine );
+    return separable;
+}
+
+Real Womersley::uexactCosine( const Real& /*x*/, const Real& y, const Real& z, const ID& i )
+{
+    return ( i == 0 ) ? real( uexactAmplitude( y, z ) ) : 0.;
+}
+
+Real Womersley::uexactSine( const Real& /*x*/, const Real& y, const Real& z, const ID& i )
+{
+    return ( i == 0 ) ? -imag( uexactAmplitude( y, z ) ) : 0.;
+}
+
+Real Womersley::cosine( const Real& t )
+{
+    return std::cos(S_w*t);
+}
+
+Real Womersley::sine( const Real& t )
+{
+    return std::sin(S_w*t);
+}
+
 Real Womersley::pexact( const Real& t, const Real& x, const Real& /*y*/, const Real& /*z*/, const ID& /* i */ )
 {
     return S_A/S_L*(S_L-x)*std::cos(S_w*t);
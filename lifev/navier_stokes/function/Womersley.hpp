@@ -59,6 +59,7 @@
 
 #include <lifev/core/LifeV.hpp>
 #include <lifev/core/filter/GetPot.hpp>
+#include <lifev/core/fem/BCFunction.hpp>
 
 
 
@@ -75,6 +76,14 @@ public:
                         const Real& z, const ID& i );
     static Real uexact( const Real& t, const Real& x, const Real& y,
                         const Real& z, const ID& i );
+
+    //! Velocity as the separable function cos(wt) Re(U(r)) - sin(wt) Im(U(r)), with U(r) computed once per point
+    static BCFunctionSeparable uexactSeparable();
+
+    static Real uexactCosine( const Real& x, const Real& y, const Real& z, const ID& i );
+    static Real uexactSine( const Real& x, const Real& y, const Real& z, const ID& i );
+    static Real cosine( const Real& t );
+    static Real sine( const Real& t );
     static Real pexact( const Real& t, const Real& x, const Real& y,
                         const Real& z, const ID& i );
 
@@ -108,6 +117,9 @@ public:
 
 private:
 
+    //! Complex amplitude U(r) of the axial velocity, u = Re( U(r) exp(iwt) )
+    static std::complex<Real> uexactAmplitude( const Real& y, const Real& z );
+
     static Int  S_flagStrain;
     static Real S_mu;
     static Real S_nu;
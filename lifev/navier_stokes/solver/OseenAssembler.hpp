@@ -246,6 +246,7 @@ public:
     {
         ASSERT(M_massRhsCFE != 0,"No Rhs currentFE for setting the quadrature rule!");
         M_massRhsCFE->setQuadRule(qr);
+        M_massRhsCFE->setGeometryCache(M_uFESpace->geometryCache(qr));
     }
 
 
@@ -444,7 +445,19 @@ setup(const fespacePtr_Type& uFESpace, const fespacePtr_Type& pFESpace, const fe
 
     M_localMassRhs.reset(new localVector_Type(M_uFESpace->fe().nbFEDof(), M_uFESpace->fieldDim()));
 
-
+    // Use the geometry cache of the velocity FE space, if enabled. All the current FEs
+    // share the geometric map of the velocity, so the cache depends only on the quadrature.
+    M_viscousCFE->setGeometryCache(M_uFESpace->geometryCache(M_viscousCFE->quadRule()));
+    M_gradPressureUCFE->setGeometryCache(M_uFESpace->geometryCache(M_gradPressureUCFE->quadRule()));
+    M_gradPressurePCFE->setGeometryCache(M_uFESpace->geometryCache(M_gradPressurePCFE->quadRule()));
+    M_divergenceUCFE->setGeometryCache(M_uFESpace->geometryCache(M_divergenceUCFE->quadRule()));
+    M_divergencePCFE->setGeometryCache(M_uFESpace->geometryCache(M_divergencePCFE->quadRule()));
+    M_massCFE->setGeometryCache(M_uFESpace->geometryCache(M_massCFE->quadRule()));
+    M_massPressureCFE->setGeometryCache(M_uFESpace->geometryCache(M_massPressureCFE->quadRule()));
+    M_convectionUCFE->setGeometryCache(M_uFESpace->geometryCache(M_convectionUCFE->quadRule()));
+    M_convectionBetaCFE->setGeometryCache(M_uFESpace->geometryCache(M_convectionBetaCFE->quadRule()));
+    M_convectionRhsUCFE->setGeometryCache(M_uFESpace->geometryCache(M_convectionRhsUCFE->quadRule()));
+    M_massRhsCFE->setGeometryCache(M_uFESpace->geometryCache(M_massRhsCFE->quadRule()));
 
 }
 
@@ -48,11 +48,13 @@
 #include <lifev/core/algorithm/Preconditioner.hpp>
 #include <lifev/core/algorithm/PreconditionerIfpack.hpp>
 #include <lifev/core/algorithm/PreconditionerAztecOO.hpp>
+#include <lifev/core/algorithm/PreconditionerSaddlePoint.hpp>
 #include <lifev/core/array/MapEpetra.hpp>
 
 #include <lifev/core/array/MatrixElemental.hpp>
 #include <lifev/core/array/VectorElemental.hpp>
 #include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/MatrixEpetraRowAccumulator.hpp>
 #include <lifev/core/array/VectorEpetra.hpp>
 
 #include <lifev/core/util/LifeChrono.hpp>
@@ -60,6 +62,8 @@
 #include <lifev/core/fem/Assembly.hpp>
 #include <lifev/core/fem/BCManage.hpp>
 #include <lifev/core/fem/AssemblyElemental.hpp>
+#include <lifev/core/fem/AssemblyElementalBatched.hpp>
+#include <lifev/core/fem/ElementColoring.hpp>
 #include <lifev/core/fem/SobolevNorms.hpp>
 #include <lifev/core/fem/GeometricMap.hpp>
 #include <lifev/core/fem/PostProcessingBoundary.hpp>
@@ -70,6 +74,10 @@
 
 #include <boost/shared_ptr.hpp>
 
+#ifdef HAVE_OPENMP
+#include <omp.h>
+#endif
+
 #include <list>
 
 namespace LifeV
@@ -567,6 +575,15 @@ public:
         return *M_velocityMatrixMass;
     }
 
+    //! Return the number of iterations of the last solution of the linear system
+    /*!
+        @return Number of iterations of the linear solver
+     */
+    Int linearSolverIterations() const
+    {
+        return M_linearSolver.numIterations();
+    }
+
     //@}
 
     //@{ unused methods
@@ -632,6 +649,50 @@ protected:
      */
     void echo( std::string message );
 
+    //! Assemble the Stokes and mass matrices with the batched procedures of AssemblyElementalBatched.hpp
+    void assembleConstantMatricesBatched();
+
+    //! Color the local elements for the threaded assembly, if not already done
+    void setupElementColoring();
+
+    //! Number of threads used by the threaded assembly
+    UInt numAssemblyThreads() const;
+
+    //! Assemble the Stokes and mass matrices with several threads, one color of elements at a time
+    void assembleConstantMatricesThreaded();
+
+    //! Assemble the convective terms with several threads, one color of elements at a time
+    /*!
+      @param betaVectorRepeated Advection field, repeated
+      @param unRepeated Velocity at the previous time step, repeated
+      @param matrixNoBC Matrix where the terms are added
+     */
+    void assembleConvectiveMatrixThreaded( const vector_Type& betaVectorRepeated,
+                                           const vector_Type& unRepeated,
+                                           matrix_Type&       matrixNoBC );
+
+    //! Assemble the convective terms of one element
+    /*!
+      @param iElement Local ID of the element
+      @param betaVectorRepeated Advection field, repeated
+      @param unRepeated Velocity at the previous time step, repeated
+      @param matrixNoBC Matrix where the terms are added
+     */
+    void assembleConvectiveElement( const UInt&        iElement,
+                                    const vector_Type& betaVectorRepeated,
+                                    const vector_Type& unRepeated,
+                                    matrix_Type&       matrixNoBC );
+
+    //! Assemble the pressure mass and Laplacian matrices of the PCD preconditioner
+    void assemblePressureMatricesPCD();
+
+    //! Update the pressure convection-diffusion matrix of the PCD preconditioner
+    /*!
+      @param alpha Coefficient of the time derivative
+      @param betaVector Advection field
+     */
+    void updatePressureConvectionDiffusion( const Real& alpha, const vector_Type& betaVector );
+
     //! Return the dim of velocity FE space
     const UInt& dimVelocity() const
     {
@@ -717,6 +778,17 @@ protected:
 
     bool                           M_stiffStrain;
 
+    bool                           M_batchedAssembly;
+
+    //! Threaded assembly, the elements of one color share no degree of freedom
+    bool                           M_threadedAssembly;
+    ElementColoring                M_elementColoring;
+    //! Row buffers of the convective term, kept between the time steps to reuse their memory
+    boost::shared_ptr<MatrixEpetraRowAccumulator> M_convectiveAccumulator;
+
+    //! Overlap the import of the advection field with the assembly of the convective term
+    bool                           M_overlappedImport;
+
     //
     Real                           M_diagonalize;
 
@@ -738,6 +810,14 @@ protected:
     VectorElemental                        M_uLoc;
     boost::shared_ptr<vector_Type> M_un;
 
+    //! Block preconditioner of the saddle point problem, if chosen in the data file
+    boost::shared_ptr<PreconditionerSaddlePoint> M_saddlePointPreconditioner;
+
+    //! Pressure mass, Laplacian and convection-diffusion matrices of the PCD preconditioner
+    matrixPtr_Type                 M_pressureMassPCD;
+    matrixPtr_Type                 M_pressureLaplacianPCD;
+    matrixPtr_Type                 M_pressureConvectionDiffusionPCD;
+
 }; // class OseenSolver
 
 
@@ -789,6 +869,10 @@ OseenSolver( boost::shared_ptr<data_Type>    dataType,
         M_betaFunction           ( 0 ),
         M_divBetaUv              ( false ),
         M_stiffStrain            ( false ),
+        M_batchedAssembly        ( false ),
+        M_threadedAssembly       ( false ),
+        M_elementColoring        ( ),
+        M_overlappedImport       ( false ),
         M_diagonalize            ( false ),
         M_count                  ( 0 ),
         M_recomputeMatrix        ( false ),
@@ -803,7 +887,11 @@ OseenSolver( boost::shared_ptr<data_Type>    dataType,
         M_blockPreconditioner    ( ),
         M_wLoc                   ( M_velocityFESpace.fe().nbFEDof(), velocityFESpace.fieldDim() ),
         M_uLoc                   ( M_velocityFESpace.fe().nbFEDof(), velocityFESpace.fieldDim() ),
-        M_un                     ( new vector_Type(M_localMap) )
+        M_un                     ( new vector_Type(M_localMap) ),
+        M_saddlePointPreconditioner   ( ),
+        M_pressureMassPCD             ( ),
+        M_pressureLaplacianPCD        ( ),
+        M_pressureConvectionDiffusionPCD ( )
 {
     M_stabilization = ( &M_velocityFESpace.refFE() == &M_pressureFESpace.refFE() );
     M_ipStabilization.setFeSpaceVelocity(M_velocityFESpace);
@@ -852,6 +940,10 @@ OseenSolver( boost::shared_ptr<data_Type>    dataType,
         M_betaFunction           ( 0 ),
         M_divBetaUv              ( false ),
         M_stiffStrain            ( false ),
+        M_batchedAssembly        ( false ),
+        M_threadedAssembly       ( false ),
+        M_elementColoring        ( ),
+        M_overlappedImport       ( false ),
         M_diagonalize            ( false ),
         M_count                  ( 0 ),
         M_recomputeMatrix        ( false ),
@@ -866,7 +958,11 @@ OseenSolver( boost::shared_ptr<data_Type>    dataType,
         M_blockPreconditioner    ( ),
         M_wLoc                   ( M_velocityFESpace.fe().nbFEDof(), M_velocityFESpace.fieldDim() ),
         M_uLoc                   ( M_velocityFESpace.fe().nbFEDof(), M_velocityFESpace.fieldDim() ),
-        M_un                     ( new vector_Type(M_localMap) )
+        M_un                     ( new vector_Type(M_localMap) ),
+        M_saddlePointPreconditioner   ( ),
+        M_pressureMassPCD             ( ),
+        M_pressureLaplacianPCD        ( ),
+        M_pressureConvectionDiffusionPCD ( )
 {
     M_stabilization = ( &M_velocityFESpace.refFE() == &M_pressureFESpace.refFE() );
     M_ipStabilization.setFeSpaceVelocity(M_velocityFESpace);
@@ -914,6 +1010,10 @@ OseenSolver( boost::shared_ptr<data_Type>    dataType,
         M_betaFunction           ( 0 ),
         M_divBetaUv              ( false ),
         M_stiffStrain            ( false ),
+        M_batchedAssembly        ( false ),
+        M_threadedAssembly       ( false ),
+        M_elementColoring        ( ),
+        M_overlappedImport       ( false ),
         M_diagonalize            ( false ),
         M_count                  ( 0 ),
         M_recomputeMatrix        ( false ),
@@ -928,7 +1028,11 @@ OseenSolver( boost::shared_ptr<data_Type>    dataType,
         M_blockPreconditioner    ( ),
         M_wLoc                   ( M_velocityFESpace.fe().nbFEDof(), velocityFESpace.fieldDim() ),
         M_uLoc                   ( M_velocityFESpace.fe().nbFEDof(), velocityFESpace.fieldDim() ),
-        M_un                     ( new vector_Type(M_localMap) )
+        M_un                     ( new vector_Type(M_localMap) ),
+        M_saddlePointPreconditioner   ( ),
+        M_pressureMassPCD             ( ),
+        M_pressureLaplacianPCD        ( ),
+        M_pressureConvectionDiffusionPCD ( )
 {
     M_stabilization = ( &M_velocityFESpace.refFE() == &M_pressureFESpace.refFE() );
     M_ipStabilization.setFeSpaceVelocity(M_velocityFESpace);
@@ -968,7 +1072,19 @@ OseenSolver<MeshType, SolverType>::setUp( const GetPot& dataFile )
     M_divBetaUv   = dataFile( "fluid/space_discretization/div_beta_u_v",false);
     // Enable grad( u )^T in stress tensor
     M_stiffStrain = dataFile( "fluid/space_discretization/stiff_strain",false);
+    // Compute the local matrices of several elements at the same time
+    M_batchedAssembly = dataFile( "fluid/space_discretization/batched_assembly", false );
+    // Compute the local matrices with several threads (only with OpenMP)
+    M_threadedAssembly = dataFile( "fluid/space_discretization/threaded_assembly", false );
+    // Assemble the convective term of the interior elements while the advection field is imported
+    M_overlappedImport = dataFile( "fluid/space_discretization/overlapped_import", false );
     M_diagonalize = dataFile( "fluid/space_discretization/diagonalize", 1. );
+    // Store the jacobians of the geometric map, useful when the mesh does not move
+    if ( dataFile( "fluid/space_discretization/geometry_cache", false ) )
+    {
+        M_velocityFESpace.setGeometryCache( true );
+        M_pressureFESpace.setGeometryCache( true );
+    }
     M_isDiagonalBlockPreconditioner = dataFile( "fluid/diagonalBlockPrec", false );
 
     //    M_linearSolver.setAztecooPreconditioner( dataFile, "fluid/solver" );
@@ -976,6 +1092,11 @@ OseenSolver<MeshType, SolverType>::setUp( const GetPot& dataFile )
     M_ipStabilization.setGammaBeta ( M_gammaBeta );
     M_ipStabilization.setGammaDiv  ( M_gammaDiv );
     M_ipStabilization.setGammaPress( M_gammaPress );
+
+    // Block preconditioners: the velocity unknowns come first
+    M_saddlePointPreconditioner = boost::dynamic_pointer_cast<PreconditionerSaddlePoint>( M_linearSolver.preconditioner() );
+    if ( M_saddlePointPreconditioner )
+        M_saddlePointPreconditioner->setNumVelocityDofs( M_velocityFESpace.fieldDim() * dimVelocity() );
 }
 
 
@@ -1061,68 +1182,91 @@ OseenSolver<MeshType, SolverType>::buildSystem()
     }
     chrono.start();
 
-    for ( UInt iElement = 0; iElement < M_velocityFESpace.mesh()->numElements(); iElement++ )
+    if ( M_threadedAssembly )
     {
-        chronoDer.start();
-        // just to provide the id number in the assem_mat_mixed
-        M_pressureFESpace.fe().update( M_velocityFESpace.mesh()->element( iElement ) );
-        // just to provide the id number in the assem_mat_mixed
-        // M_pressureFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
-        M_velocityFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
-
-        chronoDer.stop();
+        assembleConstantMatricesThreaded();
+    }
+    else if ( M_batchedAssembly )
+    {
+        assembleConstantMatricesBatched();
+    }
+    else
+    {
+        for ( UInt iElement = 0; iElement < M_velocityFESpace.mesh()->numElements(); iElement++ )
+        {
+            chronoDer.start();
+            // just to provide the id number in the assem_mat_mixed
+            M_pressureFESpace.fe().update( M_velocityFESpace.mesh()->element( iElement ) );
+            // just to provide the id number in the assem_mat_mixed
+            // M_pressureFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
+            M_velocityFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
 
-        chronoZero.start();
-        M_elementMatrixStiff.zero();
-        M_elementMatrixMass.zero();
-        M_elementMatrixPreconditioner.zero();
-        M_elementMatrixDivergence.zero();
-        M_elementMatrixGradient.zero();
-        chronoZero.stop();
+            chronoDer.stop();
 
-        // stiffness matrix
-        chronoStiff.start();
-        if ( M_stiffStrain )
-            stiff_strain( 2.0*M_oseenData->viscosity(),
-                          M_elementMatrixStiff,
-                          M_velocityFESpace.fe() );
-        else
-            stiff( M_oseenData->viscosity(),
-                   M_elementMatrixStiff,
-                   M_velocityFESpace.fe(), 0, 0, M_velocityFESpace.fieldDim() );
-        //stiff_div( 0.5*M_velocityFESpace.fe().diameter(), M_elementMatrixStiff, M_velocityFESpace.fe() );
-        chronoStiff.stop();
-
-        // mass matrix
-        if ( !M_steady )
-        {
-            chronoMass.start();
-            mass( M_oseenData->density(),
-                  M_elementMatrixMass,
-                  M_velocityFESpace.fe(), 0, 0, M_velocityFESpace.fieldDim() );
-            chronoMass.stop();
-        }
+            chronoZero.start();
+            M_elementMatrixStiff.zero();
+            M_elementMatrixMass.zero();
+            M_elementMatrixPreconditioner.zero();
+            M_elementMatrixDivergence.zero();
+            M_elementMatrixGradient.zero();
+            chronoZero.stop();
 
-        for ( UInt iComponent = 0; iComponent < numVelocityComponent; iComponent++ )
-        {
             // stiffness matrix
-            chronoStiffAssemble.start();
-            if ( M_isDiagonalBlockPreconditioner == true )
+            chronoStiff.start();
+            if ( M_stiffStrain )
+                stiff_strain( 2.0*M_oseenData->viscosity(),
+                              M_elementMatrixStiff,
+                              M_velocityFESpace.fe() );
+            else
+                stiff( M_oseenData->viscosity(),
+                       M_elementMatrixStiff,
+                       M_velocityFESpace.fe(), 0, 0, M_velocityFESpace.fieldDim() );
+            //stiff_div( 0.5*M_velocityFESpace.fe().diameter(), M_elementMatrixStiff, M_velocityFESpace.fe() );
+            chronoStiff.stop();
+
+            // mass matrix
+            if ( !M_steady )
             {
-                assembleMatrix( *M_blockPreconditioner,
-                                M_elementMatrixStiff,
-                                M_velocityFESpace.fe(),
-                                M_velocityFESpace.fe(),
-                                M_velocityFESpace.dof(),
-                                M_velocityFESpace.dof(),
-                                iComponent, iComponent,
-                                iComponent * velocityTotalDof, iComponent * velocityTotalDof);
+                chronoMass.start();
+                mass( M_oseenData->density(),
+                      M_elementMatrixMass,
+                      M_velocityFESpace.fe(), 0, 0, M_velocityFESpace.fieldDim() );
+                chronoMass.stop();
             }
-            else
+
+            for ( UInt iComponent = 0; iComponent < numVelocityComponent; iComponent++ )
             {
-                if ( M_stiffStrain ) // sigma = 0.5 * mu (grad( u ) + grad ( u )^T)
+                // stiffness matrix
+                chronoStiffAssemble.start();
+                if ( M_isDiagonalBlockPreconditioner == true )
+                {
+                    assembleMatrix( *M_blockPreconditioner,
+                                    M_elementMatrixStiff,
+                                    M_velocityFESpace.fe(),
+                                    M_velocityFESpace.fe(),
+                                    M_velocityFESpace.dof(),
+                                    M_velocityFESpace.dof(),
+                                    iComponent, iComponent,
+                                    iComponent * velocityTotalDof, iComponent * velocityTotalDof);
+                }
+                else
                 {
-                    for ( UInt jComp = 0; jComp < numVelocityComponent; jComp++ )
+                    if ( M_stiffStrain ) // sigma = 0.5 * mu (grad( u ) + grad ( u )^T)
+                    {
+                        for ( UInt jComp = 0; jComp < numVelocityComponent; jComp++ )
+                        {
+                            assembleMatrix( *M_matrixStokes,
+                                            M_elementMatrixStiff,
+                                            M_velocityFESpace.fe(),
+                                            M_velocityFESpace.fe(),
+                                            M_velocityFESpace.dof(),
+                                            M_velocityFESpace.dof(),
+                                            iComponent, jComp,
+                                            iComponent * velocityTotalDof, jComp * velocityTotalDof);
+
+                        }
+                    }
+                    else // sigma = mu grad( u )
                     {
                         assembleMatrix( *M_matrixStokes,
                                         M_elementMatrixStiff,
@@ -1130,71 +1274,59 @@ OseenSolver<MeshType, SolverType>::buildSystem()
                                         M_velocityFESpace.fe(),
                                         M_velocityFESpace.dof(),
                                         M_velocityFESpace.dof(),
-                                        iComponent, jComp,
-                                        iComponent * velocityTotalDof, jComp * velocityTotalDof);
-
+                                        iComponent, iComponent,
+                                        iComponent * velocityTotalDof, iComponent * velocityTotalDof);
                     }
                 }
-                else // sigma = mu grad( u )
+                chronoStiffAssemble.stop();
+
+                // mass matrix
+                if ( !M_steady )
                 {
-                    assembleMatrix( *M_matrixStokes,
-                                    M_elementMatrixStiff,
+                    chronoMassAssemble.start();
+                    assembleMatrix( *M_velocityMatrixMass,
+                                    M_elementMatrixMass,
                                     M_velocityFESpace.fe(),
                                     M_velocityFESpace.fe(),
                                     M_velocityFESpace.dof(),
                                     M_velocityFESpace.dof(),
                                     iComponent, iComponent,
                                     iComponent * velocityTotalDof, iComponent * velocityTotalDof);
+                    chronoMassAssemble.stop();
                 }
-            }
-            chronoStiffAssemble.stop();
 
-            // mass matrix
-            if ( !M_steady )
-            {
-                chronoMassAssemble.start();
-                assembleMatrix( *M_velocityMatrixMass,
-                                M_elementMatrixMass,
+                // divergence
+                chronoGrad.start();
+                grad( iComponent, 1.0,
+                      M_elementMatrixGradient,
+                      M_velocityFESpace.fe(),
+                      M_pressureFESpace.fe(),
+                      iComponent, 0 );
+                chronoGrad.stop();
+
+                chronoGradAssemble.start();
+                assembleMatrix( *M_matrixStokes,
+                                M_elementMatrixGradient,
                                 M_velocityFESpace.fe(),
-                                M_velocityFESpace.fe(),
-                                M_velocityFESpace.dof(),
+                                M_pressureFESpace.fe(),
                                 M_velocityFESpace.dof(),
-                                iComponent, iComponent,
-                                iComponent * velocityTotalDof, iComponent * velocityTotalDof);
-                chronoMassAssemble.stop();
+                                M_pressureFESpace.dof(),
+                                iComponent, 0,
+                                iComponent * velocityTotalDof, numVelocityComponent * velocityTotalDof );
+                chronoGradAssemble.stop();
+
+                chronoDivAssemble.start();
+                assembleTransposeMatrix( *M_matrixStokes,
+                                         -1.,
+                                         M_elementMatrixGradient,
+                                         M_pressureFESpace.fe(),
+                                         M_velocityFESpace.fe(),
+                                         M_pressureFESpace.dof(),
+                                         M_velocityFESpace.dof(),
+                                         0 , iComponent,
+                                         numVelocityComponent * velocityTotalDof, iComponent * velocityTotalDof );
+                chronoDivAssemble.stop();
             }
-
-            // divergence
-            chronoGrad.start();
-            grad( iComponent, 1.0,
-                  M_elementMatrixGradient,
-                  M_velocityFESpace.fe(),
-                  M_pressureFESpace.fe(),
-                  iComponent, 0 );
-            chronoGrad.stop();
-
-            chronoGradAssemble.start();
-            assembleMatrix( *M_matrixStokes,
-                            M_elementMatrixGradient,
-                            M_velocityFESpace.fe(),
-                            M_pressureFESpace.fe(),
-                            M_velocityFESpace.dof(),
-                            M_pressureFESpace.dof(),
-                            iComponent, 0,
-                            iComponent * velocityTotalDof, numVelocityComponent * velocityTotalDof );
-            chronoGradAssemble.stop();
-
-            chronoDivAssemble.start();
-            assembleTransposeMatrix( *M_matrixStokes,
-                                     -1.,
-                                     M_elementMatrixGradient,
-                                     M_pressureFESpace.fe(),
-                                     M_velocityFESpace.fe(),
-                                     M_pressureFESpace.dof(),
-                                     M_velocityFESpace.dof(),
-                                     0 , iComponent,
-                                     numVelocityComponent * velocityTotalDof, iComponent * velocityTotalDof );
-            chronoDivAssemble.stop();
         }
     }
 
@@ -1206,7 +1338,9 @@ OseenSolver<MeshType, SolverType>::buildSystem()
         M_blockPreconditioner->globalAssemble();
         *M_matrixStokes += *M_blockPreconditioner;
     }
+#ifndef ENABLE_PRODUCTION_LOGGING
     comm()->Barrier();
+#endif
 
     chrono.stop();
     M_Displayer.leaderPrintMax( "done in " , chrono.diff() );
@@ -1221,6 +1355,10 @@ OseenSolver<MeshType, SolverType>::buildSystem()
     chrono.stop();
     M_Displayer.leaderPrintMax( "done in " , chrono.diff() );
 
+    // The velocity mass matrix scales the LSC approximation of the Schur complement
+    if ( M_saddlePointPreconditioner && !M_steady )
+        M_saddlePointPreconditioner->setVelocityMass( M_velocityMatrixMass );
+
     if ( false )
         std::cout << " partial times:  \n"
                   << " Der            " << chronoDer.diffCumul() << " s.\n"
@@ -1273,9 +1411,6 @@ updateSystem( const Real         alpha,
 
     chrono.start();
 
-    UInt velocityTotalDof   = M_velocityFESpace.dof().numTotalDof();
-//    UInt pressureTotalDof = M_pressureFESpace.dof().numTotalDof();
-
     // Right hand side for the velocity at time
 
     updateRightHandSide( sourceVector );
@@ -1307,8 +1442,6 @@ updateSystem( const Real         alpha,
     M_Displayer.leaderPrintMax( "done in " , chrono.diff() );
 
 
-    UInt numVelocityComponent = M_velocityFESpace.fieldDim();
-
     //! managing the convective term
 
     Real normInf;
@@ -1321,7 +1454,14 @@ updateSystem( const Real         alpha,
 
         // vector with repeated nodes over the processors
 
-        vector_Type betaVectorRepeated( betaVector, Repeated );
+        // The import of the advection field is overlapped with the assembly of the interior elements
+        const bool overlappedImport( M_overlappedImport && !M_threadedAssembly && betaVector.mapType() == Unique );
+
+        vector_Type betaVectorRepeated( betaVector.map(), Repeated );
+        if ( overlappedImport )
+            betaVectorRepeated.beginImport( betaVector );
+        else
+            betaVectorRepeated = vector_Type( betaVector, Repeated );
         vector_Type unRepeated( *un, Repeated );
 
         chrono.stop();
@@ -1330,80 +1470,33 @@ updateSystem( const Real         alpha,
         M_Displayer.leaderPrint( "  F-  Updating the convective terms ...        " );
         chrono.start();
 
-        for ( UInt iElement = 0; iElement < M_velocityFESpace.mesh()->numElements(); ++iElement )
+        if ( M_threadedAssembly )
         {
-            // just to provide the id number in the assem_mat_mixed
-            M_pressureFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
-            //as updateFirstDer
-            M_velocityFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
-
-            M_elementMatrixStiff.zero();
+            assembleConvectiveMatrixThreaded( betaVectorRepeated, unRepeated, *matrixNoBC );
+        }
+        else if ( overlappedImport )
+        {
+            const std::vector<UInt>& interiorElements( M_velocityFESpace.interiorElements() );
+            const std::vector<UInt>& interfaceElements( M_velocityFESpace.interfaceElements() );
 
-            UInt elementID = M_velocityFESpace.fe().currentLocalId();
-            // Non linear term, Semi-implicit approach
-            // M_elementRightHandSide contains the velocity values in the nodes
-            for ( UInt iNode = 0 ; iNode < M_velocityFESpace.fe().nbFEDof() ; iNode++ )
+            // The interior elements need only the local values of the advection field
+            for ( UInt iElement = 0; iElement < interiorElements.size(); ++iElement )
             {
-                UInt iLocal = M_velocityFESpace.fe().patternFirst( iNode );
-                for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
-                {
-                    UInt iGlobal = M_velocityFESpace.dof().localToGlobalMap( elementID, iLocal )
-                                   + iComponent * dimVelocity();
-                    M_elementRightHandSide.vec() [ iLocal + iComponent * M_velocityFESpace.fe().nbFEDof() ]
-                    = betaVectorRepeated[iGlobal];
-
-                    M_uLoc.vec() [ iLocal + iComponent * M_velocityFESpace.fe().nbFEDof() ]
-                    = unRepeated(iGlobal);
-                    M_wLoc.vec() [ iLocal + iComponent * M_velocityFESpace.fe().nbFEDof() ]
-                    = unRepeated(iGlobal) - betaVectorRepeated(iGlobal);
-                }
+                assembleConvectiveElement( interiorElements[iElement], betaVectorRepeated, unRepeated, *matrixNoBC );
             }
 
+            betaVectorRepeated.endImport();
 
-            // ALE term: - rho div w u v
-            mass_divw( - M_oseenData->density(),
-                       M_wLoc,
-                       M_elementMatrixStiff,
-                       M_velocityFESpace.fe(), 0, 0, numVelocityComponent );
-
-            // ALE stab implicit: 0.5 rho div u w v
-            mass_divw( 0.5*M_oseenData->density(),
-                       M_uLoc,
-                       M_elementMatrixStiff,
-                       M_velocityFESpace.fe(), 0, 0, numVelocityComponent );
-
-            // Stabilising term: div u^n u v
-            if ( M_divBetaUv )
-                mass_divw( 0.5*M_oseenData->density(),
-                           M_elementRightHandSide,
-                           M_elementMatrixStiff,
-                           M_velocityFESpace.fe(), 0, 0, numVelocityComponent );
-
-            // compute local convective terms
-            advection( M_oseenData->density(),
-                       M_elementRightHandSide,
-                       M_elementMatrixStiff,
-                       M_velocityFESpace.fe(), 0, 0, numVelocityComponent );
-
-            // loop on components
-            for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+            for ( UInt iElement = 0; iElement < interfaceElements.size(); ++iElement )
             {
-                // compute local convective term and assembling
-                // grad( 0, M_elementRightHandSide, M_elementMatrixStiff, M_velocityFESpace.fe(),
-                //       M_velocityFESpace.fe(), iComponent, iComponent );
-                // grad( 1, M_elementRightHandSide, M_elementMatrixStiff, M_velocityFESpace.fe(),
-                //       M_velocityFESpace.fe(), iComponent, iComponent );
-                // grad( 2, M_elementRightHandSide, M_elementMatrixStiff, M_velocityFESpace.fe(),
-                //       M_velocityFESpace.fe(), iComponent, iComponent );
-
-                assembleMatrix( *matrixNoBC,
-                                M_elementMatrixStiff,
-                                M_velocityFESpace.fe(),
-                                M_velocityFESpace.fe(),
-                                M_velocityFESpace.dof(),
-                                M_velocityFESpace.dof(),
-                                iComponent, iComponent,
-                                iComponent*velocityTotalDof, iComponent*velocityTotalDof );
+                assembleConvectiveElement( interfaceElements[iElement], betaVectorRepeated, unRepeated, *matrixNoBC );
+            }
+        }
+        else
+        {
+            for ( UInt iElement = 0; iElement < M_velocityFESpace.mesh()->numElements(); ++iElement )
+            {
+                assembleConvectiveElement( iElement, betaVectorRepeated, unRepeated, *matrixNoBC );
             }
         }
 
@@ -1415,7 +1508,15 @@ updateSystem( const Real         alpha,
         {
             M_Displayer.leaderPrint( "  F-  Updating the stabilization terms ...     " );
             chrono.start();
-            M_matrixStabilization.reset ( new matrix_Type( M_localMap ) );
+            // The pattern of the extended stencil is kept, only the values are computed again
+            if ( M_matrixStabilization.get() == 0 )
+            {
+                M_matrixStabilization.reset ( new matrix_Type( M_localMap ) );
+            }
+            else
+            {
+                M_matrixStabilization->zero();
+            }
             M_ipStabilization.apply( *M_matrixStabilization, betaVectorRepeated, false );
             M_matrixStabilization->globalAssemble();
             M_resetStabilization = false;
@@ -1433,7 +1534,14 @@ updateSystem( const Real         alpha,
 
             if ( M_resetStabilization || !M_reuseStabilization || ( M_matrixStabilization.get() == 0 ) )
             {
-                M_matrixStabilization.reset( new matrix_Type( M_localMap ) );
+                if ( M_matrixStabilization.get() == 0 )
+                {
+                    M_matrixStabilization.reset( new matrix_Type( M_localMap ) );
+                }
+                else
+                {
+                    M_matrixStabilization->zero();
+                }
                 M_ipStabilization.apply( *M_matrixStabilization, betaVector, false );
                 M_matrixStabilization->globalAssemble();
                 M_resetStabilization = false;
@@ -1461,6 +1569,9 @@ updateSystem( const Real         alpha,
         }
     }
     *matrixNoBC += *M_matrixStokes;
+
+    if ( M_saddlePointPreconditioner && M_saddlePointPreconditioner->schurApproximation() == PreconditionerSaddlePoint::PCD )
+        updatePressureConvectionDiffusion( alpha, betaVector );
 }
 
 
@@ -1742,6 +1853,581 @@ OseenSolver<MeshType, SolverType>::removeMean( vector_Type& x )
 
 } // removeMean()
 
+template<typename MeshType, typename SolverType>
+void
+OseenSolver<MeshType, SolverType>::assembleConstantMatricesBatched()
+{
+    const UInt numVelocityComponent( M_velocityFESpace.fieldDim() );
+    const UInt velocityTotalDof( M_velocityFESpace.dof().numTotalDof() );
+    const UInt velocityNbDof( M_velocityFESpace.fe().nbFEDof() );
+    const UInt pressureNbDof( M_pressureFESpace.fe().nbFEDof() );
+    const UInt numElements( M_velocityFESpace.mesh()->numElements() );
+    const UInt batchSize( CurrentFEBatch::S_batchSize );
+
+    // The pressure basis functions are evaluated in the quadrature nodes of the velocity, as in grad
+    CurrentFEBatch velocityBatch( M_velocityFESpace.refFE(), M_velocityFESpace.fe().geoMap(), M_velocityFESpace.qr() );
+    CurrentFEBatch pressureBatch( M_pressureFESpace.refFE(), M_pressureFESpace.fe().geoMap(), M_velocityFESpace.qr() );
+
+    std::vector<MatrixElemental> elementMatrixStiff     ( batchSize, M_elementMatrixStiff );
+    std::vector<MatrixElemental> elementMatrixMass      ( batchSize, M_elementMatrixMass );
+    std::vector<MatrixElemental> elementMatrixGradient  ( batchSize, M_elementMatrixGradient );
+    std::vector<MatrixElemental> elementMatrixDivergence( batchSize, M_elementMatrixDivergence );
+
+    for ( UInt firstElement = 0; firstElement < numElements; firstElement += batchSize )
+    {
+        velocityBatch.update( *M_velocityFESpace.mesh(), firstElement, UPDATE_DPHI | UPDATE_WDET );
+        pressureBatch.update( *M_velocityFESpace.mesh(), firstElement, UPDATE_PHI );
+
+        for ( UInt lane = 0; lane < velocityBatch.size(); lane++ )
+        {
+            elementMatrixStiff[ lane ].zero();
+            elementMatrixMass[ lane ].zero();
+            elementMatrixGradient[ lane ].zero();
+            elementMatrixDivergence[ lane ].zero();
+        }
+
+        // stiffness matrix
+        if ( M_stiffStrain )
+            AssemblyElemental::stiffStrain( elementMatrixStiff, velocityBatch, 2.0*M_oseenData->viscosity() );
+        else
+            AssemblyElemental::stiffness( elementMatrixStiff, velocityBatch, M_oseenData->viscosity(), numVelocityComponent );
+
+        // mass matrix
+        if ( !M_steady )
+            AssemblyElemental::mass( elementMatrixMass, velocityBatch, M_oseenData->density(), numVelocityComponent );
+
+        // gradient and divergence, the divergence is minus the transposed of the gradient
+        AssemblyElemental::grad( elementMatrixGradient, velocityBatch, pressureBatch, 1.0 );
+        AssemblyElemental::divergence( elementMatrixDivergence, velocityBatch, pressureBatch, -1.0 );
+
+        for ( UInt lane = 0; lane < velocityBatch.size(); lane++ )
+        {
+            const UInt elementID( velocityBatch.localId( lane ) );
+
+            for ( UInt iComponent = 0; iComponent < numVelocityComponent; iComponent++ )
+            {
+                // stiffness matrix
+                if ( M_isDiagonalBlockPreconditioner == true )
+                {
+                    assembleMatrix( *M_blockPreconditioner,
+                                    elementID,
+                                    elementMatrixStiff[ lane ],
+                                    velocityNbDof,
+                                    M_velocityFESpace.dof(),
+                                    iComponent, iComponent,
+                                    iComponent * velocityTotalDof, iComponent * velocityTotalDof );
+                }
+                else
+                {
+                    // sigma = 0.5 * mu (grad( u ) + grad ( u )^T) has also extra diagonal blocks
+                    const UInt firstComponent( M_stiffStrain ? 0 : iComponent );
+                    const UInt lastComponent ( M_stiffStrain ? numVelocityComponent : iComponent + 1 );
+
+                    for ( UInt jComp = firstComponent; jComp < lastComponent; jComp++ )
+                    {
+                        assembleMatrix( *M_matrixStokes,
+                                        elementID,
+                                        elementMatrixStiff[ lane ],
+                                        velocityNbDof,
+                                        M_velocityFESpace.dof(),
+                                        iComponent, jComp,
+                                        iComponent * velocityTotalDof, jComp * velocityTotalDof );
+                    }
+                }
+
+                // mass matrix
+                if ( !M_steady )
+                {
+                    assembleMatrix( *M_velocityMatrixMass,
+                                    elementID,
+                                    elementMatrixMass[ lane ],
+                                    velocityNbDof,
+                                    M_velocityFESpace.dof(),
+                                    iComponent, iComponent,
+                                    iComponent * velocityTotalDof, iComponent * velocityTotalDof );
+                }
+
+                // gradient
+                MatrixElemental::matrix_view gradientView = elementMatrixGradient[ lane ].block( iComponent, 0 );
+                assembleMatrix( *M_matrixStokes,
+                                elementID, elementID,
+                                gradientView,
+                                velocityNbDof, pressureNbDof,
+                                M_velocityFESpace.dof(),
+                                M_pressureFESpace.dof(),
+                                iComponent * velocityTotalDof, numVelocityComponent * velocityTotalDof );
+
+                // divergence
+                MatrixElemental::matrix_view divergenceView = elementMatrixDivergence[ lane ].block( 0, iComponent );
+                assembleMatrix( *M_matrixStokes,
+                                elementID, elementID,
+                                divergenceView,
+                                pressureNbDof, velocityNbDof,
+                                M_pressureFESpace.dof(),
+                                M_velocityFESpace.dof(),
+                                numVelocityComponent * velocityTotalDof, iComponent * velocityTotalDof );
+            }
+        }
+    }
+} // assembleConstantMatricesBatched()
+
+template<typename MeshType, typename SolverType>
+void
+OseenSolver<MeshType, SolverType>::setupElementColoring()
+{
+    if ( M_elementColoring.isComputed() )
+        return;
+
+    M_elementColoring.clear();
+    M_elementColoring.addDOF( M_velocityFESpace.dof() );
+    M_elementColoring.addDOF( M_pressureFESpace.dof() );
+    M_elementColoring.compute();
+}
+
+template<typename MeshType, typename SolverType>
+UInt
+OseenSolver<MeshType, SolverType>::numAssemblyThreads() const
+{
+#ifdef HAVE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+template<typename MeshType, typename SolverType>
+void
+OseenSolver<MeshType, SolverType>::assembleConstantMatricesThreaded()
+{
+    const UInt numVelocityComponent( M_velocityFESpace.fieldDim() );
+    const UInt velocityTotalDof( M_velocityFESpace.dof().numTotalDof() );
+    const UInt velocityNbDof( M_velocityFESpace.fe().nbFEDof() );
+    const UInt pressureNbDof( M_pressureFESpace.fe().nbFEDof() );
+    const UInt numThreads( numAssemblyThreads() );
+
+    setupElementColoring();
+
+    // Each thread has its own current FEs and local matrices
+    std::vector< boost::shared_ptr<CurrentFE> > velocityFE( numThreads );
+    std::vector< boost::shared_ptr<CurrentFE> > pressureFE( numThreads );
+
+    for ( UInt iThread = 0; iThread < numThreads; iThread++ )
+    {
+        velocityFE[ iThread ].reset( new CurrentFE( M_velocityFESpace.refFE(), M_velocityFESpace.fe().geoMap(), M_velocityFESpace.qr() ) );
+        pressureFE[ iThread ].reset( new CurrentFE( M_pressureFESpace.refFE(), M_pressureFESpace.fe().geoMap(), M_pressureFESpace.qr() ) );
+    }
+
+    std::vector<MatrixElemental> elementMatrixStiff     ( numThreads, M_elementMatrixStiff );
+    std::vector<MatrixElemental> elementMatrixMass      ( numThreads, M_elementMatrixMass );
+    std::vector<MatrixElemental> elementMatrixGradient  ( numThreads, M_elementMatrixGradient );
+    std::vector<MatrixElemental> elementMatrixDivergence( numThreads, M_elementMatrixDivergence );
+
+    // The rows of the elements of one color are disjoint: the threads add their values
+    // to row buffers at the same time, the buffers are then copied in the matrices.
+    // The rows are preallocated with the number of entries of one element
+    const UInt numEntriesPerRow( numVelocityComponent * velocityNbDof + pressureNbDof );
+    MatrixEpetraRowAccumulator stokesAccumulator( M_localMap, numEntriesPerRow );
+    MatrixEpetraRowAccumulator massAccumulator( M_localMap, velocityNbDof );
+    MatrixEpetraRowAccumulator preconditionerAccumulator( M_localMap, M_isDiagonalBlockPreconditioner ? velocityNbDof : 0 );
+
+    MatrixEpetraRowAccumulator& stiffAccumulator( M_isDiagonalBlockPreconditioner ? preconditionerAccumulator : stokesAccumulator );
+
+    for ( UInt iColor = 0; iColor < M_elementColoring.numColors(); iColor++ )
+    {
+        const ElementColoring::elementList_Type& elements( M_elementColoring.elements( iColor ) );
+        const Int numColorElements( elements.size() );
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule( static )
+#endif
+        for ( Int iElement = 0; iElement < numColorElements; iElement++ )
+        {
+#ifdef HAVE_OPENMP
+            const UInt thread( omp_get_thread_num() );
+#else
+            const UInt thread( 0 );
+#endif
+            CurrentFE& velocityCFE( *velocityFE[ thread ] );
+            CurrentFE& pressureCFE( *pressureFE[ thread ] );
+
+            pressureCFE.update( M_velocityFESpace.mesh()->element( elements[ iElement ] ) );
+            velocityCFE.updateFirstDeriv( M_velocityFESpace.mesh()->element( elements[ iElement ] ) );
+
+            const UInt elementID( velocityCFE.currentLocalId() );
+
+            elementMatrixStiff[ thread ].zero();
+            elementMatrixMass[ thread ].zero();
+            elementMatrixGradient[ thread ].zero();
+            elementMatrixDivergence[ thread ].zero();
+
+            // stiffness matrix
+            if ( M_stiffStrain )
+                stiff_strain( 2.0*M_oseenData->viscosity(), elementMatrixStiff[ thread ], velocityCFE );
+            else
+                stiff( M_oseenData->viscosity(), elementMatrixStiff[ thread ], velocityCFE, 0, 0, numVelocityComponent );
+
+            // mass matrix
+            if ( !M_steady )
+                mass( M_oseenData->density(), elementMatrixMass[ thread ], velocityCFE, 0, 0, numVelocityComponent );
+
+            for ( UInt iComponent = 0; iComponent < numVelocityComponent; iComponent++ )
+            {
+                // gradient, the divergence is minus its transposed
+                grad( iComponent, 1.0, elementMatrixGradient[ thread ], velocityCFE, pressureCFE, iComponent, 0 );
+
+                MatrixElemental::matrix_view gradientView = elementMatrixGradient[ thread ].block( iComponent, 0 );
+                MatrixElemental::matrix_view divergenceView = elementMatrixDivergence[ thread ].block( 0, iComponent );
+
+                for ( UInt iPressure = 0; iPressure < pressureNbDof; iPressure++ )
+                    for ( UInt jVelocity = 0; jVelocity < velocityNbDof; jVelocity++ )
+                        divergenceView( iPressure, jVelocity ) = - gradientView( jVelocity, iPressure );
+
+                // stiffness matrix, sigma = 0.5 * mu (grad( u ) + grad ( u )^T) has also extra diagonal blocks
+                const UInt firstComponent( M_stiffStrain && !M_isDiagonalBlockPreconditioner ? 0 : iComponent );
+                const UInt lastComponent ( M_stiffStrain && !M_isDiagonalBlockPreconditioner ? numVelocityComponent : iComponent + 1 );
+
+                for ( UInt jComp = firstComponent; jComp < lastComponent; jComp++ )
+                {
+                    assembleMatrix( stiffAccumulator,
+                                    elementID,
+                                    elementMatrixStiff[ thread ],
+                                    velocityNbDof,
+                                    M_velocityFESpace.dof(),
+                                    iComponent, jComp,
+                                    iComponent * velocityTotalDof, jComp * velocityTotalDof );
+                }
+
+                // mass matrix
+                if ( !M_steady )
+                {
+                    assembleMatrix( massAccumulator,
+                                    elementID,
+                                    elementMatrixMass[ thread ],
+                                    velocityNbDof,
+                                    M_velocityFESpace.dof(),
+                                    iComponent, iComponent,
+                                    iComponent * velocityTotalDof, iComponent * velocityTotalDof );
+                }
+
+                // gradient
+                assembleMatrix( stokesAccumulator,
+                                elementID, elementID,
+                                gradientView,
+                                velocityNbDof, pressureNbDof,
+                                M_velocityFESpace.dof(),
+                                M_pressureFESpace.dof(),
+                                iComponent * velocityTotalDof, numVelocityComponent * velocityTotalDof );
+
+                // divergence
+                assembleMatrix( stokesAccumulator,
+                                elementID, elementID,
+                                divergenceView,
+                                pressureNbDof, velocityNbDof,
+                                M_pressureFESpace.dof(),
+                                M_velocityFESpace.dof(),
+                                numVelocityComponent * velocityTotalDof, iComponent * velocityTotalDof );
+            }
+        }
+    }
+
+    stokesAccumulator.addTo( *M_matrixStokes );
+    massAccumulator.addTo( *M_velocityMatrixMass );
+    if ( M_isDiagonalBlockPreconditioner == true )
+        preconditionerAccumulator.addTo( *M_blockPreconditioner );
+} // assembleConstantMatricesThreaded()
+
+template<typename MeshType, typename SolverType>
+void
+OseenSolver<MeshType, SolverType>::assembleConvectiveMatrixThreaded( const vector_Type& betaVectorRepeated,
+                                                                     const vector_Type& unRepeated,
+                                                                     matrix_Type&       matrixNoBC )
+{
+    const UInt numVelocityComponent( M_velocityFESpace.fieldDim() );
+    const UInt velocityTotalDof( M_velocityFESpace.dof().numTotalDof() );
+    const UInt velocityNbDof( M_velocityFESpace.fe().nbFEDof() );
+    const UInt numThreads( numAssemblyThreads() );
+
+    setupElementColoring();
+
+    // Each thread has its own current FE, local matrix and local vectors
+    std::vector< boost::shared_ptr<CurrentFE> > velocityFE( numThreads );
+
+    for ( UInt iThread = 0; iThread < numThreads; iThread++ )
+        velocityFE[ iThread ].reset( new CurrentFE( M_velocityFESpace.refFE(), M_velocityFESpace.fe().geoMap(), M_velocityFESpace.qr() ) );
+
+    std::vector<MatrixElemental> elementMatrixStiff( numThreads, M_elementMatrixStiff );
+    std::vector<VectorElemental> betaLoc( numThreads, M_elementRightHandSide );
+    std::vector<VectorElemental> uLoc( numThreads, M_uLoc );
+    std::vector<VectorElemental> wLoc( numThreads, M_wLoc );
+
+    // The buffers keep their memory after addTo: only the first assembly allocates the rows
+    if ( !M_convectiveAccumulator )
+        M_convectiveAccumulator.reset( new MatrixEpetraRowAccumulator( M_localMap, velocityNbDof ) );
+    MatrixEpetraRowAccumulator& convectiveAccumulator( *M_convectiveAccumulator );
+
+    for ( UInt iColor = 0; iColor < M_elementColoring.numColors(); iColor++ )
+    {
+        const ElementColoring::elementList_Type& elements( M_elementColoring.elements( iColor ) );
+        const Int numColorElements( elements.size() );
+
+#ifdef HAVE_OPENMP
+#pragma omp parallel for schedule( static )
+#endif
+        for ( Int iElement = 0; iElement < numColorElements; iElement++ )
+        {
+#ifdef HAVE_OPENMP
+            const UInt thread( omp_get_thread_num() );
+#else
+            const UInt thread( 0 );
+#endif
+            CurrentFE& velocityCFE( *velocityFE[ thread ] );
+
+            velocityCFE.updateFirstDeriv( M_velocityFESpace.mesh()->element( elements[ iElement ] ) );
+
+            elementMatrixStiff[ thread ].zero();
+
+            const UInt elementID( velocityCFE.currentLocalId() );
+
+            // Non linear term, Semi-implicit approach, as in updateSystem
+            for ( UInt iNode = 0 ; iNode < velocityNbDof ; iNode++ )
+            {
+                UInt iLocal = velocityCFE.patternFirst( iNode );
+                for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+                {
+                    UInt iGlobal = M_velocityFESpace.dof().localToGlobalMap( elementID, iLocal )
+                                   + iComponent * dimVelocity();
+
+                    betaLoc[ thread ].vec() [ iLocal + iComponent * velocityNbDof ] = betaVectorRepeated[iGlobal];
+                    uLoc[ thread ].vec() [ iLocal + iComponent * velocityNbDof ] = unRepeated(iGlobal);
+                    wLoc[ thread ].vec() [ iLocal + iComponent * velocityNbDof ] = unRepeated(iGlobal) - betaVectorRepeated(iGlobal);
+                }
+            }
+
+            // ALE term: - rho div w u v
+            mass_divw( - M_oseenData->density(), wLoc[ thread ], elementMatrixStiff[ thread ], velocityCFE, 0, 0, numVelocityComponent );
+
+            // ALE stab implicit: 0.5 rho div u w v
+            mass_divw( 0.5*M_oseenData->density(), uLoc[ thread ], elementMatrixStiff[ thread ], velocityCFE, 0, 0, numVelocityComponent );
+
+            // Stabilising term: div u^n u v
+            if ( M_divBetaUv )
+                mass_divw( 0.5*M_oseenData->density(), betaLoc[ thread ], elementMatrixStiff[ thread ], velocityCFE, 0, 0, numVelocityComponent );
+
+            // compute local convective terms
+            advection( M_oseenData->density(), betaLoc[ thread ], elementMatrixStiff[ thread ], velocityCFE, 0, 0, numVelocityComponent );
+
+            for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+            {
+                assembleMatrix( convectiveAccumulator,
+                                elementID,
+                                elementMatrixStiff[ thread ],
+                                velocityNbDof,
+                                M_velocityFESpace.dof(),
+                                iComponent, iComponent,
+                                iComponent*velocityTotalDof, iComponent*velocityTotalDof );
+            }
+        }
+    }
+
+    convectiveAccumulator.addTo( matrixNoBC );
+} // assembleConvectiveMatrixThreaded()
+
+template<typename MeshType, typename SolverType>
+void
+OseenSolver<MeshType, SolverType>::assembleConvectiveElement( const UInt&        iElement,
+                                                              const vector_Type& betaVectorRepeated,
+                                                              const vector_Type& unRepeated,
+                                                              matrix_Type&       matrixNoBC )
+{
+    const UInt velocityTotalDof( M_velocityFESpace.dof().numTotalDof() );
+    const UInt numVelocityComponent( M_velocityFESpace.fieldDim() );
+
+    // just to provide the id number in the assem_mat_mixed
+    M_pressureFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
+    //as updateFirstDer
+    M_velocityFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
+
+    M_elementMatrixStiff.zero();
+
+    UInt elementID = M_velocityFESpace.fe().currentLocalId();
+    // Non linear term, Semi-implicit approach
+    // M_elementRightHandSide contains the velocity values in the nodes
+    for ( UInt iNode = 0 ; iNode < M_velocityFESpace.fe().nbFEDof() ; iNode++ )
+    {
+        UInt iLocal = M_velocityFESpace.fe().patternFirst( iNode );
+        for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+        {
+            UInt iGlobal = M_velocityFESpace.dof().localToGlobalMap( elementID, iLocal )
+                           + iComponent * dimVelocity();
+            M_elementRightHandSide.vec() [ iLocal + iComponent * M_velocityFESpace.fe().nbFEDof() ]
+            = betaVectorRepeated[iGlobal];
+
+            M_uLoc.vec() [ iLocal + iComponent * M_velocityFESpace.fe().nbFEDof() ]
+            = unRepeated(iGlobal);
+            M_wLoc.vec() [ iLocal + iComponent * M_velocityFESpace.fe().nbFEDof() ]
+            = unRepeated(iGlobal) - betaVectorRepeated(iGlobal);
+        }
+    }
+
+
+    // ALE term: - rho div w u v
+    mass_divw( - M_oseenData->density(),
+               M_wLoc,
+               M_elementMatrixStiff,
+               M_velocityFESpace.fe(), 0, 0, numVelocityComponent );
+
+    // ALE stab implicit: 0.5 rho div u w v
+    mass_divw( 0.5*M_oseenData->density(),
+               M_uLoc,
+               M_elementMatrixStiff,
+               M_velocityFESpace.fe(), 0, 0, numVelocityComponent );
+
+    // Stabilising term: div u^n u v
+    if ( M_divBetaUv )
+        mass_divw( 0.5*M_oseenData->density(),
+                   M_elementRightHandSide,
+                   M_elementMatrixStiff,
+                   M_velocityFESpace.fe(), 0, 0, numVelocityComponent );
+
+    // compute local convective terms
+    advection( M_oseenData->density(),
+               M_elementRightHandSide,
+               M_elementMatrixStiff,
+               M_velocityFESpace.fe(), 0, 0, numVelocityComponent );
+
+    // loop on components
+    for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+    {
+        // compute local convective term and assembling
+        // grad( 0, M_elementRightHandSide, M_elementMatrixStiff, M_velocityFESpace.fe(),
+        //       M_velocityFESpace.fe(), iComponent, iComponent );
+        // grad( 1, M_elementRightHandSide, M_elementMatrixStiff, M_velocityFESpace.fe(),
+        //       M_velocityFESpace.fe(), iComponent, iComponent );
+        // grad( 2, M_elementRightHandSide, M_elementMatrixStiff, M_velocityFESpace.fe(),
+        //       M_velocityFESpace.fe(), iComponent, iComponent );
+
+        assembleMatrix( matrixNoBC,
+                        M_elementMatrixStiff,
+                        M_velocityFESpace.fe(),
+                        M_velocityFESpace.fe(),
+                        M_velocityFESpace.dof(),
+                        M_velocityFESpace.dof(),
+                        iComponent, iComponent,
+                        iComponent*velocityTotalDof, iComponent*velocityTotalDof );
+    }
+} // assembleConvectiveElement()
+
+template<typename MeshType, typename SolverType>
+void
+OseenSolver<MeshType, SolverType>::assemblePressureMatricesPCD()
+{
+    M_pressureMassPCD.reset( new matrix_Type( M_pressureFESpace.map() ) );
+    M_pressureLaplacianPCD.reset( new matrix_Type( M_pressureFESpace.map() ) );
+
+    MatrixElemental elementMatrixMass( M_pressureFESpace.fe().nbFEDof(), 1, 1 );
+    MatrixElemental elementMatrixStiff( M_pressureFESpace.fe().nbFEDof(), 1, 1 );
+
+    for ( UInt iElement = 0; iElement < M_pressureFESpace.mesh()->numElements(); ++iElement )
+    {
+        M_pressureFESpace.fe().updateFirstDeriv( M_pressureFESpace.mesh()->element( iElement ) );
+
+        elementMatrixMass.zero();
+        elementMatrixStiff.zero();
+        mass( 1., elementMatrixMass, M_pressureFESpace.fe(), 0, 0 );
+        stiff( 1., elementMatrixStiff, M_pressureFESpace.fe(), 0, 0 );
+
+        assembleMatrix( *M_pressureMassPCD, elementMatrixMass,
+                        M_pressureFESpace.fe(), M_pressureFESpace.fe(),
+                        M_pressureFESpace.dof(), M_pressureFESpace.dof(),
+                        0, 0, 0, 0 );
+        assembleMatrix( *M_pressureLaplacianPCD, elementMatrixStiff,
+                        M_pressureFESpace.fe(), M_pressureFESpace.fe(),
+                        M_pressureFESpace.dof(), M_pressureFESpace.dof(),
+                        0, 0, 0, 0 );
+    }
+
+    M_pressureMassPCD->globalAssemble();
+    M_pressureLaplacianPCD->globalAssemble();
+
+    M_saddlePointPreconditioner->setPressureMatrices( M_pressureMassPCD, M_pressureLaplacianPCD );
+} // assemblePressureMatricesPCD()
+
+template<typename MeshType, typename SolverType>
+void
+OseenSolver<MeshType, SolverType>::updatePressureConvectionDiffusion( const Real& alpha, const vector_Type& betaVector )
+{
+    if ( !M_pressureMassPCD || M_recomputeMatrix )
+        assemblePressureMatricesPCD();
+
+    const UInt numVelocityComponent( M_velocityFESpace.fieldDim() );
+    const UInt velocityNbDof( M_velocityFESpace.fe().nbFEDof() );
+    const UInt pressureNbDof( M_pressureFESpace.fe().nbFEDof() );
+
+    // The advection field is evaluated at the quadrature nodes of the pressure space,
+    // which are not the ones of the velocity space for e.g. P2-P1 or P1Bubble-P1
+    CurrentFE velocityFE( M_velocityFESpace.refFE(), M_velocityFESpace.fe().geoMap(), M_pressureFESpace.qr() );
+
+    // F_p = rho beta . grad + rho alpha + nu Laplacian, on the pressure space
+    matrixPtr_Type convection( new matrix_Type( M_pressureFESpace.map() ) );
+
+    Real normInf;
+    betaVector.normInf( &normInf );
+
+    if ( normInf != 0. )
+    {
+        vector_Type betaVectorRepeated( betaVector, Repeated );
+
+        MatrixElemental elementMatrix( pressureNbDof, 1, 1 );
+        std::vector<Real> betaQuadPoint( numVelocityComponent );
+
+        for ( UInt iElement = 0; iElement < M_velocityFESpace.mesh()->numElements(); ++iElement )
+        {
+            M_pressureFESpace.fe().updateFirstDeriv( M_velocityFESpace.mesh()->element( iElement ) );
+            velocityFE.update( M_velocityFESpace.mesh()->element( iElement ), UPDATE_PHI );
+
+            const UInt elementID( velocityFE.currentLocalId() );
+            elementMatrix.zero();
+            MatrixElemental::matrix_view matrixView = elementMatrix.block( 0, 0 );
+
+            for ( UInt iQuadPt = 0; iQuadPt < M_pressureFESpace.fe().nbQuadPt(); ++iQuadPt )
+            {
+                // Advection field at the quadrature node, from the velocity basis functions
+                for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+                {
+                    betaQuadPoint[iComponent] = 0.;
+                    for ( UInt iNode = 0; iNode < velocityNbDof; ++iNode )
+                        betaQuadPoint[iComponent] += velocityFE.phi( iNode, iQuadPt )
+                                                     * betaVectorRepeated[ M_velocityFESpace.dof().localToGlobalMap( elementID, iNode )
+                                                                           + iComponent * dimVelocity() ];
+                }
+
+                for ( UInt i = 0; i < pressureNbDof; ++i )
+                    for ( UInt j = 0; j < pressureNbDof; ++j )
+                    {
+                        Real advection( 0. );
+                        for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+                            advection += betaQuadPoint[iComponent] * M_pressureFESpace.fe().dphi( j, iComponent, iQuadPt );
+
+                        matrixView( i, j ) += M_oseenData->density() * advection * M_pressureFESpace.fe().phi( i, iQuadPt )
+                                              * M_pressureFESpace.fe().wDetJacobian( iQuadPt );
+                    }
+            }
+
+            assembleMatrix( *convection, elementMatrix,
+                            M_pressureFESpace.fe(), M_pressureFESpace.fe(),
+                            M_pressureFESpace.dof(), M_pressureFESpace.dof(),
+                            0, 0, 0, 0 );
+        }
+    }
+
+    *convection += *M_pressureMassPCD * ( alpha * M_oseenData->density() );
+    *convection += *M_pressureLaplacianPCD * M_oseenData->viscosity();
+    convection->globalAssemble();
+
+    M_pressureConvectionDiffusionPCD = convection;
+    M_saddlePointPreconditioner->setPressureConvectionDiffusion( M_pressureConvectionDiffusionPCD );
+} // updatePressureConvectionDiffusion()
+
 template<typename MeshType, typename SolverType>
 void
 OseenSolver<MeshType, SolverType>::applyBoundaryConditions( matrix_Type&       matrix,
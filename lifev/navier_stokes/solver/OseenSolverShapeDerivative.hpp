@@ -207,6 +207,34 @@ public:
                                  bool                           wImplicit = true,
                                  bool                           convectiveTermDerivative = false);
 
+    //! Apply the shape derivatives to a direction, without assembling their matrix.
+    /*!
+        The element matrices of updateShapeDerivatives are computed on the fly and multiplied
+        by the restriction of the direction to each element: the result is the product of
+        the matrix assembled by updateShapeDerivatives with the direction.
+        un, uk and w are imported on their repeated map at each call, unless they already are repeated.
+        @param direction direction, on the map of the matrix of updateShapeDerivatives
+        @param product output, on the same map as direction
+        @param alpha alpha
+        @param un Beta
+        @param uk Fluid solution
+        @param w mesh_Type Velocity
+        @param offset
+        @param dFESpace
+        @param wImplicit
+        @param convectiveTermDerivative
+     */
+    void applyShapeDerivatives( const vector_Type&             direction,
+                                vector_Type&                   product,
+                                Real&                          alpha,
+                                const vector_Type&             un,
+                                const vector_Type&             uk,
+                                const vector_Type&             w,
+                                UInt                           offset,
+                                FESpace<mesh_Type, MapEpetra>& dFESpace,
+                                bool                           wImplicit = true,
+                                bool                           convectiveTermDerivative = false);
+
     //@}
 
 
@@ -294,6 +322,31 @@ private:
     //! Empty copy constructor
     OseenSolverShapeDerivative( const OseenSolverShapeDerivative& oseenShapeDerivative );
 
+    //! Loop on the elements computing the shape derivatives
+    /*!
+        The element matrices are either assembled in the matrix (if not null)
+        or multiplied by the repeated direction and summed in the product.
+     */
+    void shapeDerivativesLoop( matrix_Type*                   matrix,
+                               const vector_Type*             directionRepeated,
+                               vector_Type*                   product,
+                               Real&                          alpha,
+                               const vector_Type&             un,
+                               const vector_Type&             uk,
+                               const vector_Type&             w,
+                               UInt                           offset,
+                               FESpace<mesh_Type, MapEpetra>& mmFESpace,
+                               bool                           wImplicit,
+                               bool                           convectiveTermDerivative );
+
+    //! Return the vector if it is repeated, otherwise its repeated copy
+    /*!
+        @param vector the vector
+        @param copy output, the repeated copy if needed
+        @return a vector with the repeated map
+     */
+    static const vector_Type& repeatedVector( const vector_Type& vector, boost::shared_ptr<vector_Type>& copy );
+
     //@}
 
     vector_Type               M_linearRightHandSideNoBC;
@@ -730,7 +783,6 @@ OseenSolverShapeDerivative<MeshType, SolverType>::updateLinearSystem( const matr
 }
 
 
-//#if UNDEF
 template<typename MeshType, typename SolverType>
 void
 OseenSolverShapeDerivative<MeshType, SolverType>::
@@ -747,8 +799,6 @@ updateShapeDerivatives( matrix_Type&                   matrix,
 {
     LifeChrono chrono;
 
-    UInt numVelocityComponent = nDimensions;
-
     //    M_linearRightHandSideNoBC = sourceVector;//which is usually zero
 
     if ( this->M_oseenData->useShapeDerivatives() )
@@ -760,169 +810,228 @@ updateShapeDerivatives( matrix_Type&                   matrix,
         //
         chrono.start();
 
-        // Loop on elements
+        shapeDerivativesLoop( &matrix, 0, 0, alpha, un, uk, w, offset, mmFESpace, wImplicit, convectiveTermDerivative );
+    }
 
-        vector_Type unRepeated  ( un  , Repeated );
-        vector_Type ukRepeated  ( uk  , Repeated );
-        // vector_Type dispRepeated( disp, Repeated );
-        vector_Type wRepeated   ( w   , Repeated );
-        // vector_Type dwRepeated  ( dw  , Repeated );
+    chrono.stop();
+    this->M_Displayer.leaderPrintMax("done in ", chrono.diff() );
+}
 
-//     std::cout << wRepeated.NormInf() << std::endl;
-//     std::cout << dwRepeated.NormInf() << std::endl;
-//     std::cout << dispRepeated.NormInf() << std::endl;
+template<typename MeshType, typename SolverType>
+void
+OseenSolverShapeDerivative<MeshType, SolverType>::
+applyShapeDerivatives( const vector_Type&             direction,
+                       vector_Type&                   product,
+                       Real&                          alpha,
+                       const vector_Type&             un,
+                       const vector_Type&             uk,
+                       const vector_Type&             w,
+                       UInt                           offset,
+                       FESpace<mesh_Type, MapEpetra>& mmFESpace,
+                       bool                           wImplicit,
+                       bool                           convectiveTermDerivative )
+{
+    product *= 0.;
 
-//            vector_Type rhsLinNoBC( M_linearRightHandSideNoBC.map(), Repeated);
+    if ( this->M_oseenData->useShapeDerivatives() )
+    {
+        vector_Type directionRepeated( direction, Repeated );
 
-        for ( UInt i = 0; i < this->M_velocityFESpace.mesh()->numVolumes(); i++ )
-        {
+        shapeDerivativesLoop( 0, &directionRepeated, &product, alpha, un, uk, w, offset, mmFESpace, wImplicit, convectiveTermDerivative );
 
-            this->M_pressureFESpace.fe().update( this->M_pressureFESpace.mesh()->volumeList( i ) );
-            this->M_velocityFESpace.fe().updateFirstDerivQuadPt( this->M_velocityFESpace.mesh()->volumeList( i ) );
-            this->M_pressureFESpace.fe().updateFirstDerivQuadPt( this->M_velocityFESpace.mesh()->volumeList( i ) );
+        product.globalAssemble();
+    }
+}
 
-            // just to provide the id number in the assem_mat_mixed
-            //this->M_pressureFESpace.fe().updateFirstDeriv( this->M_velocityFESpace.mesh()->volumeList( i ) );
-            //as updateFirstDer
-            //this->M_velocityFESpace.fe().updateFirstDeriv( this->M_velocityFESpace.mesh()->volumeList( i ) );
-            mmFESpace.fe().updateFirstDerivQuadPt( mmFESpace.mesh()->volumeList( i ) );
+// ===================================================
+// Private Methods
+// ===================================================
 
-            // initialization of elementary vectors
-            boost::shared_ptr<MatrixElemental> elementMatrixPressure ( new MatrixElemental( this->M_pressureFESpace.fe().nbFEDof(),
-                                                                            1,
-                                                                            0,
-                                                                            mmFESpace.fe().nbFEDof(),
-                                                                            0,
-                                                                            nDimensions ) );
-            boost::shared_ptr<MatrixElemental> elementMatrixVelocity ( new MatrixElemental( this->M_velocityFESpace.fe().nbFEDof(),
-                                                                            nDimensions,
-                                                                            0,
-                                                                            this->M_velocityFESpace.fe().nbFEDof(),
-                                                                            0,
-                                                                            nDimensions ) );
-            boost::shared_ptr<MatrixElemental> elementMatrixConvective;
-
-            if ( convectiveTermDerivative )
-            {
-                elementMatrixConvective.reset( new MatrixElemental( this->M_velocityFESpace.fe().nbFEDof(),
-                                                            nDimensions,
-                                                            0,
-                                                            mmFESpace.fe().nbFEDof(),
-                                                            0,
-                                                            nDimensions ) );
-                elementMatrixConvective->zero();
-            }
+template<typename MeshType, typename SolverType>
+void
+OseenSolverShapeDerivative<MeshType, SolverType>::
+shapeDerivativesLoop( matrix_Type*                   matrix,
+                      const vector_Type*             directionRepeated,
+                      vector_Type*                   product,
+                      Real&                          alpha,
+                      const vector_Type&             un,
+                      const vector_Type&             uk,
+                      const vector_Type&             w,
+                      UInt                           offset,
+                      FESpace<mesh_Type, MapEpetra>& mmFESpace,
+                      bool                           wImplicit,
+                      bool                           convectiveTermDerivative )
+{
+    UInt numVelocityComponent = nDimensions;
 
-            elementMatrixPressure->zero();
-            elementMatrixVelocity->zero();
+    // Loop on elements
 
-            for ( UInt iNode = 0 ; iNode < this->M_velocityFESpace.fe().nbFEDof() ; iNode++ )
-            {
-                UInt iLocal = this->M_velocityFESpace.fe().patternFirst( iNode ); // iLocal = iNode
+    // The vectors given on their repeated map are not copied (see applyShapeDerivatives)
+    boost::shared_ptr<vector_Type> unCopy, ukCopy, wCopy;
+    const vector_Type& unRepeated( repeatedVector( un, unCopy ) );
+    const vector_Type& ukRepeated( repeatedVector( uk, ukCopy ) );
+    // vector_Type dispRepeated( disp, Repeated );
+    const vector_Type& wRepeated ( repeatedVector( w , wCopy  ) );
+    // vector_Type dwRepeated  ( dw  , Repeated );
 
-                for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
-                {
-                    UInt iGlobal = this->M_velocityFESpace.dof().localToGlobalMap( i, iLocal ) + iComponent * this->dimVelocity();
+//     std::cout << wRepeated.NormInf() << std::endl;
+//     std::cout << dwRepeated.NormInf() << std::endl;
+//     std::cout << dispRepeated.NormInf() << std::endl;
 
-                    // if(!wImplicit)
-                    // u^n - w^iNode local
-                    M_elementConvectionVelocity.vec() [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = unRepeated(iGlobal)
-                            - wRepeated( iGlobal );
-                    // else
-                    // u^n - w^iNode local
-                    // M_elementConvectionVelocity.vec() [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = ukRepeated(iGlobal)
-                    // - wRepeated(iGlobal);
-                    // w^iNode local
-                    M_elementMeshVelocity.vec( )  [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = wRepeated( iGlobal );
-                    // u^iNode local
-                    M_elementVelocity.vec( ) [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = ukRepeated( iGlobal );
-                    // dw local
-                    //M_elementDisplacement.vec( ) [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = dispRepeated( iGlobal );
-                    // dw local
-                    //M_elementVelocityRightHandSide.vec( ) [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = dwRepeated( iGlobal );
-                    // un local
-                    M_u_loc.vec()   [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = unRepeated( iGlobal );
-                }
-            }
-            /*
-            std::cout << M_elementConvectionVelocity.vec() << std::endl;
-            std::cout << M_elementMeshVelocity.vec() << std::endl;
-            std::cout << M_elementVelocity.vec() << std::endl;
-            std::cout << M_elementDisplacement.vec() << std::endl;
-            std::cout << M_elementVelocityRightHandSide.vec() << std::endl;
-            std::cout << M_u_loc.vec() << std::endl;
-            */
-            for ( UInt iNode = 0 ; iNode < this->M_pressureFESpace.fe().nbFEDof() ; iNode++ )
-            {
-                // iLocal = iNode
-                UInt iLocal = this->M_pressureFESpace.fe().patternFirst( iNode );
-                UInt iGlobal = this->M_pressureFESpace.dof().localToGlobalMap( i, iLocal ) + numVelocityComponent*this->dimVelocity();
-                // p^iNode local
-                M_elementPressure[ iLocal ] = ukRepeated[ iGlobal ];
-            }
+//            vector_Type rhsLinNoBC( M_linearRightHandSideNoBC.map(), Repeated);
 
+    for ( UInt i = 0; i < this->M_velocityFESpace.mesh()->numVolumes(); i++ )
+    {
 
-            shape_terms( //M_elementDisplacement,
-                this->M_oseenData->density(),
-                this->M_oseenData->viscosity(),
-                M_u_loc,
-                M_elementVelocity,
-                M_elementMeshVelocity,
-                M_elementConvectionVelocity,
-                M_elementPressure,
-                *elementMatrixVelocity,
-                this->M_velocityFESpace.fe(),
-                this->M_pressureFESpace.fe(),
-                (ID) mmFESpace.fe().nbFEDof(),
-                *elementMatrixPressure,
-                0,
-                wImplicit,
-                alpha//,
-                //elementMatrixConvective
-            );
-
-            //elementMatrixVelocity->showMe(std::cout);
+        this->M_pressureFESpace.fe().update( this->M_pressureFESpace.mesh()->volumeList( i ) );
+        this->M_velocityFESpace.fe().updateFirstDerivQuadPt( this->M_velocityFESpace.mesh()->volumeList( i ) );
+        this->M_pressureFESpace.fe().updateFirstDerivQuadPt( this->M_velocityFESpace.mesh()->volumeList( i ) );
+
+        // just to provide the id number in the assem_mat_mixed
+        //this->M_pressureFESpace.fe().updateFirstDeriv( this->M_velocityFESpace.mesh()->volumeList( i ) );
+        //as updateFirstDer
+        //this->M_velocityFESpace.fe().updateFirstDeriv( this->M_velocityFESpace.mesh()->volumeList( i ) );
+        mmFESpace.fe().updateFirstDerivQuadPt( mmFESpace.mesh()->volumeList( i ) );
+
+        // initialization of elementary vectors
+        boost::shared_ptr<MatrixElemental> elementMatrixPressure ( new MatrixElemental( this->M_pressureFESpace.fe().nbFEDof(),
+                                                                        1,
+                                                                        0,
+                                                                        mmFESpace.fe().nbFEDof(),
+                                                                        0,
+                                                                        nDimensions ) );
+        boost::shared_ptr<MatrixElemental> elementMatrixVelocity ( new MatrixElemental( this->M_velocityFESpace.fe().nbFEDof(),
+                                                                        nDimensions,
+                                                                        0,
+                                                                        this->M_velocityFESpace.fe().nbFEDof(),
+                                                                        0,
+                                                                        nDimensions ) );
+        boost::shared_ptr<MatrixElemental> elementMatrixConvective;
+
+        if ( convectiveTermDerivative )
+        {
+            elementMatrixConvective.reset( new MatrixElemental( this->M_velocityFESpace.fe().nbFEDof(),
+                                                        nDimensions,
+                                                        0,
+                                                        mmFESpace.fe().nbFEDof(),
+                                                        0,
+                                                        nDimensions ) );
+            elementMatrixConvective->zero();
+        }
 
-            /*
-            source_mass2( this->M_oseenData->density(),
-                          M_elementVelocity,
-                          *M_elementMatrixConvective,
-                          this->M_velocityFESpace.fe(),
-                          alpha );
-            */
+        elementMatrixPressure->zero();
+        elementMatrixVelocity->zero();
 
-            source_press( 1.0,
-                          M_elementVelocity,
-                          *elementMatrixPressure,
-                          this->M_velocityFESpace.fe(),
-                          this->M_pressureFESpace.fe(),
-                          (ID) mmFESpace.fe().nbFEDof() );
+        for ( UInt iNode = 0 ; iNode < this->M_velocityFESpace.fe().nbFEDof() ; iNode++ )
+        {
+            UInt iLocal = this->M_velocityFESpace.fe().patternFirst( iNode ); // iLocal = iNode
 
-            //derivative of the convective term
-            if ( convectiveTermDerivative )
-                mass_gradu( this->M_oseenData->density(),
-                            M_elementVelocity,
-                            *elementMatrixConvective,
-                            this->M_velocityFESpace.fe() );
-            /*
-              std::cout << "source_press -> norm_inf( M_elementVectorVelocity )"  << std::endl;
-            M_elementVectorPressure.showMe( std::cout );
-            */
-            //
-            // Assembling
-            //
-            /*
-            std::cout << "debut ====================" << std::endl;
-            M_elementVectorPressure.showMe( std::cout );
-            M_elementVectorVelocity.showMe( std::cout );
-            std::cout << "fin   ====================" << std::endl;
-            */
-            UInt const velocityTotalDof ( this->M_velocityFESpace.dof().numTotalDof() );
+            for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+            {
+                UInt iGlobal = this->M_velocityFESpace.dof().localToGlobalMap( i, iLocal ) + iComponent * this->dimVelocity();
+
+                // if(!wImplicit)
+                // u^n - w^iNode local
+                M_elementConvectionVelocity.vec() [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = unRepeated(iGlobal)
+                        - wRepeated( iGlobal );
+                // else
+                // u^n - w^iNode local
+                // M_elementConvectionVelocity.vec() [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = ukRepeated(iGlobal)
+                // - wRepeated(iGlobal);
+                // w^iNode local
+                M_elementMeshVelocity.vec( )  [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = wRepeated( iGlobal );
+                // u^iNode local
+                M_elementVelocity.vec( ) [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = ukRepeated( iGlobal );
+                // dw local
+                //M_elementDisplacement.vec( ) [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = dispRepeated( iGlobal );
+                // dw local
+                //M_elementVelocityRightHandSide.vec( ) [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = dwRepeated( iGlobal );
+                // un local
+                M_u_loc.vec()   [ iLocal + iComponent*this->M_velocityFESpace.fe().nbFEDof() ] = unRepeated( iGlobal );
+            }
+        }
+        /*
+        std::cout << M_elementConvectionVelocity.vec() << std::endl;
+        std::cout << M_elementMeshVelocity.vec() << std::endl;
+        std::cout << M_elementVelocity.vec() << std::endl;
+        std::cout << M_elementDisplacement.vec() << std::endl;
+        std::cout << M_elementVelocityRightHandSide.vec() << std::endl;
+        std::cout << M_u_loc.vec() << std::endl;
+        */
+        for ( UInt iNode = 0 ; iNode < this->M_pressureFESpace.fe().nbFEDof() ; iNode++ )
+        {
+            // iLocal = iNode
+            UInt iLocal = this->M_pressureFESpace.fe().patternFirst( iNode );
+            UInt iGlobal = this->M_pressureFESpace.dof().localToGlobalMap( i, iLocal ) + numVelocityComponent*this->dimVelocity();
+            // p^iNode local
+            M_elementPressure[ iLocal ] = ukRepeated[ iGlobal ];
+        }
+
+
+        shape_terms( //M_elementDisplacement,
+            this->M_oseenData->density(),
+            this->M_oseenData->viscosity(),
+            M_u_loc,
+            M_elementVelocity,
+            M_elementMeshVelocity,
+            M_elementConvectionVelocity,
+            M_elementPressure,
+            *elementMatrixVelocity,
+            this->M_velocityFESpace.fe(),
+            this->M_pressureFESpace.fe(),
+            (ID) mmFESpace.fe().nbFEDof(),
+            *elementMatrixPressure,
+            0,
+            wImplicit,
+            alpha//,
+            //elementMatrixConvective
+        );
+
+        //elementMatrixVelocity->showMe(std::cout);
+
+        /*
+        source_mass2( this->M_oseenData->density(),
+                      M_elementVelocity,
+                      *M_elementMatrixConvective,
+                      this->M_velocityFESpace.fe(),
+                      alpha );
+        */
+
+        source_press( 1.0,
+                      M_elementVelocity,
+                      *elementMatrixPressure,
+                      this->M_velocityFESpace.fe(),
+                      this->M_pressureFESpace.fe(),
+                      (ID) mmFESpace.fe().nbFEDof() );
+
+        //derivative of the convective term
+        if ( convectiveTermDerivative )
+            mass_gradu( this->M_oseenData->density(),
+                        M_elementVelocity,
+                        *elementMatrixConvective,
+                        this->M_velocityFESpace.fe() );
+        /*
+          std::cout << "source_press -> norm_inf( M_elementVectorVelocity )"  << std::endl;
+        M_elementVectorPressure.showMe( std::cout );
+        */
+        //
+        // Assembling
+        //
+        /*
+        std::cout << "debut ====================" << std::endl;
+        M_elementVectorPressure.showMe( std::cout );
+        M_elementVectorVelocity.showMe( std::cout );
+        std::cout << "fin   ====================" << std::endl;
+        */
+        UInt const velocityTotalDof ( this->M_velocityFESpace.dof().numTotalDof() );
+
+        if ( matrix )
+        {
             for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
             {
                 for ( UInt jComponent = 0; jComponent < numVelocityComponent; ++jComponent )
                 {
-                    assembleMatrix( matrix,
+                    assembleMatrix( *matrix,
                                     *elementMatrixVelocity,
                                     this->M_velocityFESpace.fe(),
                                     mmFESpace.fe(),
@@ -935,7 +1044,7 @@ updateShapeDerivatives( matrix_Type&                   matrix,
 
                     //assembling the derivative of the convective term
                     if ( convectiveTermDerivative )
-                        assembleMatrix( matrix,
+                        assembleMatrix( *matrix,
                                         *elementMatrixConvective,
                                         this->M_velocityFESpace.fe(),
                                         this->M_velocityFESpace.fe(),
@@ -946,7 +1055,7 @@ updateShapeDerivatives( matrix_Type&                   matrix,
                                         iComponent * velocityTotalDof,
                                         jComponent * velocityTotalDof );
                 }
-                assembleMatrix( matrix,
+                assembleMatrix( *matrix,
                                 *elementMatrixPressure,
                                 this->M_pressureFESpace.fe(),
                                 mmFESpace.fe(),
@@ -958,10 +1067,64 @@ updateShapeDerivatives( matrix_Type&                   matrix,
                                 offset + iComponent * velocityTotalDof );
             }
         }
+        else
+        {
+            // Matrix-free application: the element matrices are multiplied by the local direction
+            for ( UInt iComponent = 0; iComponent < numVelocityComponent; ++iComponent )
+            {
+                for ( UInt jComponent = 0; jComponent < numVelocityComponent; ++jComponent )
+                {
+                    assembleMatrixVectorProduct( *product,
+                                                 *directionRepeated,
+                                                 *elementMatrixVelocity,
+                                                 this->M_velocityFESpace.fe(),
+                                                 mmFESpace.fe(),
+                                                 this->M_velocityFESpace.dof(),
+                                                 mmFESpace.dof(),
+                                                 iComponent,
+                                                 jComponent,
+                                                 iComponent * velocityTotalDof,
+                                                 offset + jComponent * velocityTotalDof );
+
+                    if ( convectiveTermDerivative )
+                        assembleMatrixVectorProduct( *product,
+                                                     *directionRepeated,
+                                                     *elementMatrixConvective,
+                                                     this->M_velocityFESpace.fe(),
+                                                     this->M_velocityFESpace.fe(),
+                                                     this->M_velocityFESpace.dof(),
+                                                     this->M_velocityFESpace.dof(),
+                                                     iComponent,
+                                                     jComponent,
+                                                     iComponent * velocityTotalDof,
+                                                     jComponent * velocityTotalDof );
+                }
+                assembleMatrixVectorProduct( *product,
+                                             *directionRepeated,
+                                             *elementMatrixPressure,
+                                             this->M_pressureFESpace.fe(),
+                                             mmFESpace.fe(),
+                                             this->M_pressureFESpace.dof(),
+                                             mmFESpace.dof(),
+                                             (UInt) 0,
+                                             iComponent,
+                                             (UInt) numVelocityComponent * velocityTotalDof,
+                                             offset + iComponent * velocityTotalDof );
+            }
+        }
     }
+}
 
-    chrono.stop();
-    this->M_Displayer.leaderPrintMax("done in ", chrono.diff() );
+template<typename MeshType, typename SolverType>
+const typename OseenSolverShapeDerivative<MeshType, SolverType>::vector_Type&
+OseenSolverShapeDerivative<MeshType, SolverType>::
+repeatedVector( const vector_Type& vector, boost::shared_ptr<vector_Type>& copy )
+{
+    if ( vector.mapType() == Repeated )
+        return vector;
+
+    copy.reset( new vector_Type( vector, Repeated ) );
+    return *copy;
 }
 
 } // namespace LifeV
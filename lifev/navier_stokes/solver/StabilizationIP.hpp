@@ -85,6 +85,12 @@ namespace details
  *  </ol>
  *  Both high Pechlet numbers and inf-sup incompatible FEM are stabilized.
  *
+ *  The geometry of the interior facets (adjacent elements, measures, derivatives of the basis functions
+ *  on the facets) is computed at the first call of apply() and stored in an InteriorFacetCache, which is
+ *  built again only when the mesh is moved with its MeshTransformer.
+ *  If the matrix given to apply() is not filled, all the entries of the extended stencil are inserted,
+ *  so that the matrix can then be zeroed and given again to apply() to update only the values.
+ *
  */
 
 template<typename MeshType, typename DofType>
@@ -145,6 +151,9 @@ public:
      *
      *	PREREQUISITE: The velocity and the pressure field should belong to the same finite element space
      *
+     *  If the matrix is already filled (e.g. by a previous call to this method followed by globalAssemble() and zero()),
+     *  the values are summed into its pattern.
+     *
      *  Parameters are the followings:
      *  @param dt      Real   timestep (INPUT)
      *  @param matrix  MatrixType where the stabilization terms are added into. (OUTPUT)
@@ -216,6 +225,8 @@ private:
     Real         M_viscosity;
     //! facetToPoint(i,j) = localId of jth point on ith local facet
     FTOP         M_facetToPoint;
+    //! Geometry of the interior facets
+    InteriorFacetCache M_facets;
     //@}
 }; // class StabilizationIP
 
@@ -248,23 +259,31 @@ void StabilizationIP<MeshType, DofType>::apply( MatrixType& matrix,  const Vecto
     LifeChronoFake chronoUpdate;
     LifeChronoFake chronoBeta;
     LifeChronoFake chronoElemComp;
-    LifeChronoFake chronoAssembly1;
-    LifeChronoFake chronoAssembly2;
-    LifeChronoFake chronoAssembly3;
-    LifeChronoFake chronoAssembly4;
-    LifeChronoFake chronoAssembly5;
-    LifeChronoFake chronoAssembly6;
-    LifeChronoFake chronoAssembly7;
-    LifeChronoFake chronoAssembly8;
-    LifeChronoFake chronoAssembly9;
+    LifeChronoFake chronoAssemblyPress;
+    LifeChronoFake chronoAssemblyVel;
     LifeChrono chronoAssembly;
 
+    // The geometry of the facets is computed once for the mesh
+    chronoUpdate.start();
+    const UInt geometryVersion( M_mesh->meshTransformer().geometryVersion() );
+    if ( !M_facets.isUpToDate( geometryVersion ) )
+    {
+        M_facets.build( *M_mesh, M_feOnSide1->refFE(), M_feOnSide1->quadRule(), *M_feBd, geometryVersion );
+    }
+    chronoUpdate.stop();
+
+    // When the matrix is not filled, the whole extended stencil is inserted (with zeros where
+    // the velocity vanishes): the matrix can then be zeroed and assembled again with the same pattern.
+    const bool insertPattern( !matrix.matrixPtr()->Filled() );
+
     ID geoDimensions = MeshType::S_geoDimensions;
     MatrixElemental elMatU( M_feOnSide1->nbFEDof(), geoDimensions    , geoDimensions   );
     MatrixElemental elMatP( M_feOnSide1->nbFEDof(), geoDimensions + 1, geoDimensions+1 );
 
+    MatrixElemental::matrix_view viewP( elMatP.block( geoDimensions, geoDimensions ) );
 
     const UInt nDof = M_dof->numTotalDof();
+    const UInt nbFEDof = M_feOnSide1->nbFEDof();
 
     Real normInf;
     state.normInf(&normInf);
@@ -276,34 +295,18 @@ void StabilizationIP<MeshType, DofType>::apply( MatrixType& matrix,  const Vecto
 
     chronoAssembly.start();
     // loop on interior facets
-    for ( UInt iFacet( M_mesh->numBoundaryFacets() ); iFacet< M_mesh->numFacets();
-            ++iFacet )
+    for ( UInt iFacet( 0 ); iFacet < M_facets.numFacets(); ++iFacet )
     {
-        const UInt iElAd1 ( M_mesh->facet( iFacet ).firstAdjacentElementIdentity()  );
-        const UInt iElAd2 ( M_mesh->facet( iFacet ).secondAdjacentElementIdentity() );
-
-        if ( Flag::testOneSet( M_mesh->facet( iFacet ).flag(),
-                               EntityFlags::SUBDOMAIN_INTERFACE | EntityFlags::PHYSICAL_BOUNDARY ) )
+        if ( M_facets.isInterface( iFacet ) )
         {
-        	//std::cout << "iElAd1 = " << iElAd1 << "; iElAd2 = " << iElAd2 << std::endl;
             continue;
         }
         ++myFacets;
 
-        chronoUpdate.start();
-        // update current finite elements
-#if WITH_DIVERGENCE
-        M_feBd->updateMeas( M_mesh->facet( iFacet ) );
-#else
-        M_feBd->updateMeasNormal( M_mesh->facet( iFacet ) );
-        KNM<Real>& normal = M_feBd->normal;
-#endif
-        const Real hK2 = M_feBd->measure();
+        const UInt iElAd1 ( M_facets.element( iFacet, 0 ) );
+        const UInt iElAd2 ( M_facets.element( iFacet, 1 ) );
 
-
-        M_feOnSide1->updateFirstDeriv( M_mesh->element( iElAd1 ) );
-        M_feOnSide2->updateFirstDeriv( M_mesh->element( iElAd2 ) );
-        chronoUpdate.stop();
+        const Real hK2 = M_facets.measure( iFacet );
 
         Real bmax(0);
         if (normInf != 0.)
@@ -313,11 +316,11 @@ void StabilizationIP<MeshType, DofType>::apply( MatrixType& matrix,  const Vecto
             // first, get the local trace of the velocity into beta
 
             // local id of the facet in its adjacent element
-            UInt iFaEl ( M_mesh->facet( iFacet ).firstAdjacentElementPosition() );
+            UInt iFaEl ( M_facets.positionInFirstElement( iFacet ) );
             for ( UInt iNode ( 0 ); iNode < M_feBd->nbNode(); ++iNode )
             {
                 UInt iloc ( M_facetToPoint( iFaEl, iNode ) );
-                for ( UInt iCoor ( 0 ); iCoor < M_feOnSide1->nbCoor(); ++iCoor )
+                for ( UInt iCoor ( 0 ); iCoor < M_facets.nbCoor(); ++iCoor )
                 {
                     UInt ig ( M_dof->localToGlobalMap( iElAd1, iloc ) +iCoor*nDof );
 
@@ -327,7 +330,7 @@ void StabilizationIP<MeshType, DofType>::apply( MatrixType& matrix,  const Vecto
             }
 
             // second, calculate its max norm
-            for ( UInt l ( 0 ); l < static_cast<UInt>( M_feOnSide1->nbCoor()*M_feBd->nbNode() ); ++l )
+            for ( UInt l ( 0 ); l < static_cast<UInt>( M_facets.nbCoor()*M_feBd->nbNode() ); ++l )
             {
                 if ( bmax < std::fabs( beta.vec()[ l ] ) )
                     bmax = std::fabs( beta.vec()[ l ] );
@@ -348,63 +351,30 @@ void StabilizationIP<MeshType, DofType>::apply( MatrixType& matrix,  const Vecto
                               std::max<Real>( bmax, M_viscosity/sqrt( hK2 ) );
 #endif
 
-            elMatP.zero();
-            chronoElemComp.start();
-            // coef*\int_{facet} grad u1 . grad v1
-            ipstab_grad( coeffPress, elMatP, *M_feOnSide1, *M_feOnSide1, *M_feBd,
-                         geoDimensions, geoDimensions);
-            chronoElemComp.stop();
-            chronoAssembly1.start();
-
-            assembleMatrix(matrix, elMatP, *M_feOnSide1, *M_dof,
-                           geoDimensions, geoDimensions, geoDimensions*nDof, geoDimensions*nDof);
-            chronoAssembly1.stop();
-
-            elMatP.zero();
-            chronoElemComp.start();
-            // coef*\int_{face} grad u2 . grad v2
-            ipstab_grad( coeffPress, elMatP, *M_feOnSide2, *M_feOnSide2, *M_feBd,
-                         geoDimensions, geoDimensions);
-            chronoElemComp.stop();
-            chronoAssembly2.start();
-
-            assembleMatrix(matrix, elMatP, *M_feOnSide2, *M_dof,
-                           geoDimensions, geoDimensions, geoDimensions*nDof, geoDimensions*nDof);
-            chronoAssembly2.stop();
-
-            elMatP.zero();
-            chronoElemComp.start();
-            // - coef*\int_{facet} grad u1 . grad v2
-            ipstab_grad(- coeffPress, elMatP, *M_feOnSide1, *M_feOnSide2, *M_feBd,
-                        geoDimensions, geoDimensions);
-            chronoElemComp.stop();
-            chronoAssembly3.start();
-
-            assembleMatrix(matrix, elMatP, *M_feOnSide1, *M_feOnSide2, *M_dof, *M_dof,
-                           geoDimensions, geoDimensions, geoDimensions*nDof, geoDimensions*nDof);
-            chronoAssembly3.stop();
-
-            elMatP.zero();
-            chronoElemComp.start();
-            // - coef*\int_{facet} grad u2 . grad v1
-            ipstab_grad(- coeffPress, elMatP, *M_feOnSide2, *M_feOnSide1, *M_feBd,
-                        geoDimensions, geoDimensions);
-            chronoElemComp.stop();
-            chronoAssembly4.start();
-
-            assembleMatrix(matrix, elMatP, *M_feOnSide2, *M_feOnSide1, *M_dof, *M_dof,
-                           geoDimensions, geoDimensions, geoDimensions*nDof, geoDimensions*nDof);
-            chronoAssembly4.stop();
+            for ( UInt side1 ( 0 ); side1 < 2; ++side1 )
+                for ( UInt side2 ( 0 ); side2 < 2; ++side2 )
+                {
+                    elMatP.zero();
+                    chronoElemComp.start();
+                    // (+/-) coef*\int_{facet} grad u_side1 . grad v_side2
+                    ipstab_grad( side1 == side2 ? coeffPress : -coeffPress, elMatP, M_facets, iFacet, side1, side2,
+                                 geoDimensions, geoDimensions );
+                    chronoElemComp.stop();
+                    chronoAssemblyPress.start();
+                    assembleMatrix( matrix, M_facets.element( iFacet, side1 ), M_facets.element( iFacet, side2 ), viewP,
+                                    nbFEDof, nbFEDof, *M_dof, *M_dof, geoDimensions*nDof, geoDimensions*nDof );
+                    chronoAssemblyPress.stop();
+                }
         }
 
         // velocity stabilization
-        if ( ( M_gammaDiv != 0 || M_gammaBeta != 0 ) && bmax > 0 )
+        if ( ( M_gammaDiv != 0 || M_gammaBeta != 0 ) && ( bmax > 0 || insertPattern ) )
         {
 #if WITH_DIVERGENCE
 #if USE_OLD_PARAMETERS
             Real coeffBeta ( M_gammaBeta * hK2 / std::max<Real>(bmax, hK2) ); // code
 #else
-            Real coeffBeta ( M_gammaBeta * hK2 / bmax ); // paper
+            Real coeffBeta ( bmax > 0 ? M_gammaBeta * hK2 / bmax : 0. ); // paper
 #endif
 
             Real coeffDiv ( M_gammaDiv * hK2 * bmax ); // (code and paper)
@@ -412,22 +382,23 @@ void StabilizationIP<MeshType, DofType>::apply( MatrixType& matrix,  const Vecto
 #else
             // determine bnmax = ||\beta \cdot n||_{0,\infty,K}
             // and       bcmax = ||\beta \cross n||_{0,\infty,K}
+            // (the facets are flat, the normal is the one of the first quadrature node)
 
             chronoBeta.start();
             Real bnmax ( 0. );
             Real bcmax ( 0. );
-            for ( UInt iNode(0); iNode<M_feBd->nbNode; ++iNode )
+            for ( UInt iNode(0); iNode<M_feBd->nbNode(); ++iNode )
             {
                 Real bn ( 0 );
-                for ( UInt iCoor(0); iCoor<M_feOnSide1->nbCoor(); ++iCoor )
+                for ( UInt iCoor(0); iCoor<M_facets.nbCoor(); ++iCoor )
                 {
-                    bn += normal(iNode, iCoor) *
-                          beta.vec()[ iCoor*M_feBd->nbNode + iNode ];
+                    bn += M_facets.normal( iFacet, iCoor, 0 ) *
+                          beta.vec()[ iCoor*M_feBd->nbNode() + iNode ];
                     bcmax = std::max<Real>
-                            (bcmax, normal(iNode, (iCoor)%3) *
-                             beta.vec()[ (iCoor+1)%3*M_feBd->nbNode + iNode ] -
-                             normal(iNode, (iCoor+1)%3) *
-                             beta.vec()[ (iCoor)%3*M_feBd->nbNode + iNode ]);
+                            (bcmax, M_facets.normal( iFacet, (iCoor)%3, 0 ) *
+                             beta.vec()[ (iCoor+1)%3*M_feBd->nbNode() + iNode ] -
+                             M_facets.normal( iFacet, (iCoor+1)%3, 0 ) *
+                             beta.vec()[ (iCoor)%3*M_feBd->nbNode() + iNode ]);
                 }
                 bnmax = std::max<Real> (bnmax, bn);
             }
@@ -435,97 +406,36 @@ void StabilizationIP<MeshType, DofType>::apply( MatrixType& matrix,  const Vecto
 
             Real coeffGrad = hK2 * (M_gammaBeta*bnmax + M_gammaDiv*bcmax);
 #endif
-            elMatU.zero();
-            chronoElemComp.start();
-#if WITH_DIVERGENCE
-            // coef*\int_{facet} (\beta1 . grad u1) (\beta2 . grad v2)
-            ipstab_bgrad( coeffBeta, elMatU, *M_feOnSide1, *M_feOnSide1, beta,
-                          *M_feBd, 0, 0, geoDimensions );
-            // coef*\int_{facet} div u1 . div v1
-            ipstab_div( coeffDiv, elMatU, *M_feOnSide1, *M_feOnSide1, *M_feBd );
-#else
-            // coef*\int_{facet} grad u1 . grad v1
-            ipstab_grad( coeffGrad, elMatU, *M_feOnSide1, *M_feOnSide1, *M_feBd, 0, 0,
-                         geoDimensions );
-#endif
-            chronoElemComp.stop();
-            chronoAssembly5.start();
-            for ( UInt iComp ( 0 ); iComp<geoDimensions; ++iComp )
-                for ( UInt jComp ( 0 ); jComp<geoDimensions; ++jComp )
-                {
-                    assembleMatrix( matrix, elMatU, *M_feOnSide1, *M_dof,
-                                    iComp, jComp, iComp*nDof, jComp*nDof );
-                }
-            chronoAssembly5.stop();
-
-            elMatU.zero();
-            chronoElemComp.start();
-#if WITH_DIVERGENCE
-            // coef*\int_{facet} (\beta2 . grad u2) (\beta2 . grad v2)
-            ipstab_bgrad( coeffBeta, elMatU, *M_feOnSide2, *M_feOnSide2, beta,
-                          *M_feBd, 0, 0, geoDimensions );
-            // coef*\int_{facet} div u2 . div v2
-            ipstab_div( coeffDiv, elMatU, *M_feOnSide2, *M_feOnSide2, *M_feBd );
-#else
-            // coef*\int_{facet} grad u2 . grad v2
-            ipstab_grad( coeffGrad, elMatU, *M_feOnSide2, *M_feOnSide2, *M_feBd, 0, 0,
-                         geoDimensions );
-#endif
-            chronoElemComp.stop();
-            chronoAssembly6.start();
-            for ( UInt iComp ( 0 ); iComp<geoDimensions; ++iComp )
-                for ( UInt jComp ( 0 ); jComp<geoDimensions; ++jComp )
-                {
-                    assembleMatrix( matrix, elMatU, *M_feOnSide2, *M_dof,
-                                    iComp, jComp, iComp*nDof, jComp*nDof );
-                }
-            chronoAssembly6.stop();
 
-            elMatU.zero();
-            chronoElemComp.start();
-#if WITH_DIVERGENCE
-            // - coef*\int_{facet} (\beta1 . grad u1) (\beta2 . grad v2)
-            ipstab_bgrad( -coeffBeta, elMatU, *M_feOnSide1, *M_feOnSide2, beta,
-                          *M_feBd, 0, 0, geoDimensions );
-            // - coef*\int_{facet} div u1 . div v2
-            ipstab_div( -coeffDiv, elMatU, *M_feOnSide1, *M_feOnSide2, *M_feBd );
-#else
-            // - coef*\int_{facet} grad u1 . grad v2
-            ipstab_grad( -coeffGrad, elMatU, *M_feOnSide1, *M_feOnSide2, *M_feBd, 0, 0,
-                         geoDimensions );
-#endif
-            chronoElemComp.stop();
-            chronoAssembly7.start();
-            for ( UInt iComp = 0; iComp<geoDimensions; ++iComp )
-                for ( UInt jComp = 0; jComp<geoDimensions; ++jComp )
+            for ( UInt side1 ( 0 ); side1 < 2; ++side1 )
+                for ( UInt side2 ( 0 ); side2 < 2; ++side2 )
                 {
-                    assembleMatrix( matrix, elMatU, *M_feOnSide1, *M_feOnSide2, *M_dof, *M_dof,
-                                    iComp, jComp, iComp*nDof, jComp*nDof );
-                }
-            chronoAssembly7.stop();
+                    const Real sign ( side1 == side2 ? 1. : -1. );
 
-            elMatU.zero();
-            chronoElemComp.start();
+                    elMatU.zero();
+                    chronoElemComp.start();
 #if WITH_DIVERGENCE
-            // - coef*\int_{facet} (\beta2 . grad u2) (\beta1 . grad v1)
-            ipstab_bgrad( -coeffBeta, elMatU, *M_feOnSide2, *M_feOnSide1, beta,
-                          *M_feBd, 0, 0, geoDimensions );
-            // - coef*\int_{facet} div u2 . div v1
-            ipstab_div( -coeffDiv, elMatU, *M_feOnSide2, *M_feOnSide1, *M_feBd );
+                    // (+/-) coef*\int_{facet} (\beta . grad u_side1) (\beta . grad v_side2)
+                    ipstab_bgrad( sign * coeffBeta, elMatU, M_facets, iFacet, side1, side2, beta,
+                                  *M_feBd, 0, 0, geoDimensions );
+                    // (+/-) coef*\int_{facet} div u_side1 . div v_side2
+                    ipstab_div( sign * coeffDiv, elMatU, M_facets, iFacet, side1, side2 );
 #else
-            // - coef*\int_{facet} grad u2 . grad v1
-            ipstab_grad( -coeffGrad, elMatU, *M_feOnSide2, *M_feOnSide1, *M_feBd, 0, 0,
-                         geoDimensions );
+                    // (+/-) coef*\int_{facet} grad u_side1 . grad v_side2
+                    ipstab_grad( sign * coeffGrad, elMatU, M_facets, iFacet, side1, side2, 0, 0,
+                                 geoDimensions );
 #endif
-            chronoElemComp.stop();
-            chronoAssembly8.start();
-            for ( UInt iComp ( 0 ); iComp<geoDimensions; ++iComp )
-                for ( UInt jComp ( 0 ); jComp<geoDimensions; ++jComp )
-                {
-                    assembleMatrix( matrix, elMatU, *M_feOnSide2, *M_feOnSide1, *M_dof, *M_dof,
-                                    iComp, jComp, iComp*nDof, jComp*nDof );
+                    chronoElemComp.stop();
+                    chronoAssemblyVel.start();
+                    for ( UInt iComp ( 0 ); iComp<geoDimensions; ++iComp )
+                        for ( UInt jComp ( 0 ); jComp<geoDimensions; ++jComp )
+                        {
+                            MatrixElemental::matrix_view viewU( elMatU.block( iComp, jComp ) );
+                            assembleMatrix( matrix, M_facets.element( iFacet, side1 ), M_facets.element( iFacet, side2 ),
+                                            viewU, nbFEDof, nbFEDof, *M_dof, *M_dof, iComp*nDof, jComp*nDof );
+                        }
+                    chronoAssemblyVel.stop();
                 }
-            chronoAssembly8.stop();
         }
 
     } // loop on interior facets
@@ -534,28 +444,16 @@ void StabilizationIP<MeshType, DofType>::apply( MatrixType& matrix,  const Vecto
     {
         debugStream(7101) << "\n";
         debugStream(7101) << static_cast<UInt>(state.blockMap().Comm().MyPID())
-        <<  "  .   Updating of element   done in "
+        <<  "  .   Updating of facets    done in "
         << chronoUpdate.diffCumul()   << " s." << "\n";
         debugStream(7101) << "   .   Determination of beta done in "
         << chronoBeta.diffCumul()     << " s." << "\n";
         debugStream(7101) << "   .   Element computations  done in "
         << chronoElemComp.diffCumul() << " s." << "\n";
-        debugStream(7101) << "   .   chrono 1              done in "
-        << chronoAssembly1.diffCumul() << " s." << "\n";
-        debugStream(7101) << "   .   chrono 2              done in "
-        << chronoAssembly2.diffCumul() << " s." << "\n";
-        debugStream(7101) << "   .   chrono 3              done in "
-        << chronoAssembly3.diffCumul() << " s." << "\n";
-        debugStream(7101) << "   .   chrono 4              done in "
-        << chronoAssembly4.diffCumul() << " s." << "\n";
-        debugStream(7101) << "   .   chrono 5              done in "
-        << chronoAssembly5.diffCumul() << " s." << "\n";
-        debugStream(7101) << "   .   chrono 6              done in "
-        << chronoAssembly6.diffCumul() << " s." << "\n";
-        debugStream(7101) << "   .   chrono 7              done in "
-        << chronoAssembly7.diffCumul() << " s." << "\n";
-        debugStream(7101) << "   .   chrono 8              done in "
-        << chronoAssembly8.diffCumul() << " s." << "\n";
+        debugStream(7101) << "   .   pressure assembly     done in "
+        << chronoAssemblyPress.diffCumul() << " s." << "\n";
+        debugStream(7101) << "   .   velocity assembly     done in "
+        << chronoAssemblyVel.diffCumul() << " s." << "\n";
         debugStream(7101) << "   .   total                                   "
         << chronoAssembly.diffCumul() << " s."
         << " myFacets = " << myFacets << "\n";
@@ -585,6 +483,7 @@ void StabilizationIP<MeshType, DofType>::setDiscretization(const dofPtr_Type& do
     M_feOnSide1.reset( new CurrentFE(refFE, getGeometricMap(*M_mesh), quadRule) );
     M_feOnSide2.reset( new CurrentFE(refFE, getGeometricMap(*M_mesh), quadRule) );
     M_feBd = &feBd;
+    M_facets.clear();
 
     M_facetToPoint = MeshType::elementShape_Type::facetToPoint;
 }
@@ -0,0 +1,227 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+
+/*!
+    @file
+    @brief Test of the assembly options of the OseenSolver
+
+    @date 19-10-2012
+
+    The Oseen system is assembled with the default (element by element) assembly and with each
+    option of the data file section fluid/space_discretization that changes the way the
+    matrices are assembled. The matrices without boundary conditions are compared by applying
+    them to the same vector, for two time steps, so that the buffers kept by the solver
+    between the time steps are used as well.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/algorithm/PreconditionerIfpack.hpp>
+
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/filter/GetPot.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/navier_stokes/solver/OseenData.hpp>
+#include <lifev/navier_stokes/solver/OseenSolver.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef boost::shared_ptr<Epetra_Comm> commPtr_Type;
+
+namespace
+{
+
+const UInt numTimeSteps( 2 );
+
+// Assemble the Oseen system for some time steps and apply its matrix to the vector x
+std::vector<vector_Type> assembleAndApply( const GetPot& dataFile,
+                                           const feSpacePtr_Type& uFESpace, const feSpacePtr_Type& pFESpace,
+                                           const commPtr_Type& comm,
+                                           const vector_Type& x, const vector_Type& beta )
+{
+    boost::shared_ptr<OseenData> oseenData( new OseenData() );
+    oseenData->setup( dataFile );
+
+    OseenSolver< mesh_Type > fluid( oseenData, *uFESpace, *pFESpace, comm );
+    fluid.setUp( dataFile );
+    fluid.buildSystem();
+
+    // The previous solution enters the ALE terms of the convective matrix
+    fluid.initialize( beta );
+
+    const Real alpha( oseenData->dataTime()->orderBDF() / oseenData->dataTime()->timeStep() );
+    vector_Type rightHandSide( fluid.getMap() );
+
+    std::vector<vector_Type> products;
+    for ( UInt iStep(0); iStep < numTimeSteps; ++iStep )
+    {
+        vector_Type stepBeta( beta );
+        stepBeta *= 1. + iStep;
+
+        fluid.updateSystem( alpha, stepBeta, rightHandSide );
+        products.push_back( fluid.matrixNoBC() * x );
+    }
+
+    return products;
+}
+
+// Relative difference of two vectors
+Real relativeDifference( const vector_Type& reference, const vector_Type& other )
+{
+    vector_Type difference( reference );
+    difference -= other;
+    return difference.normInf() / reference.normInf();
+}
+
+// Compare the assembly with an option enabled with the reference assembly
+bool checkOption( const std::string& option, const std::vector<vector_Type>& reference,
+                  GetPot dataFile,
+                  const feSpacePtr_Type& uFESpace, const feSpacePtr_Type& pFESpace,
+                  const commPtr_Type& comm,
+                  const vector_Type& x, const vector_Type& beta,
+                  const Real& tolerance, const bool& verbose )
+{
+    dataFile.set( ( "fluid/space_discretization/" + option ).c_str(), "true" );
+
+    const std::vector<vector_Type> products( assembleAndApply( dataFile, uFESpace, pFESpace, comm, x, beta ) );
+
+    bool success( true );
+    for ( UInt iStep(0); iStep < numTimeSteps; ++iStep )
+    {
+        const Real difference( relativeDifference( reference[iStep], products[iStep] ) );
+        if ( verbose ) std::cout << " ---> " << option << ", time step " << iStep << ", difference : " << difference << std::endl;
+        success &= difference < tolerance;
+    }
+
+    return success;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    commPtr_Type Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    commPtr_Type Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    GetPot command_line( argc, argv );
+    const std::string dataFileName = command_line.follow( "data", 2, "-f", "--file" );
+    GetPot dataFile( dataFileName );
+
+    const UInt Nelements( dataFile( "fluid/space_discretization/mesh_size", 4 ) );
+    const Real tolerance( 1e-12 );
+
+    bool success( true );
+
+// Build and partition the mesh
+
+    boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+    regularMesh3D( *fullMeshPtr, 1, Nelements, Nelements, Nelements, false,
+                   2.0,   2.0,   2.0,
+                   -1.0,  -1.0,  -1.0 );
+
+    boost::shared_ptr< mesh_Type > meshPtr;
+    {
+        MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+        meshPtr = meshPart.meshPartition();
+    }
+    fullMeshPtr.reset();
+
+// Build the FESpaces and the vectors
+
+    const std::string uOrder( dataFile( "fluid/space_discretization/vel_order", "P2" ) );
+    const std::string pOrder( dataFile( "fluid/space_discretization/press_order", "P1" ) );
+
+    feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, uOrder, 3, Comm ) );
+    feSpacePtr_Type pFESpace( new feSpace_Type( meshPtr, pOrder, 1, Comm ) );
+
+    MapEpetra fullMap( uFESpace->map() );
+    fullMap += pFESpace->map();
+
+    vector_Type x( fullMap, Unique );
+    x.epetraVector().Random();
+
+    vector_Type beta( fullMap, Unique );
+    beta.epetraVector().Random();
+
+// Compare the assembly options with the reference assembly
+
+    const std::vector<vector_Type> reference( assembleAndApply( dataFile, uFESpace, pFESpace, Comm, x, beta ) );
+
+    success &= checkOption( "threaded_assembly", reference, dataFile, uFESpace, pFESpace, Comm, x, beta, tolerance, verbose );
+    success &= checkOption( "overlapped_import", reference, dataFile, uFESpace, pFESpace, Comm, x, beta, tolerance, verbose );
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
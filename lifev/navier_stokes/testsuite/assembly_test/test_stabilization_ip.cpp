@@ -0,0 +1,334 @@
+//@HEADER
+/*
+*******************************************************************************
+
+    Copyright (C) 2004, 2005, 2007 EPFL, Politecnico di Milano, INRIA
+    Copyright (C) 2010 EPFL, Politecnico di Milano, Emory University
+
+    This file is part of LifeV.
+
+    LifeV is free software; you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LifeV is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+    Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with LifeV.  If not, see <http://www.gnu.org/licenses/>.
+
+*******************************************************************************
+*/
+//@HEADER
+
+
+/*!
+    @file
+    @brief Test of the interior penalty stabilization of the Navier-Stokes equations
+
+    @date 19-10-2012
+
+    The stabilization matrix assembled by StabilizationIP, with the geometry of the facets
+    stored in an InteriorFacetCache, is compared with the assembly facet by facet with
+    CurrentFE and CurrentBoundaryFE updated on each facet. The same StabilizationIP object
+    and the same matrix are used, as in OseenSolver, for three assemblies:
+    <ol>
+    <li> with a vanishing velocity, on a matrix which is not filled (the extended stencil is inserted); </li>
+    <li> with a non vanishing velocity, on the filled matrix set to zero; </li>
+    <li> after the mesh has been moved, on the filled matrix set to zero. </li>
+    </ol>
+    Both P1 and P2 finite elements are tested.
+ */
+
+// Tell the compiler to ignore specific kind of warnings:
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+
+#include <Epetra_ConfigDefs.h>
+#ifdef EPETRA_MPI
+#include <mpi.h>
+#include <Epetra_MpiComm.h>
+#else
+#include <Epetra_SerialComm.h>
+#endif
+
+//Tell the compiler to restore the warning previously silented
+#pragma GCC diagnostic warning "-Wunused-variable"
+#pragma GCC diagnostic warning "-Wunused-parameter"
+
+#include <lifev/core/LifeV.hpp>
+
+#include <lifev/core/array/MapEpetra.hpp>
+#include <lifev/core/array/MatrixEpetra.hpp>
+#include <lifev/core/array/VectorEpetra.hpp>
+
+#include <lifev/core/fem/Assembly.hpp>
+#include <lifev/core/fem/AssemblyElemental.hpp>
+#include <lifev/core/fem/FESpace.hpp>
+
+#include <lifev/core/mesh/MeshPartitioner.hpp>
+#include <lifev/core/mesh/RegionMesh3DStructured.hpp>
+#include <lifev/core/mesh/RegionMesh.hpp>
+
+#include <lifev/navier_stokes/solver/StabilizationIP.hpp>
+
+using namespace LifeV;
+
+typedef RegionMesh<LinearTetra> mesh_Type;
+typedef MatrixEpetra<Real> matrix_Type;
+typedef VectorEpetra vector_Type;
+typedef FESpace<mesh_Type, MapEpetra> feSpace_Type;
+typedef boost::shared_ptr<feSpace_Type> feSpacePtr_Type;
+typedef details::StabilizationIP<mesh_Type, DOF> stabilization_Type;
+
+namespace
+{
+
+const Real tolerance( 1e-12 );
+
+const Real gammaBeta( 0.3 );
+const Real gammaDiv( 0.2 );
+const Real gammaPress( 0.5 );
+const Real viscosity( 0.01 );
+
+Real velocity( const Real& /* t */, const Real& x, const Real& y, const Real& z, const ID& i )
+{
+    switch ( i )
+    {
+    case 0:
+        return std::sin( y ) + z * z;
+    case 1:
+        return x * z - 0.5;
+    default:
+        return std::cos( x + y );
+    }
+}
+
+// Mapping used to move the mesh, the elements remain valid
+struct MeshMapping
+{
+    void operator() ( Real& x, Real& y, Real& z ) const
+    {
+        const Real xOld( x ), yOld( y );
+        x = xOld + 0.1 * yOld * z;
+        y = yOld + 0.05 * xOld * xOld;
+        z = z + 0.08 * xOld * yOld;
+    }
+};
+
+// Assembly of the stabilization facet by facet, with the finite elements updated on each facet
+void referenceAssembly( matrix_Type& matrix, feSpace_Type& uFESpace, const vector_Type& beta )
+{
+    const mesh_Type& mesh( *uFESpace.mesh() );
+    const DOF& dof( uFESpace.dof() );
+
+    const UInt geoDimensions( mesh_Type::S_geoDimensions );
+    const UInt nDof( dof.numTotalDof() );
+
+    CurrentFE fe1( uFESpace.refFE(), getGeometricMap( mesh ), uFESpace.qr() );
+    CurrentFE fe2( uFESpace.refFE(), getGeometricMap( mesh ), uFESpace.qr() );
+    CurrentBoundaryFE& feBd( uFESpace.feBd() );
+    const CurrentFE* fe[ 2 ] = { &fe1, &fe2 };
+
+    MatrixElemental elMatU( fe1.nbFEDof(), geoDimensions, geoDimensions );
+    MatrixElemental elMatP( fe1.nbFEDof(), geoDimensions + 1, geoDimensions + 1 );
+    VectorElemental betaLocal( feBd.nbNode(), geoDimensions );
+
+    const Real normInf( beta.normInf() );
+
+    for ( UInt iFacet( mesh.numBoundaryFacets() ); iFacet < mesh.numFacets(); ++iFacet )
+    {
+        if ( Flag::testOneSet( mesh.facet( iFacet ).flag(),
+                               EntityFlags::SUBDOMAIN_INTERFACE | EntityFlags::PHYSICAL_BOUNDARY ) )
+        {
+            continue;
+        }
+
+        const UInt iElAd1( mesh.facet( iFacet ).firstAdjacentElementIdentity() );
+        const UInt iElAd2( mesh.facet( iFacet ).secondAdjacentElementIdentity() );
+
+        feBd.updateMeas( mesh.facet( iFacet ) );
+        const Real hK2( feBd.measure() );
+
+        fe1.updateFirstDeriv( mesh.element( iElAd1 ) );
+        fe2.updateFirstDeriv( mesh.element( iElAd2 ) );
+
+        // Maximum norm of the trace of the velocity on the facet
+        Real bmax( 0. );
+        if ( normInf != 0. )
+        {
+            const UInt iFaEl( mesh.facet( iFacet ).firstAdjacentElementPosition() );
+            for ( UInt iNode( 0 ); iNode < feBd.nbNode(); ++iNode )
+            {
+                const UInt iloc( mesh_Type::elementShape_Type::facetToPoint( iFaEl, iNode ) );
+                for ( UInt iCoor( 0 ); iCoor < geoDimensions; ++iCoor )
+                {
+                    const UInt ig( dof.localToGlobalMap( iElAd1, iloc ) + iCoor * nDof );
+                    betaLocal.vec()[ iCoor * feBd.nbNode() + iNode ] = beta( ig );
+                    bmax = std::max( bmax, std::fabs( beta( ig ) ) );
+                }
+            }
+        }
+
+        // Pressure stabilization
+        const Real coeffPress( gammaPress * hK2 / std::max<Real>( bmax, viscosity / std::sqrt( hK2 ) ) );
+        for ( UInt side1( 0 ); side1 < 2; ++side1 )
+            for ( UInt side2( 0 ); side2 < 2; ++side2 )
+            {
+                elMatP.zero();
+                ipstab_grad( side1 == side2 ? coeffPress : -coeffPress, elMatP, *fe[ side1 ], *fe[ side2 ], feBd,
+                             geoDimensions, geoDimensions );
+                assembleMatrix( matrix, elMatP, *fe[ side1 ], *fe[ side2 ], dof, dof,
+                                geoDimensions, geoDimensions, geoDimensions * nDof, geoDimensions * nDof );
+            }
+
+        // Velocity stabilization
+        if ( bmax > 0 )
+        {
+            const Real coeffBeta( gammaBeta * hK2 / bmax );
+            const Real coeffDiv( gammaDiv * hK2 * bmax );
+
+            for ( UInt side1( 0 ); side1 < 2; ++side1 )
+                for ( UInt side2( 0 ); side2 < 2; ++side2 )
+                {
+                    const Real sign( side1 == side2 ? 1. : -1. );
+
+                    elMatU.zero();
+                    ipstab_bgrad( sign * coeffBeta, elMatU, *fe[ side1 ], *fe[ side2 ], betaLocal, feBd,
+                                  0, 0, geoDimensions );
+                    ipstab_div( sign * coeffDiv, elMatU, *fe[ side1 ], *fe[ side2 ], feBd );
+                    for ( UInt iComp( 0 ); iComp < geoDimensions; ++iComp )
+                        for ( UInt jComp( 0 ); jComp < geoDimensions; ++jComp )
+                        {
+                            assembleMatrix( matrix, elMatU, *fe[ side1 ], *fe[ side2 ], dof, dof,
+                                            iComp, jComp, iComp * nDof, jComp * nDof );
+                        }
+                }
+        }
+    }
+}
+
+// Relative difference of two assembled matrices
+Real relativeDifference( const MapEpetra& map, const matrix_Type& reference, const matrix_Type& other )
+{
+    matrix_Type difference( map );
+    difference += reference;
+    difference.add( -1., other );
+    difference.globalAssemble();
+    return difference.normInf() / reference.normInf();
+}
+
+// Compare the assemblies for the three cases
+bool compareAssemblies( feSpacePtr_Type& uFESpace, const MapEpetra& fullMap, const bool& verbose )
+{
+    stabilization_Type stabilization;
+    stabilization.setFeSpaceVelocity( *uFESpace );
+    stabilization.setViscosity( viscosity );
+    stabilization.setGammaBeta( gammaBeta );
+    stabilization.setGammaDiv( gammaDiv );
+    stabilization.setGammaPress( gammaPress );
+
+    vector_Type beta( uFESpace->map(), Unique );
+    uFESpace->interpolate( static_cast<feSpace_Type::function_Type>( velocity ), beta, 0.0 );
+
+    vector_Type zeroBeta( uFESpace->map(), Repeated );
+    zeroBeta *= 0.;
+
+    matrix_Type matrix( fullMap );
+
+    bool success( true );
+
+    for ( UInt iCase( 0 ); iCase < 3; ++iCase )
+    {
+        if ( iCase == 2 )
+        {
+            uFESpace->mesh()->meshTransformer().transformMesh( MeshMapping() );
+        }
+
+        const vector_Type stepBeta( iCase == 0 ? zeroBeta : vector_Type( beta, Repeated ) );
+
+        // Same object and same matrix as in OseenSolver::updateSystem
+        if ( iCase > 0 )
+        {
+            matrix.zero();
+        }
+        stabilization.apply( matrix, stepBeta, false );
+        matrix.globalAssemble();
+
+        matrix_Type reference( fullMap );
+        referenceAssembly( reference, *uFESpace, stepBeta );
+        reference.globalAssemble();
+
+        const Real difference( relativeDifference( fullMap, reference, matrix ) );
+
+        if ( verbose ) std::cout << " ---> " << uFESpace->refFE().name()
+                                 << ( iCase == 0 ? ", vanishing velocity" : iCase == 1 ? ", filled matrix" : ", moved mesh" )
+                                 << ", difference : " << difference << std::endl;
+
+        success &= difference < tolerance;
+    }
+
+    return success;
+}
+
+}
+
+int
+main( int argc, char** argv )
+{
+
+#ifdef HAVE_MPI
+    MPI_Init( &argc, &argv );
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_MpiComm( MPI_COMM_WORLD ) );
+#else
+    boost::shared_ptr<Epetra_Comm> Comm( new Epetra_SerialComm );
+#endif
+
+    const bool verbose( Comm->MyPID() == 0 );
+
+    bool success( true );
+
+    const std::string orders[ 2 ] = { "P1", "P2" };
+
+    for ( UInt iOrder( 0 ); iOrder < 2; ++iOrder )
+    {
+        // Each order moves its own mesh
+        boost::shared_ptr< mesh_Type > fullMeshPtr( new mesh_Type( Comm ) );
+        regularMesh3D( *fullMeshPtr, 1, 4, 4, 4, false,
+                       2.0,   2.0,   2.0,
+                       -1.0,  -1.0,  -1.0 );
+
+        boost::shared_ptr< mesh_Type > meshPtr;
+        {
+            MeshPartitioner< mesh_Type > meshPart( fullMeshPtr, Comm );
+            meshPtr = meshPart.meshPartition();
+        }
+        fullMeshPtr.reset();
+
+        // Same finite elements for the velocity and the pressure
+        feSpacePtr_Type uFESpace( new feSpace_Type( meshPtr, orders[ iOrder ], 3, Comm ) );
+        feSpacePtr_Type pFESpace( new feSpace_Type( meshPtr, orders[ iOrder ], 1, Comm ) );
+
+        MapEpetra fullMap( uFESpace->map() );
+        fullMap += pFESpace->map();
+
+        success &= compareAssemblies( uFESpace, fullMap, verbose );
+    }
+
+#ifdef HAVE_MPI
+    MPI_Finalize();
+#endif
+
+    if ( !success )
+    {
+        if ( verbose ) std::cout << "End Result: TEST NOT PASSED" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if ( verbose ) std::cout << "End Result: TEST PASSED" << std::endl;
+
+    return EXIT_SUCCESS;
+}
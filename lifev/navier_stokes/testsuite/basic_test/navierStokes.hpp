@@ -66,6 +66,8 @@ enum TimeScheme { BDF_ORDER_ONE = 1, BDF_ORDER_TWO, BDF_ORDER_THREE };
         <li> NavierStokes/initialization (interpolation/projection)
         <li> NavierStokes/export_norms
         <li> NavierStokes/export_exact_solutions
+        <li> NavierStokes/max_linear_iterations (the test fails if the linear solver needs more
+             iterations in a time step, 0 to disable the check)
         <li> NavierStokes/mesh_source (regular_mesh/file)
         <li> exporter/type (ensight/hdf5)
         <li> fluid/problem/Re
@@ -223,6 +225,9 @@ private:
                                           // convTol lower down the theoretical bounds
     LifeV::Real                M_accuracyTol;
 
+    // Maximum number of iterations of the linear solver (0: no check)
+    LifeV::Int                 M_maxLinearIterations;
+
     // Data related to norm export
     bool                       M_exportNorms;
     std::ofstream              M_outNorm;
@@ -347,6 +352,7 @@ NavierStokes<MeshType, Problem>::NavierStokes( int argc,
 
     M_convTol     = dataFile("NavierStokes/space_convergence_tolerance", 1.0);
     M_accuracyTol = dataFile("NavierStokes/accuracy_tolerance", 1.0);
+    M_maxLinearIterations = dataFile("NavierStokes/max_linear_iterations", 0);
 
     // Method of initialization
     string initType = dataFile("NavierStokes/initialization", "projection");
@@ -930,6 +936,15 @@ NavierStokes<MeshType, Problem>::run()
                 fluid.updateSystem( alpha, beta, rhs );
                 fluid.iterate( bcH );
 
+                // Check of the number of iterations of the linear solver (i.e. of the preconditioner)
+                if (verbose) std::cout << "Linear solver iterations: " << fluid.linearSolverIterations() << std::endl;
+                if (M_maxLinearIterations > 0 && fluid.linearSolverIterations() > M_maxLinearIterations)
+                {
+                    if (verbose) std::cout << "TEST_NAVIERSTOKES STATUS: ECHEC (more than " << M_maxLinearIterations
+                                           << " iterations)" << std::endl;
+                    throw typename NavierStokes::RESULT_CHANGED_EXCEPTION();
+                }
+
                 bdf.bdfVelocity().shiftRight( *fluid.solution() );
 
                 // Computation of the error
@@ -962,6 +977,8 @@ NavierStokes<MeshType, Problem>::run()
                 }
                 exporter->postProcess( time );
 
+                // Timings of the time step (with ENABLE_PRODUCTION_LOGGING only)
+                fluid.getDisplayer().leaderPrintTimings( "Timings of the time step" );
 
                 MPI_Barrier(MPI_COMM_WORLD);
 
@@ -1088,6 +1088,11 @@ VenantKirchhoffSolver<Mesh, SolverType>::setDataFromGetPot( const GetPot& dataFi
 {
   M_linearSolver->setDataFromGetPot( dataFile, "solid/solver" );
   M_linearSolver->setupPreconditioner(dataFile, "solid/prec");
+
+  // Rigid body modes for the multilevel preconditioners
+  boost::shared_ptr<std::vector<Real> > nullSpace( new std::vector<Real> );
+  const UInt numModes( M_FESpace->rigidBodyModes( *nullSpace ) );
+  M_linearSolver->preconditioner()->setNullSpace( nullSpace, numModes );
 }
 
 
@@ -578,6 +578,11 @@ VenantKirchhoffViscoelasticSolver<Mesh, SolverType>::setDataFromGetPot( const Ge
 {
     M_linearSolver->setDataFromGetPot( dataFile, "problem/solver" );
     M_linearSolver->setupPreconditioner(dataFile, "problem/prec");
+
+    // Rigid body modes for the multilevel preconditioners
+    boost::shared_ptr<std::vector<Real> > nullSpace( new std::vector<Real> );
+    const UInt numModes( M_FESpace->rigidBodyModes( *nullSpace ) );
+    M_linearSolver->preconditioner()->setNullSpace( nullSpace, numModes );
 }
 
 template <typename Mesh, typename SolverType>